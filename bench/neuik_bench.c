@@ -0,0 +1,662 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+/*******************************************************************************
+ *
+ *  neuik-bench
+ *
+ *  Builds a set of representative element trees and redraws each of them 
+ *  offscreen, writing the results (one JSON object per line) to stdout or to 
+ *  the file given with `-o`. A set of microbenchmarks of the object system 
+ *  follows the scenes; these are selected by name in the same way.
+ *
+ *  Usage: neuik-bench [-n FRAMES] [-o FILE] [SCENE ...]
+ *
+ *  Unless SDL_VIDEODRIVER is already set, the `dummy` video driver is used; 
+ *  windows then render through the software renderer, so no GPU is required.
+ *
+ ******************************************************************************/
+#include <SDL.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "NEUIK.h"
+#include "NEUIK_Event_internal.h"
+#include "neuik_internal.h"
+#include "neuik_classes.h"
+
+#define NEUIK_BENCH_FRAMES      60   /* default number of timed frames */
+#define NEUIK_BENCH_WIN_W     1024   /* window width  (unscaled px) */
+#define NEUIK_BENCH_WIN_H      768   /* window height (unscaled px) */
+#define NEUIK_BENCH_NEST_DEPTH 100   /* levels of alternating V/HGroups */
+#define NEUIK_BENCH_GRID_DIM   100   /* GridLayout rows and columns */
+#define NEUIK_BENCH_LIST_ROWS  10000
+#define NEUIK_BENCH_TEXT_LINES 1000000
+#define NEUIK_BENCH_PLOT_PTS   10000000
+#define NEUIK_BENCH_MICRO_OPS  10000000 /* operations per microbenchmark */
+
+/*----------------------------------------------------------------------------*/
+/* A scene builds the element tree placed within the benchmark window. Any    */
+/* additional object which is not freed along with the tree is returned in    */
+/* `extra` (freed after the tree).                                            */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    const char  * name;
+    int        (* Build)(NEUIK_Element * elem, void ** extra);
+} neuik_BenchScene;
+
+/*----------------------------------------------------------------------------*/
+/* A microbenchmark performs `nOps` operations and reports the elapsed time.  */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    const char  * name;
+    int        (* Run)(long nOps, double * seconds);
+} neuik_BenchMicro;
+
+/* results of timed operations are stored here so they are not optimized out */
+static void * volatile neuik_Bench_Sink = NULL;
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Bench_WrapInScrollView
+ *
+ *  Description:   Place an element within a ScrollView (so that the window is
+ *                 not expanded to the full size of the element).
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_Bench_WrapInScrollView(
+    NEUIK_Element   content,
+    NEUIK_Element * elem)
+{
+    NEUIK_ScrollView * sv = NULL;
+
+    if (NEUIK_NewScrollView(&sv)) return 1;
+    if (NEUIK_Element_Configure(sv, "FillAll", NULL)) return 1;
+    if (NEUIK_Container_SetElement(sv, content)) return 1;
+
+    *elem = sv;
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Bench_Build_NestedGroups
+ *
+ *  Description:   Alternating VGroups and HGroups nested 
+ *                 NEUIK_BENCH_NEST_DEPTH levels deep; each level holds a label
+ *                 along with the next level.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_Bench_Build_NestedGroups(
+    NEUIK_Element  * elem,
+    void          ** extra)
+{
+    int             ctr;
+    char            buf[64];
+    NEUIK_Label   * lbl  = NULL;
+    NEUIK_VGroup  * vg   = NULL;
+    NEUIK_HGroup  * hg   = NULL;
+    NEUIK_Element   top  = NULL;
+    NEUIK_Element   cur  = NULL;
+    NEUIK_Element   next = NULL;
+
+    if (NEUIK_NewVGroup(&vg)) return 1;
+    top = vg;
+    cur = vg;
+
+    for (ctr = 0; ctr < NEUIK_BENCH_NEST_DEPTH; ctr++)
+    {
+        sprintf(buf, "Level %d", ctr);
+        if (NEUIK_MakeLabel(&lbl, buf)) return 1;
+        if (NEUIK_Container_AddElement(cur, lbl)) return 1;
+
+        if (ctr % 2)
+        {
+            if (NEUIK_NewVGroup(&vg)) return 1;
+            next = vg;
+        }
+        else
+        {
+            if (NEUIK_NewHGroup(&hg)) return 1;
+            next = hg;
+        }
+        if (NEUIK_Container_AddElement(cur, next)) return 1;
+        cur = next;
+    }
+    if (NEUIK_MakeLabel(&lbl, "Innermost")) return 1;
+    if (NEUIK_Container_AddElement(cur, lbl)) return 1;
+
+    return neuik_Bench_WrapInScrollView(top, elem);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Bench_Build_Grid
+ *
+ *  Description:   A GridLayout with NEUIK_BENCH_GRID_DIM rows and columns, one
+ *                 label per cell.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_Bench_Build_Grid(
+    NEUIK_Element  * elem,
+    void          ** extra)
+{
+    unsigned int       xCtr;
+    unsigned int       yCtr;
+    char               buf[32];
+    NEUIK_Label      * lbl  = NULL;
+    NEUIK_GridLayout * grid = NULL;
+
+    if (NEUIK_NewGridLayout(&grid)) return 1;
+    if (NEUIK_GridLayout_SetDimensions(grid, 
+        NEUIK_BENCH_GRID_DIM, NEUIK_BENCH_GRID_DIM)) return 1;
+
+    for (yCtr = 0; yCtr < NEUIK_BENCH_GRID_DIM; yCtr++)
+    {
+        for (xCtr = 0; xCtr < NEUIK_BENCH_GRID_DIM; xCtr++)
+        {
+            sprintf(buf, "%u,%u", xCtr, yCtr);
+            if (NEUIK_MakeLabel(&lbl, buf)) return 1;
+            if (NEUIK_GridLayout_SetElementAt(grid, xCtr, yCtr, lbl)) return 1;
+        }
+    }
+
+    return neuik_Bench_WrapInScrollView(grid, elem);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Bench_Build_List
+ *
+ *  Description:   A ListGroup of NEUIK_BENCH_LIST_ROWS rows, each row holding a
+ *                 label.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_Bench_Build_List(
+    NEUIK_Element  * elem,
+    void          ** extra)
+{
+    int               ctr;
+    char              buf[32];
+    NEUIK_Label     * lbl = NULL;
+    NEUIK_ListRow   * row = NULL;
+    NEUIK_ListGroup * lg  = NULL;
+
+    if (NEUIK_NewListGroup(&lg)) return 1;
+
+    for (ctr = 0; ctr < NEUIK_BENCH_LIST_ROWS; ctr++)
+    {
+        sprintf(buf, "Row %d", ctr);
+        if (NEUIK_NewListRow(&row)) return 1;
+        if (NEUIK_MakeLabel(&lbl, buf)) return 1;
+        if (NEUIK_Container_AddElement(row, lbl)) return 1;
+        if (NEUIK_ListGroup_AddRow(lg, row)) return 1;
+    }
+
+    return neuik_Bench_WrapInScrollView(lg, elem);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Bench_Build_TextEdit
+ *
+ *  Description:   A TextEdit holding NEUIK_BENCH_TEXT_LINES lines of text.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_Bench_Build_TextEdit(
+    NEUIK_Element  * elem,
+    void          ** extra)
+{
+    int              ctr;
+    int              rv   = 1;
+    char           * text = NULL;
+    char           * pos  = NULL;
+    NEUIK_TextEdit * te   = NULL;
+
+    /* each line: "line 0000000: lorem ipsum dolor sit amet\n" */
+    text = (char *)malloc(NEUIK_BENCH_TEXT_LINES*48 + 1);
+    if (text == NULL) goto out;
+
+    pos = text;
+    for (ctr = 0; ctr < NEUIK_BENCH_TEXT_LINES; ctr++)
+    {
+        pos += sprintf(pos, "line %07d: lorem ipsum dolor sit amet\n", ctr);
+    }
+
+    if (NEUIK_MakeTextEdit(&te, text)) goto out;
+    if (NEUIK_Element_Configure(te, "FillAll", NULL)) goto out;
+
+    *elem = te;
+    rv    = 0;
+out:
+    if (text != NULL) free(text);
+
+    return rv;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Bench_Build_Plot2D
+ *
+ *  Description:   A Plot2D with a single data set of NEUIK_BENCH_PLOT_PTS 
+ *                 points. The values are stored directly rather than being 
+ *                 formatted and parsed back out of a string.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_Bench_Build_Plot2D(
+    NEUIK_Element  * elem,
+    void          ** extra)
+{
+    unsigned int     ctr;
+    float            yVal;
+    NEUIK_Plot2D   * plot = NULL;
+    NEUIK_PlotData * pd   = NULL;
+
+    if (NEUIK_NewPlotData(&pd, "bench")) return 1;
+    *extra = pd; /* a Plot2D does not free its data sets */
+
+    pd->data_32 = (float *)malloc(2*NEUIK_BENCH_PLOT_PTS*sizeof(float));
+    if (pd->data_32 == NULL) return 1;
+
+    pd->bounds_32.x_min = 0.0;
+    pd->bounds_32.x_max = (float)(NEUIK_BENCH_PLOT_PTS - 1);
+    pd->bounds_32.y_min = 0.0;
+    pd->bounds_32.y_max = 0.0;
+    for (ctr = 0; ctr < NEUIK_BENCH_PLOT_PTS; ctr++)
+    {
+        yVal = (float)(sin(0.0001*(double)(ctr)) + 0.1*sin(0.37*(double)(ctr)));
+        pd->data_32[2*ctr]     = (float)(ctr);
+        pd->data_32[2*ctr + 1] = yVal;
+        if (yVal < pd->bounds_32.y_min) pd->bounds_32.y_min = yVal;
+        if (yVal > pd->bounds_32.y_max) pd->bounds_32.y_max = yVal;
+    }
+    pd->precision = 32;
+    pd->nPoints   = NEUIK_BENCH_PLOT_PTS;
+    pd->nAlloc    = 2*NEUIK_BENCH_PLOT_PTS;
+    pd->nUsed     = 2*NEUIK_BENCH_PLOT_PTS;
+    pd->boundsSet = 1;
+    pd->stateMod++;
+
+    if (NEUIK_NewPlot2D(&plot)) return 1;
+    if (NEUIK_Plot2D_AddPlotData(plot, pd, "10M points")) return 1;
+    if (NEUIK_Element_Configure(plot, "FillAll", NULL)) return 1;
+
+    *elem = plot;
+    return 0;
+}
+
+
+static const neuik_BenchScene neuik_BenchScenes[] = {
+    {"nested_groups", neuik_Bench_Build_NestedGroups},
+    {"grid_100x100",  neuik_Bench_Build_Grid},
+    {"list_10k",      neuik_Bench_Build_List},
+    {"textedit_1M",   neuik_Bench_Build_TextEdit},
+    {"plot2d_10M",    neuik_Bench_Build_Plot2D},
+    {NULL,            NULL},
+};
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Bench_Micro_GetClassObject
+ *
+ *  Description:   Look up the class objects of the superclasses of a Plot2D 
+ *                 (Plot2D -> Plot -> Element); these lookups are performed 
+ *                 by nearly every element function.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_Bench_Micro_GetClassObject(
+    long     nOps,
+    double * seconds)
+{
+    int            rv    = 1;
+    long           ctr;
+    void         * cObj  = NULL;
+    Uint64         t0;
+    NEUIK_Plot2D * plot  = NULL;
+
+    if (NEUIK_NewPlot2D(&plot)) goto out;
+
+    t0 = SDL_GetPerformanceCounter();
+    for (ctr = 0; ctr < nOps; ctr++)
+    {
+        if (neuik_Object_GetClassObject(plot, 
+            (ctr & 1) ? neuik__Class_Element : neuik__Class_Plot, &cObj))
+        {
+            goto out;
+        }
+        neuik_Bench_Sink = cObj;
+    }
+    *seconds = (double)(SDL_GetPerformanceCounter() - t0)/
+        (double)(SDL_GetPerformanceFrequency());
+    rv = 0;
+out:
+    if (plot != NULL) neuik_Object_Free(plot);
+
+    return rv;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Bench_Micro_VirtualDispatch
+ *
+ *  Description:   Resolve the virtual function implementations used by the
+ *                 event and redraw passes for a Container -> Group -> Frame
+ *                 nesting (a ScrollView holding an HGroup holding a Frame).
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_Bench_Micro_VirtualDispatch(
+    long     nOps,
+    double * seconds)
+{
+    int                 rv    = 1;
+    long                ctr;
+    Uint64              t0;
+    void              * objs[3];
+    NEUIK_ScrollView  * sv    = NULL;
+    NEUIK_HGroup      * hg    = NULL;
+    NEUIK_Frame       * frame = NULL;
+    neuik_VirtualFunc   vFuncs[4];
+
+    /*------------------------------------------------------------------------*/
+    /* Once an element is placed within a container, it is freed along with  */
+    /* that container.                                                        */
+    /*------------------------------------------------------------------------*/
+    if (NEUIK_NewFrame(&frame)) goto out;
+    if (NEUIK_NewHGroup(&hg)) goto out;
+    if (NEUIK_Container_AddElement(hg, frame)) goto out;
+    objs[2] = frame;
+    frame   = NULL;
+
+    if (NEUIK_NewScrollView(&sv)) goto out;
+    if (NEUIK_Container_SetElement(sv, hg)) goto out;
+    objs[1] = hg;
+    hg      = NULL;
+    objs[0] = sv;
+
+    vFuncs[0] = neuik_Element_vfunc_CaptureEvent;
+    vFuncs[1] = neuik_Element_vfunc_IsShown;
+    vFuncs[2] = neuik_Element_vfunc_RequestRedraw;
+    vFuncs[3] = neuik_Element_vfunc_ShouldRedrawAll;
+
+    t0 = SDL_GetPerformanceCounter();
+    for (ctr = 0; ctr < nOps; ctr++)
+    {
+        neuik_Bench_Sink = neuik_VirtualFunc_GetImplementation(
+            vFuncs[ctr & 3], objs[ctr % 3]);
+    }
+    *seconds = (double)(SDL_GetPerformanceCounter() - t0)/
+        (double)(SDL_GetPerformanceFrequency());
+    rv = 0;
+out:
+    if (sv    != NULL) neuik_Object_Free(sv);
+    if (hg    != NULL) neuik_Object_Free(hg);
+    if (frame != NULL) neuik_Object_Free(frame);
+
+    return rv;
+}
+
+
+static const neuik_BenchMicro neuik_BenchMicros[] = {
+    {"object/get_class_object",  neuik_Bench_Micro_GetClassObject},
+    {"object/virtual_dispatch",  neuik_Bench_Micro_VirtualDispatch},
+    {NULL,                       NULL},
+};
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Bench_RunMicro
+ *
+ *  Description:   Run a microbenchmark and write its result as a JSON object
+ *                 (`ops`, `seconds`, `ns_per_op`).
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_Bench_RunMicro(
+    const neuik_BenchMicro * micro,
+    FILE                   * fp)
+{
+    double seconds = 0.0;
+
+    if ((micro->Run)(NEUIK_BENCH_MICRO_OPS, &seconds)) return 1;
+
+    if (fprintf(fp, "{\"name\": \"%s\", \"ops\": %ld, \"seconds\": %.6f, "
+        "\"ns_per_op\": %.3f}\n", micro->name, (long)NEUIK_BENCH_MICRO_OPS,
+        seconds, 1.0e9*seconds/(double)(NEUIK_BENCH_MICRO_OPS)) < 0)
+    {
+        return 1;
+    }
+    fflush(fp);
+
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Bench_RunScene
+ *
+ *  Description:   Build a scene within an offscreen window and benchmark it; 
+ *                 both with a full redraw every frame (`<scene>/full`) and 
+ *                 with only the requested redraws (`<scene>/idle`).
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_Bench_RunScene(
+    const neuik_BenchScene * scene,
+    int                      nFrames,
+    FILE                   * fp)
+{
+    int                    rv    = 1;
+    char                   name[128];
+    void                 * extra = NULL;
+    NEUIK_Element          elem  = NULL;
+    NEUIK_Window         * w     = NULL;
+    NEUIK_BenchmarkResult  result;
+
+    if ((scene->Build)(&elem, &extra)) goto out;
+
+    if (NEUIK_NewWindow(&w)) goto out;
+    if (NEUIK_Window_SetTitle(w, scene->name)) goto out;
+    if (NEUIK_Window_SetSize(w, NEUIK_BENCH_WIN_W, NEUIK_BENCH_WIN_H)) goto out;
+    if (NEUIK_Window_SetElement(w, elem)) goto out;
+    if (NEUIK_Window_Create(w)) goto out;
+
+    if (NEUIK_Window_Benchmark(w, nFrames, 1, &result)) goto out;
+    sprintf(name, "%s/full", scene->name);
+    if (NEUIK_BenchmarkResult_WriteJSON(&result, name, fp)) goto out;
+
+    if (NEUIK_Window_Benchmark(w, nFrames, 0, &result)) goto out;
+    sprintf(name, "%s/idle", scene->name);
+    if (NEUIK_BenchmarkResult_WriteJSON(&result, name, fp)) goto out;
+
+    fflush(fp);
+    rv = 0;
+out:
+    if (w != NULL)
+    {
+        /*--------------------------------------------------------------------*/
+        /* A created window is registered for event handling; release it     */
+        /* through the registry.                                              */
+        /*--------------------------------------------------------------------*/
+        if (w->win != NULL) neuik_FreeWindow(w);
+        else                NEUIK_Window_Free(w);
+    }
+    if (elem  != NULL) neuik_Object_Free(elem);
+    if (extra != NULL) neuik_Object_Free(extra);
+
+    return rv;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Bench_SceneSelected
+ *
+ *  Description:   Whether a scene was requested on the command line (all of 
+ *                 the scenes are run if none were named).
+ *
+ ******************************************************************************/
+static int neuik_Bench_SceneSelected(
+    const char  * name,
+    int           nNames,
+    char       ** names)
+{
+    int ctr;
+
+    if (nNames == 0) return 1;
+    for (ctr = 0; ctr < nNames; ctr++)
+    {
+        if (!strcmp(name, names[ctr])) return 1;
+    }
+    return 0;
+}
+
+
+int main(
+    int     argc,
+    char ** argv)
+{
+    int           ctr;
+    int           rv      = 0;
+    int           nFrames = NEUIK_BENCH_FRAMES;
+    int           nNames  = 0;
+    char       ** names   = NULL;
+    FILE        * fp      = stdout;
+
+    /*------------------------------------------------------------------------*/
+    /* Read in the command line arguments.                                    */
+    /*------------------------------------------------------------------------*/
+    names = (char **)malloc(argc*sizeof(char *));
+    if (names == NULL) return 1;
+    for (ctr = 1; ctr < argc; ctr++)
+    {
+        if (!strcmp(argv[ctr], "-n") && ctr + 1 < argc)
+        {
+            nFrames = atoi(argv[++ctr]);
+            if (nFrames <= 0) nFrames = NEUIK_BENCH_FRAMES;
+        }
+        else if (!strcmp(argv[ctr], "-o") && ctr + 1 < argc)
+        {
+            fp = fopen(argv[++ctr], "w");
+            if (fp == NULL)
+            {
+                fprintf(stderr, "neuik-bench: unable to open `%s`.\n", argv[ctr]);
+                free(names);
+                return 1;
+            }
+        }
+        else if (!strcmp(argv[ctr], "-h") || !strcmp(argv[ctr], "--help"))
+        {
+            printf("Usage: %s [-n FRAMES] [-o FILE] [SCENE ...]\n", argv[0]);
+            printf("Scenes:");
+            for (ctr = 0; neuik_BenchScenes[ctr].name != NULL; ctr++)
+            {
+                printf(" %s", neuik_BenchScenes[ctr].name);
+            }
+            for (ctr = 0; neuik_BenchMicros[ctr].name != NULL; ctr++)
+            {
+                printf(" %s", neuik_BenchMicros[ctr].name);
+            }
+            printf("\n");
+            free(names);
+            return 0;
+        }
+        else
+        {
+            names[nNames++] = argv[ctr];
+        }
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Render offscreen unless a video driver was explicitly selected.        */
+    /*------------------------------------------------------------------------*/
+    SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+
+    if (NEUIK_Init())
+    {
+        rv = 1;
+        goto out;
+    }
+    NEUIK_SetAppName("neuik-bench");
+
+    for (ctr = 0; neuik_BenchScenes[ctr].name != NULL; ctr++)
+    {
+        if (!neuik_Bench_SceneSelected(neuik_BenchScenes[ctr].name, 
+            nNames, names)) continue;
+
+        if (neuik_Bench_RunScene(&neuik_BenchScenes[ctr], nFrames, fp))
+        {
+            fprintf(stderr, "neuik-bench: scene `%s` failed.\n", 
+                neuik_BenchScenes[ctr].name);
+            rv = 1;
+            goto out;
+        }
+    }
+
+    for (ctr = 0; neuik_BenchMicros[ctr].name != NULL; ctr++)
+    {
+        if (!neuik_Bench_SceneSelected(neuik_BenchMicros[ctr].name, 
+            nNames, names)) continue;
+
+        if (neuik_Bench_RunMicro(&neuik_BenchMicros[ctr], fp))
+        {
+            fprintf(stderr, "neuik-bench: microbenchmark `%s` failed.\n", 
+                neuik_BenchMicros[ctr].name);
+            rv = 1;
+            goto out;
+        }
+    }
+out:
+    if (NEUIK_HasErrors())
+    {
+        NEUIK_BacktraceErrors();
+        rv = 1;
+    }
+    NEUIK_Quit();
+
+    if (fp != stdout) fclose(fp);
+    free(names);
+
+    return rv;
+}
@@ -23,6 +23,7 @@
 int NEUIK_Object_Free(
 	void ** objPtr);
 
+#include "NEUIK_Benchmark.h"
 #include "NEUIK_Button.h"
 #include "NEUIK_ButtonConfig.h"
 #include "NEUIK_Canvas.h"
@@ -47,7 +48,9 @@ int NEUIK_Object_Free(
 #include "NEUIK_Plot2D.h"
 #include "NEUIK_PlotData.h"
 #include "NEUIK_ProgressBar.h"
+#include "NEUIK_Profile.h"
 // #include "NEUIK_PopupMenu.h"
+#include "NEUIK_ScrollView.h"
 #include "NEUIK_Stack.h"
 #include "NEUIK_StockImage.h"
 #include "NEUIK_TextEdit.h"
@@ -55,6 +58,7 @@ int NEUIK_Object_Free(
 #include "NEUIK_ToggleButton.h"
 #include "NEUIK_ToggleButtonConfig.h"
 #include "NEUIK_Transformer.h"
+#include "NEUIK_UIQueue.h"
 #include "NEUIK_HGroup.h"
 #include "NEUIK_VGroup.h"
 #include "NEUIK_FlowGroup.h"
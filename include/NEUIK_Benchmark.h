@@ -0,0 +1,52 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#ifndef NEUIK_BENCHMARK_H
+#define NEUIK_BENCHMARK_H
+
+#include <stdio.h>
+#include "NEUIK_Window.h"
+
+/*----------------------------------------------------------------------------*/
+/* Typedef(s)                                                                 */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+	int     nFrames;          /* number of frames which were timed */
+	double  frameMs_min;      /* fastest frame (ms) */
+	double  frameMs_mean;     /* average frame time (ms) */
+	double  frameMs_p50;      /* median frame time (ms) */
+	double  frameMs_p90;      /* 90th percentile frame time (ms) */
+	double  frameMs_p99;      /* 99th percentile frame time (ms) */
+	double  frameMs_max;      /* slowest frame (ms) */
+	double  objectsPerFrame;  /* NEUIK object allocations per frame */
+	double  texturesPerFrame; /* SDL_Texture creations per frame */
+} NEUIK_BenchmarkResult;
+
+
+int
+	NEUIK_Window_Benchmark(
+			NEUIK_Window          * w,
+			int                     nFrames,
+			int                     fullRedraw,
+			NEUIK_BenchmarkResult * result);
+
+int
+	NEUIK_BenchmarkResult_WriteJSON(
+			const NEUIK_BenchmarkResult * result,
+			const char                  * name,
+			FILE                        * fp);
+
+
+#endif /* NEUIK_BENCHMARK_H */
@@ -13,23 +13,15 @@
  * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  ******************************************************************************/
+#ifndef NEUIK_CALLBACK_INTERNAL_H
+#define NEUIK_CALLBACK_INTERNAL_H
 
-// #include <SDL.h>
-#include "NEUIK_Image.h"
+#include "NEUIK_Callback.h"
 
+int
+	neuik_BindingQueue_Init();
 
-/*******************************************************************************
- *
- *  Name:          neuik_GetStockImage_neuik_logo
- *
- *  Description:   Return a pointer to the .
- *
- *  Returns:       NULL if there is a problem; otherwise a valid string
- *
- ******************************************************************************/
-int neuik_GetStockImage_neuik_logo(
-    NEUIK_Image ** imgPtr)
-{
-    return 1;
-}
+void
+	neuik_BindingQueue_Shutdown();
 
+#endif /* NEUIK_CALLBACK_INTERNAL_H */
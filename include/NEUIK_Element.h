@@ -27,6 +27,45 @@
 
 typedef void * NEUIK_Element;
 
+/*----------------------------------------------------------------------------*/
+/* Pre-resolved element configuration keys (see NEUIK_Element_ConfigureItems) */
+/*----------------------------------------------------------------------------*/
+typedef enum {
+	NEUIK_ELEMENTCFG_INVALID = -1,
+	NEUIK_ELEMENTCFG_FILLALL,   /* bool  */
+	NEUIK_ELEMENTCFG_HFILL,     /* bool  */
+	NEUIK_ELEMENTCFG_VFILL,     /* bool  */
+	NEUIK_ELEMENTCFG_SHOW,      /* bool  */
+	NEUIK_ELEMENTCFG_LAYER,     /* bool  */
+	NEUIK_ELEMENTCFG_HSCALE,    /* float */
+	NEUIK_ELEMENTCFG_VSCALE,    /* float */
+	NEUIK_ELEMENTCFG_HJUSTIFY,  /* int (NEUIK_HJUSTIFY_*) */
+	NEUIK_ELEMENTCFG_VJUSTIFY,  /* int (NEUIK_VJUSTIFY_*) */
+	NEUIK_ELEMENTCFG_PADLEFT,   /* int   */
+	NEUIK_ELEMENTCFG_PADRIGHT,  /* int   */
+	NEUIK_ELEMENTCFG_PADTOP,    /* int   */
+	NEUIK_ELEMENTCFG_PADBOTTOM, /* int   */
+	NEUIK_ELEMENTCFG_PADALL,    /* int   */
+	NEUIK_ELEMENTCFG_NKEYS,
+} NEUIK_ElementConfigKey;
+
+typedef struct {
+	NEUIK_ElementConfigKey   key;
+	int                      intVal;   /* bool, justify and pad settings */
+	float                    floatVal; /* HScale and VScale */
+} NEUIK_ElementConfigItem;
+
+
+NEUIK_ElementConfigKey
+	NEUIK_ElementConfigKey_FromName(
+			const char * name);
+
+int
+	NEUIK_Element_ConfigureItems(
+			NEUIK_Element                   elem,
+			const NEUIK_ElementConfigItem * items,
+			int                             nItems);
+
 
 int 
 	NEUIK_Element_Configure(
@@ -41,6 +41,7 @@ typedef struct {
 	int                  minH;      /* Minimum Height */
 	int                  maxH;      /* Maximum Height */
 	int                  Show;      /* Whether or not the element is shown */
+	int                  Layer;     /* Keep the rendered element as a retained layer */
 } NEUIK_ElementConfig;
 
 
@@ -69,6 +70,7 @@ typedef struct {
 	NEUIK_Color           solid_color; /* solid color to use under normal condtions */
 	char                  grad_dirn;   /* direction to use for a gradient (`v` or `h`) */
 	NEUIK_ColorStop    ** grad_desc;   /* description of a color gradient */
+	neuik_Gradient      * grad_lut;    /* compiled form of `grad_desc` */
 } neuik_BackgroundConfig;
 
 
@@ -100,6 +102,13 @@ typedef struct {
 	RenderSize              minSizeOld; /* Minimum size of the element (previous frame) */
     enum neuik_minsize      wDelta;     /* How min elem width changed (rel. to previous frame) */
     enum neuik_minsize      hDelta;     /* How min elem height changed (rel. to previous frame) */
+	SDL_Texture           * rotTex;     /* Cached unrotated render (for RenderRotate) */
+	SDL_Renderer          * rotRend;    /* The renderer which owns `rotTex` */
+	RenderLoc               rotLoc;     /* Location the children of `rotTex` were laid out at */
+	SDL_Texture           * layerTex;   /* Retained render of the element (Layer mode) */
+	SDL_Renderer          * layerRend;  /* The renderer which owns `layerTex` */
+	RenderLoc               layerLoc;   /* Location the children of `layerTex` were laid out at */
+	size_t                  layerBytes; /* Memory charged to the layer budget */
 } NEUIK_ElementState;
 
 
@@ -242,6 +251,10 @@ int
 			NEUIK_Element   elem,
 			RenderSize    * rSize);
 
+float
+	neuik_Element_MakeScaleCurrent(
+			NEUIK_Element   elem);
+
 int
 	NEUIK_Element_SetBackgroundColorSolid_noRedraw(
 			NEUIK_Element   elem,
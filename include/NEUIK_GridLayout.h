@@ -20,15 +20,53 @@
 #include "NEUIK_Element.h"
 
 
+/*----------------------------------------------------------------------------*/
+/* neuik_GridCell                                                             */
+/*                                                                            */
+/* A populated location within a GridLayout. Only populated cells are stored; */
+/* the container `elems` list holds the same elements (in the same order) as  */
+/* a packed NULL-terminated array. The remaining fields hold the contribution */
+/* the cell made to its row/column tracks when it was last measured.          */
+/*----------------------------------------------------------------------------*/
 typedef struct {
-		neuik_Object objBase;  /* this structure is requied to be an neuik object */
-		int          HSpacing;
-		int          VSpacing;
-		unsigned int xDim;     /* The max number of grid items along the x-axis */
-		unsigned int yDim;     /* The max number of grid items along the y-axis */
-		int          squareElems; /* If elems should all be square in shape */
-		int          selected;
-		int          isActive;
+		NEUIK_Element elem;  /* the element stored within this cell */
+		unsigned int  pos;   /* location within the grid (x + y*xDim) */
+		int           shown; /* [bool] elem was shown when last measured */
+		RenderSize    minSz; /* unpadded minimum size when last measured */
+		int           padW;  /* padded minimum width (0 if not shown) */
+		int           padH;  /* padded minimum height (0 if not shown) */
+		int           hFill; /* [bool] elem was shown with HFill set */
+		int           vFill; /* [bool] elem was shown with VFill set */
+} neuik_GridCell;
+
+/*----------------------------------------------------------------------------*/
+/* neuik_GridTrack                                                            */
+/*                                                                            */
+/* The cached sizing information of a single GridLayout row or column.        */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+		int   minSz;  /* largest padded minimum size among shown cells */
+		int   nFill;  /* number of shown cells which fill along this track */
+		int   dirty;  /* [bool] minSz must be rescanned from the cells */
+		int   rendSz; /* size of the track as last rendered */
+		float pos;    /* offset of the track as last rendered */
+} neuik_GridTrack;
+
+typedef struct {
+		neuik_Object      objBase;  /* this structure is requied to be an neuik object */
+		int               HSpacing;
+		int               VSpacing;
+		unsigned int      xDim;     /* The max number of grid items along the x-axis */
+		unsigned int      yDim;     /* The max number of grid items along the y-axis */
+		int               squareElems; /* If elems should all be square in shape */
+		int               selected;
+		int               isActive;
+		neuik_GridCell  * cells;    /* populated cells; sorted by `pos` */
+		unsigned int      nCells;   /* number of populated cells */
+		unsigned int      nCellsAlloc; /* number of cell slots allocated */
+		neuik_GridTrack * cols;     /* cached column tracks [xDim] */
+		neuik_GridTrack * rows;     /* cached row tracks [yDim] */
+		int               tracksValid; /* [bool] cols/rows match the cells */
 } NEUIK_GridLayout;
 
 int 
@@ -22,12 +22,28 @@
 #include "NEUIK_ImageConfig.h"
 #include "NEUIK_StockImage.h"
 
+/*----------------------------------------------------------------------------*/
+/* Number of downscaled variants (each half the size of the one before) which */
+/* may be generated for an image that is displayed at a reduced size.         */
+/*----------------------------------------------------------------------------*/
+#define NEUIK_IMAGE_MAXVARIANTS 12
+
 
 typedef struct {
 		neuik_Object        objBase; /* this structure is requied to be an neuik object */
 		NEUIK_ImageConfig * cfg;
 		NEUIK_ImageConfig * cfgPtr; /* if NULL, the non-Pointer version is used */
-		void              * image;  /* SDL_Surface */
+		void              * image;     /* SDL_Surface */
+		void              * imageTex;  /* SDL_Texture; uploaded copy of `image` */
+		void              * imageRend; /* SDL_Renderer which owns `imageTex` */
+		int                 imageTexLevel; /* variant uploaded to `imageTex` (0 = `image`) */
+		void              * variants[NEUIK_IMAGE_MAXVARIANTS]; /* SDL_Surface; [n] is 1/2^(n+1) size */
+		int                 dispW;     /* width  to display the image at (0 = natural) */
+		int                 dispH;     /* height to display the image at (0 = natural) */
+		void              * decoded;   /* shared decoded image holding `image` */
+		void              * loader;    /* pending asynchronous load (or NULL) */
+		int                 loadW;     /* placeholder size while loading */
+		int                 loadH;
 		int                 needsRedraw;
 } NEUIK_Image;
 
@@ -41,6 +57,13 @@ int
 			NEUIK_Image ** imgPtr,
 			const char   * filename);
 
+int
+	NEUIK_MakeImage_Async(
+			NEUIK_Image ** imgPtr,
+			const char   * filename,
+			int            width,
+			int            height);
+
 int 
 	NEUIK_MakeImage_FromSource(
 			NEUIK_Image         ** imgPtr,
@@ -54,6 +77,12 @@ int
 			NEUIK_Image      ** imgPtr,
 			NEUIK_StockImage    stockImage);
 
+int
+	NEUIK_Image_SetDisplaySize(
+			NEUIK_Image * img,
+			int           width,
+			int           height);
+
 // int 
 // 	NEUIK_Image_Configure(
 // 			NEUIK_Image * img,
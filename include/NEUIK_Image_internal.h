@@ -0,0 +1,54 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#ifndef NEUIK_IMAGE_INTERNAL_H
+#define NEUIK_IMAGE_INTERNAL_H
+
+#include <SDL.h>
+#include "NEUIK_Image.h"
+
+int
+	neuik_ImageCache_Load(
+			const char  * fileName,
+			int           maxW,
+			int           maxH,
+			void       ** decoded);
+
+SDL_Surface *
+	neuik_ImageCache_GetSurface(
+			void * decoded);
+
+void
+	neuik_ImageCache_Release(
+			void * decoded);
+
+SDL_Surface *
+	neuik_Image_Downscale(
+			SDL_Surface * src,
+			int           w,
+			int           h);
+
+void
+	neuik_Image_FreeVariants(
+			NEUIK_Image * img);
+
+void
+	neuik_Image_CancelLoad(
+			NEUIK_Image * img);
+
+void
+	neuik_ImageLoader_Shutdown();
+
+#endif /* NEUIK_IMAGE_INTERNAL_H */
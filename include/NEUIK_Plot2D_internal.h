@@ -32,7 +32,8 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
 	int                     ticZoneH,
 	int                     ticZoneOffsetX,
 	int                     ticZoneOffsetY,
-	neuik_MaskMap        ** lineMask);
+	neuik_MaskMap         * lineMask,
+	const char           ** errMsg);
 
 int neuik_Plot2D_Render64_SimpleLineToMask(
 	NEUIK_Plot2D          * plot2d,
@@ -45,7 +46,8 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
 	int                     ticZoneH,
 	int                     ticZoneOffsetX,
 	int                     ticZoneOffsetY,
-	neuik_MaskMap        ** lineMask);
+	neuik_MaskMap         * lineMask,
+	const char           ** errMsg);
 
 int neuik_Plot2D_UpdateAxesRanges(
 	NEUIK_Plot2D * plot2d);
@@ -0,0 +1,56 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#ifndef NEUIK_PROFILE_H
+#define NEUIK_PROFILE_H
+
+#include <stdio.h>
+
+/*----------------------------------------------------------------------------*/
+/* Typedef(s)                                                                 */
+/*----------------------------------------------------------------------------*/
+/* Accumulated timings of one kind of operation for one element class within  */
+/* one window.                                                                */
+typedef struct {
+	const void    * window;    /* NEUIK_Window* (NULL if not within a window) */
+	const char    * className; /* class of the object which was profiled */
+	const char    * scope;     /* operation; e.g. "Render" or "GetMinSize" */
+	unsigned long   calls;     /* number of times the operation was timed */
+	double          totalMs;   /* total time (including nested operations) */
+	double          selfMs;    /* total time (excluding nested operations) */
+	double          maxMs;     /* slowest single call (including nested) */
+} NEUIK_ProfileEntry;
+
+
+int
+	NEUIK_Profile_Start();
+
+int
+	NEUIK_Profile_Stop();
+
+void
+	NEUIK_Profile_Reset();
+
+int
+	NEUIK_Profile_GetResults(
+			const NEUIK_ProfileEntry ** entries,
+			int                       * nEntries);
+
+int
+	NEUIK_Profile_WriteChromeTrace(
+			FILE * fp);
+
+
+#endif /* NEUIK_PROFILE_H */
@@ -0,0 +1,47 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#ifndef NEUIK_PROFILE_INTERNAL_H
+#define NEUIK_PROFILE_INTERNAL_H
+
+#include "NEUIK_Profile.h"
+
+/*----------------------------------------------------------------------------*/
+/* The kinds of operations which may be profiled.                             */
+/*----------------------------------------------------------------------------*/
+typedef enum {
+	NEUIK_PROFILE_FRAME,            /* a full NEUIK_Window_Redraw() */
+	NEUIK_PROFILE_GETMINSIZE,
+	NEUIK_PROFILE_RENDER,
+	NEUIK_PROFILE_CAPTUREEVENT,
+	NEUIK_PROFILE_REDRAWBACKGROUND,
+	NEUIK_PROFILE_RENDERTEXT,       /* text rasterization (SDL_ttf) */
+	NEUIK_PROFILE_TEXTUREUPLOAD,    /* texture creation */
+	NEUIK_PROFILE_NSCOPES,
+} neuik_ProfileScope;
+
+extern int neuik__Profile_Enabled;
+
+int
+	neuik_Profile_Begin(
+			neuik_ProfileScope   scope,
+			const void         * object,
+			const void         * window);
+
+void
+	neuik_Profile_End(
+			int began);
+
+#endif /* NEUIK_PROFILE_INTERNAL_H */
@@ -0,0 +1,67 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#ifndef NEUIK_SCROLLVIEW_H
+#define NEUIK_SCROLLVIEW_H
+
+#include "NEUIK_Event.h"
+#include "NEUIK_Element.h"
+#include "NEUIK_structs_basic.h"
+#include "neuik_internal.h"
+
+
+typedef struct {
+		neuik_Object    objBase;    /* this structure is requied to be an neuik object */
+		int             scrollX;    /* horizontal scroll offset (px) */
+		int             scrollY;    /* vertical scroll offset (px) */
+		int             lastX;      /* scroll offset of the retained content */
+		int             lastY;      /* scroll offset of the retained content */
+		int             viewW;      /* width of the viewport (px) */
+		int             viewH;      /* height of the viewport (px) */
+		int             contentW;   /* width of the contained element (px) */
+		int             contentH;   /* height of the contained element (px) */
+		int             lastMouseX; /* last known mouse position */
+		int             lastMouseY; /* last known mouse position */
+		int             cur;        /* index of the texture holding the content */
+		void          * tex[2];     /* SDL_Texture; retained viewport contents */
+		void          * texRend;    /* SDL_Renderer which owns `tex` */
+		neuik_ClipRect  valid;      /* region of `tex[cur]` which is up to date */
+		RenderLoc       layoutLoc;  /* loc. of the contained element at its last layout */
+} NEUIK_ScrollView;
+
+
+int 
+	NEUIK_NewScrollView(
+			NEUIK_ScrollView ** svPtr);
+
+int 
+	NEUIK_ScrollView_SetScroll(
+			NEUIK_ScrollView * sv,
+			int                x,
+			int                y);
+
+int 
+	NEUIK_ScrollView_GetScroll(
+			NEUIK_ScrollView * sv,
+			int              * x,
+			int              * y);
+
+int 
+	NEUIK_ScrollView_ScrollBy(
+			NEUIK_ScrollView * sv,
+			int                dx,
+			int                dy);
+
+#endif /* NEUIK_SCROLLVIEW_H */
@@ -16,8 +16,15 @@
 #ifndef NEUIK_STOCKIMAGE_INTERNAL_H
 #define NEUIK_STOCKIMAGE_INTERNAL_H
 
+#include <SDL.h>
 #include "NEUIK_Image.h"
 
+int neuik_MakeImage_FromEncodedStock(
+	NEUIK_Image         ** imgPtr,
+	const unsigned char  * data,
+	size_t                 nBytes,
+	SDL_Surface         ** decoded);
+
 int neuik_GetStockImage_app_crashed(
 	NEUIK_Image ** imgPtr);
 
@@ -41,6 +41,8 @@ typedef struct {
 		unsigned long long     vertPanLn;     /* Vertical number of lines the view is panned */
 		unsigned int           vertPanPx;     /* Additional pixels of vertical view panning */
 		int                    cursorX;       /* px pos of cursor (not considering pan) */
+		void                 * lineWidths;    /* `neuik_PrefixWidths*` (cursor line) */
+		void                 * loader;        /* file load in progress (if any) */
 		int                    lastMouseX;    /* X-position of associated last mouse event */
 		int                    lastMouseY;    /* Y-position of associated last mouse event */
 		int                    selected;
@@ -90,6 +92,32 @@ int
 			NEUIK_TextEdit * te,
 			const char     * text);
 
+int
+	NEUIK_TextEdit_FindNext(
+			NEUIK_TextEdit * te,
+			const char     * needle,
+			int            * found);
+
+int
+	NEUIK_TextEdit_ReplaceAll(
+			NEUIK_TextEdit * te,
+			const char     * needle,
+			const char     * replacement,
+			size_t         * nReplaced);
+
+int
+	NEUIK_TextEdit_Undo(
+			NEUIK_TextEdit * te);
+
+int
+	NEUIK_TextEdit_Redo(
+			NEUIK_TextEdit * te);
+
+int
+	NEUIK_TextEdit_LoadFile(
+			NEUIK_TextEdit * te,
+			const char     * fileName);
+
 int 
 	NEUIK_TextEdit_Configure(
 			NEUIK_TextEdit * te,
@@ -20,6 +20,7 @@
 #include "NEUIK_render.h"
 #include "NEUIK_structs_basic.h"
 #include "NEUIK_Element_internal.h"
+#include "NEUIK_TextEdit.h"
 
 extern int neuik__isInitialized;
 
@@ -33,7 +34,7 @@ extern int neuik__isInitialized;
 /* Internal Function Prototypes                                               */
 /*----------------------------------------------------------------------------*/
 int neuik_Object_New__TextEdit(void ** wPtr);
-int neuik_Object_Free__TextEdit(void ** wPtr);
+int neuik_Object_Free__TextEdit(void * wPtr);
 
 int 
 	neuik_Element_GetMinSize__TextEdit(
@@ -49,11 +50,17 @@ int
 			RenderSize*, 
 			RenderLoc*,
 			SDL_Renderer*,
-			SDL_Surface*,
 			int);
 
 void
 	neuik_Element_Defocus__TextEdit(
 			NEUIK_Element);
 
+void
+	neuik_TextEdit_CancelLoad(
+			NEUIK_TextEdit * te);
+
+void
+	neuik_TextEditLoader_Shutdown();
+
 #endif /* NEUIK_TEXTEDIT_INTERNAL_H */
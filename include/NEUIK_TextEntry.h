@@ -36,6 +36,7 @@ typedef struct {
 		size_t                  textAllocSize; /* current mem alloc for text */
 		size_t                  cursorPos;     /* position of cursor in text */
 		int                     cursorX;       /* px pos of cursor (not considering pan) */
+		void                  * textWidths;    /* `neuik_PrefixWidths*` */
 		int                     selected;
 		int                     wasSelected;
 		size_t                  highlightBegin;
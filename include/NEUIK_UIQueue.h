@@ -0,0 +1,50 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#ifndef NEUIK_UIQUEUE_H
+#define NEUIK_UIQUEUE_H
+
+/*----------------------------------------------------------------------------*/
+/* Updates posted with this key are never coalesced with other updates.       */
+/*----------------------------------------------------------------------------*/
+#define NEUIK_UIUPDATE_NO_COALESCE  -1
+
+/*----------------------------------------------------------------------------*/
+/* Typedef(s)                                                                 */
+/*----------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------*/
+/* A UI update is called on the thread running NEUIK_EventLoop() with the     */
+/* element and argument that were posted. A nonzero return value indicates an */
+/* error (which should have been raised with NEUIK_RaiseError).               */
+/*----------------------------------------------------------------------------*/
+typedef int (* NEUIK_UIUpdateFn)(void * elem, void * arg);
+
+/*----------------------------------------------------------------------------*/
+/* NEUIK_PostToUIThread() may be called from any thread. Updates posted for   */
+/* the same (elem, key) pair before the event loop gets to them are coalesced */
+/* so that only the most recent one is applied; the arguments of superseded   */
+/* updates are passed to `freeArg` (if non-NULL) without calling `fn`. When   */
+/* called off of the UI thread, failures are only reported by the return      */
+/* value (the error stack is not touched).                                    */
+/*----------------------------------------------------------------------------*/
+int
+	NEUIK_PostToUIThread(
+			NEUIK_UIUpdateFn   fn,
+			void             * elem,
+			int                key,
+			void             * arg,
+			void            (* freeArg)(void *));
+
+#endif /* NEUIK_UIQUEUE_H */
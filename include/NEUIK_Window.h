@@ -27,6 +27,9 @@
 #include "NEUIK_Callback.h"
 #include "neuik_MaskMap.h"
 
+/* maximum stored depth of the window clip-rectangle stack */
+#define NEUIK_MAX_CLIP_DEPTH 64
+
 /*----------------------------------------------------------------------------*/
 /* Typedef(s)                                                                 */
 /*----------------------------------------------------------------------------*/
@@ -56,6 +59,16 @@ typedef struct {
 	int                       updateIcon;
 	int                       updateTitle;
 	int                       doRedraw;
+	double                    frameNext;  /* earliest time (ms) of the next present */
+	unsigned int              framesPresented;
+	unsigned int              framesDropped; /* display refreshes missed by late frames */
+	unsigned int              framesLate;    /* frames that took longer than one interval */
+	unsigned int              elemsDrawn;    /* elements rendered during the last frame */
+	unsigned int              elemsCulled;   /* elements skipped (not visible) during the last frame */
+	neuik_ClipRect            clipStack[NEUIK_MAX_CLIP_DEPTH]; /* visible regions being rendered */
+	int                       clipDepth;     /* number of pushed clip regions */
+	float                     scale;         /* HighDPI scaling of this window */
+	int                       scaleFixed;    /* scale was set by NEUIK_Window_SetScale() */
 } NEUIK_Window;
 
 /*----------------------------------------------------------------------------*/
@@ -160,5 +173,32 @@ int
 			NEUIK_Window  * w,
 			NEUIK_Element   elem);
 
+int
+	NEUIK_Window_GetFrameStats(
+			NEUIK_Window * w,
+			unsigned int * nPresented,
+			unsigned int * nDropped,
+			unsigned int * nLate);
+
+int
+	NEUIK_Window_ResetFrameStats(
+			NEUIK_Window * w);
+
+int
+	NEUIK_Window_GetCullStats(
+			NEUIK_Window * w,
+			unsigned int * nDrawn,
+			unsigned int * nCulled);
+
+int
+	NEUIK_Window_SetScale(
+			NEUIK_Window * w,
+			float          scale);
+
+int
+	NEUIK_Window_GetScale(
+			NEUIK_Window * w,
+			float        * scale);
+
 
 #endif /* NEUIK_WINDOW_H */
@@ -39,6 +39,9 @@ typedef struct {
 	int           isFullscreen; /* whether or not a window is fullscreen */
 	int           isMaximized;  /* whether or not a window is maximized */
 	int           isMinimized;  /* whether or not a window is minimized */
+	int           isVSync;      /* whether presentation waits for the display refresh */
+	int           targetFPS;    /* max frames presented per second (0 = display rate) */
+	int           detectScale;  /* whether HighDPI scaling follows the display DPI */
 } NEUIK_WindowConfig;
 
 
@@ -58,6 +58,44 @@ int
 			int             x,
 			int             y);
 
+int
+	neuik_Window_FrameIsDue(
+			NEUIK_Window * w,
+			unsigned int * waitMs);
+
+void
+	neuik_Window_ResetClip(
+			NEUIK_Window * w);
+
+void
+	neuik_Window_PushClip(
+			NEUIK_Window     * w,
+			const RenderLoc  * rLoc,
+			const RenderSize * rSize);
+
+void
+	neuik_Window_PopClip(
+			NEUIK_Window * w);
+
+int
+	neuik_Window_GetClip(
+			NEUIK_Window   * w,
+			neuik_ClipRect * clip);
+
+int
+	neuik_Window_IsClipped(
+			NEUIK_Window     * w,
+			const RenderLoc  * rLoc,
+			const RenderSize * rSize);
+
+void
+	neuik_Window_MakeScaleCurrent(
+			NEUIK_Window * w);
+
+int
+	neuik_Window_UpdateScale(
+			NEUIK_Window * w);
+
 int
 	neuik_Window_SetSizeNoScaling(
 			NEUIK_Window * w, 
@@ -0,0 +1,40 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#ifndef NEUIK_WORKPOOL_INTERNAL_H
+#define NEUIK_WORKPOOL_INTERNAL_H
+
+/*----------------------------------------------------------------------------*/
+/* A job function should only do CPU-side work (e.g., filling a MaskMap or an */
+/* SDL_Surface); it must not use an SDL_Renderer or create NEUIK objects. The */
+/* NEUIK error stack is not thread-safe; a job must report failures through   */
+/* its return value (and the job data), for the caller to raise once          */
+/* neuik_WorkPool_Run() has returned.                                         */
+/*----------------------------------------------------------------------------*/
+typedef int (* neuik_WorkFn)(void * job);
+
+int
+	neuik_WorkPool_NumThreads();
+
+int
+	neuik_WorkPool_Run(
+			neuik_WorkFn    fn,
+			void         ** jobs,
+			int             nJobs);
+
+void
+	neuik_WorkPool_Shutdown();
+
+#endif /* NEUIK_WORKPOOL_INTERNAL_H */
@@ -23,6 +23,8 @@
 	#define TRUE (1)
 #endif /* FALSE */
 
+#include <stddef.h>
+
 int  NEUIK_Init();
 
 void NEUIK_Quit();
@@ -31,4 +33,17 @@ int
 	NEUIK_SetAppName(
 			const char * appName);
 
+int
+	NEUIK_SetRenderThreads(
+			int nThreads);
+
+int
+	NEUIK_SetLayerMemoryBudget(
+			size_t nBytes);
+
+int
+	NEUIK_GetLayerMemoryUsage(
+			size_t * inUse,
+			size_t * budget);
+
 #endif /* NEUIK_NEUIK_H */
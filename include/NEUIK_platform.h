@@ -24,6 +24,7 @@ int neuik_KeyShortcut_Copy(SDL_KeyboardEvent * keyEv, SDL_Keymod keyMod);
 int neuik_KeyShortcut_Paste(SDL_KeyboardEvent * keyEv, SDL_Keymod keyMod);
 int neuik_KeyShortcut_SelectAll(SDL_KeyboardEvent * keyEv, SDL_Keymod keyMod);
 int neuik_KeyShortcut_Undo(SDL_KeyboardEvent * keyEv, SDL_Keymod keyMod);
+int neuik_KeyShortcut_Redo(SDL_KeyboardEvent * keyEv, SDL_Keymod keyMod);
 int neuik_KeyShortcut_Save(SDL_KeyboardEvent * keyEv, SDL_Keymod keyMod);
 int neuik_KeyShortcut_New(SDL_KeyboardEvent * keyEv, SDL_Keymod keyMod);
 int neuik_KeyShortcut_NewWindow(SDL_KeyboardEvent * keyEv, SDL_Keymod keyMod);
@@ -25,6 +25,48 @@ void
 	ConditionallyDestroyTexture(
 			SDL_Texture **tex);
 
+SDL_Texture *
+	neuik_CreateTexture(
+			SDL_Renderer * rend,
+			Uint32         format,
+			int            access,
+			int            w,
+			int            h);
+
+SDL_Texture *
+	neuik_CreateTextureFromSurface(
+			SDL_Renderer * rend,
+			SDL_Surface  * surf);
+
+SDL_Texture *
+	neuik_TexturePool_Acquire(
+			SDL_Renderer * rend,
+			Uint32         format,
+			int            access,
+			int            w,
+			int            h);
+
+void
+	neuik_TexturePool_Release(
+			SDL_Renderer  * rend,
+			SDL_Texture  ** tex);
+
+SDL_Surface *
+	neuik_SurfacePool_Acquire(
+			int    w,
+			int    h,
+			Uint32 rmask,
+			Uint32 gmask,
+			Uint32 bmask,
+			Uint32 amask);
+
+void
+	neuik_SurfacePool_Release(
+			SDL_Surface ** surf);
+
+void
+	neuik_Pool_EndFrame();
+
 SDL_Texture * 
 	NEUIK_RenderArrowDown(
 			NEUIK_Color     color,
@@ -66,6 +108,32 @@ SDL_Texture *
 			SDL_Renderer      * renderer,
 			RenderSize          rSize);
 
+int
+	neuik_Gradient_Compile(
+			NEUIK_ColorStop  ** cs,
+			char                dirn,
+			neuik_Gradient    * grad);
+
+SDL_Texture * 
+	neuik_GetGradientTexture(
+			const neuik_Gradient * grad,
+			int                    length,
+			SDL_Renderer         * rend);
+
+int
+	neuik_TextureSlot_Set(
+			SDL_Texture  ** slot,
+			SDL_Texture   * tex,
+			SDL_Renderer  * rend);
+
+void
+	neuik_TextureSlot_Clear(
+			SDL_Texture ** slot);
+
+void
+	neuik_DropRendererTextures(
+			SDL_Renderer * rend);
+
 void 
 	String_Duplicate(
 			char       **dst, 
@@ -39,6 +39,14 @@ typedef struct {
 		int  y; /* y-position for item (px) */
 } RenderLoc;
 
+/* a rectangular region of a window (px) */
+typedef struct {
+		int  x; /* x-position of the region (px) */
+		int  y; /* y-position of the region (px) */
+		int  w; /* width  of the region (px) */
+		int  h; /* height of the region (px) */
+} neuik_ClipRect;
+
 
 typedef struct {
 		uint8 r;  /* red   0-255 */
@@ -70,4 +78,18 @@ typedef struct {
 	float a;
 } colorDeltas;
 
+/* number of entries within the lookup table of a compiled gradient */
+#define NEUIK_GRADIENT_LUTSIZE 256
+
+/* neuik_Gradient */
+/* A set of ColorStops which has been validated and sampled into a lookup     */
+/* table (RGBA8888) so that the gradient can be generated without searching   */
+/* the ColorStops for every line. See `neuik_Gradient_Compile()`.             */
+typedef struct {
+	char          dirn;    /* direction of the gradient (`v` or `h`) */
+	int           nStops;  /* number of ColorStops which were compiled */
+	unsigned int  hash;    /* hash of the lookup table (for cache lookups) */
+	unsigned int  lut[NEUIK_GRADIENT_LUTSIZE]; /* color at frac = i/(size-1) */
+} neuik_Gradient;
+
 #endif /* NEUIK_STRUCTS_BASIC_H */
@@ -132,6 +132,31 @@ int
 		    int             x,
 		    int             y);
 
+/*----------------------------------------------------------------------------*/
+/* Variants which do not raise errors; for use from worker threads.           */
+/*----------------------------------------------------------------------------*/
+int 
+	neuik_MaskMap_UnmaskLine_NoError(
+			neuik_MaskMap * map, 
+			int             x1,
+			int             y1,
+			int             x2,
+			int             y2);
+
+int 
+	neuik_MaskMap_UnmaskUnboundedLine_NoError(
+			neuik_MaskMap * map, 
+			int             x1,
+			int             y1,
+			int             x2,
+			int             y2);
+
+int
+	neuik_MaskMap_UnmaskUnboundedPoint_NoError(
+			neuik_MaskMap * map, 
+			int             x,
+			int             y);
+
 int
 	neuik_MaskMap_UnmaskUnboundedRect(
 			neuik_MaskMap * map, 
@@ -0,0 +1,66 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#ifndef NEUIK_PREFIXWIDTHS_H
+#define NEUIK_PREFIXWIDTHS_H
+
+#include <stdlib.h>
+#include <SDL_ttf.h>
+
+/*----------------------------------------------------------------------------*/
+/* The rendered widths of every prefix of a line of text. This is built once  */
+/* (from glyph metrics and kerning) each time the text or font changes, after */
+/* which cursor placement and click hit-testing need not measure substrings.  */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+	TTF_Font * font;     /* font the widths were measured with */
+	char     * text;     /* copy of the measured text */
+	size_t     len;      /* length of the measured text */
+	size_t     cap;      /* allocated size of `text` and `widths` */
+	int      * widths;   /* widths[i] = rendered width of text[0:i] */
+	int        valid;
+} neuik_PrefixWidths;
+
+int
+	neuik_NewPrefixWidths(
+			neuik_PrefixWidths ** pwPtr);
+
+void
+	neuik_PrefixWidths_Free(
+			neuik_PrefixWidths * pw);
+
+int
+	neuik_PrefixWidths_Update(
+			neuik_PrefixWidths * pw,
+			TTF_Font           * font,
+			const char         * text);
+
+/*----------------------------------------------------------------------------*/
+/* Get the rendered width of the first `pos` characters (O(1)).               */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_PrefixWidths_GetWidth(
+			const neuik_PrefixWidths * pw,
+			size_t                     pos);
+
+/*----------------------------------------------------------------------------*/
+/* Get the cursor position nearest to the pixel offset `x` (O(log n)).        */
+/*----------------------------------------------------------------------------*/
+size_t
+	neuik_PrefixWidths_HitTest(
+			const neuik_PrefixWidths * pw,
+			int                        x);
+
+#endif /* NEUIK_PREFIXWIDTHS_H */
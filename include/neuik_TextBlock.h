@@ -41,6 +41,7 @@ typedef struct {
 	neuik_TextBlockData *  firstBlock;
 	neuik_TextBlockData *  lastBlock;
 	neuik_TextBlockData ** chapters;      /*  */
+	void                *  journal;       /* (neuik_TextBlockJournal*) NULL = none */
 } neuik_TextBlock;
 
 int
@@ -54,6 +55,15 @@ int
 			neuik_TextBlock * tblk,
 			const char      * text);
 
+/*----------------------------------------------------------------------------*/
+/* Append a chain of data blocks (holding complete lines) to the TextBlock.   */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextBlock_AppendBlocks(
+			neuik_TextBlock     * tblk,
+			neuik_TextBlockData * first,
+			int                   isFinal);
+
 /*----------------------------------------------------------------------------*/
 /* Get the number of bytes contained by the TextBlock.                        */
 /*----------------------------------------------------------------------------*/
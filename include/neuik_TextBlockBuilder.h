@@ -0,0 +1,81 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#ifndef NEUIK_TEXTBLOCKBUILDER_H
+#define NEUIK_TEXTBLOCKBUILDER_H
+
+#include "neuik_TextBlock.h"
+
+/*----------------------------------------------------------------------------*/
+/* A TextBlockBuilder indexes text into a detached chain of TextBlockData     */
+/* blocks (in the same layout used by neuik_TextBlock_SetText) as it is fed   */
+/* successive chunks of a file. Completed blocks are then handed over to a    */
+/* TextBlock with neuik_TextBlock_AppendBlocks, so the text is only copied    */
+/* once.                                                                      */
+/*                                                                            */
+/* None of these functions raise NEUIK errors; they may be used from a thread */
+/* other than the one running the event loop.                                 */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+	size_t                blockSize;  /* size of the blocks being built */
+	size_t                fillLimit;  /* bytes used in a block before starting another */
+	size_t                lineStart;  /* offset of the unterminated line in lastBlock */
+	int                   pendingCR;  /* the previous chunk ended with a `\r` */
+	neuik_TextBlockData * firstBlock;
+	neuik_TextBlockData * lastBlock;
+} neuik_TextBlockBuilder;
+
+int
+	neuik_NewTextBlockBuilder(
+			neuik_TextBlockBuilder ** bldPtr,
+			size_t                    blockSize,
+			unsigned int              overProvisionPct);
+
+void
+	neuik_TextBlockBuilder_Free(
+			neuik_TextBlockBuilder * bld);
+
+/*----------------------------------------------------------------------------*/
+/* Index the next chunk of text. Lines may be split across chunks.            */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextBlockBuilder_Feed(
+			neuik_TextBlockBuilder * bld,
+			const char             * chunk,
+			size_t                   chunkLen);
+
+/*----------------------------------------------------------------------------*/
+/* Terminate the final line; no more text may be fed after this.              */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextBlockBuilder_Finish(
+			neuik_TextBlockBuilder * bld);
+
+/*----------------------------------------------------------------------------*/
+/* Detach the blocks holding completed lines. An unterminated line is kept    */
+/* back by the builder until it is completed by a later chunk (or Finish).    */
+/*----------------------------------------------------------------------------*/
+neuik_TextBlockData *
+	neuik_TextBlockBuilder_TakeBlocks(
+			neuik_TextBlockBuilder * bld);
+
+/*----------------------------------------------------------------------------*/
+/* Free a detached chain of blocks which was never appended to a TextBlock.   */
+/*----------------------------------------------------------------------------*/
+void
+	neuik_TextBlockBuilder_FreeBlocks(
+			neuik_TextBlockData * first);
+
+#endif /* NEUIK_TEXTBLOCKBUILDER_H */
@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#ifndef NEUIK_TEXTBLOCKJOURNAL_H
+#define NEUIK_TEXTBLOCKJOURNAL_H
+
+#include "neuik_TextBlock.h"
+
+typedef enum {
+	NEUIK_JOURNAL_INSERT,
+	NEUIK_JOURNAL_DELETE,
+} neuik_JournalOp;
+
+/*----------------------------------------------------------------------------*/
+/* A single reversible edit. The start position and the text are all that is  */
+/* needed to redo the edit; the end position (the far side of the inserted/   */
+/* deleted text) is kept so that an insert can be undone without a rescan.    */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+	neuik_JournalOp   op;
+	int               isRun;        /* may still be extended by typing/deleting */
+	int               joinPrev;     /* undone/redone along with the prior record */
+	size_t            startLineNo;
+	size_t            startLinePos;
+	size_t            endLineNo;
+	size_t            endLinePos;
+	size_t            textLen;
+	size_t            textAlloc;
+	char            * text;         /* the inserted/deleted text */
+} neuik_TextBlockJournalRecord;
+
+/*----------------------------------------------------------------------------*/
+/* The edit history of a TextBlock. Records are held in a ring so that the    */
+/* oldest may be dropped (to stay within the byte budget) in constant time.   */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+	neuik_TextBlockJournalRecord * records;
+	size_t                         nAllocated;
+	size_t                         first;        /* index of the oldest record */
+	size_t                         nUndo;        /* applied records (may be undone) */
+	size_t                         nRedo;        /* undone records (may be redone) */
+	size_t                         bytesInUse;   /* memory held by all records */
+	size_t                         byteBudget;   /* oldest records dropped beyond this */
+	int                            replaying;    /* edits aren't recorded while set */
+	int                            groupDepth;   /* nesting of BeginEditGroup calls */
+	int                            groupStarted; /* current group has a record */
+} neuik_TextBlockJournal;
+
+/*----------------------------------------------------------------------------*/
+/* Start keeping an edit history (a `byteBudget` of 0 selects the default).   */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextBlock_EnableJournal(
+			neuik_TextBlock * tblk,
+			size_t            byteBudget);
+
+/*----------------------------------------------------------------------------*/
+/* Forget all of the recorded edits (the journal itself remains enabled).     */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextBlock_ClearJournal(
+			neuik_TextBlock * tblk);
+
+/*----------------------------------------------------------------------------*/
+/* Edits made between Begin and End are undone/redone as a single step.       */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextBlock_BeginEditGroup(
+			neuik_TextBlock * tblk);
+
+int
+	neuik_TextBlock_EndEditGroup(
+			neuik_TextBlock * tblk);
+
+/*----------------------------------------------------------------------------*/
+/* Undo/Redo the most recent step; `done` is set to 0 if there was nothing to */
+/* undo/redo. The returned position is where the cursor should be placed.     */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextBlock_Undo(
+			neuik_TextBlock * tblk,
+			int             * done,
+			size_t          * cursorLineNo,
+			size_t          * cursorLinePos);
+
+int
+	neuik_TextBlock_Redo(
+			neuik_TextBlock * tblk,
+			int             * done,
+			size_t          * cursorLineNo,
+			size_t          * cursorLinePos);
+
+/*----------------------------------------------------------------------------*/
+/* Used by the TextBlock editing functions to record their changes.           */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextBlockJournal_IsRecording__noErrChecks(
+			neuik_TextBlock * tblk);
+
+void
+	neuik_TextBlockJournal_Record__noErrChecks(
+			neuik_TextBlock * tblk,
+			neuik_JournalOp   op,
+			int               isRun,
+			size_t            startLineNo,
+			size_t            startLinePos,
+			size_t            endLineNo,
+			size_t            endLinePos,
+			const char      * text,
+			size_t            textLen);
+
+void
+	neuik_TextBlockJournal_Free(
+			neuik_TextBlockJournal * journal);
+
+#endif /* NEUIK_TEXTBLOCKJOURNAL_H */
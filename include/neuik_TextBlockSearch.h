@@ -0,0 +1,72 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#ifndef NEUIK_TEXTBLOCKSEARCH_H
+#define NEUIK_TEXTBLOCKSEARCH_H
+
+#include "neuik_TextBlock.h"
+
+/*----------------------------------------------------------------------------*/
+/* An in-progress search of a TextBlock. The data blocks are scanned in place */
+/* (nothing is copied) and matches may span line endings and block edges.    */
+/* A search is invalidated by any change to the contents of its TextBlock.    */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+	neuik_TextBlock     * tblk;
+	char                * needle;    /* copy of the text being searched for */
+	size_t                needleLen;
+	neuik_TextBlockData * block;     /* block holding the scan position (NULL at end) */
+	size_t                offset;    /* scan position within `block` */
+	size_t                lineNo;    /* line containing the scan position */
+	size_t                lineStart; /* offset of the start of `lineNo` within `block` */
+	size_t                lineBase;  /* bytes of `lineNo` held by earlier blocks */
+} neuik_TextBlockSearch;
+
+int
+	neuik_TextBlock_SearchBegin(
+			neuik_TextBlock        * tblk,
+			const char             * needle,
+			size_t                   startLineNo,
+			size_t                   startLinePos,
+			neuik_TextBlockSearch ** srchPtr);
+
+/*----------------------------------------------------------------------------*/
+/* Find the next (non-overlapping) match; `found` is set to 0 once there are  */
+/* no more matches. The end position is the position just after the match.   */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextBlockSearch_Next(
+			neuik_TextBlockSearch * srch,
+			int                   * found,
+			size_t                * lineNo,
+			size_t                * linePos,
+			size_t                * endLineNo,
+			size_t                * endLinePos);
+
+void
+	neuik_TextBlockSearch_Free(
+			neuik_TextBlockSearch * srch);
+
+/*----------------------------------------------------------------------------*/
+/* Replace every occurrence of `needle` in a single pass over the TextBlock.  */
+/*----------------------------------------------------------------------------*/
+int
+	neuik_TextBlock_ReplaceAll(
+			neuik_TextBlock * tblk,
+			const char      * needle,
+			const char      * replacement,
+			size_t          * nReplaced);
+
+#endif /* NEUIK_TEXTBLOCKSEARCH_H */
@@ -21,6 +21,10 @@
 /* Internal Function Prototypes                                               */
 /*----------------------------------------------------------------------------*/
 int neuik_Object_Free__TextBlock(void * ptr);
+int neuik_NewTextBlockData(neuik_TextBlockData ** dataPtr, size_t blockSize);
+int neuik_TextBlock_GetPositionLineStart__noErrChecks(
+    neuik_TextBlock * tblk, size_t lineNo, neuik_TextBlockData ** blockPtr,
+    size_t * offset);
 
 
 #endif /* NEUIK_TEXTBLOCK_INTERNAL_H */
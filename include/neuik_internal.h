@@ -65,6 +65,12 @@ typedef struct {
 	void                  * SuperClass; /* (neuik_Class*) */
 	neuik_Class_BaseFuncs * baseFuncs;
 	void                  * classFuncs;
+	int                     classDepth; /* number of superclasses above this class */
+	void                 ** lineage;    /* (neuik_Class**) [0]:root ... [classDepth]:this */
+	void                 ** vFuncTable; /* resolved virtual function imps (by slot) */
+	size_t                  objSize;    /* size of the object struct of this class */
+	size_t                  blockSize;  /* size of an object incl. its superclass objects */
+	size_t                * offsets;    /* [d]: offset of the depth `d` class object */
 } neuik_Class;
 
 
@@ -83,6 +89,8 @@ typedef struct {
 	neuik_Set     * nSet;          /* pointer to parent set */
 	neuik_Class   * nClass;        /* pointer to class */
 	void          * superClassObj; /* ptr to the superClass object of this Object (NULL if None) */
+	unsigned char   contiguous;    /* superclass objects lie at the class offsets */
+	unsigned char   embedded;      /* allocated within a subclass object's block */
 } neuik_Object;
 
 /*----------------------------------------------------------------------------*/
@@ -107,11 +115,21 @@ typedef struct {
 } neuik_virtualFuncPair;
 
 /*----------------------------------------------------------------------------*/
-/* neuik_VirtualFunc                                                          */
+/* neuik_virtualFuncSet                                                       */
 /*                                                                            */
-/* One or more virtual function pairs define a virtual function set.          */
+/* One or more virtual function pairs define a virtual function set. Each set */
+/* is assigned a slot within the dispatch table (vFuncTable) of every class;  */
+/* the slot holds the implementation which applies to that class.             */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+	int                      slot;  /* index within class dispatch tables */
+	neuik_virtualFuncPair ** pairs; /* nullPtr terminated list */
+} neuik_virtualFuncSet;
+
+/*----------------------------------------------------------------------------*/
+/* neuik_VirtualFunc                                                          */
 /*----------------------------------------------------------------------------*/
-typedef neuik_virtualFuncPair ** neuik_VirtualFunc;
+typedef neuik_virtualFuncSet * neuik_VirtualFunc;
 
 
 int
@@ -127,6 +145,7 @@ int
 			const char             * classDescription,
 			neuik_Set              * classSet,
 			neuik_Class            * superClass,
+			size_t                   objSize,
 			neuik_Class_BaseFuncs  * baseFuncs,
 			void                   * classFuncs,
 			neuik_Class           ** newClass);
@@ -143,6 +162,15 @@ int
 	neuik_Object_Free(
 			void * objPtr);
 
+void *
+	neuik_Object_Alloc(
+			neuik_Class  * objClass,
+			void        ** objPtr);
+
+void
+	neuik_Object_Release(
+			void * objPtr);
+
 int
 	neuik_Object_IsNEUIKObject(
 			const void * objPtr);
@@ -182,7 +182,7 @@ SDL_Texture* NEUIK_RenderMainMenu(
     /* Copy the text onto the renderer and update it                          */
     /*------------------------------------------------------------------------*/
     SDL_RenderPresent(rend);
-    rvTex = SDL_CreateTextureFromSurface(extRend, surf);
+    rvTex = neuik_CreateTextureFromSurface(extRend, surf);
 
 out:
     if (eNum > 0)
@@ -518,7 +518,7 @@ SDL_Texture * NEUIK_RenderMenu(
     /* Present all changes and create a texture from this surface             */
     /*------------------------------------------------------------------------*/
     SDL_RenderPresent(rend);
-    rvTex = SDL_CreateTextureFromSurface(extRend, surf);
+    rvTex = neuik_CreateTextureFromSurface(extRend, surf);
 out:
     if (eNum > 0)
     {
@@ -337,7 +337,7 @@ SDL_Texture*  NEUIK_RenderMenuItem(
     /* Copy the text onto the renderer and update it                          */
     /*------------------------------------------------------------------------*/
     SDL_RenderPresent(rend);
-    rvTex = SDL_CreateTextureFromSurface(extRend, surf);
+    rvTex = neuik_CreateTextureFromSurface(extRend, surf);
 
 out:
     if (surf != NULL) SDL_FreeSurface(surf);
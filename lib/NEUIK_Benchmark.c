@@ -0,0 +1,280 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#include <SDL.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "NEUIK_error.h"
+#include "NEUIK_Benchmark.h"
+#include "NEUIK_Window.h"
+#include "NEUIK_Window_internal.h"
+#include "neuik_internal.h"
+#include "neuik_classes.h"
+
+extern SDL_atomic_t  neuik__ObjectsCreated;
+extern unsigned long neuik__TexturesCreated;
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Benchmark_CompareDouble
+ *
+ *  Description:   qsort() comparison function for doubles (ascending order).
+ *
+ ******************************************************************************/
+static int neuik_Benchmark_CompareDouble(
+    const void * a,
+    const void * b)
+{
+    double dA = *((const double *)a);
+    double dB = *((const double *)b);
+
+    if (dA < dB) return -1;
+    if (dA > dB) return  1;
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Benchmark_Percentile
+ *
+ *  Description:   Return the requested percentile (nearest-rank method) of a
+ *                 sorted array of values.
+ *
+ ******************************************************************************/
+static double neuik_Benchmark_Percentile(
+    const double * sorted,
+    int            n,
+    double         pct)
+{
+    int rank;
+
+    rank = (int)(pct/100.0*(double)(n) + 0.5);
+    if (rank < 1) rank = 1;
+    if (rank > n) rank = n;
+
+    return sorted[rank - 1];
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_Window_Benchmark
+ *
+ *  Description:   Redraw a window a number of times and report frame time 
+ *                 statistics along with the number of NEUIK object allocations
+ *                 and SDL_Texture creations per frame.
+ *
+ *                 If `fullRedraw` is set, every frame redraws the entire window
+ *                 (the worst case); otherwise each frame only redraws what has
+ *                 requested a redraw since the previous frame.
+ *
+ *                 The window must have been created (NEUIK_Window_Create). When
+ *                 no GPU is available the `dummy` SDL video driver may be used
+ *                 (SDL_VIDEODRIVER=dummy); the window then renders using the
+ *                 software renderer.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_Window_Benchmark(
+    NEUIK_Window          * w,          /* [in] the window to redraw */
+    int                     nFrames,    /* [in] number of frames to time */
+    int                     fullRedraw, /* [in] force a full redraw each frame */
+    NEUIK_BenchmarkResult * result)     /* [out] the benchmark results */
+{
+    int             ctr;
+    int             eNum       = 0; /* which error to report (if any) */
+    double          sum        = 0.0;
+    double          tickPerMs;
+    double        * frameMs    = NULL;
+    Uint64          tStart;
+    unsigned int    objs0;
+    unsigned long   texs0;
+    static char     funcName[] = "NEUIK_Window_Benchmark";
+    static char   * errMsgs[]  = {"",                     // [0] no error
+        "Argument `w` does not implement Window class.",  // [1]
+        "Argument `result` is NULL.",                     // [2]
+        "Argument `nFrames` must be greater than zero.",  // [3]
+        "Failure to allocate memory.",                    // [4]
+        "Failure in `neuik_Window_RequestFullRedraw()`.", // [5]
+        "Failure in `NEUIK_Window_Redraw()`.",            // [6]
+        "Window has not been created.",                   // [7]
+    };
+
+    if (!neuik_Object_IsClass(w, neuik__Class_Window))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (result == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (nFrames <= 0)
+    {
+        eNum = 3;
+        goto out;
+    }
+    if (w->rend == NULL)
+    {
+        eNum = 7;
+        goto out;
+    }
+
+    frameMs = (double *)malloc(nFrames*sizeof(double));
+    if (frameMs == NULL)
+    {
+        eNum = 4;
+        goto out;
+    }
+
+    tickPerMs = (double)(SDL_GetPerformanceFrequency())/1000.0;
+    objs0     = (unsigned int)SDL_AtomicGet(&neuik__ObjectsCreated);
+    texs0     = neuik__TexturesCreated;
+
+    for (ctr = 0; ctr < nFrames; ctr++)
+    {
+        if (fullRedraw)
+        {
+            if (neuik_Window_RequestFullRedraw(w))
+            {
+                eNum = 5;
+                goto out;
+            }
+        }
+
+        tStart = SDL_GetPerformanceCounter();
+        if (NEUIK_Window_Redraw(w))
+        {
+            eNum = 6;
+            goto out;
+        }
+        frameMs[ctr] = (double)(SDL_GetPerformanceCounter() - tStart)/tickPerMs;
+        sum += frameMs[ctr];
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Calculate the frame statistics.                                        */
+    /*------------------------------------------------------------------------*/
+    qsort(frameMs, nFrames, sizeof(double), neuik_Benchmark_CompareDouble);
+
+    result->nFrames      = nFrames;
+    result->frameMs_min  = frameMs[0];
+    result->frameMs_mean = sum/(double)(nFrames);
+    result->frameMs_p50  = neuik_Benchmark_Percentile(frameMs, nFrames, 50.0);
+    result->frameMs_p90  = neuik_Benchmark_Percentile(frameMs, nFrames, 90.0);
+    result->frameMs_p99  = neuik_Benchmark_Percentile(frameMs, nFrames, 99.0);
+    result->frameMs_max  = frameMs[nFrames - 1];
+    result->objectsPerFrame = 
+        (double)((unsigned int)SDL_AtomicGet(&neuik__ObjectsCreated) - 
+        objs0)/(double)(nFrames);
+    result->texturesPerFrame = 
+        (double)(neuik__TexturesCreated - texs0)/(double)(nFrames);
+out:
+    if (frameMs != NULL) free(frameMs);
+
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_BenchmarkResult_WriteJSON
+ *
+ *  Description:   Write benchmark results out as a JSON object (on one line).
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_BenchmarkResult_WriteJSON(
+    const NEUIK_BenchmarkResult * result, /* [in] the benchmark results */
+    const char                  * name,   /* [in] name of the benchmark */
+    FILE                        * fp)     /* [in] where to write the JSON */
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    const char  * namePtr;
+    static char   funcName[] = "NEUIK_BenchmarkResult_WriteJSON";
+    static char * errMsgs[]  = {"",   // [0] no error
+        "Argument `result` is NULL.", // [1]
+        "Argument `fp` is NULL.",     // [2]
+        "Failure in `fprintf()`.",    // [3]
+    };
+
+    if (result == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (fp == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Write the name as a JSON string; escape quotes and backslashes.        */
+    /*------------------------------------------------------------------------*/
+    if (fputs("{\"name\": \"", fp) < 0)
+    {
+        eNum = 3;
+        goto out;
+    }
+    for (namePtr = name; namePtr != NULL && *namePtr != '\0'; namePtr++)
+    {
+        if (*namePtr == '"' || *namePtr == '\\') fputc('\\', fp);
+        if ((unsigned char)(*namePtr) < 0x20)
+        {
+            fputc(' ', fp);
+            continue;
+        }
+        fputc(*namePtr, fp);
+    }
+
+    if (fprintf(fp, "\", \"frames\": %d, "
+            "\"frame_ms\": {\"min\": %.4f, \"mean\": %.4f, \"p50\": %.4f, "
+            "\"p90\": %.4f, \"p99\": %.4f, \"max\": %.4f}, "
+            "\"objects_per_frame\": %.3f, \"textures_per_frame\": %.3f}\n",
+            result->nFrames,
+            result->frameMs_min,
+            result->frameMs_mean,
+            result->frameMs_p50,
+            result->frameMs_p90,
+            result->frameMs_p99,
+            result->frameMs_max,
+            result->objectsPerFrame,
+            result->texturesPerFrame) < 0)
+    {
+        eNum = 3;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
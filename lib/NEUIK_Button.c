@@ -107,6 +107,7 @@ int neuik_RegisterClass_Button()
         "A GUI button which may contain text.", // classDescription
         neuik__Set_NEUIK,                       // classSet
         neuik__Class_Element,                   // superClass
+        sizeof(NEUIK_Button),                   // objSize
         &neuik_Button_BaseFuncs,                // baseFuncs
         NULL,                                   // classFuncs
         &neuik__Class_Button))                  // newClass
@@ -157,7 +158,8 @@ int neuik_Object_New__Button(
         goto out;
     }
 
-    (*btnPtr) = (NEUIK_Button*) malloc(sizeof(NEUIK_Button));
+    (*btnPtr) = (NEUIK_Button*) neuik_Object_Alloc(
+        neuik__Class_Button, (void**)btnPtr);
     btn = *btnPtr;
     if (btn == NULL)
     {
@@ -296,7 +298,7 @@ int neuik_Object_Free__Button(
         goto out;
     }
 
-    free(btn);
+    neuik_Object_Release(btn);
 out:
     if (eNum > 0)
     {
@@ -1310,7 +1312,7 @@ out:
         if (!mock) eBase->eSt.doRedraw = 0;
     }
 
-    ConditionallyDestroyTexture(&tTex);
+    neuik_TexturePool_Release(rend, &tTex);
     if (maskMap != NULL) neuik_Object_Free(maskMap);
 
     if (eNum > 0)
@@ -78,6 +78,7 @@ int neuik_RegisterClass_ButtonConfig()
         "Configuration for the Button Object.", // classDescription
         neuik__Set_NEUIK,                       // classSet
         NULL,                                   // superClass
+        sizeof(NEUIK_ButtonConfig),             // objSize
         &neuik_ButtonConfig_BaseFuncs,          // baseFuncs
         NULL,                                   // classFuncs
         &neuik__Class_ButtonConfig))            // newClass
@@ -225,7 +226,8 @@ int NEUIK_NewButtonConfig(
         goto out;
     }
 
-    (*cfgPtr) = (NEUIK_ButtonConfig*) malloc(sizeof(NEUIK_ButtonConfig));
+    (*cfgPtr) = (NEUIK_ButtonConfig*) neuik_Object_Alloc(
+        neuik__Class_ButtonConfig, (void**)cfgPtr);
     cfg = (*cfgPtr);
     if (cfg == NULL)
     {
@@ -399,7 +401,7 @@ int NEUIK_ButtonConfig_Free(
     /*------------------------------------------------------------------------*/
     if (cfg->fontName != NULL) free(cfg->fontName);
 
-    free(cfg);
+    neuik_Object_Release(cfg);
 out:
     if (eNum > 0)
     {
@@ -17,15 +17,34 @@
 #include <stdlib.h>
 
 #include "NEUIK_Callback.h"
+#include "NEUIK_Callback_internal.h"
 #include "NEUIK_error.h"
 
-#define N_BINDING_STACK       250
-#define N_BINDING_STACK_FINAL 249
-
-static unsigned int neuik_bindingStack[N_BINDING_STACK];
-static int          neuik_bindingStack_Start      = 0;
-static int          neuik_bindingStack_Stop       = 0;
-// static int          neuik_bindingStack_ReadBlock  = 0;
+/*----------------------------------------------------------------------------*/
+/* Binding IDs are queued in a linked list of fixed-size segments so that the */
+/* queue never fills up (and never drops a binding). A segment is recycled    */
+/* once it has been fully read.                                               */
+/*----------------------------------------------------------------------------*/
+#define N_BINDING_SEGMENT 256
+
+typedef struct neuik_BindingSegment neuik_BindingSegment;
+
+struct neuik_BindingSegment {
+    neuik_BindingSegment * next;
+    int                    start; /* index of the next ID to be read */
+    int                    stop;  /* index of the next free slot */
+    unsigned int           ids[N_BINDING_SEGMENT];
+};
+
+/*----------------------------------------------------------------------------*/
+/* Created by NEUIK_Init() and destroyed by NEUIK_Quit(); other threads only  */
+/* use the queue in between.                                                  */
+/*----------------------------------------------------------------------------*/
+static SDL_mutex            * neuik_bindingQueue_Mutex = NULL;
+static SDL_sem              * neuik_bindingQueue_Count = NULL; /* # queued */
+static neuik_BindingSegment * neuik_bindingQueue_Head  = NULL;
+static neuik_BindingSegment * neuik_bindingQueue_Tail  = NULL;
+static neuik_BindingSegment * neuik_bindingQueue_Spare = NULL;
 
 
 /*******************************************************************************
@@ -144,107 +163,214 @@ out:
 
 /*******************************************************************************
  *
- *  Name:          neuik_PushBindingCallbackToStack
+ *  Name:          neuik_BindingQueue_Init
  *
- *  Description:   Push the callback Binding ID on to the Binding Callback 
- *                 stack.
+ *  Description:   Create the synchronization objects used by the binding
+ *                 callback queue. This is called by NEUIK_Init() (on the 
+ *                 event loop thread) before any binding can be pushed.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
  *
  ******************************************************************************/
-void neuik_PushBindingCallbackToStack(
-    unsigned int bindID)
+int neuik_BindingQueue_Init()
 {
-    int           nAttempts;
-    int           eNum        = 0; /* which error to report (if any) */
-    static int    maxAttempts = 25;
-    static int    writeBlock  = 0;
-    static char   funcName[]  = "neuik_PushBindingCallbackToStack";
-    static char * errMsgs[]   = {"",                       // [0] no error
-        "Obtaining a write block took too long.",          // [1]
-        "Obtaining an opening in the stack took to long.", // [2]
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "neuik_BindingQueue_Init";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Failed to create the binding queue mutex.",     // [1]
+        "Failed to create the binding queue semaphore.", // [2]
     };
 
-    /*------------------------------------------------------------------------*/
-    /* Wait until we can obtain a write block on the callback stack           */
-    /*------------------------------------------------------------------------*/
-    if (writeBlock)
+    if (neuik_bindingQueue_Mutex == NULL)
     {
-        for (nAttempts = 0; nAttempts < maxAttempts; nAttempts++) 
+        neuik_bindingQueue_Mutex = SDL_CreateMutex();
+        if (neuik_bindingQueue_Mutex == NULL)
         {
-            SDL_Delay(1);
-            if (!writeBlock)
-            {
-                writeBlock = 1;
-                break;
-            }
+            eNum = 1;
+            goto out;
         }
-
-        /*--------------------------------------------------------------------*/
-        /* Too many failed attempts at obtaining a write block.               */
-        /*--------------------------------------------------------------------*/
-        if (nAttempts == maxAttempts)
+    }
+    if (neuik_bindingQueue_Count == NULL)
+    {
+        neuik_bindingQueue_Count = SDL_CreateSemaphore(0);
+        if (neuik_bindingQueue_Count == NULL)
         {
-            eNum = 1;
+            eNum = 2;
             goto out;
         }
     }
-    else
+out:
+    if (eNum > 0)
     {
-        writeBlock = 1;
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
     }
-    /*------------------------------------------------------------------------*/
-    /* Write block obtained on the callback stack                             */
-    /*------------------------------------------------------------------------*/
-    /* First check to make sure that the stack is not full                    */
-    /*------------------------------------------------------------------------*/
-    if ((neuik_bindingStack_Stop == 0 
-            && neuik_bindingStack_Start == N_BINDING_STACK_FINAL) ||
-        (neuik_bindingStack_Stop == neuik_bindingStack_Start - 1))
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_BindingQueue_Shutdown
+ *
+ *  Description:   Discard any queued Binding IDs and free the binding callback
+ *                 queue. This is called by NEUIK_Quit(); no other thread may 
+ *                 still be pushing or waiting for bindings.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+void neuik_BindingQueue_Shutdown()
+{
+    neuik_BindingSegment * seg = NULL;
+
+    while (neuik_bindingQueue_Head != NULL)
+    {
+        seg                     = neuik_bindingQueue_Head;
+        neuik_bindingQueue_Head = seg->next;
+        free(seg);
+    }
+    neuik_bindingQueue_Tail = NULL;
+    if (neuik_bindingQueue_Spare != NULL)
+    {
+        free(neuik_bindingQueue_Spare);
+        neuik_bindingQueue_Spare = NULL;
+    }
+
+    if (neuik_bindingQueue_Count != NULL)
+    {
+        SDL_DestroySemaphore(neuik_bindingQueue_Count);
+        neuik_bindingQueue_Count = NULL;
+    }
+    if (neuik_bindingQueue_Mutex != NULL)
+    {
+        SDL_DestroyMutex(neuik_bindingQueue_Mutex);
+        neuik_bindingQueue_Mutex = NULL;
+    }
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_PushBindingCallbackToStack
+ *
+ *  Description:   Push the callback Binding ID on to the Binding Callback 
+ *                 queue and wake a thread waiting for it (if any). This is
+ *                 safe to call from any thread, so it does not raise errors; 
+ *                 a binding which can't be queued (NEUIK is not initialized 
+ *                 or memory is exhausted) is dropped.
+ *
+ ******************************************************************************/
+void neuik_PushBindingCallbackToStack(
+    unsigned int bindID)
+{
+    neuik_BindingSegment * seg = NULL;
+
+    if (neuik_bindingQueue_Count == NULL)
+    {
+        return;
+    }
+
+    SDL_LockMutex(neuik_bindingQueue_Mutex);
+    seg = neuik_bindingQueue_Tail;
+    if (seg == NULL || seg->stop == N_BINDING_SEGMENT)
     {
-        for (nAttempts = 0; nAttempts < maxAttempts; nAttempts++) 
+        /*--------------------------------------------------------------------*/
+        /* The current segment is full (or there isn't one); start another.   */
+        /*--------------------------------------------------------------------*/
+        seg = neuik_bindingQueue_Spare;
+        if (seg != NULL)
         {
-            SDL_Delay(1);
-            if (!((neuik_bindingStack_Stop == 0 
-                    && neuik_bindingStack_Start == N_BINDING_STACK_FINAL) ||
-                (neuik_bindingStack_Stop == neuik_bindingStack_Start - 1)))
+            neuik_bindingQueue_Spare = NULL;
+        }
+        else
+        {
+            seg = (neuik_BindingSegment *)malloc(sizeof(neuik_BindingSegment));
+            if (seg == NULL)
             {
-                break;
+                SDL_UnlockMutex(neuik_bindingQueue_Mutex);
+                return;
             }
         }
+        seg->next  = NULL;
+        seg->start = 0;
+        seg->stop  = 0;
 
-        /*--------------------------------------------------------------------*/
-        /* Too many failed attempts at waiting for an opening in the stack.   */
-        /*--------------------------------------------------------------------*/
-        if (nAttempts == maxAttempts)
+        if (neuik_bindingQueue_Tail != NULL)
         {
-            eNum = 2;
-            goto out;
+            neuik_bindingQueue_Tail->next = seg;
+        }
+        else
+        {
+            neuik_bindingQueue_Head = seg;
         }
+        neuik_bindingQueue_Tail = seg;
     }
+    seg->ids[seg->stop] = bindID;
+    seg->stop++;
+    SDL_UnlockMutex(neuik_bindingQueue_Mutex);
 
-    /*------------------------------------------------------------------------*/
-    /* There is an opening on the stack, write the binding ID there.          */
-    /*------------------------------------------------------------------------*/
-    neuik_bindingStack[neuik_bindingStack_Stop] = bindID;
-    neuik_bindingStack_Stop++;
+    SDL_SemPost(neuik_bindingQueue_Count);
+}
 
-    if (neuik_bindingStack_Stop > N_BINDING_STACK_FINAL)
-    {
-        neuik_bindingStack_Stop = 0;
-    }   
-    writeBlock = 0;
-out:
-    if (eNum != 0)
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_BindingQueue_Take
+ *
+ *  Description:   Remove the oldest Binding ID from the queue. The caller
+ *                 must already have decremented the queue semaphore (which
+ *                 guarantees that there is an ID to take).
+ *
+ *  Returns:       The oldest Binding ID.
+ *
+ ******************************************************************************/
+static unsigned int neuik_BindingQueue_Take()
+{
+    unsigned int           bindID = 0;
+    neuik_BindingSegment * seg    = NULL;
+
+    SDL_LockMutex(neuik_bindingQueue_Mutex);
+    seg    = neuik_bindingQueue_Head;
+    bindID = seg->ids[seg->start];
+    seg->start++;
+
+    if (seg->start == seg->stop)
     {
-        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        if (seg == neuik_bindingQueue_Tail)
+        {
+            /*----------------------------------------------------------------*/
+            /* The queue is now empty; reuse this segment from the start.     */
+            /*----------------------------------------------------------------*/
+            seg->start = 0;
+            seg->stop  = 0;
+        }
+        else
+        {
+            neuik_bindingQueue_Head = seg->next;
+            if (neuik_bindingQueue_Spare == NULL)
+            {
+                neuik_bindingQueue_Spare = seg;
+            }
+            else
+            {
+                free(seg);
+            }
+        }
     }
+    SDL_UnlockMutex(neuik_bindingQueue_Mutex);
+
+    return bindID;
 }
 
+
 /*******************************************************************************
  *
  *  Name:          NEUIK_PopBindingCallbackFromStack
  *
- *  Description:   Pop a callback Binding ID from the Binding Callback stack.
- *                 stack.
+ *  Description:   Pop a callback Binding ID from the Binding Callback queue
+ *                 (without waiting).
  *
  *  Returns:       1 if a valid bindID was returned; 0 otherwise.
  *
@@ -252,64 +378,27 @@ out:
 int NEUIK_PopBindingCallbackFromStack(
     unsigned int * bindID)
 {
-    int           nAttempts;
-    int           isValid     = 0;
-    int           eNum        = 0; /* which error to report (if any) */
-    static int    maxAttempts = 25;
-    static int    readBlock   = 0;
-    static char   funcName[]  = "NEUIK_PopBindingCallbackFromStack";
-    static char * errMsgs[]   = {"",             // [0] no error
-        "Obtaining a read block took too long.", // [1]
+    int           isValid    = 0;
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "NEUIK_PopBindingCallbackFromStack";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `bindID` is NULL.", // [1]
     };
 
-    /*------------------------------------------------------------------------*/
-    /* Wait until we can obtain a read block on the callback stack            */
-    /*------------------------------------------------------------------------*/
-    if (readBlock)
-    {
-        for (nAttempts = 0; nAttempts < maxAttempts; nAttempts++) 
-        {
-            SDL_Delay(1);
-            if (!readBlock)
-            {
-                readBlock = 1;
-                break;
-            }
-        }
-
-        /*--------------------------------------------------------------------*/
-        /* Too many failed attempts at obtaining a read block.                */
-        /*--------------------------------------------------------------------*/
-        if (nAttempts == maxAttempts)
-        {
-            eNum = 1;
-            goto out;
-        }
-    }
-    else
+    if (bindID == NULL)
     {
-        readBlock = 1;
+        eNum = 1;
+        goto out;
     }
+    if (neuik_bindingQueue_Count == NULL) goto out;
 
     /*------------------------------------------------------------------------*/
-    /* Check to see if there are actually any bindIDs in the stack.           */
+    /* Check to see if there are actually any bindIDs in the queue.           */
     /*------------------------------------------------------------------------*/
-    if (neuik_bindingStack_Start  == neuik_bindingStack_Stop)
-    {
-        readBlock = 0;
-        goto out;
-    }
-    else
-    {
-        isValid   = 1;
-        (*bindID) = neuik_bindingStack[neuik_bindingStack_Start];
-        neuik_bindingStack_Start++;
-        if (neuik_bindingStack_Start > N_BINDING_STACK_FINAL)
-        {
-            neuik_bindingStack_Start = 0;
-        }
-        readBlock = 0;
-    }
+    if (SDL_SemTryWait(neuik_bindingQueue_Count) != 0) goto out;
+
+    isValid   = 1;
+    (*bindID) = neuik_BindingQueue_Take();
 out:
     if (eNum != 0)
     {
@@ -323,25 +412,31 @@ out:
  *
  *  Name:          NEUIK_WaitForBindingCallback
  *
- *  Description:   Wait for a valid Binding ID to be poped from the Binding 
- *                 Callback stack.
+ *  Description:   Block until a Binding ID is available in the Binding 
+ *                 Callback queue and then pop it.
+ *
+ *                 The calling thread sleeps on a semaphore and is woken as
+ *                 soon as a binding is pushed; `msSleep` is no longer used
+ *                 but is kept for API compatibility. The queue is created by
+ *                 NEUIK_Init(); this must not be called before it.
  *
- *  Returns:       The Binding ID that was popped from the stack.
+ *  Returns:       The Binding ID that was popped from the queue (0 if NEUIK
+ *                 has not been initialized).
  *
  ******************************************************************************/
 unsigned int NEUIK_WaitForBindingCallback(
     unsigned int msSleep)
 {
-    unsigned int bindID;
+    (void)msSleep;
 
-    for (;;)
+    if (neuik_bindingQueue_Count == NULL)
     {
-        if (NEUIK_PopBindingCallbackFromStack(&bindID))
-        {
-            return bindID;
-        }
-        SDL_Delay(msSleep);
+        return 0;
     }
+
+    while (SDL_SemWait(neuik_bindingQueue_Count) != 0);
+
+    return neuik_BindingQueue_Take();
 }
 
 
@@ -102,6 +102,7 @@ int neuik_RegisterClass_Canvas()
         "An element which can be drawn to.", // classDescription
         neuik__Set_NEUIK,                    // classSet
         neuik__Class_Element,                // superClass
+        sizeof(NEUIK_Canvas),                // objSize
         &neuik_Canvas_BaseFuncs,             // baseFuncs
         NULL,                                // classFuncs
         &neuik__Class_Canvas))               // newClass
@@ -155,7 +156,8 @@ int neuik_Object_New__Canvas(
         eNum = 1;
         goto out;
     }
-    (*cnvsPtr) = (NEUIK_Canvas*) malloc(sizeof(NEUIK_Canvas));
+    (*cnvsPtr) = (NEUIK_Canvas*) neuik_Object_Alloc(
+        neuik__Class_Canvas, (void**)cnvsPtr);
     cnvs = *cnvsPtr;
     if (cnvs == NULL)
     {
@@ -310,7 +312,7 @@ int neuik_Object_Free__Canvas(
         goto out;
     }
 
-    free(cnvs);
+    neuik_Object_Release(cnvs);
 out:
     if (eNum > 0)
     {
@@ -577,7 +579,7 @@ int neuik_Element_Render__Canvas(
                     rect.w = textW;
                     rect.h = textH;
                     SDL_RenderCopy(rend, tTex, NULL, &rect);
-                    ConditionallyDestroyTexture(&tTex);
+                    neuik_TexturePool_Release(rend, &tTex);
                     break;
                     //
                 case NEUIK_CANVAS_OP_DRAWTEXTLARGE:
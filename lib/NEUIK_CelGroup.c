@@ -108,6 +108,7 @@ int neuik_RegisterClass_CelGroup()
         "all elements layered on top of each other.", // classDescription
         neuik__Set_NEUIK,                             // classSet
         neuik__Class_Container,                       // superClass
+        sizeof(NEUIK_CelGroup),                       // objSize
         &neuik_CelGroup_BaseFuncs,                    // baseFuncs
         NULL,                                         // classFuncs
         &neuik__Class_CelGroup))                      // newClass
@@ -167,7 +168,8 @@ int neuik_Object_New__CelGroup(
         eNum = 1;
         goto out;
     }
-    (*objPtr) = (NEUIK_CelGroup*) malloc(sizeof(NEUIK_CelGroup));
+    (*objPtr) = (NEUIK_CelGroup*) neuik_Object_Alloc(
+        neuik__Class_CelGroup, (void**)objPtr);
     cg = *objPtr;
     if (cg == NULL)
     {
@@ -284,7 +286,7 @@ int neuik_Object_Free__CelGroup(
         goto out;
     }
 
-    free(cg);
+    neuik_Object_Release(cg);
 out:
     if (eNum > 0)
     {
@@ -105,6 +105,7 @@ int neuik_RegisterClass_ComboBox()
         "A GUI button which toggles a dropdown menu.", // classDescription
         neuik__Set_NEUIK,                              // classSet
         neuik__Class_Element,                          // superClass
+        sizeof(NEUIK_ComboBox),                        // objSize
         &neuik_ComboBox_BaseFuncs,                     // baseFuncs
         NULL,                                          // classFuncs
         &neuik__Class_ComboBox))                       // newClass
@@ -155,7 +156,8 @@ int neuik_Object_New__ComboBox(
         goto out;
     }
 
-    (*cbPtr) = (NEUIK_ComboBox*) malloc(sizeof(NEUIK_ComboBox));
+    (*cbPtr) = (NEUIK_ComboBox*) neuik_Object_Alloc(
+        neuik__Class_ComboBox, (void**)cbPtr);
     cb = *cbPtr;
     if (cb == NULL)
     {
@@ -295,7 +297,7 @@ int neuik_Object_Free__ComboBox(
         goto out;
     }
 
-    free(cb);
+    neuik_Object_Release(cb);
 out:
     if (eNum > 0)
     {
@@ -899,7 +901,7 @@ out:
         if (!mock) eBase->eSt.doRedraw = 0;
     }
 
-    ConditionallyDestroyTexture(&tTex);
+    neuik_TexturePool_Release(rend, &tTex);
     if (maskMap != NULL) neuik_Object_Free(maskMap);
 
     if (eNum > 0)
@@ -78,6 +78,7 @@ int neuik_RegisterClass_ComboBoxConfig()
         "Configuration for the ComboBox Object.", // classDescription
         neuik__Set_NEUIK,                         // classSet
         NULL,                                     // superClass
+        sizeof(NEUIK_ComboBoxConfig),             // objSize
         &neuik_ComboBoxConfig_BaseFuncs,          // baseFuncs
         NULL,                                     // classFuncs
         &neuik__Class_ComboBoxConfig))            // newClass
@@ -225,7 +226,8 @@ int NEUIK_NewComboBoxConfig(
         goto out;
     }
 
-    (*cfgPtr) = (NEUIK_ComboBoxConfig*) malloc(sizeof(NEUIK_ComboBoxConfig));
+    (*cfgPtr) = (NEUIK_ComboBoxConfig*) neuik_Object_Alloc(
+        neuik__Class_ComboBoxConfig, (void**)cfgPtr);
     cfg = (*cfgPtr);
     if (cfg == NULL)
     {
@@ -397,7 +399,7 @@ int NEUIK_ComboBoxConfig_Free(
     /*------------------------------------------------------------------------*/
     if (cfg->fontName != NULL) free(cfg->fontName);
 
-    free(cfg);
+    neuik_Object_Release(cfg);
 out:
     if (eNum > 0)
     {
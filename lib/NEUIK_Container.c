@@ -96,6 +96,7 @@ int neuik_RegisterClass_Container()
         "This Element may contain one or more Elements.", // classDescription
         neuik__Set_NEUIK,                                 // classSet
         neuik__Class_Element,                             // superClass
+        sizeof(NEUIK_Container),                          // objSize
         &neuik_Container_BaseFuncs,                       // baseFuncs
         NULL,                                             // classFuncs XXXXX
         &neuik__Class_Container))                         // newClass
@@ -181,7 +182,8 @@ int neuik_Object_New__Container(
         eNum = 1;
         goto out;
     }
-    (*contPtr) = (NEUIK_Container*) malloc(sizeof(NEUIK_Container));
+    (*contPtr) = (NEUIK_Container*) neuik_Object_Alloc(
+        neuik__Class_Container, (void**)contPtr);
     cont = *contPtr;
     if (cont == NULL)
     {
@@ -294,7 +296,7 @@ int neuik_Object_Free__Container(
         }
     }
 
-    free(cont);
+    neuik_Object_Release(cont);
 out:
     if (eNum > 0)
     {
@@ -23,6 +23,7 @@
 #include "NEUIK_colors.h"
 #include "NEUIK_error.h"
 #include "NEUIK_render.h"
+#include "NEUIK_Profile_internal.h"
 #include "NEUIK_structs_basic.h"
 #include "NEUIK_Event.h"
 #include "NEUIK_Window.h"
@@ -35,6 +36,7 @@
 
 extern int neuik__isInitialized;
 extern int neuik__Report_Debug;
+extern float neuik__HighDPI_Scaling;
 
 /*----------------------------------------------------------------------------*/
 /* Internal Function Prototypes                                               */
@@ -45,6 +47,10 @@ int neuik_Object_Free__Element(void * elemPtr);
 int neuik_NewElement(NEUIK_Element ** elemPtr);
 int neuik_Element_Free(NEUIK_Element ** elemPtr);
 
+static int neuik_Element_RenderLayer(NEUIK_Element elem, 
+    NEUIK_ElementBase * eBase, RenderSize * rSize, RenderLoc * rlMod, 
+    SDL_Renderer * xRend);
+
 /*----------------------------------------------------------------------------*/
 /* neuik_Object    Function Table                                             */
 /*----------------------------------------------------------------------------*/
@@ -59,7 +65,7 @@ neuik_Class_BaseFuncs  neuik_Element_BaseFuncs = {
     neuik_Object_Free__Element,
 };
 
-#define NEUIK_DEFAULT_BACKGROUNDCONFIG {NEUIK_BGSTYLE_SOLID, COLOR_LLGRAY, 'v', NULL}
+#define NEUIK_DEFAULT_BACKGROUNDCONFIG {NEUIK_BGSTYLE_SOLID, COLOR_LLGRAY, 'v', NULL, NULL}
 
 NEUIK_ElementBackground neuik_default_ElementBackground = {
     NEUIK_DEFAULT_BACKGROUNDCONFIG, /* config for when element is unselected */
@@ -85,6 +91,7 @@ NEUIK_ElementConfig neuik_default_ElementConfig = {
     -1,                     /* Minimum Height */
     -1,                     /* Maximum Height */
      1,                     /* Element is being shown */
+     0,                     /* Element is not kept as a retained layer */
 };
 
 NEUIK_ElementState neuik_default_ElementState = {
@@ -108,9 +115,85 @@ NEUIK_ElementState neuik_default_ElementState = {
     {NEUIK_INVALID_SIZE, NEUIK_INVALID_SIZE}, /* Minimum size of the element (previous frame) */
     NEUIK_MINSIZE_NOCHANGE,                   /* How min elem width changed */
     NEUIK_MINSIZE_NOCHANGE,                   /* How min elem height changed */
+    NULL,                                     /* (SDL_Texture *)  cached unrotated render */
+    NULL,                                     /* (SDL_Renderer *) owner of the cached render */
+    {0, 0},                                   /* loc. the cached render was laid out at */
+    NULL,                                     /* (SDL_Texture *)  retained layer render */
+    NULL,                                     /* (SDL_Renderer *) owner of the layer render */
+    {0, 0},                                   /* loc. the layer render was laid out at */
+    0,                                        /* layer memory charged to the budget */
 };
 
 
+/*----------------------------------------------------------------------------*/
+/* Retained layers                                                            */
+/*                                                                            */
+/* The textures of all elements in `Layer` mode are charged against a single  */
+/* memory budget; an element whose layer does not fit is rendered directly.   */
+/*----------------------------------------------------------------------------*/
+static size_t neuik_Layer_BytesInUse = 0;
+static size_t neuik_Layer_Budget     = 64*1024*1024;
+
+
+/*----------------------------------------------------------------------------*/
+/* Destroy the retained layer of an element and return its memory to the      */
+/* layer budget.                                                              */
+/*----------------------------------------------------------------------------*/
+static void neuik_Element_ReleaseLayer(
+    NEUIK_ElementBase * eBase)
+{
+    neuik_TextureSlot_Clear(&(eBase->eSt.layerTex));
+    if (eBase->eSt.layerBytes > neuik_Layer_BytesInUse)
+    {
+        eBase->eSt.layerBytes = neuik_Layer_BytesInUse;
+    }
+    neuik_Layer_BytesInUse -= eBase->eSt.layerBytes;
+    eBase->eSt.layerBytes   = 0;
+    eBase->eSt.layerRend    = NULL;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_SetLayerMemoryBudget
+ *
+ *  Description:   Set the total number of bytes which may be used by the 
+ *                 retained layer textures of elements in `Layer` mode. When a
+ *                 budget is lowered, layers in excess of it are released as 
+ *                 their elements are next rendered.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_SetLayerMemoryBudget(
+    size_t nBytes)
+{
+    neuik_Layer_Budget = nBytes;
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_GetLayerMemoryUsage
+ *
+ *  Description:   Get the number of bytes currently used by retained layer
+ *                 textures and the budget they are limited to. Either output
+ *                 argument may be NULL.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_GetLayerMemoryUsage(
+    size_t * inUse,
+    size_t * budget)
+{
+    if (inUse  != NULL) *inUse  = neuik_Layer_BytesInUse;
+    if (budget != NULL) *budget = neuik_Layer_Budget;
+    return 0;
+}
+
+
 /*******************************************************************************
  *
  *  Name:          neuik_RegisterClass_Element
@@ -143,6 +226,7 @@ int neuik_RegisterClass_Element()
         "The basic NEUIK_Object Class.", // classDescription
         neuik__Set_NEUIK,                // classSet
         NULL,                            // superClass
+        sizeof(NEUIK_ElementBase),       // objSize
         &neuik_Element_BaseFuncs,        // baseFuncs
         NULL,                            // classFuncs XXXXX
         &neuik__Class_Element))          // newClass
@@ -189,7 +273,8 @@ int neuik_Object_New__Element(
         eNum = 1;
         goto out;
     }
-    (*elemPtr) = (NEUIK_Element*) malloc(sizeof(NEUIK_ElementBase));
+    (*elemPtr) = (NEUIK_Element*) neuik_Object_Alloc(
+        neuik__Class_Element, (void**)elemPtr);
     elem = (NEUIK_ElementBase*)(*elemPtr);
     if (elem == NULL)
     {
@@ -295,7 +380,12 @@ int neuik_Object_Free__Element(
         goto out;
     }
 
-    free(eBase);
+    neuik_TextureSlot_Clear(&(eBase->eSt.rotTex));
+    neuik_Element_ReleaseLayer(eBase);
+    free(eBase->eBg.modeNormal.grad_lut);
+    free(eBase->eBg.modeSelected.grad_lut);
+    free(eBase->eBg.modeHover.grad_lut);
+    neuik_Object_Release(eBase);
 out:
     if (eNum > 0)
     {
@@ -324,207 +414,208 @@ NEUIK_ElementConfig neuik_GetDefaultElementConfig()
     return neuik_default_ElementConfig;
 }
 
-void neuik_Element_Configure_capture_segv(
-    int sig_num)
+/*----------------------------------------------------------------------------*/
+/* Configuration key names, indexed by NEUIK_ElementConfigKey.                */
+/*----------------------------------------------------------------------------*/
+static const char * neuik_ElementConfigKey_Names[] = {
+    "FillAll",
+    "HFill",
+    "VFill",
+    "Show",
+    "Layer",
+    "HScale",
+    "VScale",
+    "HJustify",
+    "VJustify",
+    "PadLeft",
+    "PadRight",
+    "PadTop",
+    "PadBottom",
+    "PadAll",
+};
+
+#define NEUIK_ELEMENTCFG_NBOOLS 5 /* the first five keys are bool types */
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_ElementConfigKey_Lookup
+ *
+ *  Description:   Resolve the (not necessarily NULL terminated) name of an
+ *                 element configuration setting.
+ *
+ *                 The length of the name together with its first character
+ *                 (and, for the six character `Pad` names, its fourth) selects
+ *                 a single candidate key; only that candidate is compared.
+ *
+ *  Returns:       The matching key; NEUIK_ELEMENTCFG_INVALID if unknown.
+ *
+ ******************************************************************************/
+static NEUIK_ElementConfigKey neuik_ElementConfigKey_Lookup(
+    const char * name,
+    size_t       nameLen)
 {
-    static char funcName[] = "NEUIK_Element_Configure";
-    static char errMsg[] =
-        "SIGSEGV (segmentation fault) captured; is call `NULL` terminated?";
+    NEUIK_ElementConfigKey key = NEUIK_ELEMENTCFG_INVALID;
 
-    NEUIK_RaiseError(funcName, errMsg);
-    NEUIK_BacktraceErrors();
-    exit(1);
+    switch (nameLen)
+    {
+        case 4:
+            if (name[0] == 'S') key = NEUIK_ELEMENTCFG_SHOW;
+            break;
+        case 5:
+            switch (name[0])
+            {
+                case 'H': key = NEUIK_ELEMENTCFG_HFILL; break;
+                case 'V': key = NEUIK_ELEMENTCFG_VFILL; break;
+                case 'L': key = NEUIK_ELEMENTCFG_LAYER; break;
+            }
+            break;
+        case 6:
+            switch (name[0])
+            {
+                case 'H': key = NEUIK_ELEMENTCFG_HSCALE; break;
+                case 'V': key = NEUIK_ELEMENTCFG_VSCALE; break;
+                case 'P':
+                    if      (name[3] == 'T') key = NEUIK_ELEMENTCFG_PADTOP;
+                    else if (name[3] == 'A') key = NEUIK_ELEMENTCFG_PADALL;
+                    break;
+            }
+            break;
+        case 7:
+            switch (name[0])
+            {
+                case 'F': key = NEUIK_ELEMENTCFG_FILLALL; break;
+                case 'P': key = NEUIK_ELEMENTCFG_PADLEFT; break;
+            }
+            break;
+        case 8:
+            switch (name[0])
+            {
+                case 'H': key = NEUIK_ELEMENTCFG_HJUSTIFY; break;
+                case 'V': key = NEUIK_ELEMENTCFG_VJUSTIFY; break;
+                case 'P': key = NEUIK_ELEMENTCFG_PADRIGHT; break;
+            }
+            break;
+        case 9:
+            if (name[0] == 'P') key = NEUIK_ELEMENTCFG_PADBOTTOM;
+            break;
+    }
+
+    if (key == NEUIK_ELEMENTCFG_INVALID ||
+        memcmp(neuik_ElementConfigKey_Names[key], name, nameLen))
+    {
+        return NEUIK_ELEMENTCFG_INVALID;
+    }
+    return key;
 }
 
 
 /*******************************************************************************
  *
- *  Name:          NEUIK_Element_Configure
+ *  Name:          NEUIK_ElementConfigKey_FromName
  *
- *  Description:   Configure one or more settings for an element.
+ *  Description:   Resolve the name of an element configuration setting (e.g.,
+ *                 "HFill") to a key which may be used with
+ *                 NEUIK_Element_ConfigureItems(). This only needs to be done
+ *                 once per setting.
  *
- *                 NOTE: This list of settings must be terminated by a NULL
- *                 pointer.
+ *  Returns:       The matching key; NEUIK_ELEMENTCFG_INVALID if unknown.
+ *
+ ******************************************************************************/
+NEUIK_ElementConfigKey NEUIK_ElementConfigKey_FromName(
+    const char * name)
+{
+    if (name == NULL || name[0] == 0) return NEUIK_ELEMENTCFG_INVALID;
+
+    return neuik_ElementConfigKey_Lookup(name, strlen(name));
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_Element_ConfigureItems
+ *
+ *  Description:   Apply a batch of pre-resolved configuration settings to an
+ *                 element. However many settings change, the element requests
+ *                 at most one redraw (and one min-size propagation).
  *
  *  Returns:       1 if there is an error; 0 otherwise.
  *
  ******************************************************************************/
-int NEUIK_Element_Configure(
-    NEUIK_Element   elem,
-    const char    * set0,
-    ...)
+int NEUIK_Element_ConfigureItems(
+    NEUIK_Element                   elem,
+    const NEUIK_ElementConfigItem * items,
+    int                             nItems)
 {
     int                   ctr;
-    int                   nCtr;
-    int                   isBool;
-    int                   boolVal    = 0;
+    int                   eNum       = 0; /* which error to report (if any) */
     int                   doRedraw   = 0;
     int                   fullRedraw = 0;
     int                   intVal     = 0;
-    int                   typeMixup;
     RenderSize            rSize;
     RenderLoc             rLoc;
-    va_list               args;
-    char                * strPtr     = NULL;
-    char                * name       = NULL;
-    char                * value      = NULL;
-    const char          * set        = NULL;
-    char                  buf[4096];
     NEUIK_ElementBase   * eBase      = NULL;
     NEUIK_ElementConfig * eCfg       = NULL;
-    /*------------------------------------------------------------------------*/
-    /* If a `name=value` string with an unsupported name is found, check to   */
-    /* see if a boolName was mistakenly used instead.                         */
-    /*------------------------------------------------------------------------*/
-    static char         * boolNames[] = {
-        "FillAll",
-        "HFill",
-        "VFill",
-        "Show",
-        NULL,
-    };
-    /*------------------------------------------------------------------------*/
-    /* If a boolName string with an unsupported name is found, check to see   */
-    /* if a supported nameValue type was mistakenly used instead.             */
-    /*------------------------------------------------------------------------*/
-    static char         * valueNames[] = {
-        "HScale",
-        "VScale",
-        "HJustify",
-        "VJustify",
-        "PadLeft",
-        "PadRight",
-        "PadTop",
-        "PadBottom",
-        "PadAll",
-        NULL,
-    };
-    static char           funcName[] = "NEUIK_Element_Configure";
-    static char         * errMsgs[] = {"", // [ 0] no error
-        "Argument `elem` caused `neuik_Object_GetClassObject` to fail.",   // [ 1]
-        "NamedSet.name is NULL, skipping.",                                // [ 2]
-        "NamedSet.name is blank, skipping.",                               // [ 3]
-        "NamedSet.name type unknown, skipping.",                           // [ 4]
-        "`name=value` string is too long.",                                // [ 5]
-        "Set string is empty.",                                            // [ 6]
-        "HJustify value is invalid.",                                      // [ 7]
-        "VJustify value is invalid.",                                      // [ 8]
-        "BoolType name unknown, skipping.",                                // [ 9]
-        "Invalid `name=value` string.",                                    // [10]
-        "ValueType name used as BoolType, skipping.",                      // [11]
-        "BoolType name used as ValueType, skipping.",                      // [12]
-        "Failure in `neuik_Window_RequestFullRedraw()`.",                  // [13]
-        "Failure in `neuik_Element_PropagateIndeterminateMinSizeDelta()`", // [14]
+    static char           funcName[] = "NEUIK_Element_ConfigureItems";
+    static char         * errMsgs[]  = {"", // [0] no error
+        "Argument `elem` caused `neuik_Object_GetClassObject` to fail.",   // [1]
+        "Argument `items` is NULL.",                                       // [2]
+        "Configuration key is invalid, skipping.",                         // [3]
+        "HJustify value is invalid.",                                      // [4]
+        "VJustify value is invalid.",                                      // [5]
+        "Failure in `neuik_Window_RequestFullRedraw()`.",                  // [6]
+        "Failure in `neuik_Element_PropagateIndeterminateMinSizeDelta()`", // [7]
     };
 
     if (neuik_Object_GetClassObject(elem, neuik__Class_Element, (void**)&eBase))
     {
-        NEUIK_RaiseError(funcName, errMsgs[1]);
-        return 1;
+        eNum = 1;
+        goto out;
+    }
+    if (items == NULL && nItems > 0)
+    {
+        eNum = 2;
+        goto out;
     }
-
-    set = set0;
 
     eCfg = neuik_Element_GetConfig(eBase);
 
-    va_start(args, set0);
-
-    for (ctr = 0;; ctr++)
+    for (ctr = 0; ctr < nItems; ctr++)
     {
-        isBool = 0;
-        name   = NULL;
-        value  = NULL;
-
-        if (set == NULL) break;
-
-        #ifndef NO_NEUIK_SIGNAL_TRAPPING
-            signal(SIGSEGV, neuik_Element_Configure_capture_segv);
-        #endif
-
-        if (strlen(set) > 4095)
-        {
-            #ifndef NO_NEUIK_SIGNAL_TRAPPING
-                signal(SIGSEGV, NULL);
-            #endif
-            NEUIK_RaiseError(funcName, errMsgs[5]);
-            set = va_arg(args, const char *);
-            continue;
-        }
-        else
-        {
-            #ifndef NO_NEUIK_SIGNAL_TRAPPING
-                signal(SIGSEGV, NULL);
-            #endif
-            strcpy(buf, set);
-            /* Find the equals and set it to '\0' */
-            strPtr = strchr(buf, '=');
-            if (strPtr == NULL)
-            {
-                /*------------------------------------------------------------*/
-                /* Bool type configuration (or a mistake)                     */
-                /*------------------------------------------------------------*/
-                if (buf[0] == 0)
-                {
-                    NEUIK_RaiseError(funcName, errMsgs[6]);
-                }
-
-                isBool  = 1;
-                boolVal = 1;
-                name    = buf;
-                if (buf[0] == '!')
-                {
-                    boolVal = 0;
-                    name    = buf + 1;
-                }
-            }
-            else
-            {
-                *strPtr = 0;
-                strPtr++;
-                if (*strPtr == 0)
-                {
-                    /* `name=value` string is missing a value */
-                    NEUIK_RaiseError(funcName, errMsgs[10]);
-                    set = va_arg(args, const char *);
-                    continue;
-                }
-                name  = buf;
-                value = strPtr;
-            }
-        }
+        intVal = items[ctr].intVal;
 
-        if (isBool)
+        switch (items[ctr].key)
         {
-            if (!strcmp("VFill", name))
-            {
-                if (eCfg->VFill != boolVal)
+            case NEUIK_ELEMENTCFG_FILLALL:
+                intVal = (intVal != 0);
+                if (eCfg->HFill != intVal || eCfg->VFill != intVal)
                 {
-                    eCfg->VFill = boolVal;
+                    eCfg->HFill = intVal;
+                    eCfg->VFill = intVal;
                     doRedraw = 1;
                 }
-            }
-            else if (!strcmp("HFill", name))
-            {
-                if (eCfg->HFill != boolVal)
+                break;
+            case NEUIK_ELEMENTCFG_HFILL:
+                intVal = (intVal != 0);
+                if (eCfg->HFill != intVal)
                 {
-                    eCfg->HFill = boolVal;
+                    eCfg->HFill = intVal;
                     doRedraw = 1;
                 }
-            }
-            else if (!strcmp("FillAll", name))
-            {
-                if (eCfg->HFill != boolVal || eCfg->VFill != boolVal)
+                break;
+            case NEUIK_ELEMENTCFG_VFILL:
+                intVal = (intVal != 0);
+                if (eCfg->VFill != intVal)
                 {
-                    eCfg->HFill = boolVal;
-                    eCfg->VFill = boolVal;
+                    eCfg->VFill = intVal;
                     doRedraw = 1;
                 }
-            }
-            else if (!strcmp("Show", name))
-            {
-                if (eCfg->Show != boolVal)
+                break;
+            case NEUIK_ELEMENTCFG_SHOW:
+                intVal = (intVal != 0);
+                if (eCfg->Show != intVal)
                 {
-                    eCfg->Show = boolVal;
+                    eCfg->Show = intVal;
                     doRedraw   = 1;
                     /*--------------------------------------------------------*/
                     /* Showing/hiding elements can result in drastic changes  */
@@ -533,170 +624,83 @@ int NEUIK_Element_Configure(
                     /*--------------------------------------------------------*/
                     fullRedraw = 1;
                 }
-            }
-            else
-            {
-                typeMixup = 0;
-                for (nCtr = 0;; nCtr++)
-                {
-                    if (valueNames[nCtr] == NULL) break;
-
-                    if (!strcmp(valueNames[nCtr], name))
-                    {
-                        typeMixup = 1;
-                        break;
-                    }
-                }
-
-                if (typeMixup)
-                {
-                    /* A value type was mistakenly used as a bool type */
-                    NEUIK_RaiseError(funcName, errMsgs[11]);
-                }
-                else
+                break;
+            case NEUIK_ELEMENTCFG_LAYER:
+                intVal = (intVal != 0);
+                if (eCfg->Layer != intVal)
                 {
-                    /* An unsupported name was used as a bool type */
-                    NEUIK_RaiseError(funcName, errMsgs[9]);
+                    eCfg->Layer = intVal;
+                    if (!intVal) neuik_Element_ReleaseLayer(eBase);
+                    doRedraw = 1;
                 }
-            }
-        }
-        else
-        {
-            if (name == NULL)
-            {
-                NEUIK_RaiseError(funcName, errMsgs[2]);
-            }
-            else if (name[0] == 0)
-            {
-                NEUIK_RaiseError(funcName, errMsgs[3]);
-            }
-            else if (!strcmp("VScale", name))
-            {
-                eCfg->VScale = (float)(atof(value));
+                break;
+            case NEUIK_ELEMENTCFG_HSCALE:
+                eCfg->HScale = items[ctr].floatVal;
                 doRedraw = 1;
-            }
-            else if (!strcmp("HScale", name))
-            {
-                eCfg->HScale = (float)(atof(value));
+                break;
+            case NEUIK_ELEMENTCFG_VSCALE:
+                eCfg->VScale = items[ctr].floatVal;
                 doRedraw = 1;
-            }
-            else if (!strcmp("HJustify", name))
-            {
-                if (!strcmp("left", value))
-                {
-                    if (eCfg->HJustify != NEUIK_HJUSTIFY_LEFT)
-                    {
-                        eCfg->HJustify = NEUIK_HJUSTIFY_LEFT;
-                        doRedraw = 1;
-                    }
-                }
-                else if (!strcmp("center", value))
-                {
-                    if (eCfg->HJustify != NEUIK_HJUSTIFY_CENTER)
-                    {
-                        eCfg->HJustify = NEUIK_HJUSTIFY_CENTER;
-                        doRedraw = 1;
-                    }
-                }
-                else if (!strcmp("right", value))
-                {
-                    if (eCfg->HJustify != NEUIK_HJUSTIFY_RIGHT)
-                    {
-                        eCfg->HJustify = NEUIK_HJUSTIFY_RIGHT;
-                        doRedraw = 1;
-                    }
-                }
-                else if (!strcmp("default", value))
-                {
-                    if (eCfg->HJustify != NEUIK_HJUSTIFY_DEFAULT)
-                    {
-                        eCfg->HJustify = NEUIK_HJUSTIFY_DEFAULT;
-                        doRedraw = 1;
-                    }
-                }
-                else
-                {
-                    NEUIK_RaiseError(funcName, errMsgs[7]);
-                }
-            }
-            else if (!strcmp("VJustify", name))
-            {
-                if (!strcmp("top", value))
-                {
-                    if (eCfg->VJustify != NEUIK_VJUSTIFY_TOP)
-                    {
-                        eCfg->VJustify = NEUIK_VJUSTIFY_TOP;
-                        doRedraw = 1;
-                    }
-                }
-                else if (!strcmp("center", value))
+                break;
+            case NEUIK_ELEMENTCFG_HJUSTIFY:
+                if (intVal != NEUIK_HJUSTIFY_DEFAULT &&
+                    intVal != NEUIK_HJUSTIFY_LEFT    &&
+                    intVal != NEUIK_HJUSTIFY_CENTER  &&
+                    intVal != NEUIK_HJUSTIFY_RIGHT)
                 {
-                    if (eCfg->VJustify != NEUIK_VJUSTIFY_CENTER)
-                    {
-                        eCfg->VJustify = NEUIK_VJUSTIFY_CENTER;
-                        doRedraw = 1;
-                    }
+                    NEUIK_RaiseError(funcName, errMsgs[4]);
+                    eNum = -1;
                 }
-                else if (!strcmp("bottom", value))
+                else if (eCfg->HJustify != intVal)
                 {
-                    if (eCfg->VJustify != NEUIK_VJUSTIFY_BOTTOM)
-                    {
-                        eCfg->VJustify = NEUIK_VJUSTIFY_BOTTOM;
-                        doRedraw = 1;
-                    }
+                    eCfg->HJustify = intVal;
+                    doRedraw = 1;
                 }
-                else if (!strcmp("default", value))
+                break;
+            case NEUIK_ELEMENTCFG_VJUSTIFY:
+                if (intVal != NEUIK_VJUSTIFY_DEFAULT &&
+                    intVal != NEUIK_VJUSTIFY_TOP     &&
+                    intVal != NEUIK_VJUSTIFY_CENTER  &&
+                    intVal != NEUIK_VJUSTIFY_BOTTOM)
                 {
-                    if (eCfg->VJustify != NEUIK_VJUSTIFY_DEFAULT)
-                    {
-                        eCfg->VJustify = NEUIK_VJUSTIFY_DEFAULT;
-                        doRedraw = 1;
-                    }
+                    NEUIK_RaiseError(funcName, errMsgs[5]);
+                    eNum = -1;
                 }
-                else
+                else if (eCfg->VJustify != intVal)
                 {
-                    NEUIK_RaiseError(funcName, errMsgs[8]);
+                    eCfg->VJustify = intVal;
+                    doRedraw = 1;
                 }
-            }
-            else if (!strcmp("PadLeft", name))
-            {
-                intVal = atoi(value);
+                break;
+            case NEUIK_ELEMENTCFG_PADLEFT:
                 if (eCfg->PadLeft != intVal)
                 {
                     eCfg->PadLeft = intVal;
                     doRedraw = 1;
                 }
-            }
-            else if (!strcmp("PadRight", name))
-            {
-                intVal = atoi(value);
+                break;
+            case NEUIK_ELEMENTCFG_PADRIGHT:
                 if (eCfg->PadRight != intVal)
                 {
                     eCfg->PadRight = intVal;
                     doRedraw = 1;
                 }
-            }
-            else if (!strcmp("PadTop", name))
-            {
-                intVal = atoi(value);
+                break;
+            case NEUIK_ELEMENTCFG_PADTOP:
                 if (eCfg->PadTop != intVal)
                 {
                     eCfg->PadTop = intVal;
                     doRedraw = 1;
                 }
-            }
-            else if (!strcmp("PadBottom", name))
-            {
-                intVal = atoi(value);
+                break;
+            case NEUIK_ELEMENTCFG_PADBOTTOM:
                 if (eCfg->PadBottom != intVal)
                 {
                     eCfg->PadBottom = intVal;
                     doRedraw = 1;
                 }
-            }
-            else if (!strcmp("PadAll", name))
-            {
-                intVal = atoi(value);
+                break;
+            case NEUIK_ELEMENTCFG_PADALL:
                 if (eCfg->PadLeft   != intVal ||
                     eCfg->PadRight  != intVal ||
                     eCfg->PadTop    != intVal ||
@@ -708,39 +712,13 @@ int NEUIK_Element_Configure(
                     eCfg->PadBottom = intVal;
                     doRedraw = 1;
                 }
-
-            }
-            else
-            {
-                typeMixup = 0;
-                for (nCtr = 0;; nCtr++)
-                {
-                    if (boolNames[nCtr] == NULL) break;
-
-                    if (!strcmp(boolNames[nCtr], name))
-                    {
-                        typeMixup = 1;
-                        break;
-                    }
-                }
-
-                if (typeMixup)
-                {
-                    /* A bool type was mistakenly used as a value type */
-                    NEUIK_RaiseError(funcName, errMsgs[12]);
-                }
-                else
-                {
-                    /* An unsupported name was used as a value type */
-                    NEUIK_RaiseError(funcName, errMsgs[4]);
-                }
-            }
+                break;
+            default:
+                NEUIK_RaiseError(funcName, errMsgs[3]);
+                eNum = -1;
+                break;
         }
-
-        /* before starting */
-        set = va_arg(args, const char *);
     }
-    va_end(args);
 
     if (doRedraw)
     {
@@ -751,20 +729,257 @@ int NEUIK_Element_Configure(
                 if (neuik_Element_PropagateIndeterminateMinSizeDelta(
                     eBase->eSt.parent))
                 {
-                    NEUIK_RaiseError(funcName, errMsgs[14]);
+                    eNum = 7;
+                    goto out;
                 }
             }
 
             if (neuik_Window_RequestFullRedraw((NEUIK_Window*)eBase->eSt.window))
             {
-                NEUIK_RaiseError(funcName, errMsgs[13]);
+                eNum = 6;
+                goto out;
             }
         }
         rSize = eBase->eSt.rSize;
         rLoc  = eBase->eSt.rLoc;
         neuik_Element_RequestRedraw(elem, rLoc, rSize);
     }
-
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+    }
+    if (eNum != 0) eNum = 1;
+
+    return eNum;
+}
+
+
+void neuik_Element_Configure_capture_segv(
+    int sig_num)
+{
+    static char funcName[] = "NEUIK_Element_Configure";
+    static char errMsg[] =
+        "SIGSEGV (segmentation fault) captured; is call `NULL` terminated?";
+
+    NEUIK_RaiseError(funcName, errMsg);
+    NEUIK_BacktraceErrors();
+    exit(1);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_Element_Configure
+ *
+ *  Description:   Configure one or more settings for an element.
+ *
+ *                 The `name=value` strings are resolved to keys and applied
+ *                 as a single batch through NEUIK_Element_ConfigureItems().
+ *
+ *                 NOTE: This list of settings must be terminated by a NULL
+ *                 pointer.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_Element_Configure(
+    NEUIK_Element   elem,
+    const char    * set0,
+    ...)
+{
+    int                     isBool;
+    int                     boolVal    = 0;
+    int                     nItems     = 0;
+    size_t                  nameLen    = 0;
+    va_list                 args;
+    const char            * name       = NULL;
+    const char            * value      = NULL;
+    const char            * set        = NULL;
+    NEUIK_ElementBase     * eBase      = NULL;
+    NEUIK_ElementConfigKey  key;
+    NEUIK_ElementConfigItem items[32];
+    static char             funcName[] = "NEUIK_Element_Configure";
+    static char           * errMsgs[]  = {"", // [ 0] no error
+        "Argument `elem` caused `neuik_Object_GetClassObject` to fail.", // [ 1]
+        "NamedSet.name is blank, skipping.",                             // [ 2]
+        "NamedSet.name type unknown, skipping.",                         // [ 3]
+        "Set string is empty.",                                          // [ 4]
+        "HJustify value is invalid.",                                    // [ 5]
+        "VJustify value is invalid.",                                    // [ 6]
+        "BoolType name unknown, skipping.",                              // [ 7]
+        "Invalid `name=value` string.",                                  // [ 8]
+        "ValueType name used as BoolType, skipping.",                    // [ 9]
+        "BoolType name used as ValueType, skipping.",                    // [10]
+        "Failure in `NEUIK_Element_ConfigureItems()`.",                  // [11]
+    };
+
+    if (neuik_Object_GetClassObject(elem, neuik__Class_Element, (void**)&eBase))
+    {
+        NEUIK_RaiseError(funcName, errMsgs[1]);
+        return 1;
+    }
+
+    set = set0;
+
+    #ifndef NO_NEUIK_SIGNAL_TRAPPING
+        signal(SIGSEGV, neuik_Element_Configure_capture_segv);
+    #endif
+
+    va_start(args, set0);
+
+    for (; set != NULL; set = va_arg(args, const char *))
+    {
+        value = strchr(set, '=');
+        if (value == NULL)
+        {
+            /*----------------------------------------------------------------*/
+            /* Bool type configuration (or a mistake)                         */
+            /*----------------------------------------------------------------*/
+            if (set[0] == 0)
+            {
+                NEUIK_RaiseError(funcName, errMsgs[4]);
+                continue;
+            }
+
+            isBool  = 1;
+            boolVal = 1;
+            name    = set;
+            if (set[0] == '!')
+            {
+                boolVal = 0;
+                name    = set + 1;
+            }
+            nameLen = strlen(name);
+        }
+        else
+        {
+            isBool  = 0;
+            name    = set;
+            nameLen = (size_t)(value - set);
+            value++;
+            if (*value == 0)
+            {
+                /* `name=value` string is missing a value */
+                NEUIK_RaiseError(funcName, errMsgs[8]);
+                continue;
+            }
+            if (nameLen == 0)
+            {
+                NEUIK_RaiseError(funcName, errMsgs[2]);
+                continue;
+            }
+        }
+
+        key = NEUIK_ELEMENTCFG_INVALID;
+        if (nameLen > 0)
+        {
+            key = neuik_ElementConfigKey_Lookup(name, nameLen);
+        }
+
+        if (isBool)
+        {
+            if (key == NEUIK_ELEMENTCFG_INVALID)
+            {
+                /* An unsupported name was used as a bool type */
+                NEUIK_RaiseError(funcName, errMsgs[7]);
+                continue;
+            }
+            else if (key >= NEUIK_ELEMENTCFG_NBOOLS)
+            {
+                /* A value type was mistakenly used as a bool type */
+                NEUIK_RaiseError(funcName, errMsgs[9]);
+                continue;
+            }
+            items[nItems].intVal = boolVal;
+        }
+        else
+        {
+            if (key == NEUIK_ELEMENTCFG_INVALID)
+            {
+                /* An unsupported name was used as a value type */
+                NEUIK_RaiseError(funcName, errMsgs[3]);
+                continue;
+            }
+            else if (key < NEUIK_ELEMENTCFG_NBOOLS)
+            {
+                /* A bool type was mistakenly used as a value type */
+                NEUIK_RaiseError(funcName, errMsgs[10]);
+                continue;
+            }
+
+            items[nItems].intVal   = 0;
+            items[nItems].floatVal = 0.0;
+            switch (key)
+            {
+                case NEUIK_ELEMENTCFG_HSCALE:
+                case NEUIK_ELEMENTCFG_VSCALE:
+                    items[nItems].floatVal = (float)(atof(value));
+                    break;
+                case NEUIK_ELEMENTCFG_HJUSTIFY:
+                    if      (!strcmp("left",    value))
+                        items[nItems].intVal = NEUIK_HJUSTIFY_LEFT;
+                    else if (!strcmp("center",  value))
+                        items[nItems].intVal = NEUIK_HJUSTIFY_CENTER;
+                    else if (!strcmp("right",   value))
+                        items[nItems].intVal = NEUIK_HJUSTIFY_RIGHT;
+                    else if (!strcmp("default", value))
+                        items[nItems].intVal = NEUIK_HJUSTIFY_DEFAULT;
+                    else
+                    {
+                        NEUIK_RaiseError(funcName, errMsgs[5]);
+                        continue;
+                    }
+                    break;
+                case NEUIK_ELEMENTCFG_VJUSTIFY:
+                    if      (!strcmp("top",     value))
+                        items[nItems].intVal = NEUIK_VJUSTIFY_TOP;
+                    else if (!strcmp("center",  value))
+                        items[nItems].intVal = NEUIK_VJUSTIFY_CENTER;
+                    else if (!strcmp("bottom",  value))
+                        items[nItems].intVal = NEUIK_VJUSTIFY_BOTTOM;
+                    else if (!strcmp("default", value))
+                        items[nItems].intVal = NEUIK_VJUSTIFY_DEFAULT;
+                    else
+                    {
+                        NEUIK_RaiseError(funcName, errMsgs[6]);
+                        continue;
+                    }
+                    break;
+                default:
+                    items[nItems].intVal = atoi(value);
+                    break;
+            }
+        }
+        items[nItems].key = key;
+        nItems++;
+
+        if (nItems == 32)
+        {
+            /*----------------------------------------------------------------*/
+            /* A very long list of settings; apply what is stored so far.     */
+            /*----------------------------------------------------------------*/
+            if (NEUIK_Element_ConfigureItems(elem, items, nItems))
+            {
+                NEUIK_RaiseError(funcName, errMsgs[11]);
+            }
+            nItems = 0;
+        }
+    }
+    va_end(args);
+
+    #ifndef NO_NEUIK_SIGNAL_TRAPPING
+        signal(SIGSEGV, NULL);
+    #endif
+
+    if (nItems > 0)
+    {
+        if (NEUIK_Element_ConfigureItems(elem, items, nItems))
+        {
+            NEUIK_RaiseError(funcName, errMsgs[11]);
+        }
+    }
+
     return 0;
 }
 
@@ -786,6 +1001,8 @@ int neuik_Element_GetMinSize(
     RenderSize    * rSize)
 {
     int                  eNum       = 0;
+    int                  result;
+    int                  profiled;        /* if this call is being profiled */
     NEUIK_ElementBase  * eBase      = NULL;
     static int           nRecurse   = 0; /* number of times recursively called */
     static char          funcName[] = "neuik_Element_GetMinSize";
@@ -826,7 +1043,11 @@ int neuik_Element_GetMinSize(
         /* These values should only be invalid if this is the first frame to  */
         /* be drawn. The minSize will need to be calculated.                  */
         /*--------------------------------------------------------------------*/
-        if ((eBase->eFT->GetMinSize)(elem, rSize))
+        profiled = neuik_Profile_Begin(
+            NEUIK_PROFILE_GETMINSIZE, elem, eBase->eSt.window);
+        result = (eBase->eFT->GetMinSize)(elem, rSize);
+        neuik_Profile_End(profiled);
+        if (result)
         {
             if (neuik_HasFatalError())
             {
@@ -857,7 +1078,11 @@ int neuik_Element_GetMinSize(
         /* There is a change to the minimum size of this element. The minSize */
         /* will need to be recalculated.                                      */
         /*--------------------------------------------------------------------*/
-        if ((eBase->eFT->GetMinSize)(elem, rSize))
+        profiled = neuik_Profile_Begin(
+            NEUIK_PROFILE_GETMINSIZE, elem, eBase->eSt.window);
+        result = (eBase->eFT->GetMinSize)(elem, rSize);
+        neuik_Profile_End(profiled);
+        if (result)
         {
             if (neuik_HasFatalError())
             {
@@ -1001,13 +1226,408 @@ int neuik_Element_GetSize(
         eNum = 1;
         goto out;
     }
-    if (rSize == NULL)
+    if (rSize == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+
+    (*rSize) = eBase->eSt.rSize;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+int neuik_Element_GetSizeAndLocation(
+    NEUIK_Element   elem,
+    RenderSize    * rSize,
+    RenderLoc     * rLoc)
+{
+    int                  eNum      = 0;
+    NEUIK_ElementBase  * eBase     = NULL;
+    static char          funcName[] = "neuik_Element_GetSizeAndLocation";
+    static char        * errMsgs[] = {"",                                // [0] no error
+        "Argument `elem` caused `neuik_Object_GetClassObject` to fail.", // [1]
+        "Output argument `rSize` is NULL.",                              // [2]
+        "Output argument `rLoc` is NULL.",                               // [3]
+    };
+
+    if (neuik_Object_GetClassObject(elem, neuik__Class_Element, (void**)&eBase))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (rSize == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (rLoc == NULL)
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    (*rSize) = eBase->eSt.rSize;
+    (*rLoc)  = eBase->eSt.rLoc;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+int
+    NEUIK_Element_SetSize(NEUIK_Element elem, RenderSize * rSize);
+
+
+int neuik_Element_Render(
+    NEUIK_Element   elem,
+    RenderSize    * rSize, /* in/out the size the tex occupies when complete */
+    RenderLoc     * rlMod, /* A relative location modifier (for rendering) */
+    SDL_Renderer  * xRend, /* The external renderer to prepare the texture for */
+    int             mock)  /* If true; calculate sizes/locations but don't draw */
+{
+    int                 result;
+    int                 profiled; /* if this call is being profiled */
+    int                 clipped  = 0; /* if a clip region was pushed */
+    NEUIK_Window      * win      = NULL;
+    NEUIK_ElementBase * eBase;
+
+    if (neuik_Object_GetClassObject(elem, neuik__Class_Element, (void**)&eBase))
+    {
+        return 1;
+    }
+    if (eBase->eFT == NULL) return 1;
+    if (eBase->eFT->Render == NULL) return 1;
+
+    if (!mock && eBase->eSt.window != NULL)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Skip elements which lie completely outside of the visible area.    */
+        /* The element keeps its pending redraw so that it will be drawn once */
+        /* it comes into view.                                                */
+        /*--------------------------------------------------------------------*/
+        win = (NEUIK_Window*)(eBase->eSt.window);
+        if (neuik_Window_IsClipped(win, &eBase->eSt.rLoc, rSize))
+        {
+            win->elemsCulled++;
+            return 0;
+        }
+        win->elemsDrawn++;
+
+        /*--------------------------------------------------------------------*/
+        /* The children of a container are only visible within its bounds.    */
+        /*--------------------------------------------------------------------*/
+        if (neuik_Object_ImplementsClass_NoError(elem, neuik__Class_Container))
+        {
+            neuik_Window_PushClip(win, &eBase->eSt.rLoc, rSize);
+            clipped = 1;
+        }
+    }
+
+    profiled = 0;
+    if (!mock)
+    {
+        profiled = neuik_Profile_Begin(
+            NEUIK_PROFILE_RENDER, elem, eBase->eSt.window);
+    }
+    if (!mock && eBase->eCfg.Layer && SDL_RenderTargetSupported(xRend))
+    {
+        result = neuik_Element_RenderLayer(elem, eBase, rSize, rlMod, xRend);
+    }
+    else
+    {
+        result = (eBase->eFT->Render)(elem, rSize, rlMod, xRend, mock);
+    }
+    neuik_Profile_End(profiled);
+    if (clipped) neuik_Window_PopClip(win);
+    if (result)
+    {
+        return result;
+    }
+    if (!mock)
+    {
+        eBase->eSt.hDelta = NEUIK_MINSIZE_NOCHANGE;
+        eBase->eSt.wDelta = NEUIK_MINSIZE_NOCHANGE;
+    }
+    return result;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Element_UpdateCachedRender
+ *
+ *  Description:   Keep a render of an element within a cached target texture 
+ *                 (`*texSlot`, owned by `*texRend`). The texture is recreated 
+ *                 if it is missing, no longer the correct size or if the 
+ *                 renderer has changed. The element is only rerendered into 
+ *                 the texture when it is new or when the element (or one of 
+ *                 its children) has requested a redraw.
+ *
+ *                 If the texture is reused but the element has since been 
+ *                 placed at another location, its children are relaid out with
+ *                 a mock render so that their stored locations (used by event
+ *                 handling) follow the element.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_Element_UpdateCachedRender(
+    NEUIK_Element       elem,
+    NEUIK_ElementBase * eBase,
+    RenderSize        * rSize,    /* the size of the element */
+    SDL_Renderer      * xRend,    /* The external renderer to prepare the texture for */
+    SDL_Texture      ** texSlot,  /* [in/out] the cached texture */
+    SDL_Renderer     ** texRend,  /* [in/out] the renderer which owns it */
+    RenderLoc         * texLoc)   /* [in/out] the location it was laid out at */
+{
+    int                 texW        = 0;
+    int                 texH        = 0;
+    int                 doRender    = 0;
+    int                 redrawAll   = 0;
+    SDL_Texture       * prevTarget  = NULL;
+    SDL_Texture       * tex         = NULL;
+    RenderLoc           rlTex;     /* loc. modifier to render into the texture */
+    NEUIK_Container   * pCont       = NULL;
+    NEUIK_Window      * win         = (NEUIK_Window*)(eBase->eSt.window);
+    int                 eNum        = 0;
+    static char         funcName[]  = "neuik_Element_UpdateCachedRender";
+    static char       * errMsgs[]   = {"",                             // [0] no error
+        "Failure in `SDL_CreateTexture()`.",                        // [1]
+        "Failure in `SDL_SetRenderTarget()`.",                      // [2]
+        "Failure in implementation of function `Render`.",          // [3]
+    };
+
+    rlTex.x = -eBase->eSt.rLoc.x;
+    rlTex.y = -eBase->eSt.rLoc.y;
+
+    /*------------------------------------------------------------------------*/
+    /* Discard the cached texture if it is no longer the correct size or if  */
+    /* the renderer has changed.                                              */
+    /*------------------------------------------------------------------------*/
+    if (*texSlot != NULL)
+    {
+        if (*texRend != xRend)
+        {
+            /*----------------------------------------------------------------*/
+            /* The texture belongs to the previous renderer, which may still  */
+            /* be alive; destroy it rather than just dropping the pointer.    */
+            /*----------------------------------------------------------------*/
+            neuik_TextureSlot_Clear(texSlot);
+            if (*texSlot != NULL) SDL_DestroyTexture(*texSlot);
+            *texSlot = NULL;
+            *texRend = NULL;
+        }
+        else if (SDL_QueryTexture(*texSlot, NULL, NULL, &texW, &texH) ||
+            texW != rSize->w || texH != rSize->h)
+        {
+            neuik_TextureSlot_Clear(texSlot);
+        }
+    }
+
+    if (*texSlot == NULL)
+    {
+        tex = neuik_CreateTexture(xRend, 
+            SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+            rSize->w, rSize->h);
+        if (tex == NULL)
+        {
+            eNum = 1;
+            goto out;
+        }
+        SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+        if (neuik_TextureSlot_Set(texSlot, tex, xRend))
+        {
+            eNum = 1;
+            goto out;
+        }
+        *texRend = xRend;
+        doRender = 1;
+    }
+    if (eBase->eSt.doRedraw)
+    {
+        doRender = 1;
+    }
+
+    if (!doRender && 
+        (texLoc->x != eBase->eSt.rLoc.x || texLoc->y != eBase->eSt.rLoc.y))
+    {
+        /*--------------------------------------------------------------------*/
+        /* The contents are still valid but the element has moved; update    */
+        /* the stored locations of its children without drawing anything.    */
+        /*--------------------------------------------------------------------*/
+        if ((eBase->eFT->Render)(elem, rSize, &rlTex, xRend, TRUE))
+        {
+            eNum = 3;
+            goto out;
+        }
+        *texLoc = eBase->eSt.rLoc;
+    }
+
+    if (doRender)
+    {
+        prevTarget = SDL_GetRenderTarget(xRend);
+        if (SDL_SetRenderTarget(xRend, *texSlot))
+        {
+            eNum = 2;
+            goto out;
+        }
+        SDL_SetRenderDrawColor(xRend, 255, 255, 255, 0);
+        SDL_RenderClear(xRend);
+
+        /*--------------------------------------------------------------------*/
+        /* The texture starts out blank; so every child of the element must   */
+        /* be drawn, not only those which have requested a redraw.            */
+        /*--------------------------------------------------------------------*/
+        if (eBase->eSt.parent != NULL)
+        {
+            if (!neuik_Object_GetClassObject_NoError(eBase->eSt.parent,
+                neuik__Class_Container, (void**)&pCont))
+            {
+                redrawAll        = pCont->redrawAll;
+                pCont->redrawAll = 1;
+            }
+        }
+
+        /*--------------------------------------------------------------------*/
+        /* The texture is kept for later frames (possibly at another spot);   */
+        /* so its contents must not be culled against the current view.      */
+        /*--------------------------------------------------------------------*/
+        if (win != NULL) neuik_Window_PushClip(win, NULL, NULL);
+
+        if ((eBase->eFT->Render)(elem, rSize, &rlTex, xRend, FALSE))
+        {
+            eNum = 3;
+        }
+        if (win != NULL) neuik_Window_PopClip(win);
+        *texLoc = eBase->eSt.rLoc;
+
+        if (pCont != NULL) pCont->redrawAll = redrawAll;
+        if (SDL_SetRenderTarget(xRend, prevTarget) && eNum == 0)
+        {
+            eNum = 2;
+        }
+        if (eNum != 0) goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Element_RenderLayer
+ *
+ *  Description:   Render an element in `Layer` mode. The element (and all of 
+ *                 its children) is rendered once into a retained texture which
+ *                 is then copied on to the external renderer; until the 
+ *                 element (or one of its children) requests a redraw, later 
+ *                 frames cost a single texture copy.
+ *
+ *                 If the layer would not fit within the layer memory budget, 
+ *                 the element is rendered directly instead.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_Element_RenderLayer(
+    NEUIK_Element       elem,
+    NEUIK_ElementBase * eBase,
+    RenderSize        * rSize,    /* the size of the element */
+    RenderLoc         * rlMod,    /* A relative location modifier (for rendering) */
+    SDL_Renderer      * xRend)    /* The external renderer to prepare the texture for */
+{
+    int                 texW        = 0;
+    int                 texH        = 0;
+    size_t              nBytes      = 0;
+    SDL_Rect            destRect    = {0, 0, 0, 0};
+    int                 eNum        = 0;
+    static char         funcName[]  = "neuik_Element_RenderLayer";
+    static char       * errMsgs[]   = {"",                             // [0] no error
+        "Failure in implementation of function `Render`.",          // [1]
+        "Failure in `neuik_Element_UpdateCachedRender()`.",         // [2]
+        "Failure in `SDL_RenderCopy()`.",                           // [3]
+    };
+
+    /*------------------------------------------------------------------------*/
+    /* The layer texture may have been destroyed along with its renderer;    */
+    /* in that case, its memory is no longer in use.                          */
+    /*------------------------------------------------------------------------*/
+    if (eBase->eSt.layerTex == NULL && eBase->eSt.layerBytes > 0)
+    {
+        neuik_Element_ReleaseLayer(eBase);
+    }
+
+    nBytes = 4*(size_t)(rSize->w)*(size_t)(rSize->h);
+    if (eBase->eSt.layerTex != NULL)
+    {
+        if (eBase->eSt.layerRend != xRend ||
+            SDL_QueryTexture(eBase->eSt.layerTex, NULL, NULL, &texW, &texH) ||
+            texW != rSize->w || texH != rSize->h ||
+            neuik_Layer_BytesInUse > neuik_Layer_Budget)
+        {
+            neuik_Element_ReleaseLayer(eBase);
+        }
+    }
+
+    if (eBase->eSt.layerTex == NULL && 
+        (nBytes == 0 || neuik_Layer_BytesInUse + nBytes > neuik_Layer_Budget))
+    {
+        /*--------------------------------------------------------------------*/
+        /* No room for this layer; render the element directly.               */
+        /*--------------------------------------------------------------------*/
+        if ((eBase->eFT->Render)(elem, rSize, rlMod, xRend, FALSE))
+        {
+            eNum = 1;
+        }
+        goto out;
+    }
+
+    if (neuik_Element_UpdateCachedRender(elem, eBase, rSize, xRend, 
+            &(eBase->eSt.layerTex), &(eBase->eSt.layerRend), 
+            &(eBase->eSt.layerLoc)))
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (eBase->eSt.layerBytes == 0)
+    {
+        eBase->eSt.layerBytes   = nBytes;
+        neuik_Layer_BytesInUse += nBytes;
+    }
+
+    destRect.x = eBase->eSt.rLoc.x;
+    destRect.y = eBase->eSt.rLoc.y;
+    if (rlMod != NULL)
+    {
+        destRect.x += rlMod->x;
+        destRect.y += rlMod->y;
+    }
+    destRect.w = rSize->w;
+    destRect.h = rSize->h;
+    if (SDL_RenderCopy(xRend, eBase->eSt.layerTex, NULL, &destRect))
     {
-        eNum = 2;
+        eNum = 3;
         goto out;
     }
-
-    (*rSize) = eBase->eSt.rSize;
 out:
     if (eNum > 0)
     {
@@ -1019,38 +1639,96 @@ out:
 }
 
 
-int neuik_Element_GetSizeAndLocation(
-    NEUIK_Element   elem,
-    RenderSize    * rSize,
-    RenderLoc     * rLoc)
+/*******************************************************************************
+ *
+ *  Name:          neuik_Element_RenderRotateCached
+ *
+ *  Description:   Render an element into a cached target texture and draw it
+ *                 rotated (about its upper left corner) using the external 
+ *                 renderer. The element is only rerendered into the cached 
+ *                 texture when it (or one of its children) has requested a
+ *                 redraw or when its size has changed; otherwise the rotated 
+ *                 element costs a single texture copy.
+ *
+ *                 The rotation must be a multiple of 90 degrees.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_Element_RenderRotateCached(
+    NEUIK_Element       elem,
+    NEUIK_ElementBase * eBase,
+    RenderSize        * rSize,    /* the (unrotated) size of the element */
+    RenderLoc         * rlMod,    /* A relative location modifier (for rendering) */
+    SDL_Renderer      * xRend,    /* The external renderer to prepare the texture for */
+    double              rotation)
 {
-    int                  eNum      = 0;
-    NEUIK_ElementBase  * eBase     = NULL;
-    static char          funcName[] = "neuik_Element_GetSizeAndLocation";
-    static char        * errMsgs[] = {"",                                // [0] no error
-        "Argument `elem` caused `neuik_Object_GetClassObject` to fail.", // [1]
-        "Output argument `rSize` is NULL.",                              // [2]
-        "Output argument `rLoc` is NULL.",                               // [3]
+    double              angle       = 0.0;
+    SDL_Point           pivot       = {0, 0};
+    SDL_Rect            destRect    = {0, 0, 0, 0};
+    RenderLoc           rl;
+    int                 eNum        = 0;
+    static char         funcName[]  = "neuik_Element_RenderRotateCached";
+    static char       * errMsgs[]   = {"",                             // [0] no error
+        "Unsupported rotation (must be a multiple of 90 degrees).", // [1]
+        "Failure in `neuik_Element_UpdateCachedRender()`.",         // [2]
+        "Failure in `SDL_RenderCopyEx()`.",                         // [3]
     };
 
-    if (neuik_Object_GetClassObject(elem, neuik__Class_Element, (void**)&eBase))
+    angle = rotation;
+    while (angle <    0.0) angle += 360.0;
+    while (angle >= 360.0) angle -= 360.0;
+
+    /*------------------------------------------------------------------------*/
+    /* Rotating about the upper left corner of the texture; offset the        */
+    /* destination so that the rotated result begins at the element location. */
+    /*------------------------------------------------------------------------*/
+    rl = eBase->eSt.rLoc;
+    if (rlMod != NULL)
+    {
+        rl.x += rlMod->x;
+        rl.y += rlMod->y;
+    }
+    destRect.w = rSize->w;
+    destRect.h = rSize->h;
+    if (angle == 90.0)
+    {
+        destRect.x = rl.x + rSize->h;
+        destRect.y = rl.y;
+    }
+    else if (angle == 180.0)
+    {
+        destRect.x = rl.x + rSize->w;
+        destRect.y = rl.y + rSize->h;
+    }
+    else if (angle == 270.0)
+    {
+        destRect.x = rl.x;
+        destRect.y = rl.y + rSize->w;
+    }
+    else
     {
         eNum = 1;
         goto out;
     }
-    if (rSize == NULL)
+
+    if (neuik_Element_UpdateCachedRender(elem, eBase, rSize, xRend, 
+            &(eBase->eSt.rotTex), &(eBase->eSt.rotRend), 
+            &(eBase->eSt.rotLoc)))
     {
         eNum = 2;
         goto out;
     }
-    if (rLoc == NULL)
+
+    if (SDL_RenderCopyEx(xRend, eBase->eSt.rotTex, 
+            NULL, &destRect, angle, &pivot, SDL_FLIP_NONE))
     {
         eNum = 3;
         goto out;
     }
 
-    (*rSize) = eBase->eSt.rSize;
-    (*rLoc)  = eBase->eSt.rLoc;
+    eBase->eSt.hDelta = NEUIK_MINSIZE_NOCHANGE;
+    eBase->eSt.wDelta = NEUIK_MINSIZE_NOCHANGE;
 out:
     if (eNum > 0)
     {
@@ -1062,41 +1740,6 @@ out:
 }
 
 
-int
-    NEUIK_Element_SetSize(NEUIK_Element elem, RenderSize * rSize);
-
-
-int neuik_Element_Render(
-    NEUIK_Element   elem,
-    RenderSize    * rSize, /* in/out the size the tex occupies when complete */
-    RenderLoc     * rlMod, /* A relative location modifier (for rendering) */
-    SDL_Renderer  * xRend, /* The external renderer to prepare the texture for */
-    int             mock)  /* If true; calculate sizes/locations but don't draw */
-{
-    int                 result;
-    NEUIK_ElementBase * eBase;
-
-    if (neuik_Object_GetClassObject(elem, neuik__Class_Element, (void**)&eBase))
-    {
-        return 1;
-    }
-    if (eBase->eFT == NULL) return 1;
-    if (eBase->eFT->Render == NULL) return 1;
-
-    result = (eBase->eFT->Render)(elem, rSize, rlMod, xRend, mock);
-    if (result)
-    {
-        return result;
-    }
-    if (!mock)
-    {
-        eBase->eSt.hDelta = NEUIK_MINSIZE_NOCHANGE;
-        eBase->eSt.wDelta = NEUIK_MINSIZE_NOCHANGE;
-    }
-    return result;
-}
-
-
 int neuik_Element_RenderRotate(
     NEUIK_Element   elem,
     RenderSize    * rSize,    /* in/out the size the tex occupies when complete */
@@ -1126,6 +1769,8 @@ int neuik_Element_RenderRotate(
     SDL_Rect            destRect   = {0, 0, 0, 0};  /* destination rectangle */
     RenderLoc           rl;
     RenderLoc           rlAdj;             /* loc. including adjustments */
+    NEUIK_Window      * win        = NULL;
+    int                 result     = 0;
     int                 eNum       = 0;
     static char         funcName[] = "neuik_Element_RenderRotate";
     static char       * errMsgs[]  = {"",                                // [0] no error
@@ -1133,9 +1778,10 @@ int neuik_Element_RenderRotate(
         "Failed to create RGB surface.",                                 // [2]
         "Failed to create software renderer.",                           // [3]
         "Failure in `neuik_Element_Render()`",                           // [4]
-        "SDL_CreateTextureFromSurface returned NULL.",                   // [5]
+        "Failed to create the rotated texture.",                         // [5]
         "NEUIK_Element Function Table is NULL.",                         // [6]
         "`Render` unimplemented in NEUIK_Element Function Table.",       // [7]
+        "Failure in `neuik_Element_RenderRotateCached()`.",              // [8]
     };
 
     #if SDL_BYTEORDER == SDL_BIG_ENDIAN
@@ -1171,6 +1817,20 @@ int neuik_Element_RenderRotate(
         return neuik_Element_Render(elem, rSize, rlMod, xRend, mock);
     }
 
+    /*------------------------------------------------------------------------*/
+    /* Where possible, render into a cached target texture and let the        */
+    /* renderer apply the rotation.                                           */
+    /*------------------------------------------------------------------------*/
+    if (!mock && SDL_RenderTargetSupported(xRend))
+    {
+        if (neuik_Element_RenderRotateCached(
+                elem, eBase, rSize, rlMod, xRend, rotation))
+        {
+            eNum = 8;
+        }
+        goto out;
+    }
+
     rl = eBase->eSt.rLoc;
     rlAdj = rl;
     if (rlMod != NULL)
@@ -1183,8 +1843,8 @@ int neuik_Element_RenderRotate(
     /*------------------------------------------------------------------------*/
     /* Create a new surface which is the size of the source texture.          */
     /*------------------------------------------------------------------------*/
-    cpSurf = SDL_CreateRGBSurface(0,
-        rSize->w, rSize->h, 32, rmask, gmask, bmask, amask);
+    cpSurf = neuik_SurfacePool_Acquire(
+        rSize->w, rSize->h, rmask, gmask, bmask, amask);
     if (cpSurf == NULL)
     {
         eNum = 2;
@@ -1205,7 +1865,14 @@ int neuik_Element_RenderRotate(
     SDL_SetRenderDrawColor(cpRend, 255, 255, 255, 0);
     SDL_RenderClear(cpRend);
 
-    if ((eBase->eFT->Render)(elem, rSize, rlMod, cpRend, mock))
+    /*------------------------------------------------------------------------*/
+    /* The children are laid out unrotated; don't cull them against the view. */
+    /*------------------------------------------------------------------------*/
+    win = (NEUIK_Window*)(eBase->eSt.window);
+    if (win != NULL) neuik_Window_PushClip(win, NULL, NULL);
+    result = (eBase->eFT->Render)(elem, rSize, rlMod, cpRend, mock);
+    if (win != NULL) neuik_Window_PopClip(win);
+    if (result)
     {
         eNum = 4;
         goto out;
@@ -1227,8 +1894,8 @@ int neuik_Element_RenderRotate(
         /*--------------------------------------------------------------------*/
         /* Create a new surface which is the size of the rotated texture.     */
         /*--------------------------------------------------------------------*/
-        imSurf = SDL_CreateRGBSurface(0,
-            rSize->h, rSize->w, 32, rmask, gmask, bmask, amask);
+        imSurf = neuik_SurfacePool_Acquire(
+            rSize->h, rSize->w, rmask, gmask, bmask, amask);
         if (imSurf == NULL)
         {
             eNum = 2;
@@ -1265,8 +1932,8 @@ int neuik_Element_RenderRotate(
         /*--------------------------------------------------------------------*/
         /* Create a new surface which is the size of the rotated texture.     */
         /*--------------------------------------------------------------------*/
-        imSurf = SDL_CreateRGBSurface(0,
-            rSize->w, rSize->h, 32, rmask, gmask, bmask, amask);
+        imSurf = neuik_SurfacePool_Acquire(
+            rSize->w, rSize->h, rmask, gmask, bmask, amask);
         if (imSurf == NULL)
         {
             eNum = 2;
@@ -1299,8 +1966,8 @@ int neuik_Element_RenderRotate(
         /*--------------------------------------------------------------------*/
         /* Create a new surface which is the size of the rotated texture.     */
         /*--------------------------------------------------------------------*/
-        imSurf = SDL_CreateRGBSurface(0,
-            rSize->h, rSize->w, 32, rmask, gmask, bmask, amask);
+        imSurf = neuik_SurfacePool_Acquire(
+            rSize->h, rSize->w, rmask, gmask, bmask, amask);
         if (imSurf == NULL)
         {
             eNum = 2;
@@ -1334,12 +2001,25 @@ int neuik_Element_RenderRotate(
         }
     }
 
-    imTex = SDL_CreateTextureFromSurface(xRend, imSurf);
+    if (imSurf == NULL)
+    {
+        /* not a multiple of 90 degrees; no rotated surface was produced */
+        eNum = 5;
+        goto out;
+    }
+    imTex = neuik_TexturePool_Acquire(xRend, imSurf->format->format,
+        SDL_TEXTUREACCESS_STATIC, imSurf->w, imSurf->h);
     if (imTex == NULL)
     {
         eNum = 5;
         goto out;
     }
+    if (SDL_UpdateTexture(imTex, NULL, imSurf->pixels, imSurf->pitch))
+    {
+        eNum = 5;
+        goto out;
+    }
+    SDL_SetTextureBlendMode(imTex, SDL_BLENDMODE_BLEND);
 
     destRect.x = rl.x;
     destRect.y = rl.y;
@@ -1350,11 +2030,15 @@ int neuik_Element_RenderRotate(
     eBase->eSt.hDelta = NEUIK_MINSIZE_NOCHANGE;
     eBase->eSt.wDelta = NEUIK_MINSIZE_NOCHANGE;
 out:
-    if (imTex  != NULL) SDL_DestroyTexture(imTex);
+    if (imTex  != NULL) neuik_TexturePool_Release(xRend, &imTex);
     if (cpTex  != NULL) SDL_DestroyTexture(cpTex);
-    if (cpRend != NULL) SDL_DestroyRenderer(cpRend);
-    if (imSurf != NULL) SDL_FreeSurface(imSurf);
-    if (cpSurf != NULL) SDL_FreeSurface(cpSurf);
+    if (cpRend != NULL)
+    {
+        neuik_DropRendererTextures(cpRend);
+        SDL_DestroyRenderer(cpRend);
+    }
+    if (imSurf != NULL) neuik_SurfacePool_Release(&imSurf);
+    if (cpSurf != NULL) neuik_SurfacePool_Release(&cpSurf);
 
     if (eNum > 0)
     {
@@ -1382,6 +2066,7 @@ neuik_EventState neuik_Element_CaptureEvent(
     NEUIK_Element   elem,
     SDL_Event     * ev)
 {
+    int                  profiled; /* if this call is being profiled */
     neuik_EventState     captured = 0;
     neuik_EventState  (* funcImp) (NEUIK_Element, SDL_Event*);
     NEUIK_ElementBase  * eBase;
@@ -1393,6 +2078,8 @@ neuik_EventState neuik_Element_CaptureEvent(
     {
         return 0;
     }
+    profiled = neuik_Profile_Begin(
+        NEUIK_PROFILE_CAPTUREEVENT, elem, eBase->eSt.window);
 
     if (eBase->eFT != NULL)
     {
@@ -1427,6 +2114,7 @@ neuik_EventState neuik_Element_CaptureEvent(
 
     // return (eBase->eFT->CaptureEvent)(elem, ev);
 out:
+    neuik_Profile_End(profiled);
     return captured;
 }
 
@@ -1491,10 +2179,11 @@ int NEUIK_Element_SetBackgroundColorGradient(
         "Argument `direction` has unexpected value.",                     // [ 6]
         "`colorStop` string is too long.",                                // [ 7]
         "`colorStop` string invalid; should be comma separated RGBAF.",   // [ 8]
-        "`colorStop` string invalid; RGBA value range is 0-255."          // [ 9]
-        "`colorStop` string invalid; fraction value range is 0.0-1.0."    // [10]
+        "`colorStop` string invalid; RGBA value range is 0-255.",         // [ 9]
+        "`colorStop` string invalid; fraction value range is 0.0-1.0.",   // [10]
         "Failed to allocate memory.",                                     // [11]
         "Failed to reallocate memory.",                                   // [12]
+        "Failure in `neuik_Gradient_Compile()`.",                         // [13]
     };
 
     if (neuik_Object_GetClassObject(elem, neuik__Class_Element, (void**)&eBase))
@@ -1689,6 +2378,27 @@ int NEUIK_Element_SetBackgroundColorGradient(
     }
     va_end(args);
 
+    /*------------------------------------------------------------------------*/
+    /* Compile the ColorStops into a lookup table; this is what is used when  */
+    /* the background is actually drawn.                                      */
+    /*------------------------------------------------------------------------*/
+    if (bgCfg->grad_lut == NULL)
+    {
+        bgCfg->grad_lut = (neuik_Gradient *)malloc(sizeof(neuik_Gradient));
+        if (bgCfg->grad_lut == NULL)
+        {
+            eNum = 11;
+            goto out;
+        }
+    }
+    if (neuik_Gradient_Compile(*cstops, bgCfg->grad_dirn, bgCfg->grad_lut))
+    {
+        free(bgCfg->grad_lut);
+        bgCfg->grad_lut = NULL;
+        eNum = 13;
+        goto out;
+    }
+
     rSize = eBase->eSt.rSize;
     rLoc  = eBase->eSt.rLoc;
     if (neuik_Element_RequestRedraw(elem, rLoc, rSize))
@@ -1752,6 +2462,39 @@ out:
 }
 
 
+/*******************************************************************************
+ *
+ *  Name:          neuik_Element_MakeScaleCurrent
+ *
+ *  Description:   Make the scaling of the window containing this element the 
+ *                 current one, so that an element which is measured outside 
+ *                 of its window's event handling/redraw (e.g. from a setter) 
+ *                 gets the same minimum size as it would during a redraw. The
+ *                 current scaling is left as is if the element is not yet in 
+ *                 a window.
+ *
+ *                 The caller restores `neuik__HighDPI_Scaling` to the returned
+ *                 value once it is done.
+ *
+ *  Returns:       The previous value of `neuik__HighDPI_Scaling`.
+ *
+ ******************************************************************************/
+float neuik_Element_MakeScaleCurrent(
+    NEUIK_Element elem)
+{
+    float               prevScale = neuik__HighDPI_Scaling;
+    NEUIK_ElementBase * eBase     = NULL;
+
+    if (!neuik_Object_GetClassObject_NoError(
+        elem, neuik__Class_Element, (void**)&eBase))
+    {
+        neuik_Window_MakeScaleCurrent((NEUIK_Window *)(eBase->eSt.window));
+    }
+
+    return prevScale;
+}
+
+
 /*******************************************************************************
  *
  *  Name:          NEUIK_Element_SetBackgroundColorSolid
@@ -2755,69 +3498,53 @@ int neuik_Element_NeedsRedraw(
  *
  *  Name:          neuik_Element_RedrawBackgroundGradient
  *
- *  Description:   Renders a color gradient using the specified ColorStops.
+ *  Description:   Renders a compiled color gradient as the element background.
  *
  *                 Vertical gradients start at the top and go down from there.
  *                 Horizontal gradients start at the left and go right from there.
  *
- *  Returns:       NULL if there is a problem, otherwise a valid SDL_Texture*.
+ *  Returns:       1 if there is an error; 0 otherwise.
  *
  ******************************************************************************/
 int neuik_Element_RedrawBackgroundGradient(
-    NEUIK_Element      elem,
-    NEUIK_ColorStop ** cs,
-    RenderLoc        * rlMod,   /* A relative location modifier (for rendering) */
-    neuik_MaskMap    * maskMap, /* Identifies regions of background to not draw */
-    char               dirn)    /* Direction of the gradient 'v' or 'h' */
+    NEUIK_Element          elem,
+    const neuik_Gradient * grad,
+    RenderLoc            * rlMod,   /* A relative location modifier (for rendering) */
+    neuik_MaskMap        * maskMap) /* Identifies regions of background to not draw */
 {
-    int                 ctr;
     int                 gCtr;             /* gradient counter */
-    int                 nClrs;
+    int                 gLen;             /* length of the gradient (px) */
+    int                 spanStart;        /* first line of a batched span */
+    int                 spanR0;           /* region start of a batched span */
+    int                 spanRf;           /* region end of a batched span */
     int                 eNum      = 0;    /* which error to report (if any) */
-    int                 clrR;
-    int                 clrG;
-    int                 clrB;
-    int                 clrA;
-    int                 clrFound;
     int                 maskCtr;          /* maskMap counter */
     int                 maskRegions;      /* number of regions in maskMap */
-    const int         * regionX0;         /* Array of region X0 values */
-    const int         * regionXf;         /* Array of region Xf values */
-    const int         * regionY0;         /* Array of region Y0 values */
-    const int         * regionYf;         /* Array of region Yf values */
-    float               lastFrac  = -1.0;
-    float               frac;
-    float               fracDelta;        /* fraction between ColorStop 1 & 2 */
-    float               fracStart = 0.0;  /* fraction at ColorStop 1 */
-    float               fracEnd   = 1.0;  /* fraction at ColorStop 2 */
+    char                dirn;             /* Direction of the gradient 'v' or 'h' */
+    const int         * region0;          /* Array of region start values */
+    const int         * regionf;          /* Array of region end values */
+    Uint32              clr;
     RenderSize          rSize;            /* Size of the element background to fill */
     RenderLoc           rl;               /* Location of element background */
     SDL_Rect            srcRect;
+    SDL_Rect            dstRect;
+    SDL_BlendMode       blendMode;
     NEUIK_ElementBase * eBase     = NULL;
     SDL_Renderer      * rend      = NULL;
-    colorDeltas       * deltaPP   = NULL;
-    colorDeltas       * clrDelta;
-    NEUIK_Color       * clr;
+    SDL_Texture       * gradTex   = NULL;
     static char   funcName[] = "neuik_Element_RedawBackgroundGradient";
     static char * errMsgs[] = {"", // [0] no error
-        "Pointer to ColorStops is NULL.",                                // [1]
-        "Unsupported gradient direction.",                               // [2]
-        "Invalid RenderSize supplied.",                                  // [3]
-        "Unable to create RGB surface.",                                 // [4]
-        "SDL_CreateTextureFromSurface failed.",                          // [5]
-        "ColorStops array is empty.",                                    // [6]
-        "Invalid ColorStop fraction (<0 or >1).",                        // [7]
-        "ColorStops array fractions not in ascending order.",            // [8]
-        "Failure to allocate memory.",                                   // [9]
-        "Failed to create software renderer.",                           // [10]
-        "Argument `elem` caused `neuik_Object_GetClassObject` to fail.", // [11]
-        "Failure in `neuik_MaskMap_GetUnmaskedRegionsOnHLine`.",         // [12]
-        "Failure in `neuik_MaskMap_GetUnmaskedRegionsOnVLine`.",         // [13]
+        "Pointer to the compiled gradient is NULL.",                     // [1]
+        "Invalid RenderSize supplied.",                                  // [2]
+        "Argument `elem` caused `neuik_Object_GetClassObject` to fail.", // [3]
+        "Failure in `neuik_MaskMap_GetUnmaskedRegionsOnHLine`.",         // [4]
+        "Failure in `neuik_MaskMap_GetUnmaskedRegionsOnVLine`.",         // [5]
+        "Failure in `neuik_GetGradientTexture()`.",                      // [6]
     };
 
     if (neuik_Object_GetClassObject(elem, neuik__Class_Element, (void**)&eBase))
     {
-        eNum = 11;
+        eNum = 3;
         goto out;
     }
 
@@ -2826,256 +3553,177 @@ int neuik_Element_RedrawBackgroundGradient(
     rend  = eBase->eSt.rend;
 
     /*------------------------------------------------------------------------*/
-    /* Check for easily issues before attempting to render the gradient       */
+    /* Check for easily issues before attempting to render the gradient. The  */
+    /* ColorStops were validated when the gradient was compiled.              */
     /*------------------------------------------------------------------------*/
-    if (cs == NULL)
+    if (grad == NULL)
     {
         eNum = 1;
         goto out;
     }
-    else if (*cs == NULL)
-    {
-        eNum = 6;
-        goto out;
-    }
-    if (dirn != 'v' && dirn != 'h')
+    if (rSize.w <= 0 || rSize.h <= 0)
     {
         eNum = 2;
         goto out;
     }
-    if (rSize.w <= 0 || rSize.h <= 0)
+    dirn = grad->dirn;
+
+    if (grad->nStops == 1)
     {
-        eNum = 3;
+        /*--------------------------------------------------------------------*/
+        /* A single color; this will just be a filled rectangle               */
+        /*--------------------------------------------------------------------*/
+        srcRect.x = rl.x;
+        srcRect.y = rl.y;
+        srcRect.w = rSize.w;
+        srcRect.h = rSize.h;
+
+        clr = grad->lut[0];
+        SDL_SetRenderDrawColor(rend, (clr >> 24) & 0xFF, (clr >> 16) & 0xFF,
+            (clr >> 8) & 0xFF, clr & 0xFF);
+        SDL_RenderFillRect(rend, &srcRect);
         goto out;
     }
 
     /*------------------------------------------------------------------------*/
-    /* Count the number of color stops and check that the color stop          */
-    /* fractions are in increasing order                                      */
+    /* Get the (cached) 1px gradient texture; the gradient is then stretched  */
+    /* across the background. The texture blends in the same way that the     */
+    /* line drawing it replaces would have.                                   */
     /*------------------------------------------------------------------------*/
-    for (nClrs = 0;; nClrs++)
+    gLen    = (dirn == 'v') ? rSize.h : rSize.w;
+    gradTex = neuik_GetGradientTexture(grad, gLen, rend);
+    if (gradTex == NULL)
     {
-        if (cs[nClrs] == NULL) break; /* this is the number of ColorStops */
-        if (cs[nClrs]->frac < 0.0 || cs[nClrs]->frac > 1.0)
-        {
-            eNum = 7;
-            goto out;
-        }
-        else if (cs[nClrs]->frac < lastFrac)
-        {
-            eNum = 8;
-            goto out;
-        }
-        else
-        {
-            lastFrac = cs[nClrs]->frac;
-        }
+        eNum = 6;
+        goto out;
     }
-
-    /*------------------------------------------------------------------------*/
-    /* Allocate memory for delta-per-px array and calculate the ColorStop     */
-    /* delta-per-px values.                                                   */
-    /*------------------------------------------------------------------------*/
-    if (nClrs > 1)
+    if (SDL_GetRenderDrawBlendMode(rend, &blendMode) == 0)
     {
-        deltaPP = (colorDeltas *)malloc((nClrs - 1)*sizeof(colorDeltas));
-        if (deltaPP == NULL)
-        {
-            eNum = 9;
-            goto out;
-        }
-        for (ctr = 0; ctr < nClrs-1; ctr++)
-        {
-            deltaPP[ctr].r = (float)((cs[ctr+1]->color).r - (cs[ctr]->color).r);
-            deltaPP[ctr].g = (float)((cs[ctr+1]->color).g - (cs[ctr]->color).g);
-            deltaPP[ctr].b = (float)((cs[ctr+1]->color).b - (cs[ctr]->color).b);
-            deltaPP[ctr].a = (float)((cs[ctr+1]->color).a - (cs[ctr]->color).a);
-        }
+        SDL_SetTextureBlendMode(gradTex, blendMode);
     }
 
-    /*------------------------------------------------------------------------*/
-    /* Fill in the colors of the gradient                                     */
-    /*------------------------------------------------------------------------*/
-    if (nClrs == 1)
+    if (maskMap == NULL)
     {
         /*--------------------------------------------------------------------*/
-        /* A single color; this will just be a filled rectangle               */
+        /* There are no masked off (transparent areas); a single copy will    */
+        /* fill the entire background.                                        */
         /*--------------------------------------------------------------------*/
-        srcRect.x = rl.x;
-        srcRect.y = rl.y;
-        srcRect.w = rSize.w;
-        srcRect.h = rSize.h;
-
-        clr = &(cs[0]->color);
-        SDL_SetRenderDrawColor(rend, clr->r, clr->g, clr->b, clr->a);
-        SDL_RenderFillRect(rend, &srcRect);
+        dstRect.x = rl.x;
+        dstRect.y = rl.y;
+        dstRect.w = rSize.w;
+        dstRect.h = rSize.h;
+        SDL_RenderCopy(rend, gradTex, NULL, &dstRect);
+        goto out;
     }
-    else if (dirn == 'v')
+
+    /*------------------------------------------------------------------------*/
+    /* A transparency mask is included, draw unmasked regions. Consecutive    */
+    /* lines that share a single identical unmasked region (the common case   */
+    /* for rounded corners) are batched into a single copy.                   */
+    /*------------------------------------------------------------------------*/
+    spanStart = -1;
+    spanR0    = 0;
+    spanRf    = 0;
+    for (gCtr = 0; gCtr <= gLen; gCtr++)
     {
-        /*--------------------------------------------------------------------*/
-        /* Draw a vertical gradient                                           */
-        /*--------------------------------------------------------------------*/
-        for (gCtr = 0; gCtr < rSize.h; gCtr++)
+        maskRegions = 0;
+        if (gCtr < gLen)
         {
-            /* calculate the fractional position within the gradient */
-            frac = (float)(gCtr+1)/(float)(rSize.h);
-
-
-            /* determine which ColorStops/colorDeltas should be used */
-            fracStart = cs[0]->frac;
-            clr       = &(cs[0]->color);
-            clrDelta  = NULL;
-            clrFound  = 0;
-            for (ctr = 0;;ctr++)
-            {
-                if (cs[ctr] == NULL) break;
-
-                if (frac < cs[ctr]->frac)
-                {
-                    /* apply delta from this clr */
-                    fracEnd  = cs[ctr]->frac;
-                    clrFound = 1;
-                    break;
-                }
-
-                clr      = &(cs[ctr]->color);
-                clrDelta = &(deltaPP[ctr]);
-            }
-
-            if (!clrFound)
-            {
-                /* line is beyond the final ColorStop; use that color */
-                clrDelta = NULL;
-            }
-
-            /* calculate and set the color for this gradient line */
-            if (clrDelta != NULL)
+            if (dirn == 'v')
             {
-                /* between two ColorStops, blend the color */
-                fracDelta = (frac - fracStart)/(fracEnd - fracStart);
-                clrR = clr->r + (int)((clrDelta->r)*fracDelta);
-                clrG = clr->g + (int)((clrDelta->g)*fracDelta);
-                clrB = clr->b + (int)((clrDelta->b)*fracDelta);
-                clrA = clr->a + (int)((clrDelta->a)*fracDelta);
-                SDL_SetRenderDrawColor(rend, clrR, clrG, clrB, clrA);
-            }
-            else
-            {
-                /* not between two ColorStops, use a single color */
-                SDL_SetRenderDrawColor(rend, clr->r, clr->g, clr->b, clr->a);
-            }
-
-            if (maskMap != NULL)
-            {
-                /*------------------------------------------------------------*/
-                /* A transparency mask is included, draw unmasked regions.    */
-                /*------------------------------------------------------------*/
                 if (neuik_MaskMap_GetUnmaskedRegionsOnHLine(
-                        maskMap, gCtr, &maskRegions, &regionX0, &regionXf))
+                        maskMap, gCtr, &maskRegions, &region0, &regionf))
                 {
-                    eNum = 12;
+                    eNum = 4;
                     goto out;
                 }
-
-                for (maskCtr = 0; maskCtr < maskRegions; maskCtr++)
-                {
-                    SDL_RenderDrawLine(rend,
-                        rl.x + regionX0[maskCtr], rl.y + gCtr,
-                        rl.x + regionXf[maskCtr], rl.y + gCtr);
-                }
             }
             else
             {
-                /*------------------------------------------------------------*/
-                /* There are no masked off (transparent areas) draw full line */
-                /*------------------------------------------------------------*/
-                SDL_RenderDrawLine(rend,
-                    rl.x,                 rl.y + gCtr,
-                    rl.x + (rSize.w - 1), rl.y + gCtr);
-            }
-        }
-    }
-    else if (dirn == 'h')
-    {
-        /*--------------------------------------------------------------------*/
-        /* Draw a horizontal gradient                                         */
-        /*--------------------------------------------------------------------*/
-        for (gCtr = 0; gCtr < rSize.w; gCtr++)
-        {
-            /* calculate the fractional position within the gradient */
-            frac = (float)(gCtr+1)/(float)(rSize.w);
-
-            /* determine which ColorStops/colorDeltas should be used */
-            fracStart = cs[0]->frac;
-            clr       = &(cs[0]->color);
-            clrDelta  = NULL;
-            clrFound  = 0;
-            for (ctr = 0;;ctr++)
-            {
-                if (cs[ctr] == NULL) break;
-
-                if (frac < cs[ctr]->frac)
+                if (neuik_MaskMap_GetUnmaskedRegionsOnVLine(
+                        maskMap, gCtr, &maskRegions, &region0, &regionf))
                 {
-                    /* apply delta from this clr */
-                    fracEnd  = cs[ctr]->frac;
-                    clrFound = 1;
-                    break;
+                    eNum = 5;
+                    goto out;
                 }
-
-                clr      = &(cs[ctr]->color);
-                clrDelta = &(deltaPP[ctr]);
             }
 
-            if (!clrFound)
+            if (spanStart >= 0 && maskRegions == 1 &&
+                region0[0] == spanR0 && regionf[0] == spanRf)
             {
-                /* line is beyond the final ColorStop; use that color */
-                clrDelta = NULL;
+                /* this line extends the current span */
+                continue;
             }
+        }
 
-            /* calculate and set the color for this gradient line */
-            if (clrDelta != NULL)
+        if (spanStart >= 0)
+        {
+            /*----------------------------------------------------------------*/
+            /* Draw the span which has just ended.                            */
+            /*----------------------------------------------------------------*/
+            if (dirn == 'v')
             {
-                /* between two ColorStops, blend the color */
-                fracDelta = (frac - fracStart)/(fracEnd - fracStart);
-                clrR = clr->r + (int)((clrDelta->r)*fracDelta);
-                clrG = clr->g + (int)((clrDelta->g)*fracDelta);
-                clrB = clr->b + (int)((clrDelta->b)*fracDelta);
-                clrA = clr->a + (int)((clrDelta->a)*fracDelta);
-                SDL_SetRenderDrawColor(rend, clrR, clrG, clrB, clrA);
+                srcRect.x = 0;
+                srcRect.y = spanStart;
+                srcRect.w = 1;
+                srcRect.h = gCtr - spanStart;
+                dstRect.x = rl.x + spanR0;
+                dstRect.y = rl.y + spanStart;
+                dstRect.w = 1 + spanRf - spanR0;
+                dstRect.h = srcRect.h;
             }
             else
             {
-                /* not between two ColorStops, use a single color */
-                SDL_SetRenderDrawColor(rend, clr->r, clr->g, clr->b, clr->a);
+                srcRect.x = spanStart;
+                srcRect.y = 0;
+                srcRect.w = gCtr - spanStart;
+                srcRect.h = 1;
+                dstRect.x = rl.x + spanStart;
+                dstRect.y = rl.y + spanR0;
+                dstRect.w = srcRect.w;
+                dstRect.h = 1 + spanRf - spanR0;
             }
+            SDL_RenderCopy(rend, gradTex, &srcRect, &dstRect);
+            spanStart = -1;
+        }
 
-            if (maskMap != NULL)
+        if (maskRegions == 1)
+        {
+            /* start a new span */
+            spanStart = gCtr;
+            spanR0    = region0[0];
+            spanRf    = regionf[0];
+        }
+        else
+        {
+            /*----------------------------------------------------------------*/
+            /* Multiple regions (or none) on this line; draw each separately. */
+            /*----------------------------------------------------------------*/
+            for (maskCtr = 0; maskCtr < maskRegions; maskCtr++)
             {
-                /*------------------------------------------------------------*/
-                /* A transparency mask is included, draw unmasked regions.    */
-                /*------------------------------------------------------------*/
-                if (neuik_MaskMap_GetUnmaskedRegionsOnVLine(
-                        maskMap, gCtr, &maskRegions, &regionY0, &regionYf))
+                if (dirn == 'v')
                 {
-                    eNum = 13;
-                    goto out;
+                    srcRect.x = 0;
+                    srcRect.y = gCtr;
+                    srcRect.w = 1;
+                    srcRect.h = 1;
+                    dstRect.x = rl.x + region0[maskCtr];
+                    dstRect.y = rl.y + gCtr;
+                    dstRect.w = 1 + regionf[maskCtr] - region0[maskCtr];
+                    dstRect.h = 1;
                 }
-
-                for (maskCtr = 0; maskCtr < maskRegions; maskCtr++)
+                else
                 {
-                    SDL_RenderDrawLine(rend,
-                        rl.x + gCtr, rl.y + regionY0[maskCtr],
-                        rl.x + gCtr, rl.y + regionYf[maskCtr]);
+                    srcRect.x = gCtr;
+                    srcRect.y = 0;
+                    srcRect.w = 1;
+                    srcRect.h = 1;
+                    dstRect.x = rl.x + gCtr;
+                    dstRect.y = rl.y + region0[maskCtr];
+                    dstRect.w = 1;
+                    dstRect.h = 1 + regionf[maskCtr] - region0[maskCtr];
                 }
-            }
-            else
-            {
-                /*------------------------------------------------------------*/
-                /* There are no masked off (transparent areas) draw full line */
-                /*------------------------------------------------------------*/
-                SDL_RenderDrawLine(rend,
-                    rl.x + gCtr, rl.y,
-                    rl.x + gCtr, rl.y + (rSize.h - 1));
+                SDL_RenderCopy(rend, gradTex, &srcRect, &dstRect);
             }
         }
     }
@@ -3083,10 +3731,9 @@ out:
     if (eNum > 0)
     {
         NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
     }
 
-    if (deltaPP != NULL) free(deltaPP);
-
     return eNum;
 }
 
@@ -3164,6 +3811,7 @@ int neuik_Element_RedrawBackground(
     int                      y0          = 0;    /* first y-position to draw */
     int                      yf          = 0;    /* final y-position to draw */
     int                      eNum        = 0;    /* which error to report (if any) */
+    int                      profiled    = 0;    /* if this call is being profiled */
     int                      maskCtr;            /* maskMap counter */
     int                      maskRegions;        /* number of regions in maskMap */
     const int              * regionX0;           /* Array of region X0 values */
@@ -3187,6 +3835,8 @@ int neuik_Element_RedrawBackground(
         eNum = 1;
         goto out;
     }
+    profiled = neuik_Profile_Begin(
+        NEUIK_PROFILE_REDRAWBACKGROUND, elem, eBase->eSt.window);
 
     rl    = eBase->eSt.rLoc;
     rSize = eBase->eSt.rSize;
@@ -3270,7 +3920,7 @@ int neuik_Element_RedrawBackground(
             break;
         case NEUIK_BGSTYLE_GRADIENT:
             neuik_Element_RedrawBackgroundGradient(
-                elem, bgCfg->grad_desc, rlMod, maskMap, bgCfg->grad_dirn);
+                elem, bgCfg->grad_lut, rlMod, maskMap);
             break;
         case NEUIK_BGSTYLE_TRANSPARENT:
             /*----------------------------------------------------------------*/
@@ -3282,6 +3932,7 @@ int neuik_Element_RedrawBackground(
     /* No errors*/
     ConditionallyDestroyTexture((SDL_Texture **)&(tex));
 out:
+    neuik_Profile_End(profiled);
     if (eNum > 0)
     {
         NEUIK_RaiseError(funcName, errMsgs[eNum]);
@@ -3328,7 +3979,11 @@ int neuik_Element_Resize(
     }
 
     if (eBase->eSt.surf != NULL) SDL_FreeSurface(eBase->eSt.surf);
-    if (eBase->eSt.rend != NULL) SDL_DestroyRenderer(eBase->eSt.rend);
+    if (eBase->eSt.rend != NULL)
+    {
+        neuik_DropRendererTextures(eBase->eSt.rend);
+        SDL_DestroyRenderer(eBase->eSt.rend);
+    }
 
     eBase->eSt.surf = SDL_CreateRGBSurface(0,
         rSize.w, rSize.h, 32, rmask, gmask, bmask, amask);
@@ -19,6 +19,7 @@
 #include "NEUIK_error.h"
 #include "NEUIK_Event.h"
 #include "NEUIK_Event_internal.h"
+#include "NEUIK_UIQueue_internal.h"
 #include "NEUIK_Window.h"
 #include "NEUIK_Window_internal.h"
 
@@ -271,6 +272,7 @@ void NEUIK_EventLoop(
     int                checkMax   = 5;
     int                evCaptured = 0;
     int                didRedraw  = FALSE;
+    unsigned int       waitMs     = 4; /* idle wait; lowered for due frames */
     int                activeWin  = FALSE;
     static int         first      = TRUE;
     NEUIK_Window     * win        = NULL;
@@ -298,6 +300,7 @@ void NEUIK_EventLoop(
     for (;;)
     {
         didRedraw = FALSE;
+        waitMs    = 4;
         SDL_PumpEvents();
 
         /*--------------------------------------------------------------------*/
@@ -323,6 +326,13 @@ void NEUIK_EventLoop(
                 /*------------------------------------------------------------*/
                 break;
             }
+            if (event.type == neuik__UIQueue_EventType)
+            {
+                /*------------------------------------------------------------*/
+                /* Wake-up for posted UI updates; these are applied below.    */
+                /*------------------------------------------------------------*/
+                continue;
+            }
 
             /*----------------------------------------------------------------*/
             /* Check the windows to see if they can capture this event        */
@@ -351,10 +361,23 @@ void NEUIK_EventLoop(
             if (!activeWin) goto out;
         }
 
+        /*--------------------------------------------------------------------*/
+        /* Apply updates posted from other threads (once per iteration, so    */
+        /* that any number of them result in at most a single redraw).        */
+        /*--------------------------------------------------------------------*/
+        neuik_UIQueue_Drain();
+        if (NEUIK_HasErrors()) 
+        {
+            NEUIK_BacktraceErrors();
+            NEUIK_ClearErrors();
+            if (killOnError) goto out;
+        }
+
         if (!first)
         {
             /*----------------------------------------------------------------*/
-            /* Only redraw windows which need to be redrawn                   */
+            /* Only redraw windows which need to be redrawn; a window will    */
+            /* not present more than once per frame interval.                 */
             /*----------------------------------------------------------------*/
             for (ctr = 0; ctr < neuik_windows.cap; ctr++)
             {
@@ -363,7 +386,7 @@ void NEUIK_EventLoop(
 
                 win = next->window;
 
-                if (win->doRedraw)
+                if (neuik_Window_FrameIsDue(win, &waitMs))
                 {
                     NEUIK_Window_Redraw(win);
                     if (NEUIK_HasErrors()) 
@@ -411,9 +434,10 @@ void NEUIK_EventLoop(
         if (!didRedraw)
         {
             /*----------------------------------------------------------------*/
-            /* There were no events handle, just wait for a brief moment.     */
+            /* There were no events handle, just wait for a brief moment (or  */
+            /* until a new event, such as a posted UI update, arrives).       */
             /*----------------------------------------------------------------*/
-            SDL_Delay(4);
+            SDL_WaitEventTimeout(NULL, waitMs);
             continue;
         }
     }
@@ -439,6 +463,7 @@ void NEUIK_EventLoopNoErrHandling()
     int                activeWin  = FALSE;
     int                evCaptured = FALSE;
     int                didRedraw  = FALSE;
+    unsigned int       waitMs     = 4; /* idle wait; lowered for due frames */
     static int         first      = TRUE;
     NEUIK_Window     * win        = NULL;
     neuik_WindowSlot * next       = NULL;
@@ -446,6 +471,7 @@ void NEUIK_EventLoopNoErrHandling()
 
     for (;;) {
         didRedraw = FALSE;
+        waitMs    = 4;
         SDL_PumpEvents();
 
         /*--------------------------------------------------------------------*/
@@ -471,6 +497,13 @@ void NEUIK_EventLoopNoErrHandling()
                 /*------------------------------------------------------------*/
                 break;
             }
+            if (event.type == neuik__UIQueue_EventType)
+            {
+                /*------------------------------------------------------------*/
+                /* Wake-up for posted UI updates; these are applied below.    */
+                /*------------------------------------------------------------*/
+                continue;
+            }
 
             /*----------------------------------------------------------------*/
             /* Check the windows to see if they can capture this event        */
@@ -493,10 +526,17 @@ void NEUIK_EventLoopNoErrHandling()
             if (!activeWin) goto out;
         }
 
+        /*--------------------------------------------------------------------*/
+        /* Apply updates posted from other threads (once per iteration, so    */
+        /* that any number of them result in at most a single redraw).        */
+        /*--------------------------------------------------------------------*/
+        neuik_UIQueue_Drain();
+
         if (!first)
         {
             /*----------------------------------------------------------------*/
-            /* Only redraw windows which need to be redrawn                   */
+            /* Only redraw windows which need to be redrawn; a window will    */
+            /* not present more than once per frame interval.                 */
             /*----------------------------------------------------------------*/
             for (ctr = 0; ctr < neuik_windows.cap; ctr++)
             {
@@ -505,7 +545,7 @@ void NEUIK_EventLoopNoErrHandling()
 
                 win = next->window;
 
-                if (win->doRedraw)
+                if (neuik_Window_FrameIsDue(win, &waitMs))
                 {
                     NEUIK_Window_Redraw(win);
                     didRedraw = TRUE;
@@ -541,9 +581,10 @@ void NEUIK_EventLoopNoErrHandling()
         if (!didRedraw)
         {
             /*----------------------------------------------------------------*/
-            /* There were no events handle, just wait for a brief moment.     */
+            /* There were no events handle, just wait for a brief moment (or  */
+            /* until a new event, such as a posted UI update, arrives).       */
             /*----------------------------------------------------------------*/
-            SDL_Delay(4);
+            SDL_WaitEventTimeout(NULL, waitMs);
             continue;
         }
     }
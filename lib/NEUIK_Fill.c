@@ -101,6 +101,7 @@ int neuik_RegisterClass_Fill()
         "An element which fills vertically or horizontally.", // classDescription
         neuik__Set_NEUIK,                                     // classSet
         neuik__Class_Element,                                 // superClass
+        sizeof(NEUIK_Fill),                                   // objSize
         &neuik_Fill_BaseFuncs,                                // baseFuncs
         NULL,                                                 // classFuncs
         &neuik__Class_Fill))                                  // newClass
@@ -149,7 +150,8 @@ int neuik_Object_New__Fill(
         eNum = 1;
         goto out;
     }
-    (*fillPtr) = (NEUIK_Fill*) malloc(sizeof(NEUIK_Fill));
+    (*fillPtr) = (NEUIK_Fill*) neuik_Object_Alloc(
+        neuik__Class_Fill, (void**)fillPtr);
     fill = *fillPtr;
     if (fill == NULL)
     {
@@ -257,7 +259,7 @@ int neuik_Object_Free__Fill(
         goto out;
     }
 
-    free(fill);
+    neuik_Object_Release(fill);
 out:
     if (eNum > 0)
     {
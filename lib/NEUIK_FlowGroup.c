@@ -105,6 +105,7 @@ int neuik_RegisterClass_FlowGroup()
         "An element container which horizontally groups items.", // classDescription
         neuik__Set_NEUIK,                                        // classSet
         neuik__Class_Container,                                  // superClass
+        sizeof(NEUIK_FlowGroup),                                 // objSize
         &neuik_FlowGroup_BaseFuncs,                              // baseFuncs
         NULL,                                                    // classFuncs
         &neuik__Class_FlowGroup))                                // newClass
@@ -155,7 +156,8 @@ int neuik_Object_New__FlowGroup(
         eNum = 1;
         goto out;
     }
-    (*fgPtr) = (NEUIK_FlowGroup*) malloc(sizeof(NEUIK_FlowGroup));
+    (*fgPtr) = (NEUIK_FlowGroup*) neuik_Object_Alloc(
+        neuik__Class_FlowGroup, (void**)fgPtr);
     fg = *fgPtr;
     if (fg == NULL)
     {
@@ -293,7 +295,7 @@ int neuik_Object_Free__FlowGroup(
         goto out;
     }
 
-    free(fg);
+    neuik_Object_Release(fg);
 out:
     if (eNum > 0)
     {
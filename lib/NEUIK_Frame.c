@@ -105,6 +105,7 @@ int neuik_RegisterClass_Frame()
         "A single element container boxes in an element.", // classDescription
         neuik__Set_NEUIK,                                  // classSet
         neuik__Class_Container,                            // superClass
+        sizeof(NEUIK_Frame),                               // objSize
         &neuik_Frame_BaseFuncs,                            // baseFuncs
         NULL,                                              // classFuncs
         &neuik__Class_Frame))                              // newClass
@@ -156,7 +157,8 @@ int neuik_Object_New__Frame(
         eNum = 1;
         goto out;
     }
-    (*fPtr) = (NEUIK_Frame*) malloc(sizeof(NEUIK_Frame));
+    (*fPtr) = (NEUIK_Frame*) neuik_Object_Alloc(
+        neuik__Class_Frame, (void**)fPtr);
     frame = *fPtr;
     if (frame == NULL)
     {
@@ -274,7 +276,7 @@ int neuik_Object_Free__Frame(
         goto out;
     }
 
-    free(frame);
+    neuik_Object_Release(frame);
 out:
     if (eNum > 0)
     {
@@ -15,6 +15,7 @@
  ******************************************************************************/
 #include <SDL.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 #include <signal.h>
 
@@ -113,6 +114,7 @@ int neuik_RegisterClass_GridLayout()
         "An element container which aligns items vertically and horizontally.", // classDescription
         neuik__Set_NEUIK,                                                       // classSet
         neuik__Class_Container,                                                 // superClass
+        sizeof(NEUIK_GridLayout),                                               // objSize
         &neuik_GridLayout_BaseFuncs,                                            // baseFuncs
         NULL,                                                                   // classFuncs
         &neuik__Class_GridLayout))                                              // newClass
@@ -184,7 +186,8 @@ int neuik_Object_New__GridLayout(
         eNum = 1;
         goto out;
     }
-    (*gridPtr) = (NEUIK_GridLayout*) malloc(sizeof(NEUIK_GridLayout));
+    (*gridPtr) = (NEUIK_GridLayout*) neuik_Object_Alloc(
+        neuik__Class_GridLayout, (void**)gridPtr);
     grid = *gridPtr;
     if (grid == NULL)
     {
@@ -199,6 +202,12 @@ int neuik_Object_New__GridLayout(
     grid->xDim        = 0;
     grid->yDim        = 0;
     grid->squareElems = 0;
+    grid->cells       = NULL;
+    grid->nCells      = 0;
+    grid->nCellsAlloc = 0;
+    grid->cols        = NULL;
+    grid->rows        = NULL;
+    grid->tracksValid = 0;
 
     /*------------------------------------------------------------------------*/
     /* Successful allocation of Memory -- Create Base Class Object            */
@@ -340,7 +349,6 @@ int NEUIK_GridLayout_SetDimensions(
 {
     int               eNum       = 0;
     int               ctr        = 0;
-    int               finalInd   = 0;
     NEUIK_Element     elem       = NULL;
     NEUIK_Container * cBase      = NULL;
     static char       funcName[] = "NEUIK_GridLayout_SetDimensions";
@@ -348,7 +356,6 @@ int NEUIK_GridLayout_SetDimensions(
         "Argument `grid` caused `neuik_Object_GetClassObject` to fail.",  // [1]
         "Failure in function `neuik_Object_Free`.",                       // [2]
         "Failure to allocate memory.",                                    // [3]
-        "Failure to reallocate memory.",                                  // [4]
     };
 
     if (neuik_Object_GetClassObject(grid, neuik__Class_Container, (void**)&cBase))
@@ -357,8 +364,6 @@ int NEUIK_GridLayout_SetDimensions(
         goto out;
     }
 
-    finalInd = grid->xDim * grid->yDim;
-
     /*------------------------------------------------------------------------*/
     /* Conditionally free memory of contained elements before continuing.     */
     /*------------------------------------------------------------------------*/
@@ -366,16 +371,13 @@ int NEUIK_GridLayout_SetDimensions(
     {
         /*--------------------------------------------------------------------*/
         /* Free any old allocated elements before updating GridLayout dims.   */
+        /* Only populated cells are stored, so the elems array is a packed    */
+        /* NULL-terminated list (as with other containers).                   */
         /*--------------------------------------------------------------------*/
-        for (ctr = 0; ctr < finalInd; ctr++)
+        for (ctr = 0;; ctr++)
         {
-            /*----------------------------------------------------------------*/
-            /* A GridLayout is different from other containers in that NULL   */
-            /* values are permitted within the elems array. The total number  */
-            /* of contained elems is defined as xDim * yDim.                  */
-            /*----------------------------------------------------------------*/
             elem = cBase->elems[ctr];
-            if (elem == NULL) continue;
+            if (elem == NULL) break; /* end of NULL-ptr terminated array */
 
             if(neuik_Object_Free(elem))
             {
@@ -386,60 +388,24 @@ int NEUIK_GridLayout_SetDimensions(
             cBase->elems[ctr] = NULL;
         }
     }
-
-    finalInd = xDim * yDim;
-
-    /*------------------------------------------------------------------------*/
-    /* Allocate/Reallocate the Container->elems array.                        */
-    /*------------------------------------------------------------------------*/
-    if (cBase->elems == NULL)
+    else
     {
         /*--------------------------------------------------------------------*/
         /* elems array currently unallocated; allocate now                    */
         /*--------------------------------------------------------------------*/
-        cBase->elems = (NEUIK_Element*)malloc((finalInd+1)*sizeof(NEUIK_Element));
+        cBase->elems = (NEUIK_Element*)malloc(sizeof(NEUIK_Element));
         if (cBase->elems == NULL)
         {
             eNum = 3;
             goto out;
         }
-
-        /*--------------------------------------------------------------------*/
-        /* Set all of the contained pointer values to NULL before continuing. */
-        /*--------------------------------------------------------------------*/
-        for (ctr = 0; ctr < finalInd; ctr++)
-        {
-            cBase->elems[ctr] = NULL;
-        }
-
-        cBase->n_allocated = finalInd;
-        cBase->n_used      = 0;
+        cBase->elems[0]    = NULL; /* NULLptr terminated array */
+        cBase->n_allocated = 0;
     }
-    else if (cBase->n_allocated < finalInd)
-    {
-        /*--------------------------------------------------------------------*/
-        /* The new size is larger than the old, reallocate memory.            */
-        /* This pointer array will be null terminated.                        */
-        /*--------------------------------------------------------------------*/
-        cBase->elems = (NEUIK_Element*)realloc(cBase->elems, 
-            (finalInd+1)*sizeof(NEUIK_Element));
-        if (cBase->elems == NULL)
-        {
-            eNum = 4;
-            goto out;
-        }
-
-        /*--------------------------------------------------------------------*/
-        /* Set all of the contained pointer values to NULL before continuing. */
-        /*--------------------------------------------------------------------*/
-        for (ctr = 0; ctr < finalInd; ctr++)
-        {
-            cBase->elems[ctr] = NULL;
-        }
+    cBase->n_used = 0;
 
-        cBase->n_allocated = finalInd;
-        cBase->n_used      = 0;
-    }
+    grid->nCells      = 0;
+    grid->tracksValid = 0;
 
     /*------------------------------------------------------------------------*/
     /* Store the new overall GridLayout dimensions.                           */
@@ -499,7 +465,10 @@ int neuik_Object_Free__GridLayout(
         goto out;
     }
 
-    free(grid);
+    if (grid->cells != NULL) free(grid->cells);
+    if (grid->cols  != NULL) free(grid->cols);
+    if (grid->rows  != NULL) free(grid->rows);
+    neuik_Object_Release(grid);
 out:
     if (eNum > 0)
     {
@@ -511,6 +480,262 @@ out:
 }
 
 
+/*******************************************************************************
+ *
+ *  Name:          neuik_GridLayout_FindCell
+ *
+ *  Description:   Binary search the (sorted) populated cells of a GridLayout 
+ *                 for the cell at the specified grid offset.
+ *
+ *  Returns:       1 if the cell is populated, 0 otherwise. `*index` is set to
+ *                 the index of the cell or, if it is not populated, the index 
+ *                 at which it would be inserted.
+ *
+ ******************************************************************************/
+static int neuik_GridLayout_FindCell(
+    NEUIK_GridLayout * grid,
+    unsigned int       pos,
+    unsigned int     * index)
+{
+    unsigned int lo  = 0;
+    unsigned int hi  = grid->nCells;
+    unsigned int mid = 0;
+
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo)/2;
+        if (grid->cells[mid].pos < pos)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    *index = lo;
+
+    return (lo < grid->nCells && grid->cells[lo].pos == pos);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_GridLayout_SyncCells
+ *
+ *  Description:   Drop any cells whose elements have been removed from the 
+ *                 container through the generic Container functions (e.g., 
+ *                 `NEUIK_Container_RemoveElement()`). These functions keep the 
+ *                 remaining elements in order, so a single merge pass suffices.
+ *
+ ******************************************************************************/
+static void neuik_GridLayout_SyncCells(
+    NEUIK_GridLayout * grid,
+    NEUIK_Container  * cBase)
+{
+    unsigned int ctr   = 0;
+    unsigned int nKept = 0;
+
+    if (grid->nCells == cBase->n_used) return;
+
+    for (ctr = 0; ctr < grid->nCells; ctr++)
+    {
+        if (cBase->elems == NULL || cBase->elems[nKept] == NULL) break;
+        if (grid->cells[ctr].elem != cBase->elems[nKept]) continue;
+
+        grid->cells[nKept] = grid->cells[ctr];
+        nKept++;
+    }
+    grid->nCells      = nKept;
+    grid->tracksValid = 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_GridLayout_UpdateTracks
+ *
+ *  Description:   Bring the cached row/column tracks of a GridLayout up to 
+ *                 date. Each populated cell remembers the padded minimum size 
+ *                 it last contributed; only cells whose contribution changed 
+ *                 touch their tracks. A track is only rescanned (from the 
+ *                 cached cell values) when the cell which set its maximum 
+ *                 shrinks.
+ *
+ *                 Child minimum sizes are themselves cached by the elements, 
+ *                 so an unchanged cell costs a lookup rather than a layout.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_GridLayout_UpdateTracks(
+    NEUIK_GridLayout * grid,
+    NEUIK_Container  * cBase)
+{
+    int                   eNum       = 0; /* which error to report (if any) */
+    int                   nDirty     = 0;
+    int                   shown      = 0;
+    int                   padW       = 0;
+    int                   padH       = 0;
+    int                   hFill      = 0;
+    int                   vFill      = 0;
+    unsigned int          ctr        = 0;
+    RenderSize            rs         = {0, 0};
+    static RenderSize     rsZero     = {0, 0};
+    neuik_GridCell      * cell       = NULL;
+    neuik_GridTrack     * col        = NULL;
+    neuik_GridTrack     * row        = NULL;
+    NEUIK_ElementConfig * eCfg       = NULL;
+    static char           funcName[] = "neuik_GridLayout_UpdateTracks";
+    static char         * errMsgs[]  = {"",   // [0] no error
+        "Failure to allocate memory.",        // [1]
+        "Element_GetConfig returned NULL.",   // [2]
+        "Element_GetMinSize Failed.",         // [3]
+    };
+
+    neuik_GridLayout_SyncCells(grid, cBase);
+
+    if (!grid->tracksValid)
+    {
+        /*--------------------------------------------------------------------*/
+        /* The grid dimensions or the set of cells changed; start over from   */
+        /* empty tracks and treat every cell as not yet measured.             */
+        /*--------------------------------------------------------------------*/
+        if (grid->cols != NULL) free(grid->cols);
+        if (grid->rows != NULL) free(grid->rows);
+        grid->cols = calloc(grid->xDim + 1, sizeof(neuik_GridTrack));
+        grid->rows = calloc(grid->yDim + 1, sizeof(neuik_GridTrack));
+        if (grid->cols == NULL || grid->rows == NULL)
+        {
+            eNum = 1;
+            goto out;
+        }
+
+        for (ctr = 0; ctr < grid->nCells; ctr++)
+        {
+            cell = &grid->cells[ctr];
+            cell->shown = 0;
+            cell->minSz = rsZero;
+            cell->padW  = 0;
+            cell->padH  = 0;
+            cell->hFill = 0;
+            cell->vFill = 0;
+        }
+        grid->tracksValid = 1;
+    }
+
+    for (ctr = 0; ctr < grid->nCells; ctr++)
+    {
+        cell = &grid->cells[ctr];
+        col  = &grid->cols[cell->pos % grid->xDim];
+        row  = &grid->rows[cell->pos / grid->xDim];
+
+        padW  = 0;
+        padH  = 0;
+        hFill = 0;
+        vFill = 0;
+        rs    = rsZero;
+
+        shown = NEUIK_Element_IsShown(cell->elem);
+        if (shown)
+        {
+            eCfg = neuik_Element_GetConfig(cell->elem);
+            if (eCfg == NULL)
+            {
+                eNum = 2;
+                goto out;
+            }
+            if (neuik_Element_GetMinSize(cell->elem, &rs))
+            {
+                eNum = 3;
+                goto out;
+            }
+            padW  = rs.w + (eCfg->PadLeft + eCfg->PadRight);
+            padH  = rs.h + (eCfg->PadTop + eCfg->PadBottom);
+            hFill = eCfg->HFill ? 1 : 0;
+            vFill = eCfg->VFill ? 1 : 0;
+        }
+        cell->shown = shown;
+        cell->minSz = rs;
+
+        /*--------------------------------------------------------------------*/
+        /* A growing cell can raise its track directly; a cell which shrinks  */
+        /* away from the track maximum requires the track to be rescanned.    */
+        /*--------------------------------------------------------------------*/
+        if (padW != cell->padW)
+        {
+            if (padW > col->minSz)
+            {
+                col->minSz = padW;
+            }
+            else if (cell->padW == col->minSz && !col->dirty)
+            {
+                col->dirty = 1;
+                nDirty++;
+            }
+            cell->padW = padW;
+        }
+        if (padH != cell->padH)
+        {
+            if (padH > row->minSz)
+            {
+                row->minSz = padH;
+            }
+            else if (cell->padH == row->minSz && !row->dirty)
+            {
+                row->dirty = 1;
+                nDirty++;
+            }
+            cell->padH = padH;
+        }
+        col->nFill += hFill - cell->hFill;
+        row->nFill += vFill - cell->vFill;
+        cell->hFill = hFill;
+        cell->vFill = vFill;
+    }
+
+    if (nDirty == 0) goto out;
+
+    /*------------------------------------------------------------------------*/
+    /* Rescan the dirty tracks using the (now current) cached cell values.    */
+    /*------------------------------------------------------------------------*/
+    for (ctr = 0; ctr < grid->xDim; ctr++)
+    {
+        if (grid->cols[ctr].dirty) grid->cols[ctr].minSz = 0;
+    }
+    for (ctr = 0; ctr < grid->yDim; ctr++)
+    {
+        if (grid->rows[ctr].dirty) grid->rows[ctr].minSz = 0;
+    }
+    for (ctr = 0; ctr < grid->nCells; ctr++)
+    {
+        cell = &grid->cells[ctr];
+        col  = &grid->cols[cell->pos % grid->xDim];
+        row  = &grid->rows[cell->pos / grid->xDim];
+
+        if (col->dirty && cell->padW > col->minSz) col->minSz = cell->padW;
+        if (row->dirty && cell->padH > row->minSz) row->minSz = cell->padH;
+    }
+    for (ctr = 0; ctr < grid->xDim; ctr++)
+    {
+        grid->cols[ctr].dirty = 0;
+    }
+    for (ctr = 0; ctr < grid->yDim; ctr++)
+    {
+        grid->rows[ctr].dirty = 0;
+    }
+out:
+    if (eNum > 0)
+    {
+        grid->tracksValid = 0;
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
 /*******************************************************************************
  *
  *  Name:          NEUIK_GridLayout_SetHSpacing
@@ -701,7 +926,7 @@ int NEUIK_GridLayout_GetElementAt(
     NEUIK_Element    * elem)
 {
     int                 eNum       = 0;    /* which error to report (if any) */
-    int                 offset     = 0;
+    unsigned int        index      = 0;
     NEUIK_Container   * cBase      = NULL;
     static char         funcName[] = "NEUIK_GridLayout_GetElementAt";
     static char       * errMsgs[]  = {"",                                // [0] no error
@@ -742,8 +967,13 @@ int NEUIK_GridLayout_GetElementAt(
         goto out;
     }
 
-    offset = xLoc + yLoc*(grid->xDim);
-    *elem = cBase->elems[offset];
+    neuik_GridLayout_SyncCells(grid, cBase);
+
+    *elem = NULL;
+    if (neuik_GridLayout_FindCell(grid, xLoc + yLoc*(grid->xDim), &index))
+    {
+        *elem = grid->cells[index].elem;
+    }
 out:
     if (eNum > 0)
     {
@@ -773,8 +1003,7 @@ int NEUIK_GridLayout_GetElementPos(
     int              * yLoc)
 {
     int                 eNum       = 0;    /* which error to report (if any) */
-    int                 ctr        = 0;
-    int                 nAlloc     = 0;
+    unsigned int        ctr        = 0;
     NEUIK_Container   * cBase      = NULL;
     static char         funcName[] = "NEUIK_GridLayout_GetElementPos";
     static char       * errMsgs[]  = {"",                                // [0] no error
@@ -824,15 +1053,16 @@ int NEUIK_GridLayout_GetElementPos(
     *xLoc    = 0;
     *yLoc    = 0;
 
-    nAlloc = grid->xDim*grid->yDim;
+    neuik_GridLayout_SyncCells(grid, cBase);
 
-    for (ctr = 0; ctr < nAlloc; ctr++)
+    for (ctr = 0; ctr < grid->nCells; ctr++)
     {
-        if (cBase->elems[ctr] == elem)
+        if (grid->cells[ctr].elem == elem)
         {
             *hasElem = 1;
-            *xLoc = ctr % grid->xDim;
-            *yLoc = (ctr - (*xLoc)) / grid->xDim;
+            *xLoc = grid->cells[ctr].pos % grid->xDim;
+            *yLoc = grid->cells[ctr].pos / grid->xDim;
+            break;
         }
     }
 out:
@@ -864,7 +1094,11 @@ int NEUIK_GridLayout_SetElementAt(
     NEUIK_Element      elem)
 {
     int                 eNum       = 0;    /* which error to report (if any) */
-    int                 offset     = 0;
+    unsigned int        pos        = 0;
+    unsigned int        index      = 0;
+    unsigned int        nAlloc     = 0;
+    neuik_GridCell    * cells      = NULL;
+    NEUIK_Element     * elems      = NULL;
     NEUIK_ElementBase * eBase      = NULL;
     NEUIK_Container   * cBase      = NULL;
     static char         funcName[] = "NEUIK_GridLayout_SetElementAt";
@@ -874,6 +1108,7 @@ int NEUIK_GridLayout_SetElementAt(
         "Argument `elem` does not implement Element class.",             // [3]
         "Argument `xLoc` is beyond specified `xDim` of GridLayout.",     // [4]
         "Argument `yLoc` is beyond specified `yDim` of GridLayout.",     // [5]
+        "Failure to allocate memory.",                                   // [6]
     };
 
     if (!neuik_Object_IsClass(grid, neuik__Class_GridLayout))
@@ -906,8 +1141,70 @@ int NEUIK_GridLayout_SetElementAt(
         goto out;
     }
 
-    offset = xLoc + yLoc*(grid->xDim);
-    cBase->elems[offset] = elem;
+    pos = xLoc + yLoc*(grid->xDim);
+    neuik_GridLayout_SyncCells(grid, cBase);
+
+    if (neuik_GridLayout_FindCell(grid, pos, &index))
+    {
+        /*--------------------------------------------------------------------*/
+        /* Replace the element stored within an already populated cell.       */
+        /*--------------------------------------------------------------------*/
+        grid->cells[index].elem = elem;
+        cBase->elems[index]     = elem;
+    }
+    else
+    {
+        /*--------------------------------------------------------------------*/
+        /* Only populated cells are stored; grow the cell list (and the       */
+        /* matching NULL-terminated elems list) as needed.                    */
+        /*--------------------------------------------------------------------*/
+        if (grid->nCells >= grid->nCellsAlloc)
+        {
+            nAlloc = (grid->nCellsAlloc > 0) ? 2*grid->nCellsAlloc : 4;
+
+            cells = (neuik_GridCell*)realloc(grid->cells, 
+                nAlloc*sizeof(neuik_GridCell));
+            if (cells == NULL)
+            {
+                eNum = 6;
+                goto out;
+            }
+            grid->cells = cells;
+
+            elems = (NEUIK_Element*)realloc(cBase->elems, 
+                (nAlloc+1)*sizeof(NEUIK_Element));
+            if (elems == NULL)
+            {
+                eNum = 6;
+                goto out;
+            }
+            cBase->elems       = elems;
+            cBase->n_allocated = nAlloc;
+            grid->nCellsAlloc  = nAlloc;
+        }
+
+        /*--------------------------------------------------------------------*/
+        /* Insert the new cell such that the cells remain sorted by position. */
+        /*--------------------------------------------------------------------*/
+        memmove(&grid->cells[index+1], &grid->cells[index], 
+            (grid->nCells - index)*sizeof(neuik_GridCell));
+        memmove(&cBase->elems[index+1], &cBase->elems[index], 
+            (grid->nCells - index)*sizeof(NEUIK_Element));
+
+        grid->cells[index].elem  = elem;
+        grid->cells[index].pos   = pos;
+        grid->cells[index].shown = 0;
+        grid->cells[index].padW  = 0;
+        grid->cells[index].padH  = 0;
+        grid->cells[index].hFill = 0;
+        grid->cells[index].vFill = 0;
+        cBase->elems[index]      = elem;
+
+        grid->nCells++;
+        cBase->n_used = grid->nCells;
+        cBase->elems[grid->nCells] = NULL; /* NULLptr terminated array */
+    }
+    grid->tracksValid = 0;
 
     /*------------------------------------------------------------------------*/
     /* Set the Window and Parent Element pointers                             */
@@ -1195,7 +1492,6 @@ int neuik_Element_IsShown__GridLayout(
 {
     int                 isShown  = 0;
     int                 ctr      = 0;
-    int                 nAlloc   = 0;
     NEUIK_Element       elem;
     NEUIK_ElementBase * eBase;
     NEUIK_Container   * cBase = NULL;
@@ -1237,8 +1533,7 @@ int neuik_Element_IsShown__GridLayout(
     /*------------------------------------------------------------------------*/
     /* Check if the GridLayout has valid dimensions first...                  */
     /*------------------------------------------------------------------------*/
-    nAlloc = grid->xDim*grid->yDim;
-    if (nAlloc == 0)
+    if (grid->xDim*grid->yDim == 0)
     {
         goto out;
     }
@@ -1248,11 +1543,11 @@ int neuik_Element_IsShown__GridLayout(
     /*------------------------------------------------------------------------*/
     if (cBase->elems == NULL) goto out;
 
-    for (ctr = 0; ctr < nAlloc; ctr++)
+    for (ctr = 0;; ctr++)
     {
         elem = cBase->elems[ctr];
-        if (elem == NULL) continue;
-        
+        if (elem == NULL) break; /* end of NULL-ptr terminated array */
+
         if (NEUIK_Element_IsShown(elem))
         {
             if (neuik_HasFatalError())
@@ -1287,41 +1582,20 @@ int neuik_Element_GetMinSize__GridLayout(
     RenderSize    * rSize)
 {
     int                    eNum          = 0; /* which error to report (if any) */
-    int                    tempH;
-    int                    tempW;
-    int                    nAlloc        = 0;
-    int                    rowCtr        = 0;
-    int                    colCtr        = 0;
-    int                    offset        = 0;
-    int                    ctr           = 0;
+    unsigned int           ctr           = 0;
     int                    maxMin        = 0;    // Max Min (of widths and heights)
     float                  fltH          = 0.0;  // Floating point elem height
     float                  fltW          = 0.0;  // Floating point elem width
     float                  fltHspacingSc = 0.0;  // float VSpacing HighDPI scaled
     float                  fltVspacingSc = 0.0;  // float VSpacing HighDPI scaled
-    RenderSize           * rs            = NULL;
-    NEUIK_Element          elem          = NULL;
     NEUIK_ElementBase    * eBase         = NULL;
-    NEUIK_ElementConfig  * eCfg          = NULL;
-    int                  * allMaxMinH    = NULL; // Free upon returning; 
-                                                 // The max min width (per row)
-    int                  * allMaxMinW    = NULL; // Free upon returning; 
-                                                 // The max min width (per column)
-    int                  * elemsValid    = NULL; // Free upon returning.
-    int                  * elemsShown    = NULL; // Free upon returning.
-    RenderSize           * elemsMinSz    = NULL; // Free upon returning.
-    NEUIK_ElementConfig ** elemsCfg      = NULL; // Free upon returning.
-
-    static RenderSize     rsZero      = {0, 0};
     NEUIK_Container      * cont       = NULL;
     NEUIK_GridLayout     * grid       = NULL;
     static char            funcName[] = "neuik_Element_GetMinSize__GridLayout";
     static char          * errMsgs[]  = {"",                                 // [0] no error
         "Argument `gridElem` is not of GridLayout class.",                   // [1]
-        "Element_GetMinSize Failed.",                                        // [2]
-        "Element_GetConfig returned NULL.",                                  // [3]
-        "Argument `gridElem` caused `neuik_Object_GetClassObject` to fail.", // [4]
-        "Failure to allocate memory.",                                       // [5]
+        "Failure in `neuik_GridLayout_UpdateTracks()`.",                     // [2]
+        "Argument `gridElem` caused `neuik_Object_GetClassObject` to fail.", // [3]
     };
 
     rSize->w = 0;
@@ -1339,12 +1613,12 @@ int neuik_Element_GetMinSize__GridLayout(
 
     if (neuik_Object_GetClassObject(gridElem, neuik__Class_Container, (void**)&cont))
     {
-        eNum = 4;
+        eNum = 3;
         goto out;
     }
     if (neuik_Object_GetClassObject(gridElem, neuik__Class_Element, (void**)&eBase))
     {
-        eNum = 4;
+        eNum = 3;
         goto out;
     }
 
@@ -1365,150 +1639,27 @@ int neuik_Element_GetMinSize__GridLayout(
     }
 
     /*------------------------------------------------------------------------*/
-    /* Allocate memory for the calculated maximum minimum values.             */
+    /* Bring the cached maximum minimum widths (per column) and heights (per  */
+    /* row) up to date; only cells whose minimum size changed are revisited.  */
     /*------------------------------------------------------------------------*/
-    allMaxMinW = malloc(grid->xDim*sizeof(int));
-    if (allMaxMinW == NULL)
+    if (neuik_GridLayout_UpdateTracks(grid, cont))
     {
-        eNum = 5;
-        goto out;
-    }
-    allMaxMinH = malloc(grid->yDim*sizeof(int));
-    if (allMaxMinH == NULL)
-    {
-        eNum = 5;
+        eNum = 2;
         goto out;
     }
 
-    /*------------------------------------------------------------------------*/
-    /* Zero out the initial maximum minimum values.                           */
-    /*------------------------------------------------------------------------*/
     for (ctr = 0; ctr < grid->xDim; ctr++)
     {
-        allMaxMinW[ctr] = 0;
-    }
-    for (ctr = 0; ctr < grid->yDim; ctr++)
-    {
-        allMaxMinH[ctr] = 0;
-    }
-
-    /*------------------------------------------------------------------------*/
-    /* Allocate memory for lists of contained element properties.             */
-    /*------------------------------------------------------------------------*/
-    nAlloc = grid->xDim*grid->yDim;
-    elemsCfg = malloc(nAlloc*sizeof(NEUIK_ElementConfig*));
-    if (elemsCfg == NULL)
-    {
-        eNum = 5;
-        goto out;
-    }
-    elemsValid = malloc(nAlloc*sizeof(int));
-    if (elemsValid == NULL)
-    {
-        eNum = 5;
-        goto out;
-    }
-    elemsShown = malloc(nAlloc*sizeof(int));
-    if (elemsShown == NULL)
-    {
-        eNum = 5;
-        goto out;
-    }
-    elemsMinSz = malloc(nAlloc*sizeof(RenderSize));
-    if (elemsMinSz == NULL)
-    {
-        eNum = 5;
-        goto out;
-    }
-
-    /*------------------------------------------------------------------------*/
-    /* Store the current properties for the contained elements.               */
-    /*------------------------------------------------------------------------*/
-    for (ctr = 0; ctr < nAlloc; ctr++)
-    {
-        /*--------------------------------------------------------------------*/
-        /* A GridLayout is different from other containers in that NULL       */
-        /* values are permitted within the elems array. The total number of   */
-        /* contained elems is defined as xDim * yDim.                         */
-        /*--------------------------------------------------------------------*/
-        elemsValid[ctr] = 0;
-        elem = cont->elems[ctr];
-        if (elem == NULL) continue;
-        elemsValid[ctr] = 1;
-
-        elemsShown[ctr] = NEUIK_Element_IsShown(elem);
-        if (!elemsShown[ctr]) continue;
-
-        elemsCfg[ctr] = neuik_Element_GetConfig(elem);
-        if (elemsCfg[ctr] == NULL)
+        if (grid->cols[ctr].minSz > maxMin)
         {
-            eNum = 3;
-            goto out;
-        }
-
-        elemsMinSz[ctr] = rsZero;
-        if (neuik_Element_GetMinSize(elem, &elemsMinSz[ctr]))
-        {
-            eNum = 2;
-            goto out;
-        }
-    }
-
-    /*------------------------------------------------------------------------*/
-    /* Calculate the maximum minimum heights required for all of the rows.    */
-    /* (i.e., for each row of elements, determine the maximum value of the    */
-    /* minimum heights required (among elements in the row)).                 */
-    /*------------------------------------------------------------------------*/
-    for (rowCtr = 0; rowCtr < grid->yDim; rowCtr++)
-    {
-        for (colCtr = 0; colCtr < grid->xDim; colCtr++)
-        {
-            offset = colCtr + rowCtr*(grid->xDim);
-
-            if (!elemsValid[offset]) continue; /* no elem at this location */
-            if (!elemsShown[offset]) continue; /* this elem isn't shown */
-
-            eCfg = elemsCfg[offset];
-            rs   = &elemsMinSz[offset];
-
-            tempH = rs->h + (eCfg->PadTop + eCfg->PadBottom);
-            if (tempH > allMaxMinH[rowCtr])
-            {
-                allMaxMinH[rowCtr] = tempH;
-            }
-            if (tempH > maxMin)
-            {
-                maxMin = tempH;
-            }
+            maxMin = grid->cols[ctr].minSz;
         }
     }
-
-    /*------------------------------------------------------------------------*/
-    /* Calculate the maximum minimum widths required for all of the columns.  */
-    /* (i.e., for each column of elements, determine the maximum value of the */
-    /* minimum widths required (among elements in the column)).               */
-    /*------------------------------------------------------------------------*/
-    for (colCtr = 0; colCtr < grid->xDim; colCtr++)
+    for (ctr = 0; ctr < grid->yDim; ctr++)
     {
-        for (rowCtr = 0; rowCtr < grid->yDim; rowCtr++)
+        if (grid->rows[ctr].minSz > maxMin)
         {
-            offset = colCtr + rowCtr*(grid->xDim);
-
-            if (!elemsValid[offset]) continue; /* no elem at this location */
-            if (!elemsShown[offset]) continue; /* this elem isn't shown */
-
-            eCfg = elemsCfg[offset];
-            rs   = &elemsMinSz[offset];
-
-            tempW = rs->w + (eCfg->PadLeft + eCfg->PadRight);
-            if (tempW > allMaxMinW[colCtr])
-            {
-                allMaxMinW[colCtr] = tempW;
-            }
-            if (tempW > maxMin)
-            {
-                maxMin = tempW;
-            }
+            maxMin = grid->rows[ctr].minSz;
         }
     }
 
@@ -1533,7 +1684,7 @@ int neuik_Element_GetMinSize__GridLayout(
         /*--------------------------------------------------------------------*/
         for (ctr = 0; ctr < grid->xDim; ctr++)
         {
-            fltW += (float)(allMaxMinW[ctr]);
+            fltW += (float)(grid->cols[ctr].minSz);
         }
         if (grid->xDim > 1)
         {
@@ -1563,7 +1714,7 @@ int neuik_Element_GetMinSize__GridLayout(
         /*--------------------------------------------------------------------*/
         for (ctr = 0; ctr < grid->yDim; ctr++)
         {
-            fltH += (float)(allMaxMinH[ctr]);
+            fltH += (float)(grid->rows[ctr].minSz);
         }
         if (grid->yDim > 1)
         {
@@ -1572,13 +1723,6 @@ int neuik_Element_GetMinSize__GridLayout(
     }
     rSize->h = (int)(fltH);
 out:
-    if (allMaxMinW != NULL) free(allMaxMinW);
-    if (allMaxMinH != NULL) free(allMaxMinH);
-    if (elemsCfg != NULL)   free(elemsCfg);
-    if (elemsShown != NULL) free(elemsShown);
-    if (elemsValid != NULL) free(elemsValid);
-    if (elemsMinSz != NULL) free(elemsMinSz);
-
     if (eNum > 0)
     {
         NEUIK_RaiseError(funcName, errMsgs[eNum]);
@@ -1605,13 +1749,11 @@ int neuik_Element_Render__GridLayout(
     SDL_Renderer  * xRend,    /* the external renderer to prepare the texture for */
     int             mock)     /* If true; calculate sizes/locations but don't draw */
 {
-    int                    nAlloc        = 0;
     int                    tempH         = 0;
     int                    tempW         = 0;
-    int                    rowCtr        = 0;
-    int                    colCtr        = 0;
-    int                    offset        = 0;
-    int                    ctr           = 0;
+    unsigned int           rowCtr        = 0;
+    unsigned int           colCtr        = 0;
+    unsigned int           ctr           = 0;
     int                    squarePadH    = 0; // px of height lost to keep aspect
     int                    squarePadW    = 0; // px of width lost to keep aspect
     int                    xFree         = 0; // px of space free for hFill elems
@@ -1633,27 +1775,14 @@ int neuik_Element_Render__GridLayout(
     float                  yPos          = 0.0;
     float                  fltHspacingSc = 0.0;  // float VSpacing HighDPI scaled
     float                  fltVspacingSc = 0.0;  // float VSpacing HighDPI scaled
-    int                  * allHFill      = NULL; // Free upon returning; 
-                                                 // Cols fills vertically? (per col)
-    int                  * allVFill      = NULL; // Free upon returning; 
-                                                 // Row fills vertically? (per row)
-    int                  * allMaxMinH    = NULL; // Free upon returning; 
-                                                 // The max min width (per row)
-    int                  * allMaxMinW    = NULL; // Free upon returning; 
-                                                 // The max min width (per column)
-    int                  * rendColW      = NULL; // Free upon returning; 
-                                                 // Rendered col width (per column)
-    int                  * rendRowH      = NULL; // Free upon returning; 
-                                                 // Rendered row height (per row)
-    int                  * elemsValid    = NULL; // Free upon returning.
-    int                  * elemsShown    = NULL; // Free upon returning.
-    RenderSize           * elemsMinSz    = NULL; // Free upon returning.
-    NEUIK_ElementConfig ** elemsCfg      = NULL; // Free upon returning.
+    neuik_GridCell       * cell          = NULL;
+    neuik_GridTrack      * cols          = NULL; // cached column tracks
+    neuik_GridTrack      * rows          = NULL; // cached row tracks
     RenderLoc              rl;
     RenderLoc              rlRel         = {0, 0}; /* renderloc relative to parent */
     SDL_Rect               rect          = {0, 0, 0, 0};
-    static RenderSize      rsZero        = {0, 0};
     RenderSize             rsMin         = {0, 0};
+    RenderSize             rsElem        = {0, 0};
     RenderSize           * rs            = NULL;
     SDL_Renderer         * rend          = NULL;
     NEUIK_Container      * cont          = NULL;
@@ -1668,7 +1797,7 @@ int neuik_Element_Render__GridLayout(
         "Argument `gridElem` is not of GridLayout class.",                   // [1]
         "Failure in `neuik_Element_Render()`",                               // [2]
         "Element_GetConfig returned NULL.",                                  // [3]
-        "Element_GetMinSize Failed.",                                        // [4]
+        "Failure in `neuik_GridLayout_UpdateTracks()`.",                     // [4]
         "Failure to allocate memory.",                                       // [5]
         "Invalid specified `rSize` (negative values).",                      // [6]
         "Failure in `neuik_Element_GetCurrentBGStyle()`.",                   // [7]
@@ -1760,189 +1889,28 @@ int neuik_Element_Render__GridLayout(
     }
 
     /*------------------------------------------------------------------------*/
-    /* Allocate memory for the calculated maximum minimum values, the         */
-    /* VFill/HFill flags, and for the rendered row/column heights/widths.     */
+    /* Bring the cached maximum minimum widths (per column) and heights (per  */
+    /* row), along with the HFill/VFill counts, up to date. Only cells whose  */
+    /* minimum size changed since the last layout are revisited.              */
     /*------------------------------------------------------------------------*/
-    allMaxMinW = malloc(grid->xDim*sizeof(int));
-    if (allMaxMinW == NULL)
+    if (neuik_GridLayout_UpdateTracks(grid, cont))
     {
-        eNum = 5;
-        goto out;
-    }
-    allMaxMinH = malloc(grid->yDim*sizeof(int));
-    if (allMaxMinH == NULL)
-    {
-        eNum = 5;
-        goto out;
-    }
-    allHFill = malloc(grid->xDim*sizeof(int));
-    if (allHFill == NULL)
-    {
-        eNum = 5;
-        goto out;
-    }
-    allVFill = malloc(grid->yDim*sizeof(int));
-    if (allVFill == NULL)
-    {
-        eNum = 5;
-        goto out;
-    }
-    rendRowH = malloc(grid->yDim*sizeof(int));
-    if (rendRowH == NULL)
-    {
-        eNum = 5;
-        goto out;
-    }
-    rendColW = malloc(grid->xDim*sizeof(int));
-    if (rendColW == NULL)
-    {
-        eNum = 5;
+        eNum = 4;
         goto out;
     }
-
+    cols = grid->cols;
+    rows = grid->rows;
 
     /*------------------------------------------------------------------------*/
-    /* Zero out the initial maximum minimum values and HFill/VFill flags.     */
+    /* The rendered track sizes start out as the maximum minimum values.      */
     /*------------------------------------------------------------------------*/
     for (ctr = 0; ctr < grid->xDim; ctr++)
     {
-        allMaxMinW[ctr] = 0;
-        allHFill[ctr]   = 0;
+        cols[ctr].rendSz = cols[ctr].minSz;
     }
     for (ctr = 0; ctr < grid->yDim; ctr++)
     {
-        allMaxMinH[ctr] = 0;
-        allVFill[ctr]   = 0;
-    }
-
-    /*------------------------------------------------------------------------*/
-    /* Allocate memory for lists of contained element properties.             */
-    /*------------------------------------------------------------------------*/
-    nAlloc = grid->xDim*grid->yDim;
-    elemsCfg = malloc(nAlloc*sizeof(NEUIK_ElementConfig*));
-    if (elemsCfg == NULL)
-    {
-        eNum = 5;
-        goto out;
-    }
-    elemsValid = malloc(nAlloc*sizeof(int));
-    if (elemsValid == NULL)
-    {
-        eNum = 5;
-        goto out;
-    }
-    elemsShown = malloc(nAlloc*sizeof(int));
-    if (elemsShown == NULL)
-    {
-        eNum = 5;
-        goto out;
-    }
-    elemsMinSz = malloc(nAlloc*sizeof(RenderSize));
-    if (elemsMinSz == NULL)
-    {
-        eNum = 5;
-        goto out;
-    }
-
-    /*------------------------------------------------------------------------*/
-    /* Store the current properties for the contained elements.               */
-    /*------------------------------------------------------------------------*/
-    for (ctr = 0; ctr < nAlloc; ctr++)
-    {
-        /*--------------------------------------------------------------------*/
-        /* A GridLayout is different from other containers in that NULL       */
-        /* values are permitted within the elems array. The total number of   */
-        /* contained elems is defined as xDim * yDim.                         */
-        /*--------------------------------------------------------------------*/
-        elemsValid[ctr] = 0;
-        elem = cont->elems[ctr];
-        if (elem == NULL) continue;
-        elemsValid[ctr] = 1;
-
-        elemsShown[ctr] = NEUIK_Element_IsShown(elem);
-        if (!elemsShown[ctr]) continue;
-
-        elemsCfg[ctr] = neuik_Element_GetConfig(elem);
-        if (elemsCfg[ctr] == NULL)
-        {
-            eNum = 3;
-            goto out;
-        }
-
-        elemsMinSz[ctr] = rsZero;
-        if (neuik_Element_GetMinSize(elem, &elemsMinSz[ctr]))
-        {
-            eNum = 2;
-            goto out;
-        }
-    }
-
-    /*------------------------------------------------------------------------*/
-    /* Calculate the maximum minimum heights required for all of the rows.    */
-    /* (i.e., for each row of elements, determine the maximum value of the    */
-    /* minimum heights required (among elements in the row)).                 */
-    /*------------------------------------------------------------------------*/
-    for (rowCtr = 0; rowCtr < grid->yDim; rowCtr++)
-    {
-        for (colCtr = 0; colCtr < grid->xDim; colCtr++)
-        {
-            offset = colCtr + rowCtr*(grid->xDim);
-
-            if (!elemsValid[offset]) continue; /* no elem at this location */
-            if (!elemsShown[offset]) continue; /* this elem isn't shown */
-
-            eCfg = elemsCfg[offset];
-            rs   = &elemsMinSz[offset];
-
-            tempH = rs->h + (eCfg->PadTop + eCfg->PadBottom);
-            if (tempH > allMaxMinH[rowCtr])
-            {
-                allMaxMinH[rowCtr] = tempH;
-            }
-
-            /*----------------------------------------------------------------*/
-            /* Check if the element can fill vertically and if so, mark the   */
-            /* whole row as one that can fill vertically.                     */
-            /*----------------------------------------------------------------*/
-            if (eCfg->VFill)
-            {
-                allVFill[rowCtr] = 1;
-            }
-        }
-    }
-
-    /*------------------------------------------------------------------------*/
-    /* Calculate the maximum minimum widths required for all of the columns.  */
-    /* (i.e., for each column of elements, determine the maximum value of the */
-    /* minimum widths required (among elements in the column)).               */
-    /*------------------------------------------------------------------------*/
-    for (colCtr = 0; colCtr < grid->xDim; colCtr++)
-    {
-        for (rowCtr = 0; rowCtr < grid->yDim; rowCtr++)
-        {
-            offset = colCtr + rowCtr*(grid->xDim);
-
-            if (!elemsValid[offset]) continue; /* no elem at this location */
-            if (!elemsShown[offset]) continue; /* this elem isn't shown */
-
-            eCfg = elemsCfg[offset];
-            rs   = &elemsMinSz[offset];
-
-            tempW = rs->w + (eCfg->PadLeft + eCfg->PadRight);
-            if (tempW > allMaxMinW[colCtr])
-            {
-                allMaxMinW[colCtr] = tempW;
-            }
-
-            /*----------------------------------------------------------------*/
-            /* Check if the element can fill horizontally and if so, mark the */
-            /* whole column as one that can fill horizontally.                */
-            /*----------------------------------------------------------------*/
-            if (eCfg->HFill)
-            {
-                allHFill[colCtr] = 1;
-            }
-        }
+        rows[ctr].rendSz = rows[ctr].minSz;
     }
 
     /*------------------------------------------------------------------------*/
@@ -1956,30 +1924,30 @@ int neuik_Element_Render__GridLayout(
         /*--------------------------------------------------------------------*/
         for (colCtr = 0; colCtr < grid->xDim; colCtr++)
         {
-            if (allMaxMinW[colCtr] > maxSideLen)
+            if (cols[colCtr].minSz > maxSideLen)
             {
-                maxSideLen = allMaxMinW[colCtr];
+                maxSideLen = cols[colCtr].minSz;
             }
         }
         for (rowCtr = 0; rowCtr < grid->yDim; rowCtr++)
         {
-            if (allMaxMinH[rowCtr] > maxSideLen)
+            if (rows[rowCtr].minSz > maxSideLen)
             {
-                maxSideLen = allMaxMinH[rowCtr];
+                maxSideLen = rows[rowCtr].minSz;
             }
         }
 
         /*--------------------------------------------------------------------*/
-        /* Set all of the MaxMinH/MaxMinW values to this value.               */
+        /* Set all of the rendered row/column sizes to this value.            */
         /*--------------------------------------------------------------------*/
         for (colCtr = 0; colCtr < grid->xDim; colCtr++)
         {
-            allMaxMinW[colCtr] = maxSideLen;
+            cols[colCtr].rendSz = maxSideLen;
         }
 
         for (rowCtr = 0; rowCtr < grid->yDim; rowCtr++)
         {
-            allMaxMinH[rowCtr] = maxSideLen;
+            rows[rowCtr].rendSz = maxSideLen;
         }
     }
 
@@ -1991,8 +1959,8 @@ int neuik_Element_Render__GridLayout(
     /*------------------------------------------------------------------------*/
     for (ctr = 0; ctr < grid->xDim; ctr++)
     {
-        rsMin.w += allMaxMinW[ctr];
-        nHFill += allHFill[ctr];
+        rsMin.w += cols[ctr].rendSz;
+        nHFill += (cols[ctr].nFill > 0);
     }
     if (grid->xDim > 1)
     {
@@ -2006,12 +1974,12 @@ int neuik_Element_Render__GridLayout(
     /*------------------------------------------------------------------------*/
     for (ctr = 0; ctr < grid->xDim; ctr++)
     {
-        if (allHFill[ctr])
+        if (cols[ctr].nFill)
         {
-            hfillColsMinW += allMaxMinW[ctr];
-            if (hfillMaxMinW < allMaxMinW[ctr])
+            hfillColsMinW += cols[ctr].rendSz;
+            if (hfillMaxMinW < cols[ctr].rendSz)
             {
-                hfillMaxMinW = allMaxMinW[ctr];
+                hfillMaxMinW = cols[ctr].rendSz;
             }
         }
     }
@@ -2029,8 +1997,8 @@ int neuik_Element_Render__GridLayout(
     /*------------------------------------------------------------------------*/
     for (ctr = 0; ctr < grid->yDim; ctr++)
     {
-        rsMin.h += allMaxMinH[ctr];
-        nVFill += allVFill[ctr];
+        rsMin.h += rows[ctr].rendSz;
+        nVFill += (rows[ctr].nFill > 0);
     }
     if (grid->yDim > 1)
     {
@@ -2043,12 +2011,12 @@ int neuik_Element_Render__GridLayout(
     /*------------------------------------------------------------------------*/
     for (ctr = 0; ctr < grid->yDim; ctr++)
     {
-        if (allVFill[ctr])
+        if (rows[ctr].nFill)
         {
-            vfillRowsMinH += allMaxMinH[ctr];
-            if (vfillMaxMinH < allMaxMinH[ctr])
+            vfillRowsMinH += rows[ctr].rendSz;
+            if (vfillMaxMinH < rows[ctr].rendSz)
             {
-                vfillMaxMinH = allMaxMinH[ctr];
+                vfillMaxMinH = rows[ctr].rendSz;
             }
         }
     }
@@ -2090,10 +2058,9 @@ int neuik_Element_Render__GridLayout(
         /*--------------------------------------------------------------------*/
         for (ctr = 0; ctr < grid->xDim; ctr++)
         {
-            rendColW[ctr] = allMaxMinW[ctr];
-            if (allHFill[ctr])
+            if (cols[ctr].nFill)
             {
-                rendColW[ctr] = hfillMaxMinW;
+                cols[ctr].rendSz = hfillMaxMinW;
             }
         }
 
@@ -2110,9 +2077,9 @@ int neuik_Element_Render__GridLayout(
             /*----------------------------------------------------------------*/
             for (ctr = 0; ctr < grid->xDim; ctr++)
             {
-                if (allHFill[ctr])
+                if (cols[ctr].nFill)
                 {
-                    rendColW[ctr] += dW;
+                    cols[ctr].rendSz += dW;
                     xFree -= dW;
                 }
             }
@@ -2126,9 +2093,9 @@ int neuik_Element_Render__GridLayout(
             /*----------------------------------------------------------------*/
             for (ctr = 0; ctr < grid->xDim; ctr++)
             {
-                if (allHFill[ctr])
+                if (cols[ctr].nFill)
                 {
-                    rendColW[ctr] += 1;
+                    cols[ctr].rendSz += 1;
                     xFree -= 1;
                     if (xFree == 0)
                     {
@@ -2151,9 +2118,9 @@ int neuik_Element_Render__GridLayout(
             /*----------------------------------------------------------------*/
             for (ctr = 0; ctr < grid->xDim; ctr++)
             {
-                if (allHFill[ctr] && rendColW[ctr] < hfillMaxMinW)
+                if (cols[ctr].nFill && cols[ctr].rendSz < hfillMaxMinW)
                 {
-                    rendColW[ctr] += 1;
+                    cols[ctr].rendSz += 1;
                     xFree -= 1;
                     if (xFree == 0)
                     {
@@ -2176,10 +2143,9 @@ int neuik_Element_Render__GridLayout(
         /*--------------------------------------------------------------------*/
         for (ctr = 0; ctr < grid->yDim; ctr++)
         {
-            rendRowH[ctr] = allMaxMinH[ctr];
-            if (allVFill[ctr])
+            if (rows[ctr].nFill)
             {
-                rendRowH[ctr] = vfillMaxMinH;
+                rows[ctr].rendSz = vfillMaxMinH;
             }
         }
 
@@ -2196,9 +2162,9 @@ int neuik_Element_Render__GridLayout(
             /*----------------------------------------------------------------*/
             for (ctr = 0; ctr < grid->yDim; ctr++)
             {
-                if (allVFill[ctr])
+                if (rows[ctr].nFill)
                 {
-                    rendRowH[ctr] += dH;
+                    rows[ctr].rendSz += dH;
                     yFree -= dH;
                 }
             }
@@ -2212,9 +2178,9 @@ int neuik_Element_Render__GridLayout(
             /*----------------------------------------------------------------*/
             for (ctr = 0; ctr < grid->yDim; ctr++)
             {
-                if (allVFill[ctr])
+                if (rows[ctr].nFill)
                 {
-                    rendRowH[ctr] += 1;
+                    rows[ctr].rendSz += 1;
                     yFree -= 1;
                     if (yFree == 0)
                     {
@@ -2237,9 +2203,9 @@ int neuik_Element_Render__GridLayout(
             /*----------------------------------------------------------------*/
             for (ctr = 0; ctr < grid->yDim; ctr++)
             {
-                if (allVFill[ctr] && rendRowH[ctr] < vfillMaxMinH)
+                if (rows[ctr].nFill && rows[ctr].rendSz < vfillMaxMinH)
                 {
-                    rendRowH[ctr] += 1;
+                    rows[ctr].rendSz += 1;
                     yFree -= 1;
                     if (yFree == 0)
                     {
@@ -2253,129 +2219,149 @@ int neuik_Element_Render__GridLayout(
     /*========================================================================*/
     /* Render and place the child elements                                    */
     /*========================================================================*/
+    /*------------------------------------------------------------------------*/
+    /* Determine the offsets of all of the rendered rows and columns.         */
+    /*------------------------------------------------------------------------*/
+    xPos = 0.0;
+    for (colCtr = 0; colCtr < grid->xDim; colCtr++)
+    {
+        if (colCtr > 0)
+        {
+            xPos += (float)(cols[colCtr-1].rendSz) + fltHspacingSc;
+        }
+        cols[colCtr].pos = xPos;
+    }
     yPos = 0.0;
     for (rowCtr = 0; rowCtr < grid->yDim; rowCtr++)
     {
-        xPos = 0.0;
         if (rowCtr > 0)
         {
-            yPos += (float)(rendRowH[rowCtr-1]) + fltVspacingSc;
+            yPos += (float)(rows[rowCtr-1].rendSz) + fltVspacingSc;
         }
+        rows[rowCtr].pos = yPos;
+    }
 
-        for (colCtr = 0; colCtr < grid->xDim; colCtr++)
-        {
-            offset = colCtr + rowCtr*(grid->xDim);
+    /*------------------------------------------------------------------------*/
+    /* Only populated cells are visited.                                      */
+    /*------------------------------------------------------------------------*/
+    for (ctr = 0; ctr < grid->nCells; ctr++)
+    {
+        cell = &grid->cells[ctr];
+        if (!cell->shown) continue; /* this elem isn't shown */
 
-            if (colCtr > 0)
-            {
-                xPos += (float)(rendColW[colCtr-1]) + fltHspacingSc;
-            }
+        elem = cell->elem;
+        if (!neuik_Element_NeedsRedraw(elem)) continue;
 
-            if (!elemsValid[offset]) continue; /* no elem at this location */
-            if (!elemsShown[offset]) continue; /* this elem isn't shown */
+        eCfg = neuik_Element_GetConfig(elem);
+        if (eCfg == NULL)
+        {
+            eNum = 3;
+            goto out;
+        }
 
-            elem = cont->elems[offset];
-            if (!neuik_Element_NeedsRedraw(elem)) continue;
+        colCtr = cell->pos % grid->xDim;
+        rowCtr = cell->pos / grid->xDim;
+        xPos   = cols[colCtr].pos;
+        yPos   = rows[rowCtr].pos;
 
-            eCfg = elemsCfg[offset];
-            rs   = &elemsMinSz[offset];
+        rsElem = cell->minSz;
+        rs     = &rsElem;
 
-            tempH = rendRowH[rowCtr];
-            tempW = rendColW[colCtr];
+        tempH = rows[rowCtr].rendSz;
+        tempW = cols[colCtr].rendSz;
 
-            /*----------------------------------------------------------------*/
-            /* Check for and apply if necessary Horizontal and Vertical fill. */
-            /*----------------------------------------------------------------*/
-            if (allHFill[colCtr])
-            {
-                rs->w = tempW - (eCfg->PadLeft + eCfg->PadRight);
-            }
-            if (allVFill[rowCtr])
-            {
-                rs->h = tempH - (eCfg->PadTop + eCfg->PadBottom);
-            }
+        /*--------------------------------------------------------------------*/
+        /* Check for and apply if necessary Horizontal and Vertical fill.     */
+        /*--------------------------------------------------------------------*/
+        if (cols[colCtr].nFill)
+        {
+            rs->w = tempW - (eCfg->PadLeft + eCfg->PadRight);
+        }
+        if (rows[rowCtr].nFill)
+        {
+            rs->h = tempH - (eCfg->PadTop + eCfg->PadBottom);
+        }
 
-            /*----------------------------------------------------------------*/
-            /* Update the stored location before rendering the element. This  */
-            /* is necessary as the location of this object will propagate to  */
-            /* its child objects.                                             */
-            /*----------------------------------------------------------------*/
-            switch (eCfg->HJustify)
-            {
-                case NEUIK_HJUSTIFY_DEFAULT:
-                    switch (cont->HJustify)
-                    {
-                        case NEUIK_HJUSTIFY_LEFT:
-                            rect.x = (int)(xPos) + eCfg->PadLeft;
-                            break;
-                        case NEUIK_HJUSTIFY_CENTER:
-                        case NEUIK_HJUSTIFY_DEFAULT:
-                            rect.x = ((int)(xPos) + squarePadW/2 
-                                + rendColW[colCtr]/2) - (tempW/2);
-                            break;
-                        case NEUIK_HJUSTIFY_RIGHT:
-                            rect.x = ((int)(xPos) + squarePadW 
-                                + rendColW[colCtr]) - (rs->w + eCfg->PadRight);
-                            break;
-                    }
-                    break;
-                case NEUIK_HJUSTIFY_LEFT:
-                    rect.x = (int)(xPos) + eCfg->PadLeft;
-                    break;
-                case NEUIK_HJUSTIFY_CENTER:
-                    rect.x = ((int)(xPos) + squarePadW/2 + rendColW[colCtr]/2) 
-                        - (tempW/2);
-                    break;
-                case NEUIK_HJUSTIFY_RIGHT:
-                    rect.x = ((int)(xPos) + squarePadW + rendColW[colCtr]) - 
-                        (rs->w + eCfg->PadRight);
-                    break;
-            }
-            switch (eCfg->VJustify)
-            {
-                case NEUIK_VJUSTIFY_DEFAULT:
-                    switch (cont->VJustify)
-                    {
-                        case NEUIK_VJUSTIFY_TOP:
-                            rect.y = (int)(yPos) + eCfg->PadTop;
-                            break;
-                        case NEUIK_VJUSTIFY_CENTER:
-                        case NEUIK_VJUSTIFY_DEFAULT:
-                            rect.y = ((int)(yPos) + squarePadH/2 
-                                + rendRowH[rowCtr]/2) - (tempH/2);
-                            break;
-                        case NEUIK_VJUSTIFY_BOTTOM:
-                            rect.y = ((int)(yPos) + squarePadH 
-                                + rendRowH[rowCtr]) - (rs->h + eCfg->PadBottom);
-                            break;
-                    }
-                    break;
-                case NEUIK_VJUSTIFY_TOP:
-                    rect.y = (int)(yPos) + eCfg->PadTop;
-                    break;
-                case NEUIK_VJUSTIFY_CENTER:
-                    rect.y = ((int)(yPos) + squarePadH/2 + rendRowH[rowCtr]/2) 
-                        - (tempH/2);
-                    break;
-                case NEUIK_VJUSTIFY_BOTTOM:
-                    rect.y = ((int)(yPos) + squarePadH + rendRowH[rowCtr]) - 
-                        (rs->h + eCfg->PadBottom);
-                    break;
-            }
+        /*--------------------------------------------------------------------*/
+        /* Update the stored location before rendering the element. This      */
+        /* is necessary as the location of this object will propagate to      */
+        /* its child objects.                                                 */
+        /*--------------------------------------------------------------------*/
+        switch (eCfg->HJustify)
+        {
+            case NEUIK_HJUSTIFY_DEFAULT:
+                switch (cont->HJustify)
+                {
+                    case NEUIK_HJUSTIFY_LEFT:
+                        rect.x = (int)(xPos) + eCfg->PadLeft;
+                        break;
+                    case NEUIK_HJUSTIFY_CENTER:
+                    case NEUIK_HJUSTIFY_DEFAULT:
+                        rect.x = ((int)(xPos) + squarePadW/2 
+                            + cols[colCtr].rendSz/2) - (tempW/2);
+                        break;
+                    case NEUIK_HJUSTIFY_RIGHT:
+                        rect.x = ((int)(xPos) + squarePadW 
+                            + cols[colCtr].rendSz) - (rs->w + eCfg->PadRight);
+                        break;
+                }
+                break;
+            case NEUIK_HJUSTIFY_LEFT:
+                rect.x = (int)(xPos) + eCfg->PadLeft;
+                break;
+            case NEUIK_HJUSTIFY_CENTER:
+                rect.x = ((int)(xPos) + squarePadW/2 + cols[colCtr].rendSz/2) 
+                    - (tempW/2);
+                break;
+            case NEUIK_HJUSTIFY_RIGHT:
+                rect.x = ((int)(xPos) + squarePadW + cols[colCtr].rendSz) - 
+                    (rs->w + eCfg->PadRight);
+                break;
+        }
+        switch (eCfg->VJustify)
+        {
+            case NEUIK_VJUSTIFY_DEFAULT:
+                switch (cont->VJustify)
+                {
+                    case NEUIK_VJUSTIFY_TOP:
+                        rect.y = (int)(yPos) + eCfg->PadTop;
+                        break;
+                    case NEUIK_VJUSTIFY_CENTER:
+                    case NEUIK_VJUSTIFY_DEFAULT:
+                        rect.y = ((int)(yPos) + squarePadH/2 
+                            + rows[rowCtr].rendSz/2) - (tempH/2);
+                        break;
+                    case NEUIK_VJUSTIFY_BOTTOM:
+                        rect.y = ((int)(yPos) + squarePadH 
+                            + rows[rowCtr].rendSz) - (rs->h + eCfg->PadBottom);
+                        break;
+                }
+                break;
+            case NEUIK_VJUSTIFY_TOP:
+                rect.y = (int)(yPos) + eCfg->PadTop;
+                break;
+            case NEUIK_VJUSTIFY_CENTER:
+                rect.y = ((int)(yPos) + squarePadH/2 + rows[rowCtr].rendSz/2) 
+                    - (tempH/2);
+                break;
+            case NEUIK_VJUSTIFY_BOTTOM:
+                rect.y = ((int)(yPos) + squarePadH + rows[rowCtr].rendSz) - 
+                    (rs->h + eCfg->PadBottom);
+                break;
+        }
 
-            rect.w = rendColW[colCtr];
-            rect.h = rendRowH[rowCtr];
-            rl.x = (eBase->eSt.rLoc).x + rect.x;
-            rl.y = (eBase->eSt.rLoc).y + rect.y;
-            rlRel.x = rect.x;
-            rlRel.y = rect.y;
-            neuik_Element_StoreSizeAndLocation(elem, *rs, rl, rlRel);
+        rect.w = cols[colCtr].rendSz;
+        rect.h = rows[rowCtr].rendSz;
+        rl.x = (eBase->eSt.rLoc).x + rect.x;
+        rl.y = (eBase->eSt.rLoc).y + rect.y;
+        rlRel.x = rect.x;
+        rlRel.y = rect.y;
+        neuik_Element_StoreSizeAndLocation(elem, *rs, rl, rlRel);
 
-            if (neuik_Element_Render(elem, rs, rlMod, rend, mock))
-            {
-                eNum = 2;
-                goto out;
-            }
+        if (neuik_Element_Render(elem, rs, rlMod, rend, mock))
+        {
+            eNum = 2;
+            goto out;
         }
     }
 out:
@@ -2385,17 +2371,6 @@ out:
     }
     if (maskMap != NULL) neuik_Object_Free(maskMap);
 
-    if (elemsCfg   != NULL) free(elemsCfg);
-    if (elemsShown != NULL) free(elemsShown);
-    if (elemsValid != NULL) free(elemsValid);
-    if (elemsMinSz != NULL) free(elemsMinSz);
-    if (allMaxMinW != NULL) free(allMaxMinW);
-    if (allMaxMinH != NULL) free(allMaxMinH);
-    if (rendColW   != NULL) free(rendColW);
-    if (rendRowH   != NULL) free(rendRowH);
-    if (allHFill   != NULL) free(allHFill);
-    if (allVFill   != NULL) free(allVFill);
-
     if (eNum > 0)
     {
         NEUIK_RaiseError(funcName, errMsgs[eNum]);
@@ -2420,7 +2395,6 @@ neuik_EventState neuik_Element_CaptureEvent__GridLayout(
     SDL_Event     * ev)
 {
     int                ctr        = 0;
-    int                finalInd   = 0;
     neuik_EventState   evCaputred = NEUIK_EVENTSTATE_NOT_CAPTURED;
     NEUIK_Element      elem       = NULL;
     NEUIK_Container  * cBase      = NULL;
@@ -2434,16 +2408,10 @@ neuik_EventState neuik_Element_CaptureEvent__GridLayout(
 
     if (cBase->elems != NULL)
     {
-        finalInd = grid->xDim * grid->yDim;
-        for (ctr = 0; ctr < finalInd; ctr++)
+        for (ctr = 0;; ctr++)
         {
-            /*----------------------------------------------------------------*/
-            /* A GridLayout is different from other containers in that NULL   */
-            /* values are permitted within the elems array. The total number  */
-            /* of contained elems is defined as xDim * yDim.                  */
-            /*----------------------------------------------------------------*/
             elem = cBase->elems[ctr];
-            if (elem == NULL) continue;
+            if (elem == NULL) break; /* end of NULL-ptr terminated array */
 
             if (!NEUIK_Element_IsShown(elem)) continue;
 
@@ -2481,7 +2449,6 @@ int neuik_Element_SetWindowPointer__GridLayout (
 {
     int                  eNum     = 0;
     int                  ctr      = 0;
-    int                  finalInd = 0;
     NEUIK_Element        elem     = NULL; 
     NEUIK_ElementBase  * eBase    = NULL;
     NEUIK_Container    * cBase    = NULL;
@@ -2522,16 +2489,10 @@ int neuik_Element_SetWindowPointer__GridLayout (
         /*--------------------------------------------------------------------*/
         /* Propagate this information to contained UI Elements                */
         /*--------------------------------------------------------------------*/
-        finalInd = grid->xDim * grid->yDim;
-        for (ctr = 0; ctr < finalInd; ctr++)
+        for (ctr = 0;; ctr++)
         {
-            /*----------------------------------------------------------------*/
-            /* A GridLayout is different from other containers in that NULL   */
-            /* values are permitted within the elems array. The total number  */
-            /* of contained elems is defined as xDim * yDim.                  */
-            /*----------------------------------------------------------------*/
             elem = cBase->elems[ctr];
-            if (elem == NULL) continue;
+            if (elem == NULL) break; /* end of NULL-ptr terminated array */
 
             if (neuik_Element_SetWindowPointer(elem, win))
             {
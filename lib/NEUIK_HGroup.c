@@ -105,6 +105,7 @@ int neuik_RegisterClass_HGroup()
         "An element container which horizontally groups items.", // classDescription
         neuik__Set_NEUIK,                                        // classSet
         neuik__Class_Container,                                  // superClass
+        sizeof(NEUIK_HGroup),                                    // objSize
         &neuik_HGroup_BaseFuncs,                                 // baseFuncs
         NULL,                                                    // classFuncs
         &neuik__Class_HGroup))                                   // newClass
@@ -155,7 +156,8 @@ int neuik_Object_New__HGroup(
         eNum = 1;
         goto out;
     }
-    (*hgPtr) = (NEUIK_HGroup*) malloc(sizeof(NEUIK_HGroup));
+    (*hgPtr) = (NEUIK_HGroup*) neuik_Object_Alloc(
+        neuik__Class_HGroup, (void**)hgPtr);
     hg = *hgPtr;
     if (hg == NULL)
     {
@@ -343,7 +345,7 @@ int neuik_Object_Free__HGroup(
         goto out;
     }
 
-    free(hg);
+    neuik_Object_Release(hg);
 out:
     if (eNum > 0)
     {
@@ -26,6 +26,7 @@
 #include "NEUIK_structs_basic.h"
 #include "NEUIK_colors.h"
 #include "NEUIK_Image.h"
+#include "NEUIK_Image_internal.h"
 #include "NEUIK_Element_internal.h"
 #include "NEUIK_StockImage_internal.h"
 #include "neuik_internal.h"
@@ -108,6 +109,7 @@ int neuik_RegisterClass_Image()
         "An object which contains an image.", // classDescription
         neuik__Set_NEUIK,                     // classSet
         neuik__Class_Element,                 // superClass
+        sizeof(NEUIK_Image),                  // objSize
         &neuik_Image_BaseFuncs,               // baseFuncs
         NULL,                                 // classFuncs
         &neuik__Class_Image))                 // newClass
@@ -138,6 +140,7 @@ out:
 int neuik_Object_New__Image(
     void ** imgPtr)
 {
+    int             ctr;
     int             eNum       = 0; /* which error to report (if any) */
     NEUIK_Image   * img        = NULL;
     NEUIK_Element * sClassPtr  = NULL;
@@ -158,7 +161,8 @@ int neuik_Object_New__Image(
         goto out;
     }
 
-    (*imgPtr) = (NEUIK_Image *)malloc(sizeof(NEUIK_Image));
+    (*imgPtr) = (NEUIK_Image*) neuik_Object_Alloc(
+        neuik__Class_Image, (void**)imgPtr);
     img = *imgPtr;
     if (img == NULL)
     {
@@ -195,9 +199,23 @@ int neuik_Object_New__Image(
     }
 
     /* Allocation successful */
-    img->cfg         = NULL;
-    img->cfgPtr      = NULL;
-    img->needsRedraw = 1;
+    img->cfg           = NULL;
+    img->cfgPtr        = NULL;
+    img->image         = NULL;
+    img->imageTex      = NULL;
+    img->imageRend     = NULL;
+    img->imageTexLevel = 0;
+    img->dispW         = 0;
+    img->dispH         = 0;
+    img->decoded       = NULL;
+    img->loader        = NULL;
+    img->loadW         = 0;
+    img->loadH         = 0;
+    img->needsRedraw   = 1;
+    for (ctr = 0; ctr < NEUIK_IMAGE_MAXVARIANTS; ctr++)
+    {
+        img->variants[ctr] = NULL;
+    }
 
     if (NEUIK_NewImageConfig(&img->cfg))
     {
@@ -276,13 +294,24 @@ int neuik_Object_Free__Image(
         eNum = 2;
         goto out;
     }
-    if(img->image != NULL) SDL_FreeSurface(img->image);
+    neuik_Image_CancelLoad(img);
+    neuik_TextureSlot_Clear((SDL_Texture **)&(img->imageTex));
+    neuik_Image_FreeVariants(img);
+    if (img->decoded != NULL)
+    {
+        /* the surface belongs to the decoded image cache */
+        neuik_ImageCache_Release(img->decoded);
+    }
+    else if (img->image != NULL)
+    {
+        SDL_FreeSurface(img->image);
+    }
     if(neuik_Object_Free(img->cfg))
     {
         eNum = 2;
         goto out;
     }
-    free(img);
+    neuik_Object_Release(img);
 out:
     if (eNum > 0)
     {
@@ -300,6 +329,10 @@ out:
  *  Description:   Create a new NEUIK_Image and load image data into it from
  *                 the specified image file.
  *
+ *                 Decoded images are cached by their file contents; a file
+ *                 which is used by several images is only decoded once. See
+ *                 `NEUIK_MakeImage_Async()` to load an image without blocking.
+ *
  *  Returns:       1 if there is an error; 0 otherwise.
  *
  ******************************************************************************/
@@ -312,7 +345,11 @@ int NEUIK_MakeImage(
     static char   funcName[] = "NEUIK_MakeImage";
     static char * errMsgs[]  = {"",                       // [0] no error
         "Failure in function `neuik_Object_New__Image`.", // [1]
-        "Failure in function `IMG_Load`.",                // [2]
+        "Failed to initialize the decoded image cache.",  // [2]
+        "Unable to read the specified image file.",       // [3]
+        "Failure to allocate memory.",                    // [4]
+        "Failure in function `IMG_Load_RW`.",             // [5]
+        "Failure in function `neuik_Image_Downscale`.",   // [6]
     };
 
     if (neuik_Object_New__Image((void**)imgPtr))
@@ -336,12 +373,13 @@ int NEUIK_MakeImage(
     }
     else
     {
-        img->image = IMG_Load(filename);
-        if (img->image == NULL)
+        eNum = neuik_ImageCache_Load(filename, 0, 0, &(img->decoded));
+        if (eNum > 0)
         {
-            eNum = 2;
+            eNum++;
             goto out;
         }
+        img->image = neuik_ImageCache_GetSurface(img->decoded);
     }
 out:
     if (eNum > 0)
@@ -497,6 +535,87 @@ out:
     return eNum;
 }
 
+/*******************************************************************************
+ *
+ *  Name:          neuik_MakeImage_FromEncodedStock
+ *
+ *  Description:   Create a new NEUIK_Image from a stock image which is stored
+ *                 in an encoded (compressed) image format.
+ *
+ *                 The stock image is decoded on first use; the decoded surface
+ *                 is kept in `decoded` and copied for subsequent images.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_MakeImage_FromEncodedStock(
+    NEUIK_Image         ** imgPtr,  /* [out] The newly created NEUIK_Image. */
+    const unsigned char  * data,    /* [in] encoded image data (e.g. PNG) */
+    size_t                 nBytes,  /* [in] number of bytes of encoded data */
+    SDL_Surface         ** decoded) /* [in/out] cached decoded stock image */
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    SDL_RWops   * rw         = NULL;
+    NEUIK_Image * img        = NULL;
+    static char   funcName[] = "neuik_MakeImage_FromEncodedStock";
+    static char * errMsgs[]  = {"",                       // [0] no error
+        "Failure in function `neuik_Object_New__Image`.", // [1]
+        "Failure in function `SDL_RWFromConstMem`.",      // [2]
+        "Failure in function `IMG_Load_RW`.",             // [3]
+        "Failure in function `SDL_ConvertSurface`.",      // [4]
+        "Argument `decoded` is NULL.",                    // [5]
+    };
+
+    if (decoded == NULL)
+    {
+        eNum = 5;
+        goto out;
+    }
+
+    if (*decoded == NULL)
+    {
+        rw = SDL_RWFromConstMem(data, (int)nBytes);
+        if (rw == NULL)
+        {
+            eNum = 2;
+            goto out;
+        }
+        /* IMG_Load_RW() closes `rw` when its second argument is nonzero */
+        *decoded = IMG_Load_RW(rw, 1);
+        if (*decoded == NULL)
+        {
+            eNum = 3;
+            goto out;
+        }
+    }
+
+    if (neuik_Object_New__Image((void**)imgPtr))
+    {
+        eNum = 1;
+        goto out;
+    }
+    img = *imgPtr;
+
+    /*------------------------------------------------------------------------*/
+    /* Each image owns (and frees) its own surface; give it a copy.           */
+    /*------------------------------------------------------------------------*/
+    img->image = SDL_ConvertSurface(*decoded, (*decoded)->format, 0);
+    if (img->image == NULL)
+    {
+        eNum = 4;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
 /*******************************************************************************
  *
  *  Name:          NEUIK_MakeImage_FromStock
@@ -564,6 +683,254 @@ int NEUIK_NewImage(
 }
 
 
+/*******************************************************************************
+ *
+ *  Name:          neuik_Image_FreeVariants
+ *
+ *  Description:   Free the downscaled variants which were generated for the
+ *                 image. This must be done whenever the image data changes.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+void neuik_Image_FreeVariants(
+    NEUIK_Image * img)
+{
+    int ctr;
+
+    for (ctr = 0; ctr < NEUIK_IMAGE_MAXVARIANTS; ctr++)
+    {
+        if (img->variants[ctr] != NULL)
+        {
+            SDL_FreeSurface((SDL_Surface *)(img->variants[ctr]));
+            img->variants[ctr] = NULL;
+        }
+    }
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Image_GetVariant
+ *
+ *  Description:   Get the image data downscaled by a factor of 2^level. Each
+ *                 variant is generated (with a box filter) from the one above
+ *                 it the first time that it is needed and is kept afterwards.
+ *
+ *  Returns:       NULL if there is a problem, otherwise the variant surface.
+ *
+ ******************************************************************************/
+static SDL_Surface * neuik_Image_GetVariant(
+    NEUIK_Image * img,
+    int           level)
+{
+    int           ctr;
+    int           w;
+    int           h;
+    SDL_Surface * surf = NULL;
+
+    surf = (SDL_Surface *)(img->image);
+    for (ctr = 0; ctr < level && surf != NULL; ctr++)
+    {
+        if (img->variants[ctr] == NULL)
+        {
+            w = (surf->w > 1) ? surf->w/2 : 1;
+            h = (surf->h > 1) ? surf->h/2 : 1;
+            img->variants[ctr] = neuik_Image_Downscale(surf, w, h);
+        }
+        surf = (SDL_Surface *)(img->variants[ctr]);
+    }
+
+    return surf;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Image_SelectVariant
+ *
+ *  Description:   Select the smallest variant of the image which is still at
+ *                 least as large as the size that it will be drawn at; the 
+ *                 remaining (less than 2x) reduction is done by the renderer.
+ *
+ *  Returns:       The variant level (0 for the full size image).
+ *
+ ******************************************************************************/
+static int neuik_Image_SelectVariant(
+    SDL_Surface * surf,
+    int           w,    /* width that the image is drawn at (px) */
+    int           h)    /* height that the image is drawn at (px) */
+{
+    int level = 0;
+    int lvlW;
+    int lvlH;
+
+    lvlW = surf->w;
+    lvlH = surf->h;
+    while (level < NEUIK_IMAGE_MAXVARIANTS &&
+        lvlW/2 >= w && lvlH/2 >= h && lvlW > 1 && lvlH > 1)
+    {
+        lvlW /= 2;
+        lvlH /= 2;
+        level++;
+    }
+
+    return level;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Image_GetDisplaySize
+ *
+ *  Description:   Calculate the size (in px, including HiDPI scaling) at which
+ *                 the image (or its placeholder) is displayed.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+static void neuik_Image_GetDisplaySize(
+    NEUIK_Image * img,
+    int         * w,
+    int         * h)
+{
+    int           imW   = 0;
+    int           imH   = 0;
+    float         scale = 0.0;
+    SDL_Surface * surf  = NULL;
+
+    surf = (SDL_Surface *)(img->image);
+    if (surf != NULL)
+    {
+        imW = surf->w;
+        imH = surf->h;
+
+        /*--------------------------------------------------------------------*/
+        /* A display size scales the image (preserving its aspect ratio) to   */
+        /* fit within it.                                                     */
+        /*--------------------------------------------------------------------*/
+        if (img->dispW > 0)
+        {
+            scale = (float)(img->dispW)/(float)(imW);
+        }
+        if (img->dispH > 0 && 
+            (scale == 0.0 || (float)(img->dispH)/(float)(imH) < scale))
+        {
+            scale = (float)(img->dispH)/(float)(imH);
+        }
+        if (scale > 0.0)
+        {
+            imW = (int)((float)(imW)*scale + 0.5);
+            imH = (int)((float)(imH)*scale + 0.5);
+            if (imW < 1) imW = 1;
+            if (imH < 1) imH = 1;
+        }
+    }
+    else if (img->loader != NULL)
+    {
+        /* the image is still loading; use the size of its placeholder */
+        imW = img->loadW;
+        imH = img->loadH;
+    }
+
+    *w = (int)((float)(imW)*neuik__HighDPI_Scaling);
+    *h = (int)((float)(imH)*neuik__HighDPI_Scaling);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_Image_SetDisplaySize
+ *
+ *  Description:   Set the size at which an image is displayed. The image is
+ *                 scaled (preserving its aspect ratio) to fit within the 
+ *                 specified size; a value of zero leaves that dimension 
+ *                 unconstrained and zero for both displays the image at its
+ *                 natural size.
+ *
+ *                 Images which are displayed at a reduced size are drawn from
+ *                 a downscaled variant of the image; only the pixels which 
+ *                 are needed for the displayed size are uploaded.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_Image_SetDisplaySize(
+    NEUIK_Image * img,
+    int           width,  /* [in] Width to display the image at (or 0). */
+    int           height) /* [in] Height to display the image at (or 0). */
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    int           rv         = 0;
+    float         prevScale;
+    RenderSize    rSize;
+    RenderLoc     rLoc;
+    static char   funcName[] = "NEUIK_Image_SetDisplaySize";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `img` is not of Image class.",            // [1]
+        "Argument `width` has invalid value.",              // [2]
+        "Argument `height` has invalid value.",             // [3]
+        "Failure in `neuik_Element_GetSizeAndLocation()`.", // [4]
+        "Failure in `neuik_Element_GetMinSize__Image()`.",  // [5]
+        "Failure in `neuik_Element_StoreFrameMinSize()`",   // [6]
+    };
+
+    if (!neuik_Object_IsClass(img, neuik__Class_Image))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (width < 0)
+    {
+        eNum = 2;
+        goto out;
+    }
+    else if (height < 0)
+    {
+        eNum = 3;
+        goto out;
+    }
+    if (img->dispW == width && img->dispH == height) goto out;
+
+    img->dispW       = width;
+    img->dispH       = height;
+    img->needsRedraw = 1;
+
+    /*------------------------------------------------------------------------*/
+    /* Request a redraw of the old size at old location, then store the new   */
+    /* frame minimum size (measured at the scaling of the image's window).    */
+    /*------------------------------------------------------------------------*/
+    if (neuik_Element_GetSizeAndLocation(img, &rSize, &rLoc))
+    {
+        eNum = 4;
+        goto out;
+    }
+    neuik_Element_RequestRedraw(img, rLoc, rSize);
+
+    prevScale = neuik_Element_MakeScaleCurrent(img);
+    rv = neuik_Element_GetMinSize__Image(img, &rSize);
+    neuik__HighDPI_Scaling = prevScale;
+    if (rv)
+    {
+        eNum = 5;
+        goto out;
+    }
+    if (neuik_Element_StoreFrameMinSize(img, &rSize))
+    {
+        eNum = 6;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
 /*******************************************************************************
  *
  *  Name:          neuik_Image_GetMinSize
@@ -617,14 +984,7 @@ int neuik_Element_GetMinSize__Image(
         goto out;
     } 
 
-    if (img->image != NULL)
-    {
-        /* this Image contains data */
-        imW = ((SDL_Surface *)img->image)->w;
-        imW = (int)((float)(imW)*neuik__HighDPI_Scaling);
-        imH = ((SDL_Surface *)img->image)->h;
-        imH = (int)((float)(imH)*neuik__HighDPI_Scaling);
-    }
+    neuik_Image_GetDisplaySize(img, &imW, &imH);
 
     rSize->w = imW;
     rSize->h = imH;
@@ -656,13 +1016,18 @@ int neuik_Element_Render__Image(
     int             mock)  /* If true; calculate sizes/locations but don't draw */
 {
     SDL_Surface       * imgSurf    = NULL;
+    SDL_Surface       * varSurf    = NULL; /* variant of the image to upload */
     SDL_Renderer      * rend       = NULL;
     SDL_Texture       * imgTex     = NULL; /* image texture */
     SDL_Rect            rect;
     int                 imW        = 0;
     int                 imH        = 0;
+    int                 level      = 0;    /* variant level to draw */
+    float               scale;
     int                 eNum       = 0; /* which error to report (if any) */
     RenderLoc           rl;
+    NEUIK_Color         phFill     = COLOR_LLGRAY; /* placeholder fill */
+    NEUIK_Color         phBorder   = COLOR_MLGRAY; /* placeholder border */
     NEUIK_Image       * img        = NULL;
     NEUIK_ElementBase * eBase      = NULL;
     static char         funcName[] = "neuik_Element_Render__Image";
@@ -673,6 +1038,7 @@ int neuik_Element_Render__Image(
         "Invalid specified `rSize` (negative values).",                  // [4]
         "Argument `elem` caused `neuik_Object_GetClassObject` to fail.", // [5]
         "Failure in neuik_Element_RedrawBackground().",                  // [6]
+        "Failure in `neuik_TextureSlot_Set()`.",                         // [7]
     };
 
 
@@ -716,50 +1082,114 @@ int neuik_Element_Render__Image(
     }
     rl = eBase->eSt.rLoc;
 
+    /*------------------------------------------------------------------------*/
+    /* Determine the size that the image is drawn at; it is scaled down (if   */
+    /* needed) to fit within the space that it was given.                     */
+    /*------------------------------------------------------------------------*/
+    if (imgSurf == NULL && img->loader == NULL)
+    {
+        /* this Image contains no data */
+        goto out;
+    }
+    neuik_Image_GetDisplaySize(img, &imW, &imH);
+    if (imW <= 0 || imH <= 0) goto out;
+
+    if (imW > rSize->w || imH > rSize->h)
+    {
+        scale = (float)(rSize->w)/(float)(imW);
+        if ((float)(rSize->h)/(float)(imH) < scale)
+        {
+            scale = (float)(rSize->h)/(float)(imH);
+        }
+        imW = (int)((float)(imW)*scale);
+        imH = (int)((float)(imH)*scale);
+        if (imW <= 0 || imH <= 0) goto out;
+    }
+
     /*------------------------------------------------------------------------*/
     /* Render the Image                                                       */
     /*------------------------------------------------------------------------*/
     if (imgSurf != NULL)
     {
-        imW = (int)((float)(imgSurf->w)*neuik__HighDPI_Scaling);
-        imH = (int)((float)(imgSurf->h)*neuik__HighDPI_Scaling);
-        imgTex = SDL_CreateTextureFromSurface(rend, imgSurf);
-        if (imgTex == NULL)
+        /*--------------------------------------------------------------------*/
+        /* Images drawn at a reduced size use a downscaled variant; this      */
+        /* avoids aliasing and keeps the uploaded texture in proportion to    */
+        /* the number of pixels which are displayed.                          */
+        /*--------------------------------------------------------------------*/
+        level = neuik_Image_SelectVariant(imgSurf, imW, imH);
+
+        /*--------------------------------------------------------------------*/
+        /* The image is only uploaded when it is first drawn (or when it is   */
+        /* drawn by a different renderer or at a different variant); the      */
+        /* texture is kept afterwards.                                        */
+        /*--------------------------------------------------------------------*/
+        if (img->imageTex == NULL || img->imageRend != rend ||
+            img->imageTexLevel != level)
         {
-            eNum = 3;
-            goto out;
+            varSurf = neuik_Image_GetVariant(img, level);
+            if (varSurf == NULL)
+            {
+                /* fall back to the full size image */
+                level   = 0;
+                varSurf = imgSurf;
+            }
+            imgTex = neuik_CreateTextureFromSurface(rend, varSurf);
+            if (imgTex == NULL)
+            {
+                eNum = 3;
+                goto out;
+            }
+            if (neuik_TextureSlot_Set(
+                (SDL_Texture **)&(img->imageTex), imgTex, rend))
+            {
+                eNum = 7;
+                goto out;
+            }
+            img->imageRend     = rend;
+            img->imageTexLevel = level;
         }
+        imgTex = (SDL_Texture *)(img->imageTex);
+    }
 
-        rect.x = rl.x;
-        rect.y = rl.y + (int) ((float)(rSize->h - imH)/2.0);
+    rect.x = rl.x;
+    rect.y = rl.y + (int) ((float)(rSize->h - imH)/2.0);
 
-        switch (eBase->eCfg.HJustify)
-        {
-            case NEUIK_HJUSTIFY_LEFT:
-                break;
+    switch (eBase->eCfg.HJustify)
+    {
+        case NEUIK_HJUSTIFY_LEFT:
+            break;
 
-            case NEUIK_HJUSTIFY_CENTER:
-            case NEUIK_HJUSTIFY_DEFAULT:
-                rect.x += (int) ((float)(rSize->w - imW)/2.0);
-                break;
+        case NEUIK_HJUSTIFY_CENTER:
+        case NEUIK_HJUSTIFY_DEFAULT:
+            rect.x += (int) ((float)(rSize->w - imW)/2.0);
+            break;
 
-            case NEUIK_HJUSTIFY_RIGHT:
-                rect.x += (int) (rSize->w - imW);
-                break;
-        }
-        rect.w = imW;
-        rect.h = imH;
+        case NEUIK_HJUSTIFY_RIGHT:
+            rect.x += (int) (rSize->w - imW);
+            break;
+    }
+    rect.w = imW;
+    rect.h = imH;
 
+    if (imgTex != NULL)
+    {
         SDL_RenderCopy(rend, imgTex, NULL, &rect);
     }
+    else
+    {
+        SDL_SetRenderDrawColor(rend, 
+            phFill.r, phFill.g, phFill.b, phFill.a);
+        SDL_RenderFillRect(rend, &rect);
+        SDL_SetRenderDrawColor(rend, 
+            phBorder.r, phBorder.g, phBorder.b, phBorder.a);
+        SDL_RenderDrawRect(rend, &rect);
+    }
 out:
     if (eBase != NULL)
     {
         if (!mock) eBase->eSt.doRedraw = 0;
     }
 
-    ConditionallyDestroyTexture(&imgTex);
-
     if (eNum > 0)
     {
         NEUIK_RaiseError(funcName, errMsgs[eNum]);
@@ -76,6 +76,7 @@ int neuik_RegisterClass_ImageConfig()
         "Configuration for NEUIK_Image Object.", // classDescription
         neuik__Set_NEUIK,                        // classSet
         NULL,                                    // superClass
+        sizeof(NEUIK_ImageConfig),               // objSize
         &neuik_ImageConfig_BaseFuncs,            // baseFuncs
         NULL,                                    // classFuncs
         &neuik__Class_ImageConfig))              // newClass
@@ -162,7 +163,8 @@ int neuik_Object_New__ImageConfig(
         goto out;
     }
 
-    (*cfgPtr) = (NEUIK_ImageConfig*) malloc(sizeof(NEUIK_ImageConfig));
+    (*cfgPtr) = (NEUIK_ImageConfig*) neuik_Object_Alloc(
+        neuik__Class_ImageConfig, (void**)cfgPtr);
     cfg = (*cfgPtr);
     if (cfg == NULL)
     {
@@ -225,7 +227,8 @@ int NEUIK_NewImageConfig(
         goto out;
     }
 
-    (*cfgPtr) = (NEUIK_ImageConfig*) malloc(sizeof(NEUIK_ImageConfig));
+    (*cfgPtr) = (NEUIK_ImageConfig*) neuik_Object_Alloc(
+        neuik__Class_ImageConfig, (void**)cfgPtr);
     cfg = (*cfgPtr);
     if (cfg == NULL)
     {
@@ -359,7 +362,7 @@ int neuik_Object_Free__ImageConfig(
     /*------------------------------------------------------------------------*/
     /* The object is what it says it is and it is still allocated.            */
     /*------------------------------------------------------------------------*/
-    free(cfg);
+    neuik_Object_Release(cfg);
 out:
     if (eNum > 0)
     {
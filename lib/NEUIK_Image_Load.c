@@ -0,0 +1,936 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#include <SDL.h>
+#include <SDL_image.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "NEUIK_error.h"
+#include "NEUIK_render.h"
+#include "NEUIK_Image.h"
+#include "NEUIK_Image_internal.h"
+#include "NEUIK_UIQueue.h"
+#include "NEUIK_Element_internal.h"
+#include "neuik_internal.h"
+#include "neuik_classes.h"
+
+extern float neuik__HighDPI_Scaling;
+
+/*----------------------------------------------------------------------------*/
+/* Internal Function Prototypes                                               */
+/*----------------------------------------------------------------------------*/
+int neuik_Element_GetMinSize__Image(NEUIK_Element, RenderSize*);
+
+#define NEUIK_IMAGELOAD_THREADS  2  /* threads which decode async image loads */
+#define NEUIK_IMAGECACHE_MAXIDLE 16 /* unreferenced decoded images kept */
+
+/*----------------------------------------------------------------------------*/
+/* Decoded image cache                                                        */
+/*                                                                            */
+/* Decoded images are content-addressed; they are keyed by a hash and length  */
+/* of the encoded file contents (along with the size that the image was       */
+/* scaled down to fit) rather than by file name. An image file which is used  */
+/* in many places is decoded once and the resulting surface is shared by all  */
+/* of the NEUIK_Images which display it. A decode which is in progress on     */
+/* another thread is waited on rather than repeated.                          */
+/*----------------------------------------------------------------------------*/
+enum neuik_decodedstate {
+    NEUIK_DECODEDSTATE_DECODING,
+    NEUIK_DECODEDSTATE_READY,
+};
+
+typedef struct neuik_DecodedImage neuik_DecodedImage;
+
+struct neuik_DecodedImage {
+    neuik_DecodedImage      * next;
+    Uint64                    hash;     /* FNV-1a hash of the encoded file */
+    size_t                    nBytes;   /* length of the encoded file */
+    int                       maxW;     /* bounds the image was scaled to fit */
+    int                       maxH;     /*  (0 if not limited) */
+    enum neuik_decodedstate   state;
+    int                       refCount; /* NEUIK_Images using this surface */
+    unsigned int              lastUsed; /* used for least-recently-used eviction */
+    SDL_Surface             * surf;
+};
+
+static SDL_SpinLock         neuik_imgCache_InitLock = 0;
+static SDL_mutex          * neuik_imgCache_Mutex    = NULL;
+static SDL_cond           * neuik_imgCache_Decoded  = NULL; /* a decode ended */
+static neuik_DecodedImage * neuik_imgCache_Head     = NULL;
+static int                  neuik_imgCache_nIdle    = 0;
+static unsigned int         neuik_imgCache_Clock    = 0;
+
+/*----------------------------------------------------------------------------*/
+/* Asynchronous image loads                                                   */
+/*                                                                            */
+/* A load is shared between a NEUIK_Image, the loader queue/thread and the    */
+/* update which is posted to the event loop once the image is decoded. It is  */
+/* freed once the last reference is released.                                 */
+/*----------------------------------------------------------------------------*/
+typedef struct neuik_ImageLoad neuik_ImageLoad;
+
+struct neuik_ImageLoad {
+    neuik_ImageLoad * next;      /* next load waiting in the loader queue */
+    SDL_atomic_t      refCount;
+    SDL_atomic_t      cancelled;
+    NEUIK_Image     * img;       /* NULL once detached (event loop only) */
+    char            * fileName;
+    int               maxW;      /* bounds to scale the decoded image to fit */
+    int               maxH;
+    int               result;    /* return value of `neuik_ImageCache_Load` */
+    void            * decoded;   /* decoded image (until taken by `img`) */
+};
+
+static SDL_mutex        * neuik_imgLoad_Mutex    = NULL;
+static SDL_cond         * neuik_imgLoad_Wake     = NULL; /* a load was queued */
+static SDL_Thread       * neuik_imgLoad_Threads[NEUIK_IMAGELOAD_THREADS];
+static int                neuik_imgLoad_nThreads = 0;
+static int                neuik_imgLoad_Quit     = 0;
+static neuik_ImageLoad  * neuik_imgLoad_Head     = NULL;
+static neuik_ImageLoad  * neuik_imgLoad_Tail     = NULL;
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_ImageCache_Init
+ *
+ *  Description:   Create the synchronization objects used by the decoded image
+ *                 cache and the image loader (if not already created). This 
+ *                 may be called from any thread.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_ImageCache_Init()
+{
+    int rv = 0;
+
+    SDL_AtomicLock(&neuik_imgCache_InitLock);
+    if (neuik_imgCache_Mutex == NULL)
+    {
+        neuik_imgCache_Mutex   = SDL_CreateMutex();
+        neuik_imgCache_Decoded = SDL_CreateCond();
+        neuik_imgLoad_Mutex    = SDL_CreateMutex();
+        neuik_imgLoad_Wake     = SDL_CreateCond();
+    }
+    if (neuik_imgCache_Mutex == NULL || neuik_imgCache_Decoded == NULL ||
+        neuik_imgLoad_Mutex  == NULL || neuik_imgLoad_Wake     == NULL)
+    {
+        rv = 1;
+    }
+    SDL_AtomicUnlock(&neuik_imgCache_InitLock);
+
+    return rv;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Image_Downscale
+ *
+ *  Description:   Create a reduced size copy of a surface using a box filter;
+ *                 each destination pixel is the (alpha weighted) average of 
+ *                 the source pixels which it covers. This function does not
+ *                 use the NEUIK error stack and may be called from any thread.
+ *
+ *  Returns:       NULL if there is a problem, otherwise a new ARGB8888 surface.
+ *
+ ******************************************************************************/
+SDL_Surface * neuik_Image_Downscale(
+    SDL_Surface * src, /* [in] The surface to scale down */
+    int           w,   /* [in] Width of the new surface (px) */
+    int           h)   /* [in] Height of the new surface (px) */
+{
+    int           x;
+    int           y;
+    int           sx;
+    int           sy;
+    int           sx0;
+    int           sx1;
+    int           sy0;
+    int           sy1;
+    Uint32        px;
+    Uint32        alpha;
+    Uint64        sumA;
+    Uint64        sumR;
+    Uint64        sumG;
+    Uint64        sumB;
+    Uint32        nPx;
+    Uint32      * srcRow;
+    Uint32      * dstRow;
+    SDL_Surface * conv   = NULL;
+    SDL_Surface * dst    = NULL;
+
+    if (src == NULL || w <= 0 || h <= 0 || w > src->w || h > src->h)
+    {
+        return NULL;
+    }
+
+    conv = src;
+    if (src->format->format != SDL_PIXELFORMAT_ARGB8888)
+    {
+        conv = SDL_ConvertSurfaceFormat(src, SDL_PIXELFORMAT_ARGB8888, 0);
+        if (conv == NULL) goto out;
+    }
+    dst = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (dst == NULL) goto out;
+
+    for (y = 0; y < h; y++)
+    {
+        sy0 = (int)(((Sint64)y*conv->h)/h);
+        sy1 = (int)(((Sint64)(y + 1)*conv->h)/h);
+        if (sy1 <= sy0) sy1 = sy0 + 1;
+
+        dstRow = (Uint32 *)((Uint8 *)(dst->pixels) + y*dst->pitch);
+        for (x = 0; x < w; x++)
+        {
+            sx0 = (int)(((Sint64)x*conv->w)/w);
+            sx1 = (int)(((Sint64)(x + 1)*conv->w)/w);
+            if (sx1 <= sx0) sx1 = sx0 + 1;
+
+            sumA = 0;
+            sumR = 0;
+            sumG = 0;
+            sumB = 0;
+            for (sy = sy0; sy < sy1; sy++)
+            {
+                srcRow = (Uint32 *)((Uint8 *)(conv->pixels) + sy*conv->pitch);
+                for (sx = sx0; sx < sx1; sx++)
+                {
+                    px    = srcRow[sx];
+                    alpha = px >> 24;
+                    sumA += alpha;
+                    sumR += alpha*((px >> 16) & 0xFF);
+                    sumG += alpha*((px >>  8) & 0xFF);
+                    sumB += alpha*( px        & 0xFF);
+                }
+            }
+
+            /*----------------------------------------------------------------*/
+            /* Colors are weighted by alpha so that (invisible) colors of     */
+            /* transparent pixels don't bleed into their neighbors.           */
+            /*----------------------------------------------------------------*/
+            nPx = (Uint32)((sx1 - sx0)*(sy1 - sy0));
+            if (sumA == 0)
+            {
+                dstRow[x] = 0;
+                continue;
+            }
+            dstRow[x] = 
+                ((Uint32)((sumA + nPx/2)/nPx) << 24) |
+                ((Uint32)((sumR + sumA/2)/sumA) << 16) |
+                ((Uint32)((sumG + sumA/2)/sumA) <<  8) |
+                 (Uint32)((sumB + sumA/2)/sumA);
+        }
+    }
+out:
+    if (conv != NULL && conv != src) SDL_FreeSurface(conv);
+
+    return dst;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_ImageCache_TrimIdle
+ *
+ *  Description:   Free the least recently used unreferenced decoded images 
+ *                 until no more than `maxIdle` of them remain. The cache mutex
+ *                 must be held by the caller.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+static void neuik_ImageCache_TrimIdle(
+    int maxIdle)
+{
+    neuik_DecodedImage  * dec     = NULL;
+    neuik_DecodedImage ** link    = NULL;
+    neuik_DecodedImage ** lruLink = NULL;
+
+    while (neuik_imgCache_nIdle > maxIdle)
+    {
+        lruLink = NULL;
+        for (link = &neuik_imgCache_Head; *link != NULL; link = &((*link)->next))
+        {
+            dec = *link;
+            if (dec->refCount > 0 || dec->state != NEUIK_DECODEDSTATE_READY)
+            {
+                continue;
+            }
+            if (lruLink == NULL || dec->lastUsed < (*lruLink)->lastUsed)
+            {
+                lruLink = link;
+            }
+        }
+        if (lruLink == NULL) break;
+
+        dec      = *lruLink;
+        *lruLink = dec->next;
+        if (dec->surf != NULL) SDL_FreeSurface(dec->surf);
+        free(dec);
+        neuik_imgCache_nIdle--;
+    }
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_ImageCache_Load
+ *
+ *  Description:   Get a decoded copy of an image file. If the same file
+ *                 contents have already been decoded (and scaled to fit the 
+ *                 same bounds) the cached surface is shared, otherwise the 
+ *                 file is decoded and added to the cache.
+ *
+ *                 If `maxW` and/or `maxH` are greater than zero, the decoded
+ *                 image is scaled down (preserving its aspect ratio) to fit 
+ *                 within those bounds.
+ *
+ *                 This function does not use the NEUIK error stack and may be
+ *                 called from any thread. The returned reference must be 
+ *                 released with `neuik_ImageCache_Release()`.
+ *
+ *  Returns:       0 if successful; 1 if the cache could not be initialized, 
+ *                 2 if the file could not be read, 3 if memory could not be 
+ *                 allocated, 4 if the image could not be decoded and 5 if it
+ *                 could not be scaled down.
+ *
+ ******************************************************************************/
+int neuik_ImageCache_Load(
+    const char  * fileName, /* [in] The filename of the image to load. */
+    int           maxW,     /* [in] Max width of the decoded image (or 0) */
+    int           maxH,     /* [in] Max height of the decoded image (or 0) */
+    void       ** decoded)  /* [out] Reference to the cached decoded image */
+{
+    int                  rv     = 0;
+    int                  newW;
+    int                  newH;
+    long                 fSize;
+    size_t               nBytes = 0;
+    size_t               ctr;
+    float                scale;
+    Uint64               hash   = 14695981039346656037ULL; /* FNV-1a basis */
+    FILE               * file   = NULL;
+    unsigned char      * data   = NULL;
+    SDL_RWops          * rw     = NULL;
+    SDL_Surface        * surf   = NULL;
+    SDL_Surface        * scaled = NULL;
+    neuik_DecodedImage * dec    = NULL;
+    neuik_DecodedImage * ent    = NULL;
+    neuik_DecodedImage * prev   = NULL;
+
+    *decoded = NULL;
+    if (maxW < 0) maxW = 0;
+    if (maxH < 0) maxH = 0;
+
+    if (neuik_ImageCache_Init())
+    {
+        rv = 1;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Read in the encoded file contents and calculate their hash.            */
+    /*------------------------------------------------------------------------*/
+    file = fopen(fileName, "rb");
+    if (file == NULL)
+    {
+        rv = 2;
+        goto out;
+    }
+    if (fseek(file, 0, SEEK_END) != 0 || (fSize = ftell(file)) <= 0 ||
+        fseek(file, 0, SEEK_SET) != 0)
+    {
+        rv = 2;
+        goto out;
+    }
+    nBytes = (size_t)fSize;
+    data   = (unsigned char *)malloc(nBytes);
+    if (data == NULL)
+    {
+        rv = 3;
+        goto out;
+    }
+    if (fread(data, 1, nBytes, file) != nBytes)
+    {
+        rv = 2;
+        goto out;
+    }
+    fclose(file);
+    file = NULL;
+
+    for (ctr = 0; ctr < nBytes; ctr++)
+    {
+        hash = (hash ^ data[ctr]) * 1099511628211ULL;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Look for this image in the cache; if another thread is decoding it,    */
+    /* wait for that decode to finish.                                        */
+    /*------------------------------------------------------------------------*/
+    SDL_LockMutex(neuik_imgCache_Mutex);
+    for (;;)
+    {
+        for (ent = neuik_imgCache_Head; ent != NULL; ent = ent->next)
+        {
+            if (ent->hash == hash && ent->nBytes == nBytes &&
+                ent->maxW == maxW && ent->maxH == maxH)
+            {
+                break;
+            }
+        }
+        if (ent == NULL || ent->state == NEUIK_DECODEDSTATE_READY) break;
+
+        SDL_CondWait(neuik_imgCache_Decoded, neuik_imgCache_Mutex);
+    }
+
+    if (ent != NULL)
+    {
+        if (ent->refCount == 0) neuik_imgCache_nIdle--;
+        ent->refCount++;
+        ent->lastUsed = ++neuik_imgCache_Clock;
+        SDL_UnlockMutex(neuik_imgCache_Mutex);
+
+        *decoded = ent;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Not cached; add an entry (so that other loads of this image wait for   */
+    /* this one) and decode the image outside of the lock.                    */
+    /*------------------------------------------------------------------------*/
+    dec = (neuik_DecodedImage *)malloc(sizeof(neuik_DecodedImage));
+    if (dec == NULL)
+    {
+        SDL_UnlockMutex(neuik_imgCache_Mutex);
+        rv = 3;
+        goto out;
+    }
+    dec->hash     = hash;
+    dec->nBytes   = nBytes;
+    dec->maxW     = maxW;
+    dec->maxH     = maxH;
+    dec->state    = NEUIK_DECODEDSTATE_DECODING;
+    dec->refCount = 1;
+    dec->lastUsed = ++neuik_imgCache_Clock;
+    dec->surf     = NULL;
+    dec->next     = neuik_imgCache_Head;
+    neuik_imgCache_Head = dec;
+    SDL_UnlockMutex(neuik_imgCache_Mutex);
+
+    rw = SDL_RWFromConstMem(data, (int)nBytes);
+    if (rw == NULL)
+    {
+        rv = 3;
+    }
+    else
+    {
+        /* IMG_Load_RW() closes `rw` when its second argument is nonzero */
+        surf = IMG_Load_RW(rw, 1);
+        if (surf == NULL) rv = 4;
+    }
+
+    if (rv == 0 && ((maxW > 0 && surf->w > maxW) || (maxH > 0 && surf->h > maxH)))
+    {
+        /*--------------------------------------------------------------------*/
+        /* Scale the image down to fit within the requested bounds.           */
+        /*--------------------------------------------------------------------*/
+        scale = 1.0;
+        if (maxW > 0 && surf->w > maxW) scale = (float)(maxW)/(float)(surf->w);
+        if (maxH > 0 && (float)(surf->h)*scale > (float)(maxH))
+        {
+            scale = (float)(maxH)/(float)(surf->h);
+        }
+        newW = (int)((float)(surf->w)*scale + 0.5);
+        newH = (int)((float)(surf->h)*scale + 0.5);
+        if (newW < 1) newW = 1;
+        if (newH < 1) newH = 1;
+
+        scaled = neuik_Image_Downscale(surf, newW, newH);
+        SDL_FreeSurface(surf);
+        surf = scaled;
+        if (surf == NULL) rv = 5;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Publish the result; a failed entry is removed from the cache.          */
+    /*------------------------------------------------------------------------*/
+    SDL_LockMutex(neuik_imgCache_Mutex);
+    if (rv == 0)
+    {
+        dec->surf  = surf;
+        dec->state = NEUIK_DECODEDSTATE_READY;
+        *decoded   = dec;
+    }
+    else
+    {
+        prev = NULL;
+        for (ent = neuik_imgCache_Head; ent != NULL; ent = ent->next)
+        {
+            if (ent == dec) break;
+            prev = ent;
+        }
+        if (prev == NULL) neuik_imgCache_Head = dec->next;
+        else              prev->next          = dec->next;
+        free(dec);
+    }
+    SDL_CondBroadcast(neuik_imgCache_Decoded);
+    SDL_UnlockMutex(neuik_imgCache_Mutex);
+out:
+    if (file != NULL) fclose(file);
+    if (data != NULL) free(data);
+
+    return rv;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_ImageCache_GetSurface
+ *
+ *  Description:   Get the surface of a decoded image. The surface is shared;
+ *                 it must not be modified or freed.
+ *
+ *  Returns:       The decoded surface (NULL if `decoded` is NULL).
+ *
+ ******************************************************************************/
+SDL_Surface * neuik_ImageCache_GetSurface(
+    void * decoded)
+{
+    if (decoded == NULL) return NULL;
+
+    return ((neuik_DecodedImage *)decoded)->surf;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_ImageCache_Release
+ *
+ *  Description:   Release a reference to a decoded image. Unreferenced images
+ *                 are kept (for reuse) until they are among the least recently
+ *                 used of more than NEUIK_IMAGECACHE_MAXIDLE of them.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+void neuik_ImageCache_Release(
+    void * decoded)
+{
+    neuik_DecodedImage * dec = (neuik_DecodedImage *)decoded;
+
+    if (dec == NULL || neuik_imgCache_Mutex == NULL) return;
+
+    SDL_LockMutex(neuik_imgCache_Mutex);
+    dec->refCount--;
+    if (dec->refCount == 0)
+    {
+        neuik_imgCache_nIdle++;
+        neuik_ImageCache_TrimIdle(NEUIK_IMAGECACHE_MAXIDLE);
+    }
+    SDL_UnlockMutex(neuik_imgCache_Mutex);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_ImageLoad_Release
+ *
+ *  Description:   Release a reference to an image load; the last one frees it
+ *                 (along with a decoded image which was not taken).
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+static void neuik_ImageLoad_Release(
+    void * arg)
+{
+    neuik_ImageLoad * load = (neuik_ImageLoad *)arg;
+
+    if (SDL_AtomicAdd(&load->refCount, -1) != 1)
+    {
+        return;
+    }
+    if (load->decoded  != NULL) neuik_ImageCache_Release(load->decoded);
+    if (load->fileName != NULL) free(load->fileName);
+    free(load);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Image_CancelLoad
+ *
+ *  Description:   Detach an image from its asynchronous load (if one is still
+ *                 pending). A load which has not been started is skipped and
+ *                 one that has finished is discarded when it reaches the 
+ *                 event loop.
+ *
+ *                 This function must be called from the event loop thread.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+void neuik_Image_CancelLoad(
+    NEUIK_Image * img)
+{
+    neuik_ImageLoad * load = NULL;
+
+    if (img == NULL) return;
+
+    load = (neuik_ImageLoad *)(img->loader);
+    if (load == NULL) return;
+
+    img->loader = NULL;
+    load->img   = NULL;
+    SDL_AtomicSet(&load->cancelled, 1);
+    neuik_ImageLoad_Release(load);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Image_ApplyLoad
+ *
+ *  Description:   Give a decoded image to the NEUIK_Image which requested it;
+ *                 the image is uploaded when it is next drawn. This is posted
+ *                 to the event loop by the loader thread.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_Image_ApplyLoad(
+    void * elem,
+    void * arg)
+{
+    RenderSize        rSize;
+    RenderLoc         rLoc;
+    NEUIK_Image     * img        = NULL;
+    neuik_ImageLoad * load       = NULL;
+    int               eNum       = 0; /* which error to report (if any) */
+    int               rv         = 0;
+    float             prevScale;
+    static char       funcName[] = "neuik_Image_ApplyLoad";
+    static char     * errMsgs[]  = {"", // [0] no error
+        "Failed to initialize the decoded image cache.",    // [1]
+        "Unable to read the specified image file.",         // [2]
+        "Failure to allocate memory.",                      // [3]
+        "Failure in function `IMG_Load_RW`.",               // [4]
+        "Failure in function `neuik_Image_Downscale`.",     // [5]
+        "Failure in `neuik_Element_GetSizeAndLocation()`.", // [6]
+        "Failure in `neuik_Element_GetMinSize__Image()`.",  // [7]
+        "Failure in `neuik_Element_StoreFrameMinSize()`",   // [8]
+    };
+
+    load = (neuik_ImageLoad *)arg;
+    img  = load->img;
+    if (img == NULL)
+    {
+        /*--------------------------------------------------------------------*/
+        /* The load was cancelled (or the Image was freed).                   */
+        /*--------------------------------------------------------------------*/
+        goto out;
+    }
+    neuik_Image_CancelLoad(img);
+
+    if (load->result != 0)
+    {
+        /* the image will contain no data */
+        eNum = load->result;
+    }
+    else
+    {
+        neuik_TextureSlot_Clear((SDL_Texture **)&(img->imageTex));
+        neuik_Image_FreeVariants(img);
+        img->decoded     = load->decoded;
+        img->image       = neuik_ImageCache_GetSurface(load->decoded);
+        img->needsRedraw = 1;
+        load->decoded    = NULL;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Redraw the placeholder area, then store the new minimum size (measured */
+    /* at the scaling of the window containing the image).                    */
+    /*------------------------------------------------------------------------*/
+    if (neuik_Element_GetSizeAndLocation(img, &rSize, &rLoc))
+    {
+        if (eNum == 0) eNum = 6;
+        goto out;
+    }
+    neuik_Element_RequestRedraw(img, rLoc, rSize);
+
+    prevScale = neuik_Element_MakeScaleCurrent(img);
+    rv = neuik_Element_GetMinSize__Image(img, &rSize);
+    neuik__HighDPI_Scaling = prevScale;
+    if (rv)
+    {
+        if (eNum == 0) eNum = 7;
+        goto out;
+    }
+    if (neuik_Element_StoreFrameMinSize(img, &rSize))
+    {
+        if (eNum == 0) eNum = 8;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_ImageLoader_Thread
+ *
+ *  Description:   Take loads from the loader queue, decode their images and
+ *                 post the results to the event loop.
+ *
+ *  Returns:       0.
+ *
+ ******************************************************************************/
+static int neuik_ImageLoader_Thread(
+    void * unused)
+{
+    neuik_ImageLoad * load = NULL;
+
+    for (;;)
+    {
+        SDL_LockMutex(neuik_imgLoad_Mutex);
+        while (neuik_imgLoad_Head == NULL && !neuik_imgLoad_Quit)
+        {
+            SDL_CondWait(neuik_imgLoad_Wake, neuik_imgLoad_Mutex);
+        }
+        if (neuik_imgLoad_Quit)
+        {
+            SDL_UnlockMutex(neuik_imgLoad_Mutex);
+            break;
+        }
+        load               = neuik_imgLoad_Head;
+        neuik_imgLoad_Head = load->next;
+        if (neuik_imgLoad_Head == NULL) neuik_imgLoad_Tail = NULL;
+        load->next = NULL;
+        SDL_UnlockMutex(neuik_imgLoad_Mutex);
+
+        if (!SDL_AtomicGet(&load->cancelled))
+        {
+            load->result = neuik_ImageCache_Load(load->fileName, 
+                load->maxW, load->maxH, &load->decoded);
+
+            SDL_AtomicAdd(&load->refCount, 1);
+            if (NEUIK_PostToUIThread(neuik_Image_ApplyLoad, NULL,
+                NEUIK_UIUPDATE_NO_COALESCE, load, neuik_ImageLoad_Release))
+            {
+                neuik_ImageLoad_Release(load);
+            }
+        }
+        neuik_ImageLoad_Release(load); /* the reference held by the queue */
+    }
+
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_ImageLoader_Shutdown
+ *
+ *  Description:   Stop the image loader threads, discard the loads which have
+ *                 not been started and free the unreferenced decoded images.
+ *
+ *                 This function must be called from the event loop thread.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+void neuik_ImageLoader_Shutdown()
+{
+    int               ctr;
+    neuik_ImageLoad * load = NULL;
+
+    if (neuik_imgLoad_Mutex == NULL) return;
+
+    SDL_LockMutex(neuik_imgLoad_Mutex);
+    neuik_imgLoad_Quit = 1;
+    SDL_CondBroadcast(neuik_imgLoad_Wake);
+    SDL_UnlockMutex(neuik_imgLoad_Mutex);
+
+    for (ctr = 0; ctr < neuik_imgLoad_nThreads; ctr++)
+    {
+        SDL_WaitThread(neuik_imgLoad_Threads[ctr], NULL);
+        neuik_imgLoad_Threads[ctr] = NULL;
+    }
+    neuik_imgLoad_nThreads = 0;
+
+    SDL_LockMutex(neuik_imgLoad_Mutex);
+    while (neuik_imgLoad_Head != NULL)
+    {
+        load               = neuik_imgLoad_Head;
+        neuik_imgLoad_Head = load->next;
+        neuik_ImageLoad_Release(load);
+    }
+    neuik_imgLoad_Tail = NULL;
+    neuik_imgLoad_Quit = 0;
+    SDL_UnlockMutex(neuik_imgLoad_Mutex);
+
+    SDL_LockMutex(neuik_imgCache_Mutex);
+    neuik_ImageCache_TrimIdle(0);
+    SDL_UnlockMutex(neuik_imgCache_Mutex);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_MakeImage_Async
+ *
+ *  Description:   Create a new NEUIK_Image and load image data into it from
+ *                 the specified image file without blocking.
+ *
+ *                 The file is decoded by a loader thread; until it has been
+ *                 decoded, the image is drawn as a placeholder of the size 
+ *                 `width` x `height`. If `width` and/or `height` are greater
+ *                 than zero, the decoded image is also scaled down (preserving
+ *                 its aspect ratio) so that it fits within that size.
+ *
+ *                 Decoded images are cached by their file contents; a file
+ *                 which is used by several images is only decoded once.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_MakeImage_Async(
+    NEUIK_Image ** imgPtr,   /* [out] The newly created NEUIK_Image. */
+    const char   * filename, /* [in]  The filename of the image to load. */
+    int            width,    /* [in]  Width of the displayed image (or 0). */
+    int            height)   /* [in]  Height of the displayed image (or 0). */
+{
+    int               eNum       = 0; /* which error to report (if any) */
+    NEUIK_Image     * img        = NULL;
+    neuik_ImageLoad * load       = NULL;
+    static char       funcName[] = "NEUIK_MakeImage_Async";
+    static char     * errMsgs[]  = {"",                   // [0] no error
+        "Failure in function `neuik_Object_New__Image`.", // [1]
+        "Argument `width` has invalid value.",            // [2]
+        "Argument `height` has invalid value.",           // [3]
+        "Failure to allocate memory.",                    // [4]
+        "Failed to start the image loader thread.",       // [5]
+    };
+
+    if (width < 0)
+    {
+        eNum = 2;
+        goto out;
+    }
+    else if (height < 0)
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    if (NEUIK_NewImage(imgPtr))
+    {
+        eNum = 1;
+        goto out;
+    }
+    img = *imgPtr;
+
+    if (filename == NULL || filename[0] == '\0')
+    {
+        /* image will contain no data */
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Start the loader threads (if they aren't already running).             */
+    /*------------------------------------------------------------------------*/
+    if (neuik_ImageCache_Init())
+    {
+        eNum = 5;
+        goto out;
+    }
+    while (neuik_imgLoad_nThreads < NEUIK_IMAGELOAD_THREADS)
+    {
+        neuik_imgLoad_Threads[neuik_imgLoad_nThreads] = SDL_CreateThread(
+            neuik_ImageLoader_Thread, "neuik_imageloader", NULL);
+        if (neuik_imgLoad_Threads[neuik_imgLoad_nThreads] == NULL)
+        {
+            break;
+        }
+        neuik_imgLoad_nThreads++;
+    }
+    if (neuik_imgLoad_nThreads == 0)
+    {
+        eNum = 5;
+        goto out;
+    }
+
+    load = (neuik_ImageLoad *)malloc(sizeof(neuik_ImageLoad));
+    if (load == NULL)
+    {
+        eNum = 4;
+        goto out;
+    }
+    load->next     = NULL;
+    load->img      = img;
+    load->maxW     = width;
+    load->maxH     = height;
+    load->result   = 0;
+    load->decoded  = NULL;
+    load->fileName = (char *)malloc((strlen(filename) + 1)*sizeof(char));
+    if (load->fileName == NULL)
+    {
+        free(load);
+        eNum = 4;
+        goto out;
+    }
+    strcpy(load->fileName, filename);
+
+    /*------------------------------------------------------------------------*/
+    /* The image and the loader queue each hold a reference to the load.      */
+    /*------------------------------------------------------------------------*/
+    SDL_AtomicSet(&load->refCount, 2);
+    SDL_AtomicSet(&load->cancelled, 0);
+    img->loader = load;
+    img->loadW  = width;
+    img->loadH  = height;
+
+    SDL_LockMutex(neuik_imgLoad_Mutex);
+    if (neuik_imgLoad_Tail != NULL)
+    {
+        neuik_imgLoad_Tail->next = load;
+    }
+    else
+    {
+        neuik_imgLoad_Head = load;
+    }
+    neuik_imgLoad_Tail = load;
+    SDL_CondSignal(neuik_imgLoad_Wake);
+    SDL_UnlockMutex(neuik_imgLoad_Mutex);
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
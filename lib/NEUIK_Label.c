@@ -31,6 +31,7 @@
 #include "neuik_classes.h"
 
 extern int neuik__isInitialized;
+extern float neuik__HighDPI_Scaling;
 
 /*----------------------------------------------------------------------------*/
 /* Internal Function Prototypes                                               */
@@ -105,6 +106,7 @@ int neuik_RegisterClass_Label()
         "A GUI label which contains text.", // classDescription
         neuik__Set_NEUIK,                   // classSet
         neuik__Class_Element,               // superClass
+        sizeof(NEUIK_Label),                // objSize
         &neuik_Label_BaseFuncs,             // baseFuncs
         NULL,                               // classFuncs
         &neuik__Class_Label))               // newClass
@@ -155,7 +157,8 @@ int neuik_Object_New__Label(
         goto out;
     }
 
-    (*lblPtr) = (NEUIK_Label *)malloc(sizeof(NEUIK_Label));
+    (*lblPtr) = (NEUIK_Label*) neuik_Object_Alloc(
+        neuik__Class_Label, (void**)lblPtr);
     lbl = *lblPtr;
     if (lbl == NULL)
     {
@@ -280,7 +283,7 @@ int neuik_Object_Free__Label(
         eNum = 2;
         goto out;
     }
-    free(lbl);
+    neuik_Object_Release(lbl);
 out:
     if (eNum > 0)
     {
@@ -486,6 +489,8 @@ int NEUIK_Label_SetText(
     RenderLoc      rLoc;
     size_t         sLen = 1;
     int            eNum = 0; /* which error to report (if any) */
+    int            rv   = 0;
+    float          prevScale;
     static char    funcName[] = "NEUIK_Label_SetText";
     static char  * errMsgs[] = {"",                         // [0] no error
         "Argument `label` is not of Label class.",          // [1]
@@ -544,10 +549,13 @@ int NEUIK_Label_SetText(
     neuik_Element_RequestRedraw(label, rLoc, rSize);
 
     /*------------------------------------------------------------------------*/
-    /* Calculate the updated minimum size for the label and store the new     */
-    /* frame minimum size.                                                    */
+    /* Calculate the updated minimum size for the label (at the scaling of    */
+    /* its window) and store the new frame minimum size.                      */
     /*------------------------------------------------------------------------*/
-    if (neuik_Element_GetMinSize__Label(label, &rSize))
+    prevScale = neuik_Element_MakeScaleCurrent(label);
+    rv = neuik_Element_GetMinSize__Label(label, &rSize);
+    neuik__HighDPI_Scaling = prevScale;
+    if (rv)
     {
         eNum = 4;
         goto out;
@@ -774,7 +782,7 @@ out:
         if (!mock) eBase->eSt.doRedraw = 0;
     }
 
-    ConditionallyDestroyTexture(&tTex);
+    neuik_TexturePool_Release(rend, &tTex);
 
     if (eNum > 0)
     {
@@ -77,6 +77,7 @@ int neuik_RegisterClass_LabelConfig()
         "Configuration for NEUIK_Label Object.", // classDescription
         neuik__Set_NEUIK,                        // classSet
         NULL,                                    // superClass
+        sizeof(NEUIK_LabelConfig),               // objSize
         &neuik_LabelConfig_BaseFuncs,            // baseFuncs
         NULL,                                    // classFuncs
         &neuik__Class_LabelConfig))              // newClass
@@ -209,7 +210,8 @@ int neuik_Object_New__LabelConfig(
         goto out;
     }
 
-    (*cfgPtr) = (NEUIK_LabelConfig*) malloc(sizeof(NEUIK_LabelConfig));
+    (*cfgPtr) = (NEUIK_LabelConfig*) neuik_Object_Alloc(
+        neuik__Class_LabelConfig, (void**)cfgPtr);
     cfg = (*cfgPtr);
     if (cfg == NULL)
     {
@@ -272,7 +274,8 @@ int NEUIK_NewLabelConfig(
         goto out;
     }
 
-    (*cfgPtr) = (NEUIK_LabelConfig*) malloc(sizeof(NEUIK_LabelConfig));
+    (*cfgPtr) = (NEUIK_LabelConfig*) neuik_Object_Alloc(
+        neuik__Class_LabelConfig, (void**)cfgPtr);
     cfg = (*cfgPtr);
     if (cfg == NULL)
     {
@@ -431,7 +434,7 @@ int neuik_Object_Free__LabelConfig(
     /*------------------------------------------------------------------------*/
     if (cfg->fontName != NULL) free(cfg->fontName);
 
-    free(cfg);
+    neuik_Object_Release(cfg);
 out:
     if (eNum > 0)
     {
@@ -103,6 +103,7 @@ int neuik_RegisterClass_Line()
         "A vertical or horizontal line.", // classDescription
         neuik__Set_NEUIK,                 // classSet
         neuik__Class_Element,             // superClass
+        sizeof(NEUIK_Line),               // objSize
         &neuik_Line_BaseFuncs,            // baseFuncs
         NULL,                             // classFuncs
         &neuik__Class_Line))              // newClass
@@ -153,7 +154,8 @@ int neuik_Object_New__Line(
         eNum = 1;
         goto out;
     }
-    (*linePtr) = (NEUIK_Line*) malloc(sizeof(NEUIK_Line));
+    (*linePtr) = (NEUIK_Line*) neuik_Object_Alloc(
+        neuik__Class_Line, (void**)linePtr);
     line = *linePtr;
     if (line == NULL)
     {
@@ -262,7 +264,7 @@ int neuik_Object_Free__Line(
         goto out;
     }
 
-    free(line);
+    neuik_Object_Release(line);
 out:
     if (eNum > 0)
     {
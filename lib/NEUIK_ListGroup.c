@@ -106,6 +106,7 @@ int neuik_RegisterClass_ListGroup()
         "An element container which horizontally groups items.", // classDescription
         neuik__Set_NEUIK,                                        // classSet
         neuik__Class_Container,                                  // superClass
+        sizeof(NEUIK_ListGroup),                                 // objSize
         &neuik_ListGroup_BaseFuncs,                              // baseFuncs
         NULL,                                                    // classFuncs
         &neuik__Class_ListGroup))                                // newClass
@@ -164,7 +165,8 @@ int neuik_Object_New__ListGroup(
         eNum = 1;
         goto out;
     }
-    (*lgPtr) = (NEUIK_ListGroup*) malloc(sizeof(NEUIK_ListGroup));
+    (*lgPtr) = (NEUIK_ListGroup*) neuik_Object_Alloc(
+        neuik__Class_ListGroup, (void**)lgPtr);
     lg = *lgPtr;
     if (lg == NULL)
     {
@@ -318,7 +320,7 @@ int neuik_Object_Free__ListGroup(
         goto out;
     }
 
-    free(lg);
+    neuik_Object_Release(lg);
 out:
     if (eNum > 0)
     {
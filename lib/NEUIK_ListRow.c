@@ -107,6 +107,7 @@ int neuik_RegisterClass_ListRow()
         "An element container which horizontally groups items.", // classDescription
         neuik__Set_NEUIK,                                        // classSet
         neuik__Class_Container,                                  // superClass
+        sizeof(NEUIK_ListRow),                                   // objSize
         &neuik_ListRow_BaseFuncs,                                // baseFuncs
         NULL,                                                    // classFuncs
         &neuik__Class_ListRow))                                  // newClass
@@ -162,7 +163,8 @@ int neuik_Object_New__ListRow(
         eNum = 1;
         goto out;
     }
-    (*rowPtr) = (NEUIK_ListRow*) malloc(sizeof(NEUIK_ListRow));
+    (*rowPtr) = (NEUIK_ListRow*) neuik_Object_Alloc(
+        neuik__Class_ListRow, (void**)rowPtr);
     row = *rowPtr;
     if (row == NULL)
     {
@@ -453,7 +455,7 @@ int neuik_Object_Free__ListRow(
         goto out;
     }
 
-    free(row);
+    neuik_Object_Release(row);
 out:
     if (eNum > 0)
     {
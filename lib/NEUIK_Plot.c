@@ -100,6 +100,7 @@ int neuik_RegisterClass_Plot()
         "This Element contains a plot of values.", // classDescription
         neuik__Set_NEUIK,                          // classSet
         neuik__Class_Element,                      // superClass
+        sizeof(NEUIK_Plot),                        // objSize
         &neuik_Plot_BaseFuncs,                     // baseFuncs
         NULL,                                      // classFuncs XXXXX
         &neuik__Class_Plot))                       // newClass
@@ -169,7 +170,8 @@ int neuik_Object_New__Plot(
         eNum = 1;
         goto out;
     }
-    (*plotPtr) = (NEUIK_Plot*) malloc(sizeof(NEUIK_Plot));
+    (*plotPtr) = (NEUIK_Plot*) neuik_Object_Alloc(
+        neuik__Class_Plot, (void**)plotPtr);
     plot = *plotPtr;
     if (plot == NULL)
     {
@@ -452,7 +454,7 @@ int neuik_Object_Free__Plot(
         free(plot->data_configs);
     }
 
-    free(plot);
+    neuik_Object_Release(plot);
 out:
     if (eNum > 0)
     {
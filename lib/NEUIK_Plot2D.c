@@ -27,6 +27,7 @@
 #include "NEUIK_Plot2D_internal.h"
 #include "NEUIK_Element_internal.h"
 #include "NEUIK_Window_internal.h"
+#include "NEUIK_WorkPool_internal.h"
 #include "NEUIK_Container.h"
 #include "neuik_internal.h"
 #include "neuik_classes.h"
@@ -109,6 +110,7 @@ int neuik_RegisterClass_Plot2D()
         "An plot element which displays data in two dimensions.", // classDescription
         neuik__Set_NEUIK,                                         // classSet
         neuik__Class_Plot,                                        // superClass
+        sizeof(NEUIK_Plot2D),                                     // objSize
         &neuik_Plot2D_BaseFuncs,                                  // baseFuncs
         NULL,                                                     // classFuncs
         &neuik__Class_Plot2D))                                    // newClass
@@ -172,7 +174,8 @@ int neuik_Object_New__Plot2D(
         eNum = 1;
         goto out;
     }
-    (*pltPtr) = (NEUIK_Plot2D*) malloc(sizeof(NEUIK_Plot2D));
+    (*pltPtr) = (NEUIK_Plot2D*) neuik_Object_Alloc(
+        neuik__Class_Plot2D, (void**)pltPtr);
     plot2d = *pltPtr;
     if (plot2d == NULL)
     {
@@ -494,7 +497,7 @@ int neuik_Object_Free__Plot2D(
         goto out;
     }
 
-    free(plt);
+    neuik_Object_Release(plt);
 out:
     if (eNum > 0)
     {
@@ -561,96 +564,55 @@ out:
 }
 
 
+/*----------------------------------------------------------------------------*/
+/* The line mask of each PlotData set is independent of the others; these are */
+/* the arguments needed to rasterize one of them on the worker pool. The mask */
+/* is created (and errors are raised) by the UI thread; a job only fills it.  */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    NEUIK_Plot2D          * plot2d;
+    NEUIK_PlotData        * data;
+    neuik_PlotDataConfig  * dataCfg;
+    int                     maskW;
+    int                     maskH;
+    int                     ticZoneW;
+    int                     ticZoneH;
+    int                     ticZoneOffsetX;
+    int                     ticZoneOffsetY;
+    neuik_MaskMap         * lineMask;
+    const char            * errMsg;   /* set if the job failed */
+} neuik_Plot2D_LineMaskJob;
+
+
 /*******************************************************************************
  *
- *  Name:          neuik_Plot2D_RenderSimpleLineToMask
+ *  Name:          neuik_Plot2D_RunLineMaskJob
  *
- *  Description:   Renders a 1-4 pixel wide X-Y scatter line plot to a maskMap.
+ *  Description:   Worker pool job which renders the line mask of a single
+ *                 PlotData set. This does not raise errors; a failure is 
+ *                 described by `errMsg` within the job.
  *
  *  Returns:       1 if there is an error; 0 otherwise.
  *
  ******************************************************************************/
-int neuik_Plot2D_RenderSimpleLineToMask(
-    NEUIK_Plot2D          * plot2d,
-    NEUIK_PlotData        * data,
-    neuik_PlotDataConfig  * dataCfg,
-    int                     thickness,
-    int                     maskW,
-    int                     maskH,
-    int                     ticZoneW,
-    int                     ticZoneH,
-    int                     ticZoneOffsetX,
-    int                     ticZoneOffsetY,
-    neuik_MaskMap        ** lineMask)
+static int neuik_Plot2D_RunLineMaskJob(
+    void * jobPtr)
 {
-    NEUIK_Plot  * plot       = NULL;
-    int           eNum       = 0; /* which error to report (if any) */
-    static char   funcName[] = "neuik_Plot2D_RenderSimpleLineToMask";
-    static char * errMsgs[]  = {"", // [0] no error
-        "Argument `plot2d` is not of Plot2D class.",                           // [1]
-        "Argument `plot2d` caused `neuik_Object_GetClassObject` to fail.",     // [2]
-        "Output Argument `lineMask` is NULL.",                                 // [3]
-        "Argument `data` has an unsupported value for precision.",             // [4]
-        "Argument `thickness` has an invalid value (values `1-4` are valid).", // [5]
-        "Failure in `neuik_Plot2D_Render32_SimpleLineToMask()`.",              // [6]
-        "Failure in `neuik_Plot2D_Render64_SimpleLineToMask()`.",              // [7]
-    };
+    neuik_Plot2D_LineMaskJob * job = (neuik_Plot2D_LineMaskJob *)jobPtr;
 
-    if (!neuik_Object_IsClass(plot2d, neuik__Class_Plot2D))
+    if (job->data->precision == 32)
     {
-        eNum = 1;
-        goto out;
-    }
-
-    if (neuik_Object_GetClassObject(plot2d, neuik__Class_Plot, (void**)&plot))
-    {
-        eNum = 2;
-        goto out;
+        return neuik_Plot2D_Render32_SimpleLineToMask(
+            job->plot2d, job->data, job->dataCfg, 
+            job->dataCfg->lineThickness, job->maskW, job->maskH, 
+            job->ticZoneW, job->ticZoneH, job->ticZoneOffsetX, 
+            job->ticZoneOffsetY, job->lineMask, &(job->errMsg));
     }
-    if (lineMask == NULL)
-    {
-        eNum = 3;
-        goto out;
-    }
-    if (!(data->precision == 32 || data->precision == 64))
-    {
-        eNum = 4;
-        goto out;
-    }
-    if (thickness < 1 || thickness > 4)
-    {
-        eNum = 5;
-        goto out;
-    }
-
-    if (data->precision == 32)
-    {
-        if (neuik_Plot2D_Render32_SimpleLineToMask(
-            plot2d, data, dataCfg, thickness, maskW, maskH, 
-            ticZoneW, ticZoneH, ticZoneOffsetX, ticZoneOffsetY, lineMask))
-        {
-            eNum = 6;
-            goto out;
-        }
-    }
-    else if (data->precision == 64)
-    {
-        if (neuik_Plot2D_Render64_SimpleLineToMask(
-            plot2d, data, dataCfg, thickness, maskW, maskH, 
-            ticZoneW, ticZoneH, ticZoneOffsetX, ticZoneOffsetY, lineMask))
-        {
-            eNum = 7;
-            goto out;
-        }
-    }
-out:
-    if (eNum > 0)
-    {
-        NEUIK_RaiseError(funcName, errMsgs[eNum]);
-        eNum = 1;
-    }
-
-    return eNum;
+    return neuik_Plot2D_Render64_SimpleLineToMask(
+        job->plot2d, job->data, job->dataCfg, 
+        job->dataCfg->lineThickness, job->maskW, job->maskH, 
+        job->ticZoneW, job->ticZoneH, job->ticZoneOffsetX, 
+        job->ticZoneOffsetY, job->lineMask, &(job->errMsg));
 }
 
 
@@ -673,7 +635,6 @@ int neuik_Element_Render__Plot2D(
     unsigned int           uCtr         = 0;
     int                    ctr          = 0;
     int                    eNum         = 0; /* which error to report (if any) */
-    int                    lnThickness  = 0;
     int                    maskCtr      = 0; /* maskMap counter */
     int                    maskW        = 0;
     int                    maskH        = 0;
@@ -729,6 +690,8 @@ int neuik_Element_Render__Plot2D(
     neuik_PlotDataConfig * dataCfg    = NULL;
     NEUIK_Canvas         * dwg;               /* pointer to active drawing (don't free) */
     neuik_MaskMap        * maskMap    = NULL; /* FREE upon return */
+    neuik_Plot2D_LineMaskJob * maskJobs = NULL; /* FREE upon return */
+    void                  ** jobPtrs    = NULL; /* FREE upon return */
     enum neuik_bgstyle     bgStyle;
     static char            funcName[] = "neuik_Element_Render__Plot2D";
     static char          * errMsgs[]  = {"", // [0] no error
@@ -745,8 +708,12 @@ int neuik_Element_Render__Plot2D(
         "Failure in `NEUIK_Container_GetFirstElement()`",                   // [11]
         "Failure in `NEUIK_Container_GetLastElement()`",                    // [12]
         "Failure in `neuik_Element_GetSizeAndLocation()`.",                 // [13]
-        "Failure in `neuik_Plot2D_RenderSimpleLineToMask()`.",              // [14]
+        "Failure rendering the line mask of a PlotData set.",               // [14]
         "Failure in `neuik_MaskMap_GetUnmaskedRegionsOnVLine()`.",          // [15]
+        "Failure to allocate memory.",                                      // [16]
+        "PlotData set has an invalid `lineThickness` (`1-4` are valid).",   // [17]
+        "Argument `data` has an unsupported value for precision.",          // [18]
+        "Failure in `neuik_MaskMap_MaskAll()`.",                            // [19]
     };
 
     if (!neuik_Object_IsClass(pltElem, neuik__Class_Plot2D))
@@ -1152,6 +1119,94 @@ int neuik_Element_Render__Plot2D(
     pltOffsetX = (ticPlotLoc.x - dwg_loc.x);
     pltOffsetY = (ticPlotLoc.y - dwg_loc.y);
 
+    maskW = dwg_rs.w;
+    maskH = dwg_rs.h; /* yMax value is at the top of the plot */
+
+    ticZoneW = tic_xmax - tic_xmin;
+    ticZoneH = tic_ymin - tic_ymax; /* yMax value is at the top of the plot */
+
+    /*------------------------------------------------------------------------*/
+    /* Rasterize the line masks of all of the PlotData sets first; these are  */
+    /* independent CPU-side operations which may be run on the worker pool.   */
+    /*------------------------------------------------------------------------*/
+    if (plot->n_used > 0)
+    {
+        maskJobs = (neuik_Plot2D_LineMaskJob *)calloc(
+            plot->n_used, sizeof(neuik_Plot2D_LineMaskJob));
+        jobPtrs  = (void **)malloc(plot->n_used*sizeof(void *));
+        if (maskJobs == NULL || jobPtrs == NULL)
+        {
+            eNum = 16;
+            goto out;
+        }
+    }
+
+    ctr = 0;
+    for (uCtr = 0; uCtr < plot->n_used; uCtr++)
+    {
+        data = (NEUIK_PlotData*)(plot->data_sets[uCtr]);
+        if (!data->boundsSet) continue;
+
+        dataCfg = &(plot->data_configs[uCtr]);
+
+        /*--------------------------------------------------------------------*/
+        /* Check the arguments here, errors can't be raised from the pool.    */
+        /*--------------------------------------------------------------------*/
+        if (dataCfg->lineThickness < 1 || dataCfg->lineThickness > 4)
+        {
+            eNum = 17;
+            goto out;
+        }
+        if (!(data->precision == 32 || data->precision == 64))
+        {
+            eNum = 18;
+            goto out;
+        }
+
+        maskJobs[uCtr].plot2d         = plt;
+        maskJobs[uCtr].data           = data;
+        maskJobs[uCtr].dataCfg        = dataCfg;
+        maskJobs[uCtr].maskW          = maskW;
+        maskJobs[uCtr].maskH          = maskH;
+        maskJobs[uCtr].ticZoneW       = ticZoneW;
+        maskJobs[uCtr].ticZoneH       = ticZoneH;
+        maskJobs[uCtr].ticZoneOffsetX = tic_xmin;
+        maskJobs[uCtr].ticZoneOffsetY = tic_ymax;
+
+        /*--------------------------------------------------------------------*/
+        /* Objects are created on the UI thread; the job only unmasks lines.  */
+        /*--------------------------------------------------------------------*/
+        if (neuik_MakeMaskMap(&(maskJobs[uCtr].lineMask), maskW, maskH))
+        {
+            eNum = 7;
+            goto out;
+        }
+        if (neuik_MaskMap_MaskAll(maskJobs[uCtr].lineMask))
+        {
+            eNum = 19;
+            goto out;
+        }
+        jobPtrs[ctr] = &(maskJobs[uCtr]);
+        ctr++;
+    }
+
+    if (neuik_WorkPool_Run(neuik_Plot2D_RunLineMaskJob, jobPtrs, ctr))
+    {
+        /*--------------------------------------------------------------------*/
+        /* The batch has been joined; raise the errors reported by the jobs.  */
+        /*--------------------------------------------------------------------*/
+        for (uCtr = 0; uCtr < plot->n_used; uCtr++)
+        {
+            if (maskJobs[uCtr].errMsg == NULL) continue;
+            NEUIK_RaiseError((maskJobs[uCtr].data->precision == 32) ?
+                "neuik_Plot2D_Render32_SimpleLineToMask" :
+                "neuik_Plot2D_Render64_SimpleLineToMask",
+                maskJobs[uCtr].errMsg);
+        }
+        eNum = 14;
+        goto out;
+    }
+
     for (uCtr = 0; uCtr < plot->n_used; uCtr++)
     {
         data = (NEUIK_PlotData*)(plot->data_sets[uCtr]);
@@ -1202,21 +1257,11 @@ int neuik_Element_Render__Plot2D(
             maskMap = NULL;
         }
 
-        maskW = dwg_rs.w;
-        maskH = dwg_rs.h; /* yMax value is at the top of the plot */
-
-        lnThickness = dataCfg->lineThickness;
-
-        ticZoneW = tic_xmax - tic_xmin;
-        ticZoneH = tic_ymin - tic_ymax; /* yMax value is at the top of the plot */
-
-        if (neuik_Plot2D_RenderSimpleLineToMask(
-            plt, data, dataCfg, lnThickness, maskW, maskH, 
-            ticZoneW, ticZoneH, tic_xmin, tic_ymax, &maskMap))
-        {
-            eNum = 14;
-            goto out;
-        }
+        /*--------------------------------------------------------------------*/
+        /* Take ownership of the line mask rendered above.                    */
+        /*--------------------------------------------------------------------*/
+        maskMap = maskJobs[uCtr].lineMask;
+        maskJobs[uCtr].lineMask = NULL;
 
         for (ctr = 0; ctr < maskW; ctr++)
         {
@@ -1279,6 +1324,18 @@ out:
         if (!mock) eBase->eSt.doRedraw = 0;
     }
     if (maskMap != NULL) neuik_Object_Free(maskMap);
+    if (maskJobs != NULL)
+    {
+        for (uCtr = 0; uCtr < plot->n_used; uCtr++)
+        {
+            if (maskJobs[uCtr].lineMask != NULL)
+            {
+                neuik_Object_Free(maskJobs[uCtr].lineMask);
+            }
+        }
+        free(maskJobs);
+    }
+    if (jobPtrs != NULL) free(jobPtrs);
 
     if (eNum > 0)
     {
@@ -1327,6 +1384,22 @@ int neuik_Plot2D_UpdateAxesRanges(
     NEUIK_Plot     * plot       = NULL;
     NEUIK_PlotData * data       = NULL;
     char             ticMarkLbl[100]; 
+    static const NEUIK_ElementConfigItem yTicLblCfg[] = {
+        {NEUIK_ELEMENTCFG_HFILL,    1,                    0.0},
+        {NEUIK_ELEMENTCFG_HJUSTIFY, NEUIK_HJUSTIFY_RIGHT, 0.0},
+    };
+    static const NEUIK_ElementConfigItem xTicLblCfg[] = {
+        {NEUIK_ELEMENTCFG_VFILL,    1,                    0.0},
+        {NEUIK_ELEMENTCFG_VJUSTIFY, NEUIK_VJUSTIFY_TOP,   0.0},
+    };
+    static const NEUIK_ElementConfigItem yFillCfg[] = {
+        {NEUIK_ELEMENTCFG_PADALL,   2,                    0.0},
+        {NEUIK_ELEMENTCFG_PADRIGHT, 0,                    0.0},
+    };
+    static const NEUIK_ElementConfigItem xFillCfg[] = {
+        {NEUIK_ELEMENTCFG_PADALL,   2,                    0.0},
+        {NEUIK_ELEMENTCFG_PADTOP,   0,                    0.0},
+    };
     static char      funcName[] = "neuik_Plot2D_UpdateAxesRanges";
     static char    * errMsgs[]  = {"", // [0] no error
         "Argument `plot2d` is not of Plot2D class.",                       // [1]
@@ -1336,7 +1409,7 @@ int neuik_Plot2D_UpdateAxesRanges(
         "Failure in function `NEUIK_MakeLabel()`.",                        // [5]
         "Failure in function `NEUIK_Container_AddElement()`.",             // [6]
         "Failure in function `NEUIK_NewVFill()`.",                         // [7]
-        "Failure in function `NEUIK_Element_Configure()`.",                // [8]
+        "Failure in function `NEUIK_Element_ConfigureItems()`.",           // [8]
         "Failure in function `NEUIK_NewHFill()`.",                         // [9]
     };
 
@@ -1577,7 +1650,7 @@ int neuik_Plot2D_UpdateAxesRanges(
             eNum = 5;
             goto out;
         }
-        if (NEUIK_Element_Configure(newTicLbl, "HFill", "HJustify=right", NULL))
+        if (NEUIK_Element_ConfigureItems(newTicLbl, yTicLblCfg, 2))
         {
             eNum = 8;
             goto out;
@@ -1596,7 +1669,7 @@ int neuik_Plot2D_UpdateAxesRanges(
             eNum = 9;
             goto out;
         }
-        if (NEUIK_Element_Configure(newFill, "PadAll=2", "PadRight=0", NULL))
+        if (NEUIK_Element_ConfigureItems(newFill, yFillCfg, 2))
         {
             eNum = 8;
             goto out;
@@ -1642,8 +1715,8 @@ int neuik_Plot2D_UpdateAxesRanges(
                     eNum = 5;
                     goto out;
                 }
-                if (NEUIK_Element_Configure(
-                    newTicLbl, "HFill", "HJustify=right", NULL))
+                if (NEUIK_Element_ConfigureItems(
+                    newTicLbl, yTicLblCfg, 2))
                 {
                     eNum = 8;
                     goto out;
@@ -1684,7 +1757,7 @@ int neuik_Plot2D_UpdateAxesRanges(
             eNum = 5;
             goto out;
         }
-        if (NEUIK_Element_Configure(newTicLbl, "HFill", "HJustify=right", NULL))
+        if (NEUIK_Element_ConfigureItems(newTicLbl, yTicLblCfg, 2))
         {
             eNum = 8;
             goto out;
@@ -1703,7 +1776,7 @@ int neuik_Plot2D_UpdateAxesRanges(
             eNum = 9;
             goto out;
         }
-        if (NEUIK_Element_Configure(newFill, "PadAll=2", "PadRight=0", NULL))
+        if (NEUIK_Element_ConfigureItems(newFill, yFillCfg, 2))
         {
             eNum = 8;
             goto out;
@@ -1729,7 +1802,7 @@ int neuik_Plot2D_UpdateAxesRanges(
             eNum = 5;
             goto out;
         }
-        if (NEUIK_Element_Configure(newTicLbl, "VFill", "VJustify=top", NULL))
+        if (NEUIK_Element_ConfigureItems(newTicLbl, xTicLblCfg, 2))
         {
             eNum = 8;
             goto out;
@@ -1748,7 +1821,7 @@ int neuik_Plot2D_UpdateAxesRanges(
             eNum = 7;
             goto out;
         }
-        if (NEUIK_Element_Configure(newFill, "PadAll=2", "PadTop=0", NULL))
+        if (NEUIK_Element_ConfigureItems(newFill, xFillCfg, 2))
         {
             eNum = 8;
             goto out;
@@ -1794,8 +1867,8 @@ int neuik_Plot2D_UpdateAxesRanges(
                     eNum = 5;
                     goto out;
                 }
-                if (NEUIK_Element_Configure(
-                    newTicLbl, "VFill", "VJustify=top", NULL))
+                if (NEUIK_Element_ConfigureItems(
+                    newTicLbl, xTicLblCfg, 2))
                 {
                     eNum = 8;
                     goto out;
@@ -1836,7 +1909,7 @@ int neuik_Plot2D_UpdateAxesRanges(
             eNum = 5;
             goto out;
         }
-        if (NEUIK_Element_Configure(newTicLbl, "VFill", "VJustify=top", NULL))
+        if (NEUIK_Element_ConfigureItems(newTicLbl, xTicLblCfg, 2))
         {
             eNum = 8;
             goto out;
@@ -1855,7 +1928,7 @@ int neuik_Plot2D_UpdateAxesRanges(
             eNum = 7;
             goto out;
         }
-        if (NEUIK_Element_Configure(newFill, "PadAll=2", "PadTop=0", NULL))
+        if (NEUIK_Element_ConfigureItems(newFill, xFillCfg, 2))
         {
             eNum = 8;
             goto out;
@@ -75,6 +75,7 @@ int neuik_RegisterClass_PlotData()
         "Stores a set of X,Y datapoint pairs.", // classDescription
         neuik__Set_NEUIK,                       // classSet
         NULL,                                   // superClass
+        sizeof(NEUIK_PlotData),                 // objSize
         &neuik_PlotData_BaseFuncs,              // baseFuncs
         NULL,                                   // classFuncs
         &neuik__Class_PlotData))                // newClass
@@ -119,7 +120,8 @@ int neuik_Object_New__PlotData(
         goto out;
     }
 
-    (*ptr) = (NEUIK_PlotData*) malloc(sizeof(NEUIK_PlotData));
+    (*ptr) = (NEUIK_PlotData*) neuik_Object_Alloc(
+        neuik__Class_PlotData, (void**)ptr);
     pd = (*ptr);
     if (pd == NULL)
     {
@@ -222,7 +224,7 @@ int neuik_Object_Free__PlotData(
     /*------------------------------------------------------------------------*/
     /* Free the memory used for the object structure itself.                  */
     /*------------------------------------------------------------------------*/
-    free(pd);
+    neuik_Object_Release(pd);
 out:
     if (eNum > 0)
     {
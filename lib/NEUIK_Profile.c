@@ -0,0 +1,497 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#include <SDL.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+
+#include "NEUIK_error.h"
+#include "NEUIK_Profile.h"
+#include "NEUIK_Profile_internal.h"
+#include "neuik_internal.h"
+
+#define NEUIK_PROFILE_MAX_DEPTH   256       /* deeper scopes are not timed */
+#define NEUIK_PROFILE_MAX_EVENTS  (1 << 20) /* trace events kept for export */
+#define NEUIK_PROFILE_HASH_SIZE   1024
+
+int neuik__Profile_Enabled = 0;
+
+static const char * neuik_Profile_ScopeNames[NEUIK_PROFILE_NSCOPES] = {
+    "Frame",
+    "GetMinSize",
+    "Render",
+    "CaptureEvent",
+    "RedrawBackground",
+    "RenderText",
+    "TextureUpload",
+};
+
+/*----------------------------------------------------------------------------*/
+/* Currently open (nested) scopes                                             */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    Uint64               t0;         /* counter value at start of scope */
+    Uint64               childTicks; /* time spent in nested scopes */
+    neuik_ProfileScope   scope;
+    const char         * className;
+    const void         * window;
+} neuik_ProfileFrame;
+
+static neuik_ProfileFrame neuik_Profile_Stack[NEUIK_PROFILE_MAX_DEPTH];
+static int                neuik_Profile_Depth = 0;
+static Uint64             neuik_Profile_T0    = 0; /* counter at Start() */
+
+/*----------------------------------------------------------------------------*/
+/* Accumulated results; entries are found through a small chained hash table  */
+/* keyed by (scope, className, window).                                       */
+/*----------------------------------------------------------------------------*/
+static NEUIK_ProfileEntry * neuik_Profile_Entries      = NULL;
+static int                * neuik_Profile_EntryScope   = NULL;
+static int                * neuik_Profile_EntryNext    = NULL;
+static int                  neuik_Profile_nEntries     = 0;
+static int                  neuik_Profile_nAlloc       = 0;
+static int                  neuik_Profile_Hash[NEUIK_PROFILE_HASH_SIZE];
+static int                  neuik_Profile_HashInit     = 0;
+
+/*----------------------------------------------------------------------------*/
+/* Recorded trace events (for NEUIK_Profile_WriteChromeTrace())               */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    Uint64               ts;    /* start (counter ticks since Start()) */
+    Uint64               dur;   /* duration (counter ticks) */
+    neuik_ProfileScope   scope;
+    const char         * className;
+    const void         * window;
+} neuik_ProfileEvent;
+
+static neuik_ProfileEvent * neuik_Profile_Events        = NULL;
+static int                  neuik_Profile_nEvents       = 0;
+static int                  neuik_Profile_nEventsAlloc  = 0;
+static unsigned long        neuik_Profile_nEventsDropped = 0;
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Profile_GetEntry
+ *
+ *  Description:   Find (or create) the entry for the specified operation.
+ *
+ *  Returns:       NULL if there is a problem, otherwise the entry.
+ *
+ ******************************************************************************/
+static NEUIK_ProfileEntry * neuik_Profile_GetEntry(
+    neuik_ProfileScope   scope,
+    const char         * className,
+    const void         * window)
+{
+    int    ctr;
+    int    newAlloc;
+    int    bucket;
+    void * newPtr;
+
+    if (!neuik_Profile_HashInit)
+    {
+        for (ctr = 0; ctr < NEUIK_PROFILE_HASH_SIZE; ctr++)
+        {
+            neuik_Profile_Hash[ctr] = -1;
+        }
+        neuik_Profile_HashInit = 1;
+    }
+
+    bucket = (int)(((uintptr_t)(className) >> 3) ^ 
+        ((uintptr_t)(window) >> 3) ^ (uintptr_t)(scope*131));
+    bucket &= (NEUIK_PROFILE_HASH_SIZE - 1);
+
+    for (ctr = neuik_Profile_Hash[bucket]; ctr >= 0; 
+         ctr = neuik_Profile_EntryNext[ctr])
+    {
+        if (neuik_Profile_EntryScope[ctr]        == (int)(scope) &&
+            neuik_Profile_Entries[ctr].className == className &&
+            neuik_Profile_Entries[ctr].window    == window)
+        {
+            return &(neuik_Profile_Entries[ctr]);
+        }
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* This is a new entry; make sure there is room for it.                   */
+    /*------------------------------------------------------------------------*/
+    if (neuik_Profile_nEntries == neuik_Profile_nAlloc)
+    {
+        newAlloc = (neuik_Profile_nAlloc == 0) ? 64 : 2*neuik_Profile_nAlloc;
+
+        newPtr = realloc(neuik_Profile_Entries, 
+            newAlloc*sizeof(NEUIK_ProfileEntry));
+        if (newPtr == NULL) return NULL;
+        neuik_Profile_Entries = (NEUIK_ProfileEntry *)newPtr;
+
+        newPtr = realloc(neuik_Profile_EntryScope, newAlloc*sizeof(int));
+        if (newPtr == NULL) return NULL;
+        neuik_Profile_EntryScope = (int *)newPtr;
+
+        newPtr = realloc(neuik_Profile_EntryNext, newAlloc*sizeof(int));
+        if (newPtr == NULL) return NULL;
+        neuik_Profile_EntryNext = (int *)newPtr;
+
+        neuik_Profile_nAlloc = newAlloc;
+    }
+
+    ctr = neuik_Profile_nEntries++;
+    neuik_Profile_Entries[ctr].window    = window;
+    neuik_Profile_Entries[ctr].className = className;
+    neuik_Profile_Entries[ctr].scope     = neuik_Profile_ScopeNames[scope];
+    neuik_Profile_Entries[ctr].calls     = 0;
+    neuik_Profile_Entries[ctr].totalMs   = 0.0;
+    neuik_Profile_Entries[ctr].selfMs    = 0.0;
+    neuik_Profile_Entries[ctr].maxMs     = 0.0;
+    neuik_Profile_EntryScope[ctr]        = (int)(scope);
+    neuik_Profile_EntryNext[ctr]         = neuik_Profile_Hash[bucket];
+    neuik_Profile_Hash[bucket]           = ctr;
+
+    return &(neuik_Profile_Entries[ctr]);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Profile_Begin
+ *
+ *  Description:   Begin timing an operation. Every call must be matched by a
+ *                 call to neuik_Profile_End() (passing this return value).
+ *
+ *                 If `object` (or `window`) is NULL, the class (or window) of
+ *                 the enclosing scope is used.
+ *
+ *  Returns:       1 if the operation is being timed, 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_Profile_Begin(
+    neuik_ProfileScope   scope,  /* [in] the kind of operation */
+    const void         * object, /* [in] NEUIK object being operated on */
+    const void         * window) /* [in] window containing the object */
+{
+    neuik_ProfileFrame * frame;
+    neuik_ProfileFrame * parent = NULL;
+
+    if (!neuik__Profile_Enabled) return 0;
+    if (neuik_Profile_Depth >= NEUIK_PROFILE_MAX_DEPTH) return 0;
+
+    if (neuik_Profile_Depth > 0)
+    {
+        parent = &(neuik_Profile_Stack[neuik_Profile_Depth - 1]);
+    }
+
+    frame = &(neuik_Profile_Stack[neuik_Profile_Depth++]);
+    frame->scope      = scope;
+    frame->childTicks = 0;
+    frame->className  = (parent != NULL) ? parent->className : NULL;
+    frame->window     = (parent != NULL) ? parent->window    : NULL;
+
+    if (object != NULL && neuik_Object_IsNEUIKObject_NoError(object))
+    {
+        frame->className = 
+            ((const neuik_Object *)(object))->nClass->ClassName;
+    }
+    if (window != NULL) frame->window = window;
+
+    frame->t0 = SDL_GetPerformanceCounter();
+    return 1;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Profile_End
+ *
+ *  Description:   Finish timing the most recently begun operation.
+ *
+ ******************************************************************************/
+void neuik_Profile_End(
+    int began) /* [in] the value returned by neuik_Profile_Begin() */
+{
+    Uint64               dur;
+    double               ms;
+    double               msPerTick;
+    neuik_ProfileFrame * frame;
+    neuik_ProfileEvent * ev;
+    NEUIK_ProfileEntry * entry;
+    void               * newPtr;
+    int                  newAlloc;
+
+    if (!began || neuik_Profile_Depth <= 0) return;
+
+    frame = &(neuik_Profile_Stack[--neuik_Profile_Depth]);
+    dur   = SDL_GetPerformanceCounter() - frame->t0;
+
+    if (neuik_Profile_Depth > 0)
+    {
+        neuik_Profile_Stack[neuik_Profile_Depth - 1].childTicks += dur;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Accumulate the results for this kind of operation.                     */
+    /*------------------------------------------------------------------------*/
+    msPerTick = 1000.0/(double)(SDL_GetPerformanceFrequency());
+    entry = neuik_Profile_GetEntry(frame->scope, frame->className, frame->window);
+    if (entry != NULL)
+    {
+        ms = (double)(dur)*msPerTick;
+        entry->calls++;
+        entry->totalMs += ms;
+        entry->selfMs  += (double)(dur - frame->childTicks)*msPerTick;
+        if (ms > entry->maxMs) entry->maxMs = ms;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Record the trace event.                                                */
+    /*------------------------------------------------------------------------*/
+    if (neuik_Profile_nEvents == neuik_Profile_nEventsAlloc)
+    {
+        if (neuik_Profile_nEventsAlloc >= NEUIK_PROFILE_MAX_EVENTS)
+        {
+            neuik_Profile_nEventsDropped++;
+            return;
+        }
+        newAlloc = (neuik_Profile_nEventsAlloc == 0) ? 
+            4096 : 2*neuik_Profile_nEventsAlloc;
+        newPtr = realloc(neuik_Profile_Events, 
+            newAlloc*sizeof(neuik_ProfileEvent));
+        if (newPtr == NULL)
+        {
+            neuik_Profile_nEventsDropped++;
+            return;
+        }
+        neuik_Profile_Events       = (neuik_ProfileEvent *)newPtr;
+        neuik_Profile_nEventsAlloc = newAlloc;
+    }
+    ev = &(neuik_Profile_Events[neuik_Profile_nEvents++]);
+    ev->ts        = frame->t0 - neuik_Profile_T0;
+    ev->dur       = dur;
+    ev->scope     = frame->scope;
+    ev->className = frame->className;
+    ev->window    = frame->window;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_Profile_Start
+ *
+ *  Description:   Clear any previous results and begin profiling. Profiling
+ *                 is off by default and costs (almost) nothing while off.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_Profile_Start()
+{
+    NEUIK_Profile_Reset();
+    neuik__Profile_Enabled = 1;
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_Profile_Stop
+ *
+ *  Description:   Stop profiling; the results remain available until the
+ *                 next call to NEUIK_Profile_Start() or NEUIK_Profile_Reset().
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_Profile_Stop()
+{
+    neuik__Profile_Enabled = 0;
+    neuik_Profile_Depth    = 0;
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_Profile_Reset
+ *
+ *  Description:   Discard all of the profiling results collected so far.
+ *
+ ******************************************************************************/
+void NEUIK_Profile_Reset()
+{
+    int ctr;
+
+    for (ctr = 0; ctr < NEUIK_PROFILE_HASH_SIZE; ctr++)
+    {
+        neuik_Profile_Hash[ctr] = -1;
+    }
+    neuik_Profile_HashInit       = 1;
+    neuik_Profile_nEntries       = 0;
+    neuik_Profile_nEvents        = 0;
+    neuik_Profile_nEventsDropped = 0;
+    neuik_Profile_Depth          = 0;
+    neuik_Profile_T0             = SDL_GetPerformanceCounter();
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_Profile_GetResults
+ *
+ *  Description:   Get the accumulated profiling results; one entry for each
+ *                 combination of operation, object class and window. The
+ *                 returned array belongs to the profiler and is only valid
+ *                 until profiling continues or is reset.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_Profile_GetResults(
+    const NEUIK_ProfileEntry ** entries,  /* [out] array of results */
+    int                       * nEntries) /* [out] number of results */
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "NEUIK_Profile_GetResults";
+    static char * errMsgs[]  = {"",                         // [0] no error
+        "Output argument `entries` or `nEntries` is NULL.", // [1]
+    };
+
+    if (entries == NULL || nEntries == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    *entries  = neuik_Profile_Entries;
+    *nEntries = neuik_Profile_nEntries;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_Profile_WriteChromeTrace
+ *
+ *  Description:   Write the recorded operations in the Chrome trace-event JSON
+ *                 format (viewable in chrome://tracing or Perfetto). Each 
+ *                 window is shown as its own track.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_Profile_WriteChromeTrace(
+    FILE * fp) /* [in] where to write the JSON */
+{
+    int                  ctr;
+    int                  wCtr;
+    int                  nWindows   = 0;
+    int                  eNum       = 0; /* which error to report (if any) */
+    int                  tid;
+    double               usPerTick;
+    const void        ** windows    = NULL;
+    neuik_ProfileEvent * ev;
+    static char          funcName[] = "NEUIK_Profile_WriteChromeTrace";
+    static char        * errMsgs[]  = {"", // [0] no error
+        "Argument `fp` is NULL.",          // [1]
+        "Failure to allocate memory.",     // [2]
+        "Failure in `fprintf()`.",         // [3]
+    };
+
+    if (fp == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Windows are numbered in the order that they first appear.             */
+    /*------------------------------------------------------------------------*/
+    if (neuik_Profile_nEvents > 0)
+    {
+        windows = (const void **)malloc(neuik_Profile_nEvents*sizeof(void*));
+        if (windows == NULL)
+        {
+            eNum = 2;
+            goto out;
+        }
+    }
+
+    usPerTick = 1000000.0/(double)(SDL_GetPerformanceFrequency());
+    if (fprintf(fp, "{\"displayTimeUnit\": \"ms\", "
+            "\"otherData\": {\"droppedEvents\": %lu}, \"traceEvents\": [\n",
+            neuik_Profile_nEventsDropped) < 0)
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    for (ctr = 0; ctr < neuik_Profile_nEvents; ctr++)
+    {
+        ev = &(neuik_Profile_Events[ctr]);
+
+        for (tid = -1, wCtr = 0; wCtr < nWindows; wCtr++)
+        {
+            if (windows[wCtr] == ev->window)
+            {
+                tid = wCtr;
+                break;
+            }
+        }
+        if (tid < 0)
+        {
+            tid = nWindows;
+            windows[nWindows++] = ev->window;
+            fprintf(fp, "{\"name\": \"thread_name\", \"ph\": \"M\", "
+                "\"pid\": 1, \"tid\": %d, \"args\": {\"name\": \"window %d\"}},\n",
+                tid, tid);
+        }
+
+        if (fprintf(fp, "{\"name\": \"%s\", \"cat\": \"%s\", \"ph\": \"X\", "
+                "\"ts\": %.3f, \"dur\": %.3f, \"pid\": 1, \"tid\": %d}%s\n",
+                neuik_Profile_ScopeNames[ev->scope],
+                (ev->className != NULL) ? ev->className : "",
+                (double)(ev->ts)*usPerTick,
+                (double)(ev->dur)*usPerTick,
+                tid,
+                (ctr + 1 < neuik_Profile_nEvents) ? "," : "") < 0)
+        {
+            eNum = 3;
+            goto out;
+        }
+    }
+
+    if (fprintf(fp, "]}\n") < 0)
+    {
+        eNum = 3;
+        goto out;
+    }
+out:
+    if (windows != NULL) free(windows);
+
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
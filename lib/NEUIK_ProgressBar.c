@@ -106,6 +106,7 @@ int neuik_RegisterClass_ProgressBar()
         "A GUI which displays activity progress.", // classDescription
         neuik__Set_NEUIK,                          // classSet
         neuik__Class_Element,                      // superClass
+        sizeof(NEUIK_ProgressBar),                 // objSize
         &neuik_ProgressBar_BaseFuncs,              // baseFuncs
         NULL,                                      // classFuncs
         &neuik__Class_ProgressBar))                // newClass
@@ -157,7 +158,8 @@ int neuik_Object_New__ProgressBar(
         goto out;
     }
 
-    (*pbPtr) = (NEUIK_ProgressBar*) malloc(sizeof(NEUIK_ProgressBar));
+    (*pbPtr) = (NEUIK_ProgressBar*) neuik_Object_Alloc(
+        neuik__Class_ProgressBar, (void**)pbPtr);
     pb = *pbPtr;
     if (pb == NULL)
     {
@@ -308,7 +310,7 @@ int neuik_Object_Free__ProgressBar(
         goto out;
     }
 
-    free(pb);
+    neuik_Object_Release(pb);
 out:
     if (eNum > 0)
     {
@@ -849,7 +851,7 @@ out:
         if (!mock) eBase->eSt.doRedraw = 0;
     }
 
-    ConditionallyDestroyTexture(&tTex);
+    neuik_TexturePool_Release(rend, &tTex);
     ConditionallyDestroyTexture(&gTex);
     if (maskMap != NULL) neuik_Object_Free(maskMap);
     if (deltaPP != NULL) free(deltaPP);
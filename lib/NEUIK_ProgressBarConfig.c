@@ -79,6 +79,7 @@ int neuik_RegisterClass_ProgressBarConfig()
         "The configuration for a progress bar.", // classDescription
         neuik__Set_NEUIK,                        // classSet
         neuik__Class_Element,                    // superClass
+        sizeof(NEUIK_ProgressBarConfig),         // objSize
         &neuik_ProgressBarConfig_BaseFuncs,      // baseFuncs
         NULL,                                    // classFuncs
         &neuik__Class_ProgressBarConfig))        // newClass
@@ -140,7 +141,8 @@ int NEUIK_NewProgressBarConfig(
         goto out;
     }
 
-    (*cfgPtr) = (NEUIK_ProgressBarConfig*) malloc(sizeof(NEUIK_ProgressBarConfig));
+    (*cfgPtr) = (NEUIK_ProgressBarConfig*) neuik_Object_Alloc(
+        neuik__Class_ProgressBarConfig, (void**)cfgPtr);
     cfg = (*cfgPtr);
     if (cfg == NULL)
     {
@@ -466,7 +468,7 @@ int neuik_Object_Free__ProgressBarConfig(
         free(cfg->gradCS);
     }
 
-    free(cfg);
+    neuik_Object_Release(cfg);
 out:
     if (eNum > 0)
     {
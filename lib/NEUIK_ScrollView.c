@@ -0,0 +1,1344 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#include <SDL.h>
+#include <stdlib.h>
+
+#include "NEUIK_error.h"
+#include "NEUIK_render.h"
+#include "NEUIK_structs_basic.h"
+#include "NEUIK_ScrollView.h"
+#include "NEUIK_Element_internal.h"
+#include "NEUIK_Window_internal.h"
+#include "NEUIK_Container.h"
+#include "neuik_internal.h"
+#include "neuik_classes.h"
+
+extern int   neuik__isInitialized;
+extern float neuik__HighDPI_Scaling;
+
+#define NEUIK_SCROLLVIEW_MINSIZE    50 /* default viewport size (px) */
+#define NEUIK_SCROLLVIEW_WHEELSTEP  40 /* scroll distance of a wheel click (px) */
+
+/*----------------------------------------------------------------------------*/
+/* Internal Function Prototypes                                               */
+/*----------------------------------------------------------------------------*/
+int neuik_Object_New__ScrollView(void ** svPtr);
+int neuik_Object_Free__ScrollView(void * svPtr);
+
+int neuik_Element_GetMinSize__ScrollView(NEUIK_Element, RenderSize*);
+neuik_EventState neuik_Element_CaptureEvent__ScrollView(NEUIK_Element, SDL_Event*);
+int neuik_Element_Render__ScrollView(
+    NEUIK_Element, RenderSize*, RenderLoc*, SDL_Renderer*, int);
+
+
+/*----------------------------------------------------------------------------*/
+/* neuik_Object    Function Table                                             */
+/*----------------------------------------------------------------------------*/
+neuik_Class_BaseFuncs  neuik_ScrollView_BaseFuncs = {
+    /* Init(): Class initialization (in most cases will not be needed) */
+    NULL, /* (unused) */
+    /* New(): Allocate and Initialize the object */
+    neuik_Object_New__ScrollView,
+    /* Copy(): Copy the contents of one object into another */
+    NULL,
+    /* Free(): Free the allocated memory of an object */
+    neuik_Object_Free__ScrollView,
+};
+
+/*----------------------------------------------------------------------------*/
+/* neuik_Element    Function Table                                            */
+/*----------------------------------------------------------------------------*/
+NEUIK_Element_FuncTable neuik_ScrollView_FuncTable = {
+    /* GetMinSize(): Get the minimum required size for the element  */
+    neuik_Element_GetMinSize__ScrollView,
+
+    /* Render(): Redraw the element  element  */
+    neuik_Element_Render__ScrollView,
+
+    /* CaptureEvent(): Determine if this element caputures a given event */
+    neuik_Element_CaptureEvent__ScrollView,
+
+    /* Defocus(): This function will be called when an element looses focus */
+    NULL,
+};
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_RegisterClass_ScrollView
+ *
+ *  Description:   Register this class with the NEUIK runtime.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_RegisterClass_ScrollView()
+{
+    int            eNum       = 0; /* which error to report (if any) */
+    static char    funcName[] = "neuik_RegisterClass_ScrollView";
+    static char  * errMsgs[]  = {"",                      // [0] no error
+        "NEUIK library must be initialized first.",       // [1]
+        "Failed to register `ScrollView` object class .", // [2]
+    };
+
+    if (!neuik__isInitialized)
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Otherwise, register the object                                         */
+    /*------------------------------------------------------------------------*/
+    if (neuik_RegisterClass(
+        "ScrollView",                                             // className
+        "A single element container with a scrollable viewport.", // classDescription
+        neuik__Set_NEUIK,                                         // classSet
+        neuik__Class_Container,                                   // superClass
+        sizeof(NEUIK_ScrollView),                                 // objSize
+        &neuik_ScrollView_BaseFuncs,                              // baseFuncs
+        NULL,                                                     // classFuncs
+        &neuik__Class_ScrollView))                                // newClass
+    {
+        eNum = 2;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Object_New__ScrollView
+ *
+ *  Description:   An implementation of the neuik_Object_New method.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_Object_New__ScrollView(
+    void ** svPtr)
+{
+    int                eNum       = 0;
+    NEUIK_Container  * cont       = NULL;
+    NEUIK_ScrollView * sv         = NULL;
+    NEUIK_Element    * sClassPtr  = NULL;
+    static char        funcName[] = "neuik_Object_New__ScrollView";
+    static char      * errMsgs[]  = {"",                                  // [0] no error
+        "Output Argument `svPtr` is NULL.",                               // [1]
+        "Failure to allocate memory.",                                    // [2]
+        "Failure in `neuik_GetObjectBaseOfClass`.",                       // [3]
+        "Failure in function `neuik.NewElement`.",                        // [4]
+        "Failure in function `neuik_Element_SetFuncTable`.",              // [5]
+        "Argument `svPtr` caused `neuik_Object_GetClassObject` to fail.", // [6]
+        "Failure in `NEUIK_Element_SetBackgroundColorTransparent`.",      // [7]
+    };
+
+    if (svPtr == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    (*svPtr) = (NEUIK_ScrollView*) neuik_Object_Alloc(
+        neuik__Class_ScrollView, (void**)svPtr);
+    sv = *svPtr;
+    if (sv == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    sv->scrollX    = 0;
+    sv->scrollY    = 0;
+    sv->lastX      = 0;
+    sv->lastY      = 0;
+    sv->viewW      = 0;
+    sv->viewH      = 0;
+    sv->contentW   = 0;
+    sv->contentH   = 0;
+    sv->lastMouseX = 0;
+    sv->lastMouseY = 0;
+    sv->cur        = 0;
+    sv->tex[0]     = NULL;
+    sv->tex[1]     = NULL;
+    sv->texRend    = NULL;
+    sv->layoutLoc.x = 0;
+    sv->layoutLoc.y = 0;
+    sv->valid.x    = 0;
+    sv->valid.y    = 0;
+    sv->valid.w    = 0;
+    sv->valid.h    = 0;
+
+    /*------------------------------------------------------------------------*/
+    /* Successful allocation of Memory -- Create Base Class Object            */
+    /*------------------------------------------------------------------------*/
+    if (neuik_GetObjectBaseOfClass(
+            neuik__Set_NEUIK, 
+            neuik__Class_ScrollView, 
+            NULL,
+            &(sv->objBase)))
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Create first level Base SuperClass Object                              */
+    /*------------------------------------------------------------------------*/
+    sClassPtr = (NEUIK_Element *) &(sv->objBase.superClassObj);
+    if (neuik_Object_New(neuik__Class_Container, sClassPtr))
+    {
+        eNum = 4;
+        goto out;
+    }
+    if (neuik_Element_SetFuncTable(sv, &neuik_ScrollView_FuncTable))
+    {
+        eNum = 5;
+        goto out;
+    }
+
+    if (neuik_Object_GetClassObject(sv, neuik__Class_Container, (void**)&cont))
+    {
+        eNum = 6;
+        goto out;
+    }
+    cont->cType        = NEUIK_CONTAINER_SINGLE;
+    cont->shownIfEmpty = 1;
+
+    /*------------------------------------------------------------------------*/
+    /* Set the default element background redraw styles.                      */
+    /*------------------------------------------------------------------------*/
+    if (NEUIK_Element_SetBackgroundColorTransparent(sv, "normal"))
+    {
+        eNum = 7;
+        goto out;
+    }
+    if (NEUIK_Element_SetBackgroundColorTransparent(sv, "selected"))
+    {
+        eNum = 7;
+        goto out;
+    }
+    if (NEUIK_Element_SetBackgroundColorTransparent(sv, "hovered"))
+    {
+        eNum = 7;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Object_Free__ScrollView
+ *
+ *  Description:   An implementation of the neuik_Object_Free method.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_Object_Free__ScrollView(
+    void * svPtr)
+{
+    int                eNum       = 0;    /* which error to report (if any) */
+    NEUIK_ScrollView * sv         = NULL;
+    static char        funcName[] = "neuik_Object_Free__ScrollView";
+    static char      * errMsgs[]  = {"",                // [0] no error
+        "Argument `svPtr` is NULL.",                    // [1]
+        "Argument `svPtr` is not of ScrollView class.", // [2]
+        "Failure in function `neuik_Object_Free`.",     // [3]
+    };
+
+    if (svPtr == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    if (!neuik_Object_IsClass(svPtr, neuik__Class_ScrollView))
+    {
+        eNum = 2;
+        goto out;
+    }
+    sv = (NEUIK_ScrollView*)svPtr;
+
+    /*------------------------------------------------------------------------*/
+    /* The object is what it says it is and it is still allocated.            */
+    /*------------------------------------------------------------------------*/
+    neuik_TextureSlot_Clear((SDL_Texture**)&(sv->tex[0]));
+    neuik_TextureSlot_Clear((SDL_Texture**)&(sv->tex[1]));
+
+    if(neuik_Object_Free(sv->objBase.superClassObj))
+    {
+        eNum = 3;
+        goto out;
+    }
+
+    neuik_Object_Release(sv);
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_NewScrollView
+ *
+ *  Description:   Create and return a pointer to a new NEUIK_ScrollView.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_NewScrollView(
+    NEUIK_ScrollView ** svPtr)
+{
+    return neuik_Object_New__ScrollView((void**)svPtr);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Limit the scroll offsets to the range allowed by the size of the contained */
+/* element. Nothing is done until the viewport has been rendered at least     */
+/* once (as the sizes are not yet known).                                     */
+/*----------------------------------------------------------------------------*/
+static void neuik_ScrollView_ClampScroll(
+    NEUIK_ScrollView * sv)
+{
+    int maxX;
+    int maxY;
+
+    if (sv->viewW <= 0 || sv->viewH <= 0) return;
+
+    maxX = sv->contentW - sv->viewW;
+    maxY = sv->contentH - sv->viewH;
+    if (maxX < 0) maxX = 0;
+    if (maxY < 0) maxY = 0;
+
+    if (sv->scrollX > maxX) sv->scrollX = maxX;
+    if (sv->scrollY > maxY) sv->scrollY = maxY;
+    if (sv->scrollX < 0)    sv->scrollX = 0;
+    if (sv->scrollY < 0)    sv->scrollY = 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_ScrollView_SetScroll
+ *
+ *  Description:   Set the scroll offset (px) of the viewport; this is the 
+ *                 location within the contained element which is shown in the
+ *                 upper-left corner of the viewport. The offset is limited to 
+ *                 the size of the contained element.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_ScrollView_SetScroll(
+    NEUIK_ScrollView * sv,
+    int                x,
+    int                y)
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    int           oldX       = 0;
+    int           oldY       = 0;
+    RenderSize    rSize;
+    RenderLoc     rLoc;
+    static char   funcName[] = "NEUIK_ScrollView_SetScroll";
+    static char * errMsgs[]  = {"",                         // [0] no error
+        "Argument `sv` is not of ScrollView class.",        // [1]
+        "Failure in `neuik_Element_GetSizeAndLocation()`.", // [2]
+    };
+
+    if (!neuik_Object_IsClass(sv, neuik__Class_ScrollView))
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    oldX = sv->scrollX;
+    oldY = sv->scrollY;
+    sv->scrollX = x;
+    sv->scrollY = y;
+    neuik_ScrollView_ClampScroll(sv);
+
+    if (sv->scrollX != oldX || sv->scrollY != oldY)
+    {
+        if (neuik_Element_GetSizeAndLocation(sv, &rSize, &rLoc))
+        {
+            eNum = 2;
+            goto out;
+        }
+        neuik_Element_RequestRedraw(sv, rLoc, rSize);
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_ScrollView_GetScroll
+ *
+ *  Description:   Get the current scroll offset (px) of the viewport.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_ScrollView_GetScroll(
+    NEUIK_ScrollView * sv,
+    int              * x,
+    int              * y)
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "NEUIK_ScrollView_GetScroll";
+    static char * errMsgs[]  = {"",                  // [0] no error
+        "Argument `sv` is not of ScrollView class.", // [1]
+        "Output argument(s) are NULL.",              // [2]
+    };
+
+    if (!neuik_Object_IsClass(sv, neuik__Class_ScrollView))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (x == NULL || y == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+
+    (*x) = sv->scrollX;
+    (*y) = sv->scrollY;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_ScrollView_ScrollBy
+ *
+ *  Description:   Move the scroll offset of the viewport by the specified 
+ *                 amount (px). Repeated small calls (e.g. once per frame for 
+ *                 kinetic scrolling) only redraw the newly exposed strip of 
+ *                 the viewport.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_ScrollView_ScrollBy(
+    NEUIK_ScrollView * sv,
+    int                dx,
+    int                dy)
+{
+    if (!neuik_Object_IsClass(sv, neuik__Class_ScrollView))
+    {
+        NEUIK_RaiseError("NEUIK_ScrollView_ScrollBy", 
+            "Argument `sv` is not of ScrollView class.");
+        return 1;
+    }
+    return NEUIK_ScrollView_SetScroll(sv, sv->scrollX + dx, sv->scrollY + dy);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Element_GetMinSize__ScrollView
+ *
+ *  Description:   Returns the minimum size of the viewport; this does not 
+ *                 depend upon the size of the contained element.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_Element_GetMinSize__ScrollView(
+    NEUIK_Element   svElem, 
+    RenderSize    * rSize)
+{
+    int           eNum       = 0;    /* which error to report (if any) */
+    int           minSz      = NEUIK_SCROLLVIEW_MINSIZE;
+    static char   funcName[] = "neuik_Element_GetMinSize__ScrollView";
+    static char * errMsgs[]  = {"",                      // [0] no error
+        "Argument `svElem` is not of ScrollView class.", // [1]
+    };
+
+    rSize->w = 0;
+    rSize->h = 0;
+
+    if (!neuik_Object_IsClass(svElem, neuik__Class_ScrollView))
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    if (neuik__HighDPI_Scaling > 1.0)
+    {
+        minSz = (int)((float)(minSz)*neuik__HighDPI_Scaling);
+    }
+    rSize->w = minSz;
+    rSize->h = minSz;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Determine the parts of `vis` which are not covered by `valid`; these are   */
+/* returned as up to four non-overlapping rectangles (a full-width band above */
+/* and below the covered rows and a band to the left and right within them).  */
+/*----------------------------------------------------------------------------*/
+static int neuik_ScrollView_GetExposedRects(
+    const SDL_Rect * vis,
+    const SDL_Rect * valid,
+    SDL_Rect       * rects)
+{
+    int      nRects = 0;
+    SDL_Rect isct;
+
+    if (!SDL_IntersectRect(vis, valid, &isct))
+    {
+        rects[0] = *vis;
+        return 1;
+    }
+
+    if (isct.y > vis->y)
+    {
+        rects[nRects].x = vis->x;
+        rects[nRects].y = vis->y;
+        rects[nRects].w = vis->w;
+        rects[nRects].h = isct.y - vis->y;
+        nRects++;
+    }
+    if (isct.y + isct.h < vis->y + vis->h)
+    {
+        rects[nRects].x = vis->x;
+        rects[nRects].y = isct.y + isct.h;
+        rects[nRects].w = vis->w;
+        rects[nRects].h = (vis->y + vis->h) - (isct.y + isct.h);
+        nRects++;
+    }
+    if (isct.x > vis->x)
+    {
+        rects[nRects].x = vis->x;
+        rects[nRects].y = isct.y;
+        rects[nRects].w = isct.x - vis->x;
+        rects[nRects].h = isct.h;
+        nRects++;
+    }
+    if (isct.x + isct.w < vis->x + vis->w)
+    {
+        rects[nRects].x = isct.x + isct.w;
+        rects[nRects].y = isct.y;
+        rects[nRects].w = (vis->x + vis->w) - (isct.x + isct.w);
+        rects[nRects].h = isct.h;
+        nRects++;
+    }
+    return nRects;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_ScrollView_PrepareTextures
+ *
+ *  Description:   Make sure that both of the content textures exist, are of 
+ *                 the size of the viewport and belong to the current renderer.
+ *                 If the textures are (re)created, their contents are marked 
+ *                 as invalid.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_ScrollView_PrepareTextures(
+    NEUIK_ScrollView * sv,
+    RenderSize       * rSize,
+    SDL_Renderer     * xRend)
+{
+    int           ctr;
+    int           texW       = 0;
+    int           texH       = 0;
+    SDL_Texture * tex        = NULL;
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "neuik_ScrollView_PrepareTextures";
+    static char * errMsgs[]  = {"",          // [0] no error
+        "Failure in `SDL_CreateTexture()`.", // [1]
+    };
+
+    for (ctr = 0; ctr < 2; ctr++)
+    {
+        if (sv->tex[ctr] == NULL) continue;
+        if (sv->texRend != xRend ||
+            SDL_QueryTexture(sv->tex[ctr], NULL, NULL, &texW, &texH) ||
+            texW != rSize->w || texH != rSize->h)
+        {
+            neuik_TextureSlot_Clear((SDL_Texture**)&(sv->tex[ctr]));
+        }
+    }
+
+    for (ctr = 0; ctr < 2; ctr++)
+    {
+        if (sv->tex[ctr] != NULL) continue;
+
+        tex = neuik_CreateTexture(xRend, 
+            SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+            rSize->w, rSize->h);
+        if (tex == NULL)
+        {
+            eNum = 1;
+            goto out;
+        }
+        SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+        if (neuik_TextureSlot_Set((SDL_Texture**)&(sv->tex[ctr]), tex, xRend))
+        {
+            eNum = 1;
+            goto out;
+        }
+        sv->texRend = xRend;
+        sv->valid.w = 0;
+        sv->valid.h = 0;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_ScrollView_ShiftContent
+ *
+ *  Description:   Move the retained contents of the viewport by the change in 
+ *                 the scroll offset since the last render. The still valid 
+ *                 portion is copied (on the GPU) into the other content 
+ *                 texture which then becomes current; anything scrolled out 
+ *                 of the viewport is dropped from the valid region.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_ScrollView_ShiftContent(
+    NEUIK_ScrollView * sv,
+    SDL_Renderer     * xRend)
+{
+    int           dx;
+    int           dy;
+    SDL_Rect      bounds;
+    SDL_Rect      moved;
+    SDL_Rect      srcRect;
+    SDL_Rect      destRect;
+    SDL_Texture * src;
+    SDL_Texture * dest;
+    SDL_Texture * prevTarget = NULL;
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "neuik_ScrollView_ShiftContent";
+    static char * errMsgs[]  = {"",            // [0] no error
+        "Failure in `SDL_SetRenderTarget()`.", // [1]
+        "Failure in `SDL_RenderCopy()`.",      // [2]
+    };
+
+    dx = sv->scrollX - sv->lastX;
+    dy = sv->scrollY - sv->lastY;
+    sv->lastX = sv->scrollX;
+    sv->lastY = sv->scrollY;
+    if (dx == 0 && dy == 0) goto out;
+    if (sv->valid.w <= 0 || sv->valid.h <= 0) goto out;
+
+    bounds.x = 0;
+    bounds.y = 0;
+    bounds.w = sv->viewW;
+    bounds.h = sv->viewH;
+
+    moved.x = sv->valid.x - dx;
+    moved.y = sv->valid.y - dy;
+    moved.w = sv->valid.w;
+    moved.h = sv->valid.h;
+    if (!SDL_IntersectRect(&moved, &bounds, &destRect))
+    {
+        /* scrolled by more than a full viewport; nothing can be reused */
+        sv->valid.w = 0;
+        sv->valid.h = 0;
+        goto out;
+    }
+    srcRect   = destRect;
+    srcRect.x += dx;
+    srcRect.y += dy;
+
+    src  = (SDL_Texture*)(sv->tex[sv->cur]);
+    dest = (SDL_Texture*)(sv->tex[1 - sv->cur]);
+    prevTarget = SDL_GetRenderTarget(xRend);
+    if (SDL_SetRenderTarget(xRend, dest))
+    {
+        eNum = 1;
+        goto out;
+    }
+    SDL_RenderSetClipRect(xRend, NULL);
+    SDL_SetTextureBlendMode(src, SDL_BLENDMODE_NONE);
+    if (SDL_RenderCopy(xRend, src, &srcRect, &destRect))
+    {
+        eNum = 2;
+    }
+    SDL_SetTextureBlendMode(src, SDL_BLENDMODE_BLEND);
+    if (SDL_SetRenderTarget(xRend, prevTarget) && eNum == 0)
+    {
+        eNum = 1;
+    }
+    if (eNum != 0)
+    {
+        sv->valid.w = 0;
+        sv->valid.h = 0;
+        goto out;
+    }
+
+    sv->cur     = 1 - sv->cur;
+    sv->valid.x = destRect.x;
+    sv->valid.y = destRect.y;
+    sv->valid.w = destRect.w;
+    sv->valid.h = destRect.h;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_ScrollView_RenderRetained
+ *
+ *  Description:   Render the viewport using the retained content textures. 
+ *                 The previous contents are shifted by the scroll delta and 
+ *                 only the newly exposed strips of the visible region are 
+ *                 rendered; the contained element is culled against each 
+ *                 strip. The visible region is then copied on to the 
+ *                 external renderer.
+ *
+ *                 The retained contents are discarded whenever the contained 
+ *                 element requests a redraw or changes in size.
+ *
+ *                 Children which lie outside of the exposed strips are culled
+ *                 and so don't update their stored locations; whenever the
+ *                 contained element has moved (e.g. it was scrolled) or may
+ *                 have been relaid out, a mock render of it is done first so 
+ *                 that event handling sees the current locations.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_ScrollView_RenderRetained(
+    NEUIK_ScrollView  * sv,
+    NEUIK_ElementBase * eBase,
+    NEUIK_Container   * cont,
+    NEUIK_Element       elem,   /* the contained element */
+    RenderSize        * rs,     /* the size of the contained element */
+    int                 resized,/* the contained element changed in size */
+    RenderSize        * rSize,  /* the size of the viewport */
+    RenderLoc         * rlMod,  /* A relative location modifier (for rendering) */
+    SDL_Renderer      * xRend)  /* The external renderer to prepare the texture for */
+{
+    int                 ctr;
+    int                 nExposed    = 0;
+    int                 clipOn      = 0;
+    int                 redrawAll   = 0;
+    int                 relayout    = 0;
+    SDL_Rect            prevClip    = {0, 0, 0, 0};
+    SDL_Rect            bounds;
+    SDL_Rect            vis;
+    SDL_Rect            valid;
+    SDL_Rect            exposed[4];
+    SDL_Rect            srcRect;
+    SDL_Rect            destRect;
+    SDL_BlendMode       prevBlend;
+    SDL_Texture       * prevTarget  = NULL;
+    RenderLoc           rlTex;    /* loc. modifier to render into the texture */
+    RenderLoc           stripLoc;
+    RenderLoc           elemLoc;
+    RenderSize          stripSz;
+    RenderSize          rsElem;
+    neuik_ClipRect      clip;
+    NEUIK_Window      * win         = (NEUIK_Window*)(eBase->eSt.window);
+    int                 eNum        = 0;
+    static char         funcName[]  = "neuik_ScrollView_RenderRetained";
+    static char       * errMsgs[]   = {"",                  // [0] no error
+        "Failure in `neuik_ScrollView_PrepareTextures()`.", // [1]
+        "Failure in `neuik_ScrollView_ShiftContent()`.",    // [2]
+        "Failure in `SDL_SetRenderTarget()`.",              // [3]
+        "Failure in `neuik_Element_Render()`.",             // [4]
+        "Failure in `SDL_RenderCopy()`.",                   // [5]
+        "Failure in `neuik_Element_GetLocation()`.",        // [6]
+    };
+
+    clipOn = SDL_RenderIsClipEnabled(xRend);
+    SDL_RenderGetClipRect(xRend, &prevClip);
+    prevTarget = SDL_GetRenderTarget(xRend);
+
+    if (neuik_ScrollView_PrepareTextures(sv, rSize, xRend))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (neuik_Element_GetLocation(elem, &elemLoc))
+    {
+        eNum = 6;
+        goto out;
+    }
+    relayout = (elemLoc.x != sv->layoutLoc.x || elemLoc.y != sv->layoutLoc.y);
+    if (resized || neuik_Element_NeedsRedraw(elem))
+    {
+        sv->valid.w = 0;
+        sv->valid.h = 0;
+        relayout    = 1;
+    }
+    if (neuik_ScrollView_ShiftContent(sv, xRend))
+    {
+        eNum = 2;
+        goto out;
+    }
+
+    rlTex.x = -eBase->eSt.rLoc.x;
+    rlTex.y = -eBase->eSt.rLoc.y;
+    if (relayout)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Update the stored sizes/locations of every child of the contained  */
+        /* element; mock renders are not culled.                              */
+        /*--------------------------------------------------------------------*/
+        rsElem = *rs;
+        if (neuik_Element_Render(elem, &rsElem, &rlTex, xRend, TRUE))
+        {
+            eNum = 4;
+            goto out;
+        }
+        sv->layoutLoc = elemLoc;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Determine the visible region of the viewport (in texture coordinates). */
+    /* The current clip rectangle of the window already includes the bounds   */
+    /* of this ScrollView.                                                    */
+    /*------------------------------------------------------------------------*/
+    bounds.x = 0;
+    bounds.y = 0;
+    bounds.w = rSize->w;
+    bounds.h = rSize->h;
+    vis = bounds;
+    if (win != NULL && !neuik_Window_GetClip(win, &clip))
+    {
+        srcRect.x = clip.x - eBase->eSt.rLoc.x;
+        srcRect.y = clip.y - eBase->eSt.rLoc.y;
+        srcRect.w = clip.w;
+        srcRect.h = clip.h;
+        if (!SDL_IntersectRect(&srcRect, &bounds, &vis)) goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Render only the portions of the visible region which are not already  */
+    /* held by the retained texture.                                          */
+    /*------------------------------------------------------------------------*/
+    valid.x = sv->valid.x;
+    valid.y = sv->valid.y;
+    valid.w = sv->valid.w;
+    valid.h = sv->valid.h;
+    nExposed = neuik_ScrollView_GetExposedRects(&vis, &valid, exposed);
+    if (nExposed > 0)
+    {
+        if (SDL_SetRenderTarget(xRend, (SDL_Texture*)(sv->tex[sv->cur])))
+        {
+            eNum = 3;
+            goto out;
+        }
+
+        /*--------------------------------------------------------------------*/
+        /* The exposed strips start out blank; so every child of the          */
+        /* contained element must be drawn within them.                       */
+        /*--------------------------------------------------------------------*/
+        redrawAll        = cont->redrawAll;
+        cont->redrawAll  = 1;
+
+        SDL_GetRenderDrawBlendMode(xRend, &prevBlend);
+        for (ctr = 0; ctr < nExposed; ctr++)
+        {
+            SDL_RenderSetClipRect(xRend, &exposed[ctr]);
+            SDL_SetRenderDrawBlendMode(xRend, SDL_BLENDMODE_NONE);
+            SDL_SetRenderDrawColor(xRend, 255, 255, 255, 0);
+            SDL_RenderFillRect(xRend, &exposed[ctr]);
+            SDL_SetRenderDrawBlendMode(xRend, prevBlend);
+
+            stripLoc.x = eBase->eSt.rLoc.x + exposed[ctr].x;
+            stripLoc.y = eBase->eSt.rLoc.y + exposed[ctr].y;
+            stripSz.w  = exposed[ctr].w;
+            stripSz.h  = exposed[ctr].h;
+            if (win != NULL) neuik_Window_PushClip(win, &stripLoc, &stripSz);
+
+            rsElem = *rs;
+            if (neuik_Element_Render(elem, &rsElem, &rlTex, xRend, FALSE))
+            {
+                eNum = 4;
+            }
+            if (win != NULL) neuik_Window_PopClip(win);
+            if (eNum != 0) break;
+        }
+        cont->redrawAll = redrawAll;
+
+        SDL_RenderSetClipRect(xRend, NULL);
+        if (SDL_SetRenderTarget(xRend, prevTarget) && eNum == 0)
+        {
+            eNum = 3;
+        }
+        if (eNum != 0)
+        {
+            sv->valid.w = 0;
+            sv->valid.h = 0;
+            goto out;
+        }
+    }
+    sv->valid.x = vis.x;
+    sv->valid.y = vis.y;
+    sv->valid.w = vis.w;
+    sv->valid.h = vis.h;
+
+    /*------------------------------------------------------------------------*/
+    /* Copy the visible region of the viewport on to the external renderer.   */
+    /*------------------------------------------------------------------------*/
+    if (clipOn)
+    {
+        SDL_RenderSetClipRect(xRend, &prevClip);
+    }
+    srcRect  = vis;
+    destRect = vis;
+    destRect.x += eBase->eSt.rLoc.x;
+    destRect.y += eBase->eSt.rLoc.y;
+    if (rlMod != NULL)
+    {
+        destRect.x += rlMod->x;
+        destRect.y += rlMod->y;
+    }
+    if (SDL_RenderCopy(xRend, (SDL_Texture*)(sv->tex[sv->cur]), 
+        &srcRect, &destRect))
+    {
+        eNum = 5;
+        goto out;
+    }
+out:
+    if (SDL_GetRenderTarget(xRend) != prevTarget)
+    {
+        SDL_SetRenderTarget(xRend, prevTarget);
+    }
+    SDL_RenderSetClipRect(xRend, clipOn ? &prevClip : NULL);
+
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Element_Render__ScrollView
+ *
+ *  Description:   Renders the visible portion of the contained element.
+ *
+ *  Returns:       0 if there were no issues; otherwise 1.
+ *
+ ******************************************************************************/
+int neuik_Element_Render__ScrollView(
+    NEUIK_Element   svElem, 
+    RenderSize    * rSize, /* in/out the size the tex occupies when complete */
+    RenderLoc     * rlMod, /* A relative location modifier (for rendering) */
+    SDL_Renderer  * xRend, /* the external renderer to prepare the texture for */
+    int             mock)  /* If true; calculate sizes/locations but don't draw */
+{
+    int                   eNum       = 0; /* which error to report (if any) */
+    int                   resized    = 0;
+    int                   clipOn     = 0;
+    int                   redrawAll  = 0;
+    int                   contentW   = 0;
+    int                   contentH   = 0;
+    RenderLoc             rl;
+    RenderLoc             rlRel      = {0, 0}; /* renderloc relative to parent */
+    SDL_Renderer        * rend       = NULL;
+    RenderSize            rs         = {0, 0};
+    SDL_Rect              prevClip   = {0, 0, 0, 0};
+    SDL_Rect              viewRect   = {0, 0, 0, 0};
+    SDL_Rect              clipRect   = {0, 0, 0, 0};
+    NEUIK_Container     * cont       = NULL;
+    NEUIK_Element         elem       = NULL;
+    NEUIK_ElementBase   * eBase      = NULL;
+    NEUIK_ElementConfig * eCfg       = NULL;
+    NEUIK_ScrollView    * sv         = NULL;
+    neuik_MaskMap       * maskMap    = NULL; /* FREE upon return */
+    enum neuik_bgstyle    bgStyle;
+    static char           funcName[] = "neuik_Element_Render__ScrollView";
+    static char         * errMsgs[]  = {"",                                // [0] no error
+        "Argument `svElem` is not of ScrollView class.",                   // [1]
+        "Argument `svElem` caused `neuik_Object_GetClassObject` to fail.", // [2]
+        "Call to Element_GetMinSize failed.",                              // [3]
+        "Invalid specified `rSize` (negative values).",                    // [4]
+        "Failure in `neuik_Element_GetCurrentBGStyle()`.",                 // [5]
+        "Element_GetConfig returned NULL.",                                // [6]
+        "Failure in `neuik_Element_Render()`",                             // [7]
+        "Failure in `neuik_MakeMaskMap()`",                                // [8]
+        "Failure in `neuik_Element_RedrawBackground()`.",                  // [9]
+        "Failure in `neuik_Window_FillTranspMaskFromLoc()`",               // [10]
+        "Failure in `neuik_ScrollView_RenderRetained()`",                  // [11]
+    };
+
+    if (!neuik_Object_IsClass(svElem, neuik__Class_ScrollView))
+    {
+        eNum = 1;
+        goto out;
+    }
+    sv = (NEUIK_ScrollView *)svElem;
+
+    if (neuik_Object_GetClassObject(svElem, neuik__Class_Element, (void**)&eBase))
+    {
+        eNum = 2;
+        goto out;
+    }
+
+    if (neuik_Object_GetClassObject(svElem, neuik__Class_Container, (void**)&cont))
+    {
+        eNum = 2;
+        goto out;
+    }
+
+    if (rSize->w < 0 || rSize->h < 0)
+    {
+        eNum = 4;
+        goto out;
+    }
+
+    eBase->eSt.rend = xRend;
+    rend = eBase->eSt.rend;
+
+    /*------------------------------------------------------------------------*/
+    /* Redraw the background surface before continuing.                       */
+    /*------------------------------------------------------------------------*/
+    if (!mock)
+    {
+        if (neuik_Element_GetCurrentBGStyle(svElem, &bgStyle))
+        {
+            eNum = 5;
+            goto out;
+        }
+        if (bgStyle != NEUIK_BGSTYLE_TRANSPARENT)
+        {
+            /*----------------------------------------------------------------*/
+            /* Create a MaskMap an mark off the trasnparent pixels.           */
+            /*----------------------------------------------------------------*/
+            if (neuik_MakeMaskMap(&maskMap, rSize->w, rSize->h))
+            {
+                eNum = 8;
+                goto out;
+            }
+
+            rl = eBase->eSt.rLoc;
+            if (neuik_Window_FillTranspMaskFromLoc(
+                    eBase->eSt.window, maskMap, rl.x, rl.y))
+            {
+                eNum = 10;
+                goto out;
+            }
+
+            if (neuik_Element_RedrawBackground(svElem, rlMod, maskMap))
+            {
+                eNum = 9;
+                goto out;
+            }
+        }
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Render the contained Element                                           */
+    /*------------------------------------------------------------------------*/
+    if (cont->elems == NULL) goto out;
+    elem = cont->elems[0];
+
+    if (elem == NULL) goto out;
+    if (!NEUIK_Element_IsShown(elem)) goto out;
+
+    eCfg = neuik_Element_GetConfig(elem);
+    if (eCfg == NULL)
+    {
+        eNum = 6;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* The contained element is given its minimum size; if it is configured  */
+    /* to fill, it is stretched to (at least) the size of the viewport.       */
+    /*------------------------------------------------------------------------*/
+    if (neuik_Element_GetMinSize(elem, &rs))
+    {
+        eNum = 3;
+        goto out;
+    }
+    if (eCfg->HFill && rs.w < rSize->w - (eCfg->PadLeft + eCfg->PadRight))
+    {
+        rs.w = rSize->w - (eCfg->PadLeft + eCfg->PadRight);
+    }
+    if (eCfg->VFill && rs.h < rSize->h - (eCfg->PadTop + eCfg->PadBottom))
+    {
+        rs.h = rSize->h - (eCfg->PadTop + eCfg->PadBottom);
+    }
+
+    contentW = rs.w + eCfg->PadLeft + eCfg->PadRight;
+    contentH = rs.h + eCfg->PadTop  + eCfg->PadBottom;
+    resized  = (contentW != sv->contentW || contentH != sv->contentH ||
+        rSize->w != sv->viewW || rSize->h != sv->viewH);
+
+    sv->viewW    = rSize->w;
+    sv->viewH    = rSize->h;
+    sv->contentW = contentW;
+    sv->contentH = contentH;
+    neuik_ScrollView_ClampScroll(sv);
+
+    /*------------------------------------------------------------------------*/
+    /* Update the stored location before rendering the element. This is       */
+    /* necessary as the location of this object will propagate to its child   */
+    /* objects.                                                               */
+    /*------------------------------------------------------------------------*/
+    rlRel.x = eCfg->PadLeft - sv->scrollX;
+    rlRel.y = eCfg->PadTop  - sv->scrollY;
+    rl.x = (eBase->eSt.rLoc).x + rlRel.x;
+    rl.y = (eBase->eSt.rLoc).y + rlRel.y;
+    neuik_Element_StoreSizeAndLocation(elem, rs, rl, rlRel);
+
+    if (!mock && eBase->eSt.window != NULL && SDL_RenderTargetSupported(rend))
+    {
+        if (neuik_ScrollView_RenderRetained(sv, eBase, cont, elem, &rs, 
+            resized, rSize, rlMod, rend))
+        {
+            eNum = 11;
+            goto out;
+        }
+        goto out;
+    }
+
+    if (mock)
+    {
+        if (neuik_Element_Render(elem, &rs, rlMod, rend, mock))
+        {
+            eNum = 7;
+            goto out;
+        }
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Render targets are not available; draw the contained element directly */
+    /* (clipped to the viewport).                                             */
+    /*------------------------------------------------------------------------*/
+    viewRect.x = (eBase->eSt.rLoc).x;
+    viewRect.y = (eBase->eSt.rLoc).y;
+    viewRect.w = rSize->w;
+    viewRect.h = rSize->h;
+    if (rlMod != NULL)
+    {
+        viewRect.x += rlMod->x;
+        viewRect.y += rlMod->y;
+    }
+    clipOn = SDL_RenderIsClipEnabled(rend);
+    SDL_RenderGetClipRect(rend, &prevClip);
+    clipRect = viewRect;
+    if (clipOn && !SDL_IntersectRect(&prevClip, &viewRect, &clipRect)) goto out;
+    SDL_RenderSetClipRect(rend, &clipRect);
+
+    redrawAll       = cont->redrawAll;
+    cont->redrawAll = 1;
+    if (neuik_Element_Render(elem, &rs, rlMod, rend, mock))
+    {
+        eNum = 7;
+    }
+    cont->redrawAll = redrawAll;
+    SDL_RenderSetClipRect(rend, clipOn ? &prevClip : NULL);
+out:
+    if (eBase != NULL)
+    {
+        if (!mock) eBase->eSt.doRedraw = 0;
+    }
+    if (cont != NULL)
+    {
+        if (!mock) cont->redrawAll = 0;
+    }
+    if (maskMap != NULL) neuik_Object_Free(maskMap);
+
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Element_CaptureEvent__ScrollView
+ *
+ *  Description:   Pass events on to the contained element; mouse clicks are 
+ *                 only passed on if they occur within the viewport. Mouse 
+ *                 wheel events within the viewport which are not captured by 
+ *                 the contained element scroll the viewport.
+ *
+ *  Returns:       The resulting event state.
+ *
+ ******************************************************************************/
+neuik_EventState neuik_Element_CaptureEvent__ScrollView(
+    NEUIK_Element   svElem, 
+    SDL_Event     * ev)
+{
+    int                    inView     = 0;
+    int                    step       = NEUIK_SCROLLVIEW_WHEELSTEP;
+    int                    wheelX     = 0;
+    int                    wheelY     = 0;
+    int                    oldX       = 0;
+    int                    oldY       = 0;
+    neuik_EventState       evCaputred = NEUIK_EVENTSTATE_NOT_CAPTURED;
+    NEUIK_ScrollView     * sv         = NULL;
+    NEUIK_Element          elem       = NULL;
+    NEUIK_ElementBase    * eBase      = NULL;
+    NEUIK_Container      * cont       = NULL;
+    SDL_MouseButtonEvent * mouseButEv = NULL;
+    SDL_MouseMotionEvent * mouseMotEv = NULL;
+    SDL_MouseWheelEvent  * mWheelEv   = NULL;
+
+    if (!neuik_Object_IsClass(svElem, neuik__Class_ScrollView)) goto out;
+    sv = (NEUIK_ScrollView*)svElem;
+    if (neuik_Object_GetClassObject_NoError(
+        svElem, neuik__Class_Element, (void**)&eBase)) goto out;
+    if (neuik_Object_GetClassObject_NoError(
+        svElem, neuik__Class_Container, (void**)&cont)) goto out;
+
+    switch (ev->type)
+    {
+    case SDL_MOUSEMOTION:
+        mouseMotEv = (SDL_MouseMotionEvent*)(ev);
+        sv->lastMouseX = mouseMotEv->x;
+        sv->lastMouseY = mouseMotEv->y;
+        break;
+
+    case SDL_MOUSEBUTTONDOWN:
+        /*--------------------------------------------------------------------*/
+        /* Parts of the contained element which are scrolled out of view     */
+        /* should not respond to mouse clicks.                                */
+        /*--------------------------------------------------------------------*/
+        mouseButEv = (SDL_MouseButtonEvent*)(ev);
+        if (mouseButEv->x <  eBase->eSt.rLoc.x ||
+            mouseButEv->x >= eBase->eSt.rLoc.x + eBase->eSt.rSize.w ||
+            mouseButEv->y <  eBase->eSt.rLoc.y ||
+            mouseButEv->y >= eBase->eSt.rLoc.y + eBase->eSt.rSize.h)
+        {
+            goto out;
+        }
+        break;
+    }
+
+    if (cont->elems != NULL) elem = cont->elems[0];
+    if (elem != NULL && NEUIK_Element_IsShown(elem))
+    {
+        evCaputred = neuik_Element_CaptureEvent(elem, ev);
+        if (evCaputred == NEUIK_EVENTSTATE_OBJECT_FREED) goto out;
+        if (evCaputred == NEUIK_EVENTSTATE_CAPTURED)
+        {
+            neuik_Element_SetActive(svElem, 1);
+            goto out;
+        }
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Scroll the viewport using the mouse wheel.                             */
+    /*------------------------------------------------------------------------*/
+    if (ev->type != SDL_MOUSEWHEEL) goto out;
+
+    inView = (sv->lastMouseX >= eBase->eSt.rLoc.x &&
+        sv->lastMouseX < eBase->eSt.rLoc.x + eBase->eSt.rSize.w &&
+        sv->lastMouseY >= eBase->eSt.rLoc.y &&
+        sv->lastMouseY < eBase->eSt.rLoc.y + eBase->eSt.rSize.h);
+    if (!inView) goto out;
+
+    mWheelEv = (SDL_MouseWheelEvent*)(ev);
+    wheelX   = mWheelEv->x;
+    wheelY   = mWheelEv->y;
+    if (mWheelEv->direction == SDL_MOUSEWHEEL_FLIPPED)
+    {
+        wheelX = -wheelX;
+        wheelY = -wheelY;
+    }
+    if (neuik__HighDPI_Scaling > 1.0)
+    {
+        step = (int)((float)(step)*neuik__HighDPI_Scaling);
+    }
+
+    oldX = sv->scrollX;
+    oldY = sv->scrollY;
+    if (NEUIK_ScrollView_ScrollBy(sv, wheelX*step, -wheelY*step)) goto out;
+    if (sv->scrollX != oldX || sv->scrollY != oldY)
+    {
+        evCaputred = NEUIK_EVENTSTATE_CAPTURED;
+    }
+out:
+    return evCaputred;
+}
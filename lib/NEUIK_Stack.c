@@ -108,6 +108,7 @@ int neuik_RegisterClass_Stack()
         "A multi-element container which shows only one at a time.", // classDescription
         neuik__Set_NEUIK,                                            // classSet
         neuik__Class_Container,                                      // superClass
+        sizeof(NEUIK_Stack),                                         // objSize
         &neuik_Stack_BaseFuncs,                                      // baseFuncs
         NULL,                                                        // classFuncs
         &neuik__Class_Stack))                                        // newClass
@@ -167,7 +168,8 @@ int neuik_Object_New__Stack(
         eNum = 1;
         goto out;
     }
-    (*objPtr) = (NEUIK_Stack*) malloc(sizeof(NEUIK_Stack));
+    (*objPtr) = (NEUIK_Stack*) neuik_Object_Alloc(
+        neuik__Class_Stack, (void**)objPtr);
     stk = *objPtr;
     if (stk == NULL)
     {
@@ -284,7 +286,7 @@ int neuik_Object_Free__Stack(
         goto out;
     }
 
-    free(stk);
+    neuik_Object_Release(stk);
 out:
     if (eNum > 0)
     {
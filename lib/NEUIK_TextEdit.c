@@ -28,9 +28,13 @@
 #include "NEUIK_Window_internal.h"
 #include "NEUIK_platform.h"
 #include "NEUIK_TextEdit.h"
+#include "NEUIK_TextEdit_internal.h"
 #include "NEUIK_Element_internal.h"
 #include "neuik_internal.h"
 #include "neuik_classes.h"
+#include "neuik_PrefixWidths.h"
+#include "neuik_TextBlockJournal.h"
+#include "neuik_TextBlockSearch.h"
 
 extern int   neuik__isInitialized;
 extern float neuik__HighDPI_Scaling;
@@ -53,6 +57,7 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit(
 int neuik_Element_Render__TextEdit(
     NEUIK_Element, RenderSize*, RenderLoc*, SDL_Renderer*, int);
 void neuik_Element_Defocus__TextEdit(NEUIK_Element);
+int neuik_TextEdit_UpdatePanCursor(NEUIK_TextEdit * te, int cursorChange);
 
 /*----------------------------------------------------------------------------*/
 /* neuik_Element    Function Table                                            */
@@ -119,6 +124,7 @@ int neuik_RegisterClass_TextEdit()
         "An editible GUI text field.", // classDescription
         neuik__Set_NEUIK,              // classSet
         neuik__Class_Element,          // superClass
+        sizeof(NEUIK_TextEdit),        // objSize
         &neuik_TextEdit_BaseFuncs,     // baseFuncs
         NULL,                          // classFuncs
         &neuik__Class_TextEdit))       // newClass
@@ -163,6 +169,8 @@ int neuik_Object_New__TextEdit(
         "Failure in `neuik_GetObjectBaseOfClass`.",            // [6]
         "Failure in function `neuik_NewTextBlock`.",           // [7]
         "Failure in `NEUIK_Element_SetBackgroundColorSolid`.", // [8]
+        "Failure in function `neuik_NewPrefixWidths`.",        // [9]
+        "Failure in `neuik_TextBlock_EnableJournal()`.",       // [10]
     };
 
     if (tePtr == NULL)
@@ -171,7 +179,8 @@ int neuik_Object_New__TextEdit(
         goto out;
     }
 
-    (*tePtr) = (NEUIK_TextEdit*) malloc(sizeof(NEUIK_TextEdit));
+    (*tePtr) = (NEUIK_TextEdit*) neuik_Object_Alloc(
+        neuik__Class_TextEdit, (void**)tePtr);
     te = *tePtr;
     if (te == NULL)
     {
@@ -213,6 +222,11 @@ int neuik_Object_New__TextEdit(
         eNum = 7;
         goto out;
     }
+    if (neuik_TextBlock_EnableJournal(te->textBlk, 0))
+    {
+        eNum = 10;
+        goto out;
+    }
 
     /*------------------------------------------------------------------------*/
     /* All allocations successful                                             */
@@ -249,12 +263,19 @@ int neuik_Object_New__TextEdit(
     te->textSurf           = NULL;
     te->textTex            = NULL;
     te->textRend           = NULL;
+    te->lineWidths         = NULL;
+    te->loader             = NULL;
 
     if (NEUIK_NewTextEditConfig(&te->cfg))
     {
         eNum = 2;
         goto out;
     }
+    if (neuik_NewPrefixWidths((neuik_PrefixWidths**)&te->lineWidths))
+    {
+        eNum = 9;
+        goto out;
+    }
 
     /*------------------------------------------------------------------------*/
     /* Set the default element background redraw styles.                      */
@@ -394,6 +415,7 @@ int neuik_Object_Free__TextEdit(
     /*------------------------------------------------------------------------*/
     /* The object is what it says it is and it is still allocated.            */
     /*------------------------------------------------------------------------*/
+    neuik_TextEdit_CancelLoad(te);
     if (neuik_Object_Free(te->objBase.superClassObj))
     {
         eNum = 3;
@@ -403,6 +425,7 @@ int neuik_Object_Free__TextEdit(
     if (te->textSurf != NULL) SDL_FreeSurface(te->textSurf);
     if (te->textTex  != NULL) SDL_DestroyTexture(te->textTex);
     if (te->textRend != NULL) SDL_DestroyRenderer(te->textRend);
+    neuik_PrefixWidths_Free(te->lineWidths);
 
     if (neuik_Object_Free(te->cfg))
     {
@@ -415,7 +438,7 @@ int neuik_Object_Free__TextEdit(
         goto out;
     }
 
-    free(te);
+    neuik_Object_Release(te);
 out:
     if (eNum > 0)
     {
@@ -558,6 +581,7 @@ int NEUIK_TextEdit_SetText(
     /*------------------------------------------------------------------------*/
     if (text != NULL)
     {
+        neuik_TextEdit_CancelLoad(te);
         if (neuik_TextBlock_SetText(te->textBlk, text))
         {
             eNum = 2;
@@ -748,6 +772,394 @@ out:
 }
 
 
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextEdit_ShowLine
+ *
+ *  Description:   Scroll the view so that the specified line is at its top, if
+ *                 that line is not currently shown.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+static void neuik_TextEdit_ShowLine(
+    NEUIK_TextEdit * te,
+    size_t           lineNo,
+    int              viewH)
+{
+    int                    textW  = 0;
+    int                    textH  = 0;
+    size_t                 nShown = 0;
+    TTF_Font             * font   = NULL;
+    NEUIK_TextEditConfig * aCfg   = NULL; /* the active config */
+
+    aCfg = te->cfgPtr;
+    if (aCfg == NULL)  aCfg = te->cfg;  /* Fall back to internal config */
+
+    if (aCfg->fontMono)
+    {
+        font = NEUIK_FontSet_GetFont(aCfg->fontSetMS, aCfg->fontSize,
+            aCfg->fontBold, aCfg->fontItalic);
+    }
+    else
+    {
+        font = NEUIK_FontSet_GetFont(aCfg->fontSet, aCfg->fontSize,
+            aCfg->fontBold, aCfg->fontItalic);
+    }
+    if (font != NULL)
+    {
+        TTF_SizeText(font, " ", &textW, &textH);
+        if ((int)(1.1*textH) > 0)
+        {
+            nShown = viewH/(int)(1.1*textH);
+        }
+    }
+    if (lineNo < te->vertPanLn || lineNo >= te->vertPanLn + nShown)
+    {
+        te->vertPanLn = lineNo;
+        te->vertPanPx = 0;
+    }
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_TextEdit_FindNext
+ *
+ *  Description:   Search for the next occurrence of `needle` after the cursor.
+ *                 If one is found it is highlighted, the cursor is moved to the
+ *                 end of it and (if needed) the view is scrolled so that it is
+ *                 shown. Repeated calls step through successive matches.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_TextEdit_FindNext(
+    NEUIK_TextEdit * te,
+    const char     * needle,
+    int            * found)
+{
+    size_t                  lineNo     = 0;
+    size_t                  linePos    = 0;
+    size_t                  endLineNo  = 0;
+    size_t                  endLinePos = 0;
+    RenderSize              rSize;
+    RenderLoc               rLoc;
+    neuik_TextBlockSearch * srch       = NULL;
+    int                     eNum       = 0; /* which error to report (if any) */
+    static char             funcName[] = "NEUIK_TextEdit_FindNext";
+    static char           * errMsgs[]  = {"", // [0] no error
+        "Argument `te` is not of TextEdit class.",            // [1]
+        "Output argument `found` is NULL.",                   // [2]
+        "Failure in function `neuik_TextBlock_SearchBegin`.", // [3]
+        "Failure in function `neuik_TextBlockSearch_Next`.",  // [4]
+        "Failure in `neuik_Element_GetSizeAndLocation()`.",   // [5]
+    };
+
+    if (!neuik_Object_IsClass(te, neuik__Class_TextEdit))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (found == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    *found = FALSE;
+
+    if (neuik_TextBlock_SearchBegin(te->textBlk, needle, 
+        te->cursorLine, te->cursorPos, &srch))
+    {
+        eNum = 3;
+        goto out;
+    }
+    if (neuik_TextBlockSearch_Next(srch, found, 
+        &lineNo, &linePos, &endLineNo, &endLinePos))
+    {
+        eNum = 4;
+        goto out;
+    }
+    if (!*found)
+    {
+        goto out;
+    }
+
+    te->highlightIsSet     = TRUE;
+    te->highlightBeginLine = lineNo;
+    te->highlightBeginPos  = linePos;
+    te->highlightStartLine = lineNo;
+    te->highlightStartPos  = linePos;
+    te->highlightEndLine   = endLineNo;
+    te->highlightEndPos    = endLinePos;
+    te->cursorLine         = endLineNo;
+    te->cursorPos          = endLinePos;
+    te->vertMovePos        = UNDEFINED;
+
+    if (neuik_Element_GetSizeAndLocation(te, &rSize, &rLoc))
+    {
+        eNum = 5;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Scroll the start of the match to the top of the view if it is not      */
+    /* currently shown.                                                       */
+    /*------------------------------------------------------------------------*/
+    neuik_TextEdit_ShowLine(te, lineNo, rSize.h);
+
+    neuik_Element_RequestRedraw(te, rLoc, rSize);
+    neuik_Element_TriggerCallback(te, NEUIK_CALLBACK_ON_CURSOR_MOVED);
+out:
+    neuik_TextBlockSearch_Free(srch);
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_TextEdit_ReplaceAll
+ *
+ *  Description:   Replace every occurrence of `needle` with `replacement`. Any
+ *                 highlight is cleared and the cursor is kept within the text.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_TextEdit_ReplaceAll(
+    NEUIK_TextEdit * te,
+    const char     * needle,
+    const char     * replacement,
+    size_t         * nReplaced)
+{
+    size_t        nRepl      = 0;
+    size_t        nLines     = 0;
+    size_t        lineLen    = 0;
+    RenderSize    rSize;
+    RenderLoc     rLoc;
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "NEUIK_TextEdit_ReplaceAll";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `te` is not of TextEdit class.",              // [1]
+        "Failure in function `neuik_TextBlock_ReplaceAll`.",    // [2]
+        "Failure in function `neuik_TextBlock_GetLineCount`.",  // [3]
+        "Failure in function `neuik_TextBlock_GetLineLength`.", // [4]
+        "Failure in `neuik_Element_GetSizeAndLocation()`.",     // [5]
+    };
+
+    if (nReplaced != NULL) *nReplaced = 0;
+    if (!neuik_Object_IsClass(te, neuik__Class_TextEdit))
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    if (neuik_TextBlock_ReplaceAll(te->textBlk, needle, replacement, &nRepl))
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (nReplaced != NULL) *nReplaced = nRepl;
+    if (nRepl == 0)
+    {
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Keep the cursor within the (possibly shorter) text.                    */
+    /*------------------------------------------------------------------------*/
+    if (neuik_TextBlock_GetLineCount(te->textBlk, &nLines))
+    {
+        eNum = 3;
+        goto out;
+    }
+    if (te->cursorLine >= nLines)
+    {
+        te->cursorLine = nLines - 1;
+    }
+    if (neuik_TextBlock_GetLineLength(te->textBlk, te->cursorLine, &lineLen))
+    {
+        eNum = 4;
+        goto out;
+    }
+    if (te->cursorPos > lineLen)
+    {
+        te->cursorPos = lineLen;
+    }
+    if (te->vertPanLn >= nLines)
+    {
+        te->vertPanLn = nLines - 1;
+        te->vertPanPx = 0;
+    }
+    te->highlightIsSet = FALSE;
+    te->vertMovePos    = UNDEFINED;
+
+    if (neuik_Element_GetSizeAndLocation(te, &rSize, &rLoc))
+    {
+        eNum = 5;
+        goto out;
+    }
+    neuik_Element_RequestRedraw(te, rLoc, rSize);
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Place the cursor after an undo/redo; the view follows the cursor.          */
+/*                                                                            */
+/* Returns : 1 if the call failed; 0 if successful                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextEdit_PlaceEditCursor(
+    NEUIK_TextEdit * te,
+    size_t           lineNo,
+    size_t           linePos)
+{
+    RenderSize rSize;
+    RenderLoc  rLoc;
+
+    te->cursorLine     = lineNo;
+    te->cursorPos      = linePos;
+    te->highlightIsSet = FALSE;
+    te->vertMovePos    = UNDEFINED;
+
+    if (neuik_Element_GetSizeAndLocation(te, &rSize, &rLoc))
+    {
+        return 1;
+    }
+    neuik_TextEdit_ShowLine(te, lineNo, rSize.h);
+    neuik_TextEdit_UpdatePanCursor(te, CURSORPAN_TEXT_ADD_REMOVE);
+
+    neuik_Element_RequestRedraw(te, rLoc, rSize);
+    neuik_Element_TriggerCallback(te, NEUIK_CALLBACK_ON_CURSOR_MOVED);
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_TextEdit_Undo
+ *
+ *  Description:   Undo the most recent edit (a run of typing is undone as one
+ *                 step). Nothing is done if there is no edit to undo.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_TextEdit_Undo(
+    NEUIK_TextEdit * te)
+{
+    int           done       = 0;
+    size_t        lineNo     = 0;
+    size_t        linePos    = 0;
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "NEUIK_TextEdit_Undo";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `te` is not of TextEdit class.",          // [1]
+        "Failure in function `neuik_TextBlock_Undo`.",      // [2]
+        "Failure in `neuik_Element_GetSizeAndLocation()`.", // [3]
+    };
+
+    if (!neuik_Object_IsClass(te, neuik__Class_TextEdit))
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    if (neuik_TextBlock_Undo(te->textBlk, &done, &lineNo, &linePos))
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (!done)
+    {
+        goto out;
+    }
+
+    if (neuik_TextEdit_PlaceEditCursor(te, lineNo, linePos))
+    {
+        eNum = 3;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_TextEdit_Redo
+ *
+ *  Description:   Redo the most recently undone edit. Nothing is done if there
+ *                 is no edit to redo.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_TextEdit_Redo(
+    NEUIK_TextEdit * te)
+{
+    int           done       = 0;
+    size_t        lineNo     = 0;
+    size_t        linePos    = 0;
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "NEUIK_TextEdit_Redo";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `te` is not of TextEdit class.",          // [1]
+        "Failure in function `neuik_TextBlock_Redo`.",      // [2]
+        "Failure in `neuik_Element_GetSizeAndLocation()`.", // [3]
+    };
+
+    if (!neuik_Object_IsClass(te, neuik__Class_TextEdit))
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    if (neuik_TextBlock_Redo(te->textBlk, &done, &lineNo, &linePos))
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (!done)
+    {
+        goto out;
+    }
+
+    if (neuik_TextEdit_PlaceEditCursor(te, lineNo, linePos))
+    {
+        eNum = 3;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
 void neuik_TextEdit_Configure_capture_segv(
     int sig_num)
 {
@@ -1588,7 +2000,7 @@ int neuik_Element_Render__TextEdit(
             }
 
             SDL_RenderPresent(te->textRend);
-            te->textTex = SDL_CreateTextureFromSurface(rend, te->textSurf);
+            te->textTex = neuik_CreateTextureFromSurface(rend, te->textSurf);
             if (te->textTex == NULL)
             {
                 eNum = 7;
@@ -78,6 +78,7 @@ int neuik_RegisterClass_TextEditConfig()
         "Configuration for NEUIK_TextEdit Object.", // classDescription
         neuik__Set_NEUIK,                            // classSet
         NULL,                                        // superClass
+        sizeof(NEUIK_TextEditConfig),                // objSize
         &neuik_TextEditConfig_BaseFuncs,            // baseFuncs
         NULL,                                        // classFuncs
         &neuik__Class_TextEditConfig))              // newClass
@@ -248,7 +249,8 @@ int neuik_Object_New__TextEditConfig(
         goto out;
     }
 
-    (*cfgPtr) = (NEUIK_TextEditConfig*) malloc(sizeof(NEUIK_TextEditConfig));
+    (*cfgPtr) = (NEUIK_TextEditConfig*) neuik_Object_Alloc(
+        neuik__Class_TextEditConfig, (void**)cfgPtr);
     cfg = (*cfgPtr);
     if (cfg == NULL)
     {
@@ -455,7 +457,7 @@ int neuik_Object_Free__TextEditConfig(
     if (cfg->fontName != NULL)     free(cfg->fontName);
     if (cfg->restrict_str != NULL) free(cfg->restrict_str);
 
-    free(cfg);
+    neuik_Object_Release(cfg);
 out:
     if (eNum > 0)
     {
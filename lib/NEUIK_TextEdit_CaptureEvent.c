@@ -24,6 +24,8 @@
 #include "NEUIK_platform.h"
 #include "neuik_internal.h"
 #include "neuik_classes.h"
+#include "neuik_PrefixWidths.h"
+#include "neuik_TextBlockJournal.h"
 
 #define VERT_PAN_PX 50
 
@@ -52,6 +54,10 @@ static char          * errMsgs[]  = {"", // [ 0] no error
     "Failure in function `neuik_TextBlock_GetSection`.",             // [12]
     "Failure in function `neuik_TextBlock_InsertText`.",             // [13]
     "Failure in function `neuik_getTextSelectionAtPos`.",            // [14]
+    "Failure in function `neuik_PrefixWidths_Update`.",              // [15]
+    "Failure in function `NEUIK_TextEdit_Undo`.",                    // [16]
+    "Failure in function `NEUIK_TextEdit_Redo`.",                    // [17]
+    "Failure in function `neuik_TextBlock_BeginEditGroup`.",         // [18]
 };
 
 
@@ -70,11 +76,9 @@ int neuik_TextEdit_UpdatePanCursor(
 {
     int                    eNum       = 0; /* which error to report (if any) */
     int                    textW      = 0;
-    int                    textH      = 0;
     int                    normWidth  = 0;
     int                    lineLen    = 0;
     size_t                 textLen    = 0;
-    char                   tempChar;
     char                 * lineBytes  = NULL;
     TTF_Font             * font       = NULL;
     NEUIK_ElementBase    * eBase      = NULL;
@@ -86,6 +90,7 @@ int neuik_TextEdit_UpdatePanCursor(
         "Failure in function `neuik_TextBlock_GetLength`.",            // [3]
         "FontSet_GetFont returned NULL.",                              // [4]
         "Failure in function `neuik_TextBlock_GetLine`.",              // [5]
+        "Failure in function `neuik_PrefixWidths_Update`.",            // [6]
     };
 
     if (!neuik_Object_IsClass(te, neuik__Class_TextEdit))
@@ -142,7 +147,16 @@ int neuik_TextEdit_UpdatePanCursor(
     }
     lineLen = strlen(lineBytes);
 
-    TTF_SizeText(font, lineBytes, &textW, &textH);
+    /*------------------------------------------------------------------------*/
+    /* The prefix widths are only rebuilt when the line (or font) changes.    */
+    /*------------------------------------------------------------------------*/
+    if (neuik_PrefixWidths_Update(te->lineWidths, font, lineBytes))
+    {
+        eNum = 6;
+        goto out;
+    }
+
+    textW = neuik_PrefixWidths_GetWidth(te->lineWidths, lineLen);
     textW++;
     normWidth = (eBase->eSt.rSize).w - 12; 
     if (textW < normWidth) 
@@ -167,13 +181,7 @@ int neuik_TextEdit_UpdatePanCursor(
         /*--------------------------------------------------------------------*/
         /* Update the cursorX position                                        */
         /*--------------------------------------------------------------------*/
-        tempChar = lineBytes[te->cursorPos];
-        if (tempChar != '\0')
-        {
-            lineBytes[te->cursorPos] = '\0';
-        }
-        TTF_SizeText(font, lineBytes, &(te->cursorX), &textH);
-        lineBytes[te->cursorPos] = tempChar;
+        te->cursorX = neuik_PrefixWidths_GetWidth(te->lineWidths, te->cursorPos);
 
 
         switch (cursorChange)
@@ -796,9 +804,7 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_MouseEvent(
     int                    textW        = 0;
     int                    textH        = 0;
     float                  textHFull    = 0;
-    int                    charW        = 0;
     int                    eNum         = 0; /* which error to report (if any) */
-    int                    lastW        = 0; /* position of previous char */
     int                    normWidth    = 0;
     int                    yRel         = 0;
     float                  yPos         = 0;
@@ -815,8 +821,6 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_MouseEvent(
     size_t                 clickLine    = 0;
     size_t                 oldCursorPos = 0;
     size_t                 oldCursorLn  = 0;
-    size_t                 ctr          = 0;
-    char                   aChar        = 0;
     char                 * lineBytes    = NULL; /* FREE at exit */
     TTF_Font             * font         = NULL;
     SDL_Rect               rect         = {0, 0, 0 ,0};
@@ -1191,52 +1195,29 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_MouseEvent(
                 goto out;
             }
 
-            for (ctr = 1;;ctr++)
+            /*----------------------------------------------------------------*/
+            /* Look up the click position in the cached prefix widths.        */
+            /*----------------------------------------------------------------*/
+            if (neuik_PrefixWidths_Update(te->lineWidths, font, lineBytes))
             {
-                aChar = lineBytes[ctr];
-
-                lineBytes[ctr] = '\0';
-                TTF_SizeText(font, lineBytes, &textW, &textH);
-                lineBytes[ctr] = aChar;
-
-                if (mouseButEv->x + te->panCursor <= 
-                    eBase->eSt.rLoc.x + rect.x + textW)
-                {
-                    /* cursor will be before this char */
-                    te->cursorPos   = ctr - 1;
-                    te->vertMovePos = te->cursorPos;
-                    charW = textW - lastW;
-                    if (mouseButEv->x + te->panCursor <= 
-                        eBase->eSt.rLoc.x + rect.x + textW - charW/3)
-                    {
-                        /* cursor will be before this char */
-                        te->cursorPos = ctr - 1;
-                    }
-                    else
-                    {
-                        /* cursor will be after char */
-                        te->cursorPos = ctr;
-                    }
+                eNum = 15;
+                goto out;
+            }
+            te->cursorPos = neuik_PrefixWidths_HitTest(te->lineWidths,
+                mouseButEv->x + te->panCursor - (eBase->eSt.rLoc.x + rect.x));
+            te->vertMovePos = te->cursorPos;
 
-                    /*--------------------------------------------------------*/
-                    /* Update the cursor Panning (if necessary).              */
-                    /*--------------------------------------------------------*/
-                    if (oldCursorPos > te->cursorPos)
-                    {
-                        neuik_TextEdit_UpdatePanCursor(te, 
-                            CURSORPAN_MOVE_BACK);
-                    }
-                    else
-                    {
-                        neuik_TextEdit_UpdatePanCursor(te, 
-                            CURSORPAN_MOVE_FORWARD);
-                    }
-                    break;
-                }
-                lastW = textW;
-                if (aChar == '\0') break;
+            /*----------------------------------------------------------------*/
+            /* Update the cursor Panning (if necessary).                      */
+            /*----------------------------------------------------------------*/
+            if (oldCursorPos > te->cursorPos)
+            {
+                neuik_TextEdit_UpdatePanCursor(te, CURSORPAN_MOVE_BACK);
+            }
+            else
+            {
+                neuik_TextEdit_UpdatePanCursor(te, CURSORPAN_MOVE_FORWARD);
             }
-            lineBytes[ctr] = aChar;
         }
         te->clickOrigin     = te->cursorPos;
         te->timeClickMinus2 = te->timeLastClick;
@@ -1513,52 +1494,33 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_MouseEvent(
                 {
                     oldCursorPos = te->cursorPos;
 
-                    for (ctr = 0; ctr < lineLen; ctr++)
+                    /*--------------------------------------------------------*/
+                    /* Look up the position in the cached prefix widths.      */
+                    /*--------------------------------------------------------*/
+                    if (neuik_PrefixWidths_Update(te->lineWidths, font, 
+                        lineBytes))
                     {
-                        aChar = lineBytes[ctr];
-
-                        lineBytes[ctr] = '\0';
-                        TTF_SizeText(font, lineBytes, &textW, &textH);
-                        lineBytes[ctr] = aChar;
-
-                        if (mouseMotEv->x + te->panCursor <= 
-                            eBase->eSt.rLoc.x + rect.x + textW)
-                        {
-                            /* cursor will be before this char */
-                            te->cursorPos   = ctr - 1;
-                            charW = textW - lastW;
-                            if (mouseMotEv->x + te->panCursor <= 
-                                eBase->eSt.rLoc.x + rect.x + textW - charW/3)
-                            {
-                                /* cursor will be before this char */
-                                te->cursorPos = ctr - 1;
-                            }
-                            else
-                            {
-                                /* cursor will be after char */
-                                te->cursorPos = ctr;
-                            }
-                            te->vertMovePos = te->cursorPos;
+                        eNum = 15;
+                        goto out;
+                    }
+                    te->cursorPos = neuik_PrefixWidths_HitTest(te->lineWidths,
+                        mouseMotEv->x + te->panCursor - 
+                        (eBase->eSt.rLoc.x + rect.x));
+                    te->vertMovePos = te->cursorPos;
 
-                            /*------------------------------------------------*/
-                            /* Update the cursor Panning (if necessary).      */
-                            /*------------------------------------------------*/
-                            if (oldCursorPos > te->cursorPos)
-                            {
-                                neuik_TextEdit_UpdatePanCursor(te, 
-                                    CURSORPAN_MOVE_BACK);
-                            }
-                            else
-                            {
-                                neuik_TextEdit_UpdatePanCursor(te, 
-                                    CURSORPAN_MOVE_FORWARD);
-                            }
-                            break;
-                        }
-                        lastW = textW;
-                        if (aChar == '\0') break;
+                    /*--------------------------------------------------------*/
+                    /* Update the cursor Panning (if necessary).              */
+                    /*--------------------------------------------------------*/
+                    if (oldCursorPos > te->cursorPos)
+                    {
+                        neuik_TextEdit_UpdatePanCursor(te, 
+                            CURSORPAN_MOVE_BACK);
+                    }
+                    else
+                    {
+                        neuik_TextEdit_UpdatePanCursor(te, 
+                            CURSORPAN_MOVE_FORWARD);
                     }
-                    lineBytes[ctr] = aChar;
                 }
                 else
                 {
@@ -1631,6 +1593,7 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_TextInputEvent(
 {
     int                  evCaptured   = 0;
     int                  eNum         = 0; /* which error to report (if any) */
+    int                  inEditGroup  = 0; /* delete+insert undo as one edit */
     size_t               inpLen       = 0; /* length of text input */
     size_t               oldCursorPos = 0;
     size_t               oldCursorLn  = 0;
@@ -1669,6 +1632,13 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_TextInputEvent(
     /*------------------------------------------------------------------------*/
     if (te->highlightIsSet)
     {
+        if (neuik_TextBlock_BeginEditGroup(te->textBlk))
+        {
+            eNum = 18;
+            goto out;
+        }
+        inEditGroup = 1;
+
         if (neuik_TextBlock_DeleteSection(te->textBlk,
             te->highlightStartLine, te->highlightStartPos, 
             te->highlightEndLine, te->highlightEndPos))
@@ -1714,6 +1684,10 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_TextInputEvent(
     neuik_Element_RequestRedraw(te, rLoc, rSize);
     evCaptured = NEUIK_EVENTSTATE_CAPTURED;
 out:
+    if (inEditGroup)
+    {
+        neuik_TextBlock_EndEditGroup(te->textBlk);
+    }
     if (eNum > 0)
     {
         NEUIK_RaiseError(funcName, errMsgs[eNum]);
@@ -1740,6 +1714,7 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_KeyDownEvent(
     int                 evCaptured   = 0;
     int                 doRedraw     = 0;
     int                 eNum         = 0; /* which error to report (if any) */
+    int                 inEditGroup  = 0; /* delete+insert undo as one edit */
     size_t              lineLen      = 0;
     size_t              nLines       = 0;
     size_t              oldCursorPos = 0;
@@ -2691,7 +2666,26 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_KeyDownEvent(
             break;
     }
 
-    if (neuik_KeyShortcut_Copy(keyEv, keyMod))
+    if (neuik_KeyShortcut_Redo(keyEv, keyMod))
+    {
+        /*--------------------------------------------------------------------*/
+        /* Checked before undo; `Ctrl+Shift+Z` would also match an undo.      */
+        /*--------------------------------------------------------------------*/
+        if (NEUIK_TextEdit_Redo(te))
+        {
+            eNum = 17;
+            goto out;
+        }
+    }
+    else if (neuik_KeyShortcut_Undo(keyEv, keyMod))
+    {
+        if (NEUIK_TextEdit_Undo(te))
+        {
+            eNum = 16;
+            goto out;
+        }
+    }
+    else if (neuik_KeyShortcut_Copy(keyEv, keyMod))
     {
         if (te->highlightIsSet)
         {
@@ -2749,6 +2743,13 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_KeyDownEvent(
     {
         if (te->highlightIsSet)
         {
+            if (neuik_TextBlock_BeginEditGroup(te->textBlk))
+            {
+                eNum = 18;
+                goto out;
+            }
+            inEditGroup = 1;
+
             /*----------------------------------------------------------------*/
             /* Delete the section of highlighted text                         */
             /*----------------------------------------------------------------*/
@@ -2838,6 +2839,10 @@ neuik_EventState neuik_Element_CaptureEvent__TextEdit_KeyDownEvent(
     }
     evCaptured = NEUIK_EVENTSTATE_CAPTURED;
 out:
+    if (inEditGroup)
+    {
+        neuik_TextBlock_EndEditGroup(te->textBlk);
+    }
     if (eNum > 0)
     {
         NEUIK_RaiseError(funcName, errMsgs[eNum]);
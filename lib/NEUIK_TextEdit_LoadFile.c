@@ -0,0 +1,623 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#include <SDL.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "NEUIK_defs.h"
+#include "NEUIK_error.h"
+#include "NEUIK_TextEdit.h"
+#include "NEUIK_TextEdit_internal.h"
+#include "NEUIK_UIQueue.h"
+#include "NEUIK_Element_internal.h"
+#include "neuik_internal.h"
+#include "neuik_classes.h"
+#include "neuik_TextBlockBuilder.h"
+#include "neuik_TextBlockJournal.h"
+
+/*----------------------------------------------------------------------------*/
+/* The first chunk is indexed before NEUIK_TextEdit_LoadFile returns (enough  */
+/* for the first screen); the rest of the file is read on a loader thread and */
+/* handed to the TextEdit in batches.                                         */
+/*----------------------------------------------------------------------------*/
+#define LOAD_FIRST_CHUNK (64*1024)
+#define LOAD_CHUNK       (1024*1024)
+#define LOAD_BATCH       (8*1024*1024)
+#define LOAD_BLOCK_SIZE  (64*1024)
+
+/*----------------------------------------------------------------------------*/
+/* State shared between a TextEdit, its loader thread and the batches which   */
+/* are in flight. Freed once the last reference is released.                  */
+/*----------------------------------------------------------------------------*/
+typedef struct neuik_TextEditLoader neuik_TextEditLoader;
+
+struct neuik_TextEditLoader {
+    neuik_TextEditLoader   * next;  /* next running loader (event loop only) */
+    SDL_Thread             * thread;
+    SDL_atomic_t             refCount;
+    SDL_atomic_t             cancelled;
+    SDL_atomic_t             done;       /* set as the loader thread exits */
+    SDL_atomic_t             postFailed; /* a batch could not be posted */
+    NEUIK_TextEdit         * te;    /* NULL once detached (event loop only) */
+    FILE                   * file;
+    char                   * chunk;
+    neuik_TextBlockBuilder * bld;
+};
+
+typedef struct {
+    neuik_TextEditLoader * ldr;
+    neuik_TextBlockData  * blocks;  /* loaded lines (until appended) */
+    int                    isFinal;
+    int                    failed;  /* the file could not be read */
+} neuik_TextEditLoadBatch;
+
+/*----------------------------------------------------------------------------*/
+/* Loaders whose threads have not yet been joined; each entry holds a         */
+/* reference to its loader. Only used from the event loop thread.             */
+/*----------------------------------------------------------------------------*/
+static neuik_TextEditLoader * neuik_teLoad_Running = NULL;
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextEditLoader_Release
+ *
+ *  Description:   Release a reference to a loader; the last one frees it.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+static void neuik_TextEditLoader_Release(
+    neuik_TextEditLoader * ldr)
+{
+    if (SDL_AtomicAdd(&ldr->refCount, -1) != 1)
+    {
+        return;
+    }
+    if (ldr->file  != NULL) fclose(ldr->file);
+    if (ldr->chunk != NULL) free(ldr->chunk);
+    neuik_TextBlockBuilder_Free(ldr->bld);
+    free(ldr);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextEditLoadBatch_Free
+ *
+ *  Description:   Free a load batch (along with any blocks which were not
+ *                 appended to the TextEdit).
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+static void neuik_TextEditLoadBatch_Free(
+    void * arg)
+{
+    neuik_TextEditLoadBatch * batch = (neuik_TextEditLoadBatch*)arg;
+
+    neuik_TextBlockBuilder_FreeBlocks(batch->blocks);
+    neuik_TextEditLoader_Release(batch->ldr);
+    free(batch);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextEdit_DetachLoader
+ *
+ *  Description:   Detach a TextEdit from its loader. Any batches still in
+ *                 flight are discarded when they reach the event loop and the
+ *                 loader thread stops at its next chunk.
+ *
+ *                 This function must be called from the event loop thread.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+static void neuik_TextEdit_DetachLoader(
+    NEUIK_TextEdit * te)
+{
+    neuik_TextEditLoader * ldr = NULL;
+
+    ldr = (neuik_TextEditLoader*)te->loader;
+    if (ldr == NULL)
+    {
+        return;
+    }
+    te->loader = NULL;
+    ldr->te    = NULL;
+    SDL_AtomicSet(&ldr->cancelled, 1);
+    neuik_TextEditLoader_Release(ldr);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextEdit_CancelLoad
+ *
+ *  Description:   Stop loading a file into the TextEdit (if a load is still
+ *                 in progress). Lines which have already been added are kept.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+void neuik_TextEdit_CancelLoad(
+    NEUIK_TextEdit * te)
+{
+    if (te != NULL)
+    {
+        neuik_TextEdit_DetachLoader(te);
+    }
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextEdit_ApplyLoadBatch
+ *
+ *  Description:   Append a batch of loaded lines to the TextEdit. This is
+ *                 posted to the event loop by the loader thread.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_TextEdit_ApplyLoadBatch(
+    void * elem,
+    void * arg)
+{
+    RenderSize                rSize;
+    RenderLoc                 rLoc;
+    NEUIK_TextEdit          * te         = NULL;
+    neuik_TextEditLoadBatch * batch      = NULL;
+    int                       eNum       = 0; /* which error to report (if any) */
+    static char               funcName[] = "neuik_TextEdit_ApplyLoadBatch";
+    static char             * errMsgs[]  = {"", // [0] no error
+        "Failure in function `neuik_TextBlock_AppendBlocks`.", // [1]
+        "Failure reading from the file being loaded.",         // [2]
+        "Failure in `neuik_Element_GetSizeAndLocation()`.",    // [3]
+    };
+
+    batch = (neuik_TextEditLoadBatch*)arg;
+    te    = batch->ldr->te;
+    if (te == NULL)
+    {
+        /*--------------------------------------------------------------------*/
+        /* The load was cancelled (or the TextEdit was freed).                */
+        /*--------------------------------------------------------------------*/
+        goto out;
+    }
+
+    if (neuik_TextBlock_AppendBlocks(te->textBlk, batch->blocks, 
+        batch->isFinal))
+    {
+        eNum = 1;
+    }
+    batch->blocks = NULL;
+
+    if (batch->failed)
+    {
+        eNum = 2;
+    }
+    if (batch->isFinal || eNum > 0)
+    {
+        neuik_TextEdit_DetachLoader(te);
+    }
+
+    te->needsRedraw = TRUE;
+    if (neuik_Element_GetSizeAndLocation(te, &rSize, &rLoc))
+    {
+        if (eNum == 0) eNum = 3;
+        goto out;
+    }
+    neuik_Element_RequestRedraw(te, rLoc, rSize);
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextEditLoader_PostBatch
+ *
+ *  Description:   Hand the lines built so far over to the event loop.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_TextEditLoader_PostBatch(
+    neuik_TextEditLoader * ldr,
+    int                    isFinal,
+    int                    failed)
+{
+    neuik_TextEditLoadBatch * batch = NULL;
+
+    batch = (neuik_TextEditLoadBatch*) malloc(sizeof(neuik_TextEditLoadBatch));
+    if (batch == NULL)
+    {
+        return 1;
+    }
+    batch->ldr     = ldr;
+    batch->blocks  = neuik_TextBlockBuilder_TakeBlocks(ldr->bld);
+    batch->isFinal = isFinal;
+    batch->failed  = failed;
+    SDL_AtomicAdd(&ldr->refCount, 1);
+
+    if (NEUIK_PostToUIThread(neuik_TextEdit_ApplyLoadBatch, NULL,
+        NEUIK_UIUPDATE_NO_COALESCE, batch, neuik_TextEditLoadBatch_Free))
+    {
+        neuik_TextEditLoadBatch_Free(batch);
+        return 1;
+    }
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextEditLoader_Thread
+ *
+ *  Description:   Read the remainder of the file in chunks, indexing each one
+ *                 into TextBlock data blocks. Every LOAD_BATCH bytes (and at
+ *                 the end of the file) the completed lines are posted to the
+ *                 event loop to be appended to the TextEdit.
+ *
+ *  Returns:       0.
+ *
+ ******************************************************************************/
+static int neuik_TextEditLoader_Thread(
+    void * ptr)
+{
+    size_t                 nRead   = 0;
+    size_t                 pending = 0;
+    int                    isFinal = 0;
+    int                    failed  = 0;
+    neuik_TextEditLoader * ldr     = NULL;
+
+    ldr = (neuik_TextEditLoader*)ptr;
+    while (!SDL_AtomicGet(&ldr->cancelled))
+    {
+        nRead = fread(ldr->chunk, 1, LOAD_CHUNK, ldr->file);
+        if (neuik_TextBlockBuilder_Feed(ldr->bld, ldr->chunk, nRead))
+        {
+            failed = 1;
+        }
+        pending += nRead;
+
+        if (nRead < LOAD_CHUNK)
+        {
+            if (ferror(ldr->file))
+            {
+                failed = 1;
+            }
+            isFinal = 1;
+        }
+        if (isFinal && !failed && neuik_TextBlockBuilder_Finish(ldr->bld))
+        {
+            failed = 1;
+        }
+
+        if (failed || isFinal || pending >= LOAD_BATCH)
+        {
+            if (neuik_TextEditLoader_PostBatch(ldr, isFinal, failed))
+            {
+                /*------------------------------------------------------------*/
+                /* Errors may not be raised from this thread; the failure is  */
+                /* reported when the thread is joined.                        */
+                /*------------------------------------------------------------*/
+                SDL_AtomicSet(&ldr->postFailed, 1);
+                break;
+            }
+            pending = 0;
+        }
+        if (failed || isFinal)
+        {
+            break;
+        }
+    }
+
+    SDL_AtomicSet(&ldr->done, 1);
+    neuik_TextEditLoader_Release(ldr);
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextEditLoader_Join
+ *
+ *  Description:   Join the threads of the running loaders. If `all` is zero,
+ *                 only the threads which have already finished are joined;
+ *                 otherwise every loader is cancelled and waited for.
+ *
+ *                 This function must be called from the event loop thread.
+ *
+ *  Returns:       1 if a loader was unable to post its lines to the event
+ *                 loop, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_TextEditLoader_Join(
+    int all)
+{
+    int                     lost = 0;
+    neuik_TextEditLoader *  ldr  = NULL;
+    neuik_TextEditLoader ** prev = NULL;
+
+    if (all)
+    {
+        for (ldr = neuik_teLoad_Running; ldr != NULL; ldr = ldr->next)
+        {
+            SDL_AtomicSet(&ldr->cancelled, 1);
+        }
+    }
+
+    prev = &neuik_teLoad_Running;
+    while (*prev != NULL)
+    {
+        ldr = *prev;
+        if (!all && !SDL_AtomicGet(&ldr->done))
+        {
+            prev = &ldr->next;
+            continue;
+        }
+        *prev = ldr->next;
+        SDL_WaitThread(ldr->thread, NULL);
+
+        if (SDL_AtomicGet(&ldr->postFailed) && ldr->te != NULL)
+        {
+            /*----------------------------------------------------------------*/
+            /* The rest of the file will never arrive.                        */
+            /*----------------------------------------------------------------*/
+            neuik_TextEdit_DetachLoader(ldr->te);
+            lost = 1;
+        }
+        neuik_TextEditLoader_Release(ldr);
+    }
+
+    return lost;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextEditLoader_Shutdown
+ *
+ *  Description:   Cancel the file loads which are in progress and wait for
+ *                 their loader threads to exit. Batches which were already
+ *                 posted are freed when the event queue is discarded.
+ *
+ *                 This function must be called from the event loop thread.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+void neuik_TextEditLoader_Shutdown()
+{
+    neuik_TextEditLoader_Join(1);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_TextEdit_LoadFile
+ *
+ *  Description:   Replace the contents of a TextEdit with the contents of a
+ *                 file. The file is read in chunks directly into TextBlock
+ *                 data blocks (it is never held in memory as a single string).
+ *
+ *                 The first chunk is loaded before this function returns so
+ *                 that the start of the file can be displayed right away; the
+ *                 rest of the file is loaded by a background thread and added
+ *                 to the TextEdit from the event loop as it is read.
+ *
+ *                 Setting the text of the TextEdit (or loading another file)
+ *                 cancels a load which is still in progress.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_TextEdit_LoadFile(
+    NEUIK_TextEdit * te,
+    const char     * fileName)
+{
+    size_t                 nRead      = 0;
+    FILE                 * file       = NULL;
+    RenderSize             rSize;
+    RenderLoc              rLoc;
+    neuik_TextBlock      * textBlk    = NULL;
+    neuik_TextEditLoader * ldr        = NULL;
+    int                    eNum       = 0; /* which error to report (if any) */
+    static char            funcName[] = "NEUIK_TextEdit_LoadFile";
+    static char          * errMsgs[]  = {"", // [0] no error
+        "Argument `te` is not of TextEdit class.",             // [1]
+        "Argument `fileName` is NULL.",                        // [2]
+        "Unable to open the specified file for reading.",      // [3]
+        "Failure to allocate memory.",                         // [4]
+        "Failure in function `neuik_NewTextBlock`.",           // [5]
+        "Failure reading from the specified file.",            // [6]
+        "Failure in function `neuik_TextBlock_AppendBlocks`.", // [7]
+        "Failure in function `neuik_Object_Free`.",            // [8]
+        "Failure in `neuik_Element_GetSizeAndLocation()`.",    // [9]
+        "Failed to start the file loader thread.",             // [10]
+        "Failure in `neuik_TextBlock_EnableJournal()`.",       // [11]
+        "A previous file load could not be completed.",        // [12]
+    };
+
+    if (!neuik_Object_IsClass(te, neuik__Class_TextEdit))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (fileName == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (neuik_TextEditLoader_Join(0))
+    {
+        NEUIK_RaiseError(funcName, errMsgs[12]);
+    }
+
+    file = fopen(fileName, "rb");
+    if (file == NULL)
+    {
+        eNum = 3;
+        goto out;
+    }
+    neuik_TextEdit_DetachLoader(te);
+
+    ldr = (neuik_TextEditLoader*) malloc(sizeof(neuik_TextEditLoader));
+    if (ldr == NULL)
+    {
+        eNum = 4;
+        goto out;
+    }
+    SDL_AtomicSet(&ldr->refCount, 1);
+    SDL_AtomicSet(&ldr->cancelled, 0);
+    SDL_AtomicSet(&ldr->done, 0);
+    SDL_AtomicSet(&ldr->postFailed, 0);
+    ldr->next   = NULL;
+    ldr->thread = NULL;
+    ldr->te     = NULL;
+    ldr->file   = file;
+    ldr->bld    = NULL;
+    ldr->chunk  = (char*) malloc(LOAD_CHUNK*sizeof(char));
+    file = NULL;
+    if (ldr->chunk == NULL)
+    {
+        eNum = 4;
+        goto out;
+    }
+    if (neuik_NewTextBlockBuilder(&ldr->bld, LOAD_BLOCK_SIZE, 
+        te->textBlk->overProvisionPct))
+    {
+        eNum = 4;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* The loaded text goes into a new TextBlock; SetText does not trim the   */
+    /* data blocks of the existing one.                                       */
+    /*------------------------------------------------------------------------*/
+    if (neuik_NewTextBlock(&textBlk, LOAD_BLOCK_SIZE, 0))
+    {
+        eNum = 5;
+        goto out;
+    }
+    if (neuik_TextBlock_EnableJournal(textBlk, 0))
+    {
+        eNum = 11;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Index the first chunk now so that the first screen can be shown.       */
+    /*------------------------------------------------------------------------*/
+    nRead = fread(ldr->chunk, 1, LOAD_FIRST_CHUNK, ldr->file);
+    if (ferror(ldr->file) || 
+        neuik_TextBlockBuilder_Feed(ldr->bld, ldr->chunk, nRead))
+    {
+        eNum = 6;
+        goto out;
+    }
+    if (nRead < LOAD_FIRST_CHUNK && neuik_TextBlockBuilder_Finish(ldr->bld))
+    {
+        eNum = 4;
+        goto out;
+    }
+    if (neuik_TextBlock_AppendBlocks(textBlk, 
+        neuik_TextBlockBuilder_TakeBlocks(ldr->bld), nRead < LOAD_FIRST_CHUNK))
+    {
+        eNum = 7;
+        goto out;
+    }
+
+    if (neuik_Object_Free(te->textBlk))
+    {
+        eNum = 8;
+        goto out;
+    }
+    te->textBlk = textBlk;
+    textBlk     = NULL;
+
+    te->cursorLine         = 0;
+    te->cursorPos          = 0;
+    te->vertMovePos        = UNDEFINED;
+    te->vertPanLn          = 0;
+    te->vertPanPx          = 0;
+    te->cursorX            = 0;
+    te->panX               = 0;
+    te->panCursor          = 0;
+    te->highlightIsSet     = FALSE;
+    te->highlightBeginPos  = 0;
+    te->highlightBeginLine = 0;
+    te->highlightStartPos  = 0;
+    te->highlightStartLine = 0;
+    te->highlightEndPos    = 0;
+    te->highlightEndLine   = 0;
+    te->clickOrigin        = 0;
+    te->clickHeld          = FALSE;
+    te->needsRedraw        = TRUE;
+
+    if (nRead == LOAD_FIRST_CHUNK)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Hand the rest of the file over to a loader thread; the thread, the */
+        /* TextEdit and the list of running loaders each hold a reference to  */
+        /* the loader.                                                        */
+        /*--------------------------------------------------------------------*/
+        ldr->te    = te;
+        te->loader = ldr;
+        SDL_AtomicAdd(&ldr->refCount, 1);
+        ldr->thread = SDL_CreateThread(neuik_TextEditLoader_Thread, 
+            "NEUIK_TextEdit_LoadFile", ldr);
+        if (ldr->thread == NULL)
+        {
+            SDL_AtomicAdd(&ldr->refCount, -1);
+            neuik_TextEdit_DetachLoader(te);
+            ldr  = NULL;
+            eNum = 10;
+            goto out;
+        }
+        ldr->next            = neuik_teLoad_Running;
+        neuik_teLoad_Running = ldr;
+        ldr = NULL;
+    }
+
+    if (neuik_Element_GetSizeAndLocation(te, &rSize, &rLoc))
+    {
+        eNum = 9;
+        goto out;
+    }
+    neuik_Element_RequestRedraw(te, rLoc, rSize);
+out:
+    if (file    != NULL) fclose(file);
+    if (textBlk != NULL) neuik_Object_Free(textBlk);
+    if (ldr     != NULL) neuik_TextEditLoader_Release(ldr);
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
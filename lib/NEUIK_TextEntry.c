@@ -32,6 +32,7 @@
 #include "NEUIK_Element_internal.h"
 #include "neuik_internal.h"
 #include "neuik_classes.h"
+#include "neuik_PrefixWidths.h"
 
 extern int   neuik__Report_Debug;
 extern float neuik__HighDPI_Scaling;
@@ -101,6 +102,7 @@ int neuik_RegisterClass_TextEntry()
         "An editible GUI text field.", // classDescription
         neuik__Set_NEUIK,              // classSet
         neuik__Class_Element,          // superClass
+        sizeof(NEUIK_TextEntry),       // objSize
         &neuik_TextEntry_BaseFuncs,    // baseFuncs
         NULL,                          // classFuncs
         &neuik__Class_TextEntry))      // newClass
@@ -145,6 +147,7 @@ int neuik_Object_New__TextEntry(
         "Failure in function `neuik_Element_SetFuncTable`.",   // [5]
         "Failure in `neuik_GetObjectBaseOfClass`.",            // [6]
         "Failure in `NEUIK_Element_SetBackgroundColorSolid`.", // [7]
+        "Failure in function `neuik_NewPrefixWidths`.",        // [8]
     };
 
     if (tePtr == NULL)
@@ -153,7 +156,8 @@ int neuik_Object_New__TextEntry(
         goto out;
     }
 
-    (*tePtr) = (NEUIK_TextEntry*) malloc(sizeof(NEUIK_TextEntry));
+    (*tePtr) = (NEUIK_TextEntry*) neuik_Object_Alloc(
+        neuik__Class_TextEntry, (void**)tePtr);
     te = *tePtr;
     if (te == NULL)
     {
@@ -224,6 +228,13 @@ int neuik_Object_New__TextEntry(
     te->textSurf       = NULL;
     te->textTex        = NULL;
     te->textRend       = NULL;
+    te->textWidths     = NULL;
+
+    if (neuik_NewPrefixWidths((neuik_PrefixWidths**)&te->textWidths))
+    {
+        eNum = 8;
+        goto out;
+    }
 
     // if (NEUIK_TextEntry_CopyConfig(te, NEUIK_GetDefaultTextEntryConfig(&err)))
     if (NEUIK_NewTextEntryConfig(&te->cfg))
@@ -261,7 +272,7 @@ out:
         if (te != NULL)
         {
             if (te->text != NULL) free(te->text);
-            free(te);
+            neuik_Object_Release(te);
         }
         te = NULL;
         eNum = 1;
@@ -430,6 +441,7 @@ int neuik_Object_Free__TextEntry(
     if (te->textSurf != NULL) SDL_FreeSurface(te->textSurf);
     if (te->textTex  != NULL) SDL_DestroyTexture(te->textTex);
     if (te->textRend != NULL) SDL_DestroyRenderer(te->textRend);
+    neuik_PrefixWidths_Free(te->textWidths);
 
     if(neuik_Object_Free(te->cfg))
     {
@@ -437,7 +449,7 @@ int neuik_Object_Free__TextEntry(
         goto out;
     }
 
-    free(te);
+    neuik_Object_Release(te);
 out:
     if (eNum > 0)
     {
@@ -1132,7 +1144,7 @@ int neuik_Element_Render__TextEntry(
             }
 
             SDL_RenderPresent(te->textRend);
-            te->textTex = SDL_CreateTextureFromSurface(rend, te->textSurf);
+            te->textTex = neuik_CreateTextureFromSurface(rend, te->textSurf);
             if (te->textTex == NULL)
             {
                 eNum = 7;
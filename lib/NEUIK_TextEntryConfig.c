@@ -78,6 +78,7 @@ int neuik_RegisterClass_TextEntryConfig()
         "Configuration for NEUIK_TextEntry Object.", // classDescription
         neuik__Set_NEUIK,                            // classSet
         NULL,                                        // superClass
+        sizeof(NEUIK_TextEntryConfig),               // objSize
         &neuik_TextEntryConfig_BaseFuncs,            // baseFuncs
         NULL,                                        // classFuncs
         &neuik__Class_TextEntryConfig))              // newClass
@@ -213,7 +214,8 @@ int neuik_Object_New__TextEntryConfig(
         goto out;
     }
 
-    (*cfgPtr) = (NEUIK_TextEntryConfig*) malloc(sizeof(NEUIK_TextEntryConfig));
+    (*cfgPtr) = (NEUIK_TextEntryConfig*) neuik_Object_Alloc(
+        neuik__Class_TextEntryConfig, (void**)cfgPtr);
     cfg = (*cfgPtr);
     if (cfg == NULL)
     {
@@ -410,7 +412,7 @@ int neuik_Object_Free__TextEntryConfig(
     if (cfg->fontName != NULL)     free(cfg->fontName);
     if (cfg->restrict_str != NULL) free(cfg->restrict_str);
 
-    free(cfg);
+    neuik_Object_Release(cfg);
 out:
     if (eNum > 0)
     {
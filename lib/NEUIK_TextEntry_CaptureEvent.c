@@ -24,6 +24,7 @@
 #include "NEUIK_platform.h"
 #include "neuik_internal.h"
 #include "neuik_classes.h"
+#include "neuik_PrefixWidths.h"
 
 extern int neuik__Report_Debug;
 
@@ -32,6 +33,7 @@ static char * errMsgs[]  = {"", // [0] no error
     "Failed to get text from clipboard.",                            // [2]
     "Argument `elem` is not of TextEntry class.",                    // [3]
     "Argument `elem` caused `neuik_Object_GetClassObject` to fail.", // [4]
+    "Failure in function `neuik_PrefixWidths_Update`.",              // [5]
 };
 
 
@@ -50,9 +52,7 @@ int neuik_TextEntry_UpdatePanCursor(
 {
     int                     eNum       = 0; /* which error to report (if any) */
     int                     textW      = 0;
-    int                     textH      = 0;
     int                     normWidth  = 0;
-    char                    tempChar;
     TTF_Font              * font       = NULL;
     NEUIK_ElementBase     * eBase      = NULL;
     NEUIK_TextEntryConfig * aCfg       = NULL; /* the active textEntry config */
@@ -61,6 +61,7 @@ int neuik_TextEntry_UpdatePanCursor(
         "Argument `te` is not of TextEntry class.",                    // [1]
         "Argument `te` caused `neuik_Object_GetClassObject` to fail.", // [2]
         "FontSet_GetFont returned NULL.",                              // [3]
+        "Failure in function `neuik_PrefixWidths_Update`.",            // [4]
     };
 
     if (!neuik_Object_IsClass(te, neuik__Class_TextEntry))
@@ -125,7 +126,12 @@ int neuik_TextEntry_UpdatePanCursor(
     /* Before proceeding, check to see where the cursor is located within the */
     /* currently visible TextEntry field.                                     */
     /*------------------------------------------------------------------------*/
-    TTF_SizeText(font, te->text, &textW, &textH);
+    if (neuik_PrefixWidths_Update(te->textWidths, font, te->text))
+    {
+        eNum = 4;
+        goto out;
+    }
+    textW = neuik_PrefixWidths_GetWidth(te->textWidths, te->textLen);
     textW++;
     normWidth = (eBase->eSt.rSize).w - 12; 
     if (neuik__Report_Debug)
@@ -158,13 +164,7 @@ int neuik_TextEntry_UpdatePanCursor(
         /*--------------------------------------------------------------------*/
         /* Update the cursorX position                                        */
         /*--------------------------------------------------------------------*/
-        tempChar = te->text[te->cursorPos];
-        if (tempChar != '\0')
-        {
-            te->text[te->cursorPos] = '\0';
-        }
-        TTF_SizeText(font, te->text, &(te->cursorX), &textH);
-        te->text[te->cursorPos] = tempChar;
+        te->cursorX = neuik_PrefixWidths_GetWidth(te->textWidths, te->cursorPos);
 
 
         switch (cursorChange)
@@ -237,14 +237,10 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_MouseEvent(
     neuik_EventState        evCaptured   = NEUIK_EVENTSTATE_NOT_CAPTURED;
     int                     textW        = 0;
     int                     textH        = 0;
-    int                     charW        = 0;
     int                     doContinue   = 0;
     int                     eNum         = 0; /* which error to report (if any) */
-    int                     lastW        = 0; /* position of previous char */
     int                     normWidth    = 0;
     size_t                  oldCursorPos = 0;
-    size_t                  ctr;
-    char                    aChar;
     char                  * clipText     = NULL;
     TTF_Font              * font         = NULL;
     SDL_Rect                rect         = {0, 0, 0 ,0};
@@ -422,50 +418,28 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_MouseEvent(
                 if (te->textLen > 1)
                 {
                     oldCursorPos = te->cursorPos;
-                    for (ctr = 1;;ctr++)
+                    /*--------------------------------------------------------*/
+                    /* Look up the click position in the cached prefix widths */
+                    /*--------------------------------------------------------*/
+                    if (neuik_PrefixWidths_Update(te->textWidths, font, te->text))
                     {
-                        aChar = te->text[ctr];
-
-                        te->text[ctr] = '\0';
-                        TTF_SizeText(font, te->text, &textW, &textH);
-                        te->text[ctr] = aChar;
+                        eNum = 5;
+                        goto out;
+                    }
+                    te->cursorPos = neuik_PrefixWidths_HitTest(te->textWidths,
+                        mouseButEv->x + te->panCursor - (eBase->eSt.rLoc.x + rect.x));
 
-                        if (mouseButEv->x + te->panCursor <= eBase->eSt.rLoc.x + rect.x + textW)
-                        {
-                            /* cursor will be before this char */
-                            te->cursorPos = ctr - 1;
-                            charW = textW - lastW;
-                            if (mouseButEv->x + te->panCursor <= 
-                                eBase->eSt.rLoc.x + rect.x + textW - charW/3)
-                            {
-                                /* cursor will be before this char */
-                                te->cursorPos = ctr - 1;
-                            }
-                            else
-                            {
-                                /* cursor will be after char */
-                                te->cursorPos = ctr;
-                            }
-
-                            /*------------------------------------------------*/
-                            /* Update the cursor Panning (if necessary)       */
-                            /*------------------------------------------------*/
-                            if (oldCursorPos > te->cursorPos)
-                            {
-                                neuik_TextEntry_UpdatePanCursor(te, 
-                                    CURSORPAN_MOVE_BACK);
-                            }
-                            else
-                            {
-                                neuik_TextEntry_UpdatePanCursor(te, 
-                                    CURSORPAN_MOVE_FORWARD);
-                            }
-                            break;
-                        }
-                        lastW = textW;
-                        if (aChar == '\0') break;
+                    /*--------------------------------------------------------*/
+                    /* Update the cursor Panning (if necessary)               */
+                    /*--------------------------------------------------------*/
+                    if (oldCursorPos > te->cursorPos)
+                    {
+                        neuik_TextEntry_UpdatePanCursor(te, CURSORPAN_MOVE_BACK);
+                    }
+                    else
+                    {
+                        neuik_TextEntry_UpdatePanCursor(te, CURSORPAN_MOVE_FORWARD);
                     }
-                    te->text[ctr] = aChar;
                     te->highlightBegin = -1; /* unhighlight text */
                 }
                 else
@@ -525,51 +499,28 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_MouseEvent(
                 if (te->textLen > 1)
                 {
                     oldCursorPos = te->cursorPos;
-                    for (ctr = 1;;ctr++)
+                    /*--------------------------------------------------------*/
+                    /* Look up the click position in the cached prefix widths */
+                    /*--------------------------------------------------------*/
+                    if (neuik_PrefixWidths_Update(te->textWidths, font, te->text))
                     {
-                        aChar = te->text[ctr];
-
-                        te->text[ctr] = '\0';
-                        TTF_SizeText(font, te->text, &textW, &textH);
-                        te->text[ctr] = aChar;
+                        eNum = 5;
+                        goto out;
+                    }
+                    te->cursorPos = neuik_PrefixWidths_HitTest(te->textWidths,
+                        mouseButEv->x + te->panCursor - (eBase->eSt.rLoc.x + rect.x));
 
-                        if (mouseButEv->x + te->panCursor <= 
-                            eBase->eSt.rLoc.x + rect.x + textW)
-                        {
-                            /* cursor will be before this char */
-                            te->cursorPos = ctr - 1;
-                            charW = textW - lastW;
-                            if (mouseButEv->x + te->panCursor <= 
-                                eBase->eSt.rLoc.x + rect.x + textW - charW/3)
-                            {
-                                /* cursor will be before this char */
-                                te->cursorPos = ctr - 1;
-                            }
-                            else
-                            {
-                                /* cursor will be after char */
-                                te->cursorPos = ctr;
-                            }
-
-                            /*------------------------------------------------*/
-                            /* Update the cursor Panning (if necessary)       */
-                            /*------------------------------------------------*/
-                            if (oldCursorPos > te->cursorPos)
-                            {
-                                neuik_TextEntry_UpdatePanCursor(te, 
-                                    CURSORPAN_MOVE_BACK);
-                            }
-                            else
-                            {
-                                neuik_TextEntry_UpdatePanCursor(te, 
-                                    CURSORPAN_MOVE_FORWARD);
-                            }
-                            break;
-                        }
-                        lastW = textW;
-                        if (aChar == '\0') break;
+                    /*--------------------------------------------------------*/
+                    /* Update the cursor Panning (if necessary)               */
+                    /*--------------------------------------------------------*/
+                    if (oldCursorPos > te->cursorPos)
+                    {
+                        neuik_TextEntry_UpdatePanCursor(te, CURSORPAN_MOVE_BACK);
+                    }
+                    else
+                    {
+                        neuik_TextEntry_UpdatePanCursor(te, CURSORPAN_MOVE_FORWARD);
                     }
-                    te->text[ctr] = aChar;
                 }
                 else
                 {
@@ -726,51 +677,28 @@ neuik_EventState neuik_Element_CaptureEvent__TextEntry_MouseEvent(
                 {
                     oldCursorPos = te->cursorPos;
 
-                    for (ctr = 1;;ctr++)
+                    /*--------------------------------------------------------*/
+                    /* Look up the click position in the cached prefix widths */
+                    /*--------------------------------------------------------*/
+                    if (neuik_PrefixWidths_Update(te->textWidths, font, te->text))
                     {
-                        aChar = te->text[ctr];
-
-                        te->text[ctr] = '\0';
-                        TTF_SizeText(font, te->text, &textW, &textH);
-                        te->text[ctr] = aChar;
+                        eNum = 5;
+                        goto out;
+                    }
+                    te->cursorPos = neuik_PrefixWidths_HitTest(te->textWidths,
+                        mouseMotEv->x + te->panCursor - (eBase->eSt.rLoc.x + rect.x));
 
-                        if (mouseMotEv->x + te->panCursor <= 
-                            eBase->eSt.rLoc.x + rect.x + textW)
-                        {
-                            /* cursor will be before this char */
-                            te->cursorPos = ctr - 1;
-                            charW = textW - lastW;
-                            if (mouseMotEv->x + te->panCursor <= 
-                                eBase->eSt.rLoc.x + rect.x + textW - charW/3)
-                            {
-                                /* cursor will be before this char */
-                                te->cursorPos = ctr - 1;
-                            }
-                            else
-                            {
-                                /* cursor will be after char */
-                                te->cursorPos = ctr;
-                            }
-
-                            /*--------------------------------------------*/
-                            /* Update the cursor Panning (if necessary)   */
-                            /*--------------------------------------------*/
-                            if (oldCursorPos > te->cursorPos)
-                            {
-                                neuik_TextEntry_UpdatePanCursor(te, 
-                                    CURSORPAN_MOVE_BACK);
-                            }
-                            else
-                            {
-                                neuik_TextEntry_UpdatePanCursor(te, 
-                                    CURSORPAN_MOVE_FORWARD);
-                            }
-                            break;
-                        }
-                        lastW = textW;
-                        if (aChar == '\0') break;
+                    /*--------------------------------------------------------*/
+                    /* Update the cursor Panning (if necessary)               */
+                    /*--------------------------------------------------------*/
+                    if (oldCursorPos > te->cursorPos)
+                    {
+                        neuik_TextEntry_UpdatePanCursor(te, CURSORPAN_MOVE_BACK);
+                    }
+                    else
+                    {
+                        neuik_TextEntry_UpdatePanCursor(te, CURSORPAN_MOVE_FORWARD);
                     }
-                    te->text[ctr] = aChar;
                     te->highlightBegin = -1; /* unhighlight text */
                 }
                 else
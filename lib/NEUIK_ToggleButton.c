@@ -108,6 +108,7 @@ int neuik_RegisterClass_ToggleButton()
         "A GUI toggle button which may contain text.", // classDescription
         neuik__Set_NEUIK,                              // classSet
         neuik__Class_Element,                          // superClass
+        sizeof(NEUIK_ToggleButton),                    // objSize
         &neuik_ToggleButton_BaseFuncs,                 // baseFuncs
         NULL,                                          // classFuncs
         &neuik__Class_ToggleButton))                   // newClass
@@ -158,7 +159,8 @@ int neuik_Object_New__ToggleButton(
         goto out;
     }
 
-    (*btnPtr) = (NEUIK_ToggleButton*) malloc(sizeof(NEUIK_ToggleButton));
+    (*btnPtr) = (NEUIK_ToggleButton*) neuik_Object_Alloc(
+        neuik__Class_ToggleButton, (void**)btnPtr);
     btn = *btnPtr;
     if (btn == NULL)
     {
@@ -298,7 +300,7 @@ int neuik_Object_Free__ToggleButton(
         goto out;
     }
 
-    free(btn);
+    neuik_Object_Release(btn);
 out:
     if (eNum > 0)
     {
@@ -1311,7 +1313,7 @@ out:
         if (!mock) eBase->eSt.doRedraw = 0;
     }
 
-    ConditionallyDestroyTexture(&tTex);
+    neuik_TexturePool_Release(rend, &tTex);
     if (maskMap != NULL) neuik_Object_Free(maskMap);
 
     if (eNum > 0)
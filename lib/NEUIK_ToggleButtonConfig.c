@@ -80,6 +80,7 @@ int neuik_RegisterClass_ToggleButtonConfig()
         "Configuration for the ToggleButton Object.", // classDescription
         neuik__Set_NEUIK,                             // classSet
         NULL,                                         // superClass
+        sizeof(NEUIK_ToggleButtonConfig),             // objSize
         &neuik_ToggleButtonConfig_BaseFuncs,          // baseFuncs
         NULL,                                         // classFuncs
         &neuik__Class_ToggleButtonConfig))            // newClass
@@ -228,7 +229,8 @@ int NEUIK_NewToggleButtonConfig(
         goto out;
     }
 
-    (*cfgPtr) = (NEUIK_ToggleButtonConfig*) malloc(sizeof(NEUIK_ToggleButtonConfig));
+    (*cfgPtr) = (NEUIK_ToggleButtonConfig*) neuik_Object_Alloc(
+        neuik__Class_ToggleButtonConfig, (void**)cfgPtr);
     cfg = (*cfgPtr);
     if (cfg == NULL)
     {
@@ -387,7 +389,7 @@ int neuik_Object_Free__ToggleButtonConfig(
     /*------------------------------------------------------------------------*/
     if (cfg->fontName != NULL) free(cfg->fontName);
 
-    free(cfg);
+    neuik_Object_Release(cfg);
 out:
     if (eNum > 0)
     {
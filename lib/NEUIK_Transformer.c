@@ -109,6 +109,7 @@ int neuik_RegisterClass_Transformer()
         "rotate and/or scale its contained element.", // classDescription
         neuik__Set_NEUIK,                             // classSet
         neuik__Class_Container,                       // superClass
+        sizeof(NEUIK_Transformer),                    // objSize
         &neuik_Transformer_BaseFuncs,                 // baseFuncs
         NULL,                                         // classFuncs
         &neuik__Class_Transformer))                   // newClass
@@ -159,7 +160,8 @@ int neuik_Object_New__Transformer(
         eNum = 1;
         goto out;
     }
-    (*tPtr) = (NEUIK_Transformer*) malloc(sizeof(NEUIK_Transformer));
+    (*tPtr) = (NEUIK_Transformer*) neuik_Object_Alloc(
+        neuik__Class_Transformer, (void**)tPtr);
     trans = *tPtr;
     if (trans == NULL)
     {
@@ -277,7 +279,7 @@ int neuik_Object_Free__Transformer(
         goto out;
     }
 
-    free(trans);
+    neuik_Object_Release(trans);
 out:
     if (eNum > 0)
     {
@@ -1080,6 +1082,20 @@ int neuik_Element_Render__Transformer(
 
     if (neuik_Element_NeedsRedraw(elem))
     {
+        if (!mock && SDL_RenderTargetSupported(xRend))
+        {
+            /*----------------------------------------------------------------*/
+            /* The rotated element can be drawn directly using the external   */
+            /* renderer; its unrotated render is cached as a texture.         */
+            /*----------------------------------------------------------------*/
+            if (neuik_Element_RenderRotate(
+                    elem, &rsOrig, rlMod, xRend, mock, trans->rotation))
+            {
+                eNum = 7;
+            }
+            goto out;
+        }
+
         /*--------------------------------------------------------------------*/
         /* Check to see if the requested draw size of the element has changed */
         /*--------------------------------------------------------------------*/
@@ -1107,7 +1123,7 @@ int neuik_Element_Render__Transformer(
         }
         SDL_RenderPresent(rend);
 
-        tex = SDL_CreateTextureFromSurface(xRend, surf);
+        tex = neuik_CreateTextureFromSurface(xRend, surf);
         if (tex == NULL)
         {
             eNum = 8;
@@ -0,0 +1,364 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#include <SDL.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "NEUIK_error.h"
+#include "NEUIK_UIQueue.h"
+#include "NEUIK_UIQueue_internal.h"
+
+/*----------------------------------------------------------------------------*/
+/* Typedef(s)                                                                 */
+/*----------------------------------------------------------------------------*/
+typedef struct neuik_UIUpdate neuik_UIUpdate;
+
+struct neuik_UIUpdate {
+    neuik_UIUpdate    * next;
+    NEUIK_UIUpdateFn    fn;      /* NULL once superseded by a newer update */
+    void              * elem;
+    int                 key;
+    void              * arg;
+    void             (* freeArg)(void *);
+};
+
+/*----------------------------------------------------------------------------*/
+/* Pending updates are kept as an intrusive stack (most recent first) which   */
+/* producers push onto with a compare-and-swap. The UI thread is the only     */
+/* consumer and always takes the entire stack at once, so the ABA problem of  */
+/* a general lock-free stack cannot occur.                                    */
+/*----------------------------------------------------------------------------*/
+Uint32               neuik__UIQueue_EventType = (Uint32)-1;
+static void        * neuik_UIQueue_Head       = NULL;
+static SDL_atomic_t  neuik_UIQueue_WakePending;
+
+/*----------------------------------------------------------------------------*/
+/* The error stack may only be used from the thread which runs the event loop */
+/* (the thread which initialized NEUIK).                                      */
+/*----------------------------------------------------------------------------*/
+static SDL_threadID  neuik_UIQueue_UIThread   = 0;
+
+/*----------------------------------------------------------------------------*/
+/* Scratch hash table used (by the UI thread only) for coalescing.            */
+/*----------------------------------------------------------------------------*/
+static neuik_UIUpdate ** neuik_UIQueue_Table    = NULL;
+static size_t            neuik_UIQueue_TableCap = 0;
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_UIQueue_Init
+ *
+ *  Description:   Register the SDL user event which is used to wake the event
+ *                 loop when updates are posted from another thread.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_UIQueue_Init()
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "neuik_UIQueue_Init";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Failed to register SDL user event.", // [1]
+    };
+
+    neuik_UIQueue_UIThread = SDL_ThreadID();
+    if (neuik__UIQueue_EventType != (Uint32)-1) goto out;
+
+    neuik__UIQueue_EventType = SDL_RegisterEvents(1);
+    if (neuik__UIQueue_EventType == (Uint32)-1)
+    {
+        eNum = 1;
+        goto out;
+    }
+    SDL_AtomicSet(&neuik_UIQueue_WakePending, 0);
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_PostToUIThread
+ *
+ *  Description:   Queue an update to be applied by the thread running the
+ *                 event loop. This function may be called from any thread.
+ *
+ *                 If an update for the same (elem, key) pair is still pending
+ *                 when the queue is drained, only the most recent one is
+ *                 applied. Pass NEUIK_UIUPDATE_NO_COALESCE as the key for
+ *                 updates which must all be applied.
+ *
+ *                 `freeArg` (if non-NULL) is called on `arg` once the update
+ *                 has been applied or superseded.
+ *
+ *                 Errors are only raised when this is called from the UI 
+ *                 thread; other threads must rely upon the return value.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_PostToUIThread(
+    NEUIK_UIUpdateFn   fn,
+    void             * elem,
+    int                key,
+    void             * arg,
+    void            (* freeArg)(void *))
+{
+    int              eNum       = 0; /* which error to report (if any) */
+    neuik_UIUpdate * upd        = NULL;
+    void           * head       = NULL;
+    SDL_Event        ev;
+    static char      funcName[] = "NEUIK_PostToUIThread";
+    static char    * errMsgs[]  = {"", // [0] no error
+        "Argument `fn` is NULL.",                      // [1]
+        "Failure to allocate memory.",                 // [2]
+        "Failed to push wake-up event to SDL queue.",  // [3]
+    };
+
+    if (fn == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    upd = (neuik_UIUpdate *)malloc(sizeof(neuik_UIUpdate));
+    if (upd == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    upd->fn      = fn;
+    upd->elem    = elem;
+    upd->key     = key;
+    upd->arg     = arg;
+    upd->freeArg = freeArg;
+
+    do
+    {
+        head      = SDL_AtomicGetPtr(&neuik_UIQueue_Head);
+        upd->next = (neuik_UIUpdate *)head;
+    } while (!SDL_AtomicCASPtr(&neuik_UIQueue_Head, head, upd));
+
+    /*------------------------------------------------------------------------*/
+    /* Only the first update posted after a drain wakes the event loop; any   */
+    /* others are picked up by that same drain.                               */
+    /*------------------------------------------------------------------------*/
+    if (neuik__UIQueue_EventType != (Uint32)-1 &&
+        SDL_AtomicCAS(&neuik_UIQueue_WakePending, 0, 1))
+    {
+        memset(&ev, 0, sizeof(SDL_Event));
+        ev.type = neuik__UIQueue_EventType;
+        if (SDL_PushEvent(&ev) < 0)
+        {
+            SDL_AtomicSet(&neuik_UIQueue_WakePending, 0);
+            eNum = 3;
+            goto out;
+        }
+    }
+out:
+    if (eNum > 0)
+    {
+        if (SDL_ThreadID() == neuik_UIQueue_UIThread)
+        {
+            NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        }
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_UIQueue_TakeAll
+ *
+ *  Description:   Atomically take all of the pending updates and return them
+ *                 in the order in which they were posted. Superseded updates
+ *                 are left in the list with their `fn` set to NULL.
+ *
+ *  Returns:       The oldest pending update (or NULL if there are none).
+ *
+ ******************************************************************************/
+static neuik_UIUpdate * neuik_UIQueue_TakeAll()
+{
+    size_t            nUpd  = 0;
+    size_t            cap   = 0;
+    size_t            mask  = 0;
+    size_t            hash  = 0;
+    neuik_UIUpdate  * upd   = NULL;
+    neuik_UIUpdate  * nxt   = NULL;
+    neuik_UIUpdate  * fifo  = NULL;
+    neuik_UIUpdate ** table = NULL;
+
+    SDL_AtomicSet(&neuik_UIQueue_WakePending, 0);
+    upd = (neuik_UIUpdate *)SDL_AtomicSetPtr(&neuik_UIQueue_Head, NULL);
+    if (upd == NULL) return NULL;
+
+    for (nxt = upd; nxt != NULL; nxt = nxt->next) nUpd++;
+
+    /*------------------------------------------------------------------------*/
+    /* Size the (reused) open addressing table to at least twice the number  */
+    /* of pending updates. If it can't be grown, just skip coalescing.        */
+    /*------------------------------------------------------------------------*/
+    for (cap = 64; cap < 2*nUpd; cap *= 2);
+    if (cap > neuik_UIQueue_TableCap)
+    {
+        table = (neuik_UIUpdate **)realloc(
+            neuik_UIQueue_Table, cap*sizeof(neuik_UIUpdate *));
+        if (table != NULL)
+        {
+            neuik_UIQueue_Table    = table;
+            neuik_UIQueue_TableCap = cap;
+        }
+    }
+    table = NULL;
+    if (neuik_UIQueue_Table != NULL && cap <= neuik_UIQueue_TableCap)
+    {
+        table = neuik_UIQueue_Table;
+        memset(table, 0, cap*sizeof(neuik_UIUpdate *));
+    }
+    mask = cap - 1;
+
+    /*------------------------------------------------------------------------*/
+    /* Walk from newest to oldest; the first update seen for a given          */
+    /* (elem, key) wins and older ones are marked as superseded. Reverse the  */
+    /* list into posting order along the way.                                 */
+    /*------------------------------------------------------------------------*/
+    while (upd != NULL)
+    {
+        nxt = upd->next;
+
+        if (table != NULL && upd->key != NEUIK_UIUPDATE_NO_COALESCE)
+        {
+            hash = ((size_t)((uintptr_t)upd->elem >> 4) ^
+                ((size_t)(unsigned int)upd->key * 2654435761u)) & mask;
+            for (;;)
+            {
+                if (table[hash] == NULL)
+                {
+                    table[hash] = upd;
+                    break;
+                }
+                if (table[hash]->elem == upd->elem &&
+                    table[hash]->key == upd->key)
+                {
+                    upd->fn = NULL;
+                    break;
+                }
+                hash = (hash + 1) & mask;
+            }
+        }
+
+        upd->next = fifo;
+        fifo      = upd;
+        upd       = nxt;
+    }
+
+    return fifo;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_UIQueue_Drain
+ *
+ *  Description:   Apply all of the pending (non-superseded) updates in the
+ *                 order in which they were posted. This must only be called
+ *                 from the thread running the event loop.
+ *
+ *  Returns:       1 if any of the updates reported an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_UIQueue_Drain()
+{
+    int              eNum       = 0; /* which error to report (if any) */
+    neuik_UIUpdate * upd        = NULL;
+    neuik_UIUpdate * nxt        = NULL;
+    static char      funcName[] = "neuik_UIQueue_Drain";
+    static char    * errMsgs[]  = {"", // [0] no error
+        "A posted UI update reported an error.", // [1]
+    };
+
+    for (upd = neuik_UIQueue_TakeAll(); upd != NULL; upd = nxt)
+    {
+        nxt = upd->next;
+        if (upd->fn != NULL)
+        {
+            if (upd->fn(upd->elem, upd->arg))
+            {
+                eNum = 1;
+            }
+        }
+        if (upd->freeArg != NULL)
+        {
+            upd->freeArg(upd->arg);
+        }
+        free(upd);
+    }
+
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_UIQueue_Discard
+ *
+ *  Description:   Free all of the pending updates without applying them.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+void neuik_UIQueue_Discard()
+{
+    neuik_UIUpdate * upd = NULL;
+    neuik_UIUpdate * nxt = NULL;
+
+    upd = (neuik_UIUpdate *)SDL_AtomicSetPtr(&neuik_UIQueue_Head, NULL);
+    for (; upd != NULL; upd = nxt)
+    {
+        nxt = upd->next;
+        if (upd->freeArg != NULL)
+        {
+            upd->freeArg(upd->arg);
+        }
+        free(upd);
+    }
+    SDL_AtomicSet(&neuik_UIQueue_WakePending, 0);
+
+    if (neuik_UIQueue_Table != NULL)
+    {
+        free(neuik_UIQueue_Table);
+        neuik_UIQueue_Table    = NULL;
+        neuik_UIQueue_TableCap = 0;
+    }
+}
@@ -105,6 +105,7 @@ int neuik_RegisterClass_VGroup()
         "An element container which vertically groups items.", // classDescription
         neuik__Set_NEUIK,                                      // classSet
         neuik__Class_Container,                                // superClass
+        sizeof(NEUIK_VGroup),                                  // objSize
         &neuik_VGroup_BaseFuncs,                               // baseFuncs
         NULL,                                                  // classFuncs
         &neuik__Class_VGroup))                                 // newClass
@@ -155,7 +156,8 @@ int neuik_Object_New__VGroup(
         eNum = 1;
         goto out;
     }
-    (*vgPtr) = (NEUIK_VGroup*) malloc(sizeof(NEUIK_VGroup));
+    (*vgPtr) = (NEUIK_VGroup*) neuik_Object_Alloc(
+        neuik__Class_VGroup, (void**)vgPtr);
     vg = *vgPtr;
     if (vg == NULL)
     {
@@ -293,7 +295,7 @@ int neuik_Object_Free__VGroup(
         goto out;
     }
 
-    free(vg);
+    neuik_Object_Release(vg);
 out:
     if (eNum > 0)
     {
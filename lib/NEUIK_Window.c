@@ -16,6 +16,8 @@
 #include <SDL.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
+#include <math.h>
 #include <stdio.h>
 #include <signal.h>
 
@@ -24,6 +26,7 @@
 #include "NEUIK_Window_internal.h"
 #include "NEUIK_WindowConfig.h"
 #include "NEUIK_render.h"
+#include "NEUIK_Profile_internal.h"
 #include "NEUIK_error.h"
 #include "NEUIK_Event_internal.h"
 #include "NEUIK_Element.h"
@@ -36,6 +39,14 @@ extern int neuik__isInitialized;
 extern int neuik__Report_Debug;
 extern int neuik__Report_Frametime;
 extern float neuik__HighDPI_Scaling;
+extern float neuik__HighDPI_Override;
+extern int   neuik__HighDPI_Detect;
+
+/* display DPI which corresponds to a scale of 1.0 */
+#define NEUIK_WINDOW_REFERENCE_DPI 96.0
+
+/* fraction of a frame interval by which a frame may overrun and not be late */
+#define NEUIK_FRAME_TOLERANCE 0.05
 
 /*----------------------------------------------------------------------------*/
 /* Internal Function Prototypes                                               */
@@ -43,6 +54,7 @@ extern float neuik__HighDPI_Scaling;
 int neuik_Object_New__Window(void ** wPtr);
 // int neuik_Object_Copy__Window(void * dst, const void * src);
 int neuik_Object_Free__Window(void * wPtr);
+static float neuik_Window_DetectScale(NEUIK_Window * w, int dispIdx);
 
 /*----------------------------------------------------------------------------*/
 /* neuik_Object    Function Table                                             */
@@ -91,6 +103,7 @@ int neuik_RegisterClass_Window()
         "The NEUIK_Window Object.", // classDescription
         neuik__Set_NEUIK,           // classSet
         NULL,                       // superClass
+        sizeof(NEUIK_Window),       // objSize
         &neuik_Window_BaseFuncs,    // baseFuncs
         NULL,                       // classFuncs
         &neuik__Class_Window))      // newClass
@@ -154,7 +167,8 @@ int NEUIK_NewWindow(
         goto out;
     }
 
-    (*wPtr) = (NEUIK_Window*) malloc(sizeof(NEUIK_Window));
+    (*wPtr) = (NEUIK_Window*) neuik_Object_Alloc(
+        neuik__Class_Window, (void**)wPtr);
     w = (*wPtr);
     if (w == NULL)
     {
@@ -185,13 +199,25 @@ int NEUIK_NewWindow(
     w->redrawAll   = TRUE;
     w->posX        = UNDEFINED;
     w->posY        = UNDEFINED;
-    w->sizeW       = (int)(320.0*neuik__HighDPI_Scaling);
-    w->sizeH       = (int)(320.0*neuik__HighDPI_Scaling);
+    w->scale       = 1.0;
+    w->scaleFixed  = FALSE;
+    if (neuik__HighDPI_Override > 0.0) w->scale = neuik__HighDPI_Override;
+    w->sizeW       = (int)(320.0*w->scale);
+    w->sizeH       = (int)(320.0*w->scale);
     w->shown       = TRUE;
     w->updateTitle = FALSE;
     w->updateIcon  = FALSE;
     w->doRedraw    = TRUE;
 
+    /* frame pacing */
+    w->frameNext       = 0.0;
+    w->framesPresented = 0;
+    w->framesDropped   = 0;
+    w->framesLate      = 0;
+    w->elemsDrawn      = 0;
+    w->elemsCulled     = 0;
+    w->clipDepth       = 0;
+
     w->eHT = NEUIK_NewEventHandlerTable();
     w->eCT = NEUIK_NewCallbackTable();
 
@@ -252,6 +278,7 @@ int NEUIK_Window_Configure(
     int                   isBool;
     int                   boolVal   = 0;
     int                   typeMixup;
+    int                   targetFPS;
     char                  buf[4096];
     va_list               args;
     char                * strPtr    = NULL;
@@ -270,6 +297,8 @@ int NEUIK_Window_Configure(
         "Resizable",
         "Minimize",
         "Maximize",
+        "VSync",
+        "DetectScale",
         NULL,
     };
     /*------------------------------------------------------------------------*/
@@ -284,6 +313,7 @@ int NEUIK_Window_Configure(
         "CanResize",
         "CanResizeW",
         "CanResizeH",
+        "TargetFPS",
         NULL,
     };
     static char           funcName[] = "NEUIK_Window_Configure";
@@ -310,6 +340,8 @@ int NEUIK_Window_Configure(
         "BGColor value invalid; should be comma separated RGBA.", // [20]
         "BGColor value invalid; RGBA value range is 0-255.",      // [21]
         "Failure in `neuik_Window_RequestFullRedraw()`.",         // [22]
+        "TargetFPS value invalid; should be an integer >= 0.",    // [23]
+        "Failure in `neuik_Window_UpdateScale()`.",               // [24]
     };
 
     if (!neuik_Object_IsClass(w, neuik__Class_Window))
@@ -507,6 +539,40 @@ int NEUIK_Window_Configure(
                     }
                 }
             }
+            else if (!strcmp("VSync", name))
+            {
+                if (wCfg->isVSync == boolVal) continue;
+
+                /* The previous setting was changed */
+                wCfg->isVSync = boolVal;
+
+                /*------------------------------------------------------------*/
+                /* If the window is currently being shown, the renderer must  */
+                /* be updated (or recreated when that isn't supported).       */
+                /*------------------------------------------------------------*/
+                if (w->shown && w->win != NULL)
+                {
+                    #if SDL_VERSION_ATLEAST(2, 0, 18)
+                        if (SDL_RenderSetVSync(w->rend, boolVal) == 0) continue;
+                    #endif
+                    NEUIK_Window_Recreate(w);
+                }
+            }
+            else if (!strcmp("DetectScale", name))
+            {
+                if (wCfg->detectScale == boolVal) continue;
+
+                /* The previous setting was changed */
+                wCfg->detectScale = boolVal;
+
+                /*------------------------------------------------------------*/
+                /* If the window is currently being shown, rescale it now.    */
+                /*------------------------------------------------------------*/
+                if (w->win != NULL && neuik_Window_UpdateScale(w))
+                {
+                    NEUIK_RaiseError(funcName, errMsgs[24]);
+                }
+            }
             else
             {
                 typeMixup = 0;
@@ -716,6 +782,20 @@ int NEUIK_Window_Configure(
                     NEUIK_RaiseError(funcName, errMsgs[12]);
                 }
             }
+            else if (!strcmp("TargetFPS", name))
+            {
+                /*------------------------------------------------------------*/
+                /* A value of zero paces frames to the display refresh rate.  */
+                /*------------------------------------------------------------*/
+                ns = sscanf(value, "%d", &targetFPS);
+                if (ns == EOF || ns < 1 || targetFPS < 0)
+                {
+                    NEUIK_RaiseError(funcName, errMsgs[23]);
+                    continue;
+                }
+                wCfg->targetFPS = targetFPS;
+                w->frameNext    = 0.0;
+            }
             else
             {
                 typeMixup = 0;
@@ -798,6 +878,7 @@ int NEUIK_Window_Free(
     /*------------------------------------------------------------------------*/
     if (w->rend != NULL) 
     {
+        neuik_DropRendererTextures(w->rend);
         SDL_DestroyRenderer(w->rend);
     }
     if (w->win != NULL) 
@@ -821,7 +902,7 @@ int NEUIK_Window_Free(
         neuik_Object_Free(w->cfg);
     }
 
-    free(w);
+    neuik_Object_Release(w);
 out:
     if (eNum > 0)
     {
@@ -958,6 +1039,7 @@ int NEUIK_Window_Recreate(
     int                   oldX;          /* when recreated, use this window placement */
     int                   oldY;          /* when recreated, use this window placement */
     Uint32                winFlags   = 0;
+    Uint32                rendFlags  = SDL_RENDERER_ACCELERATED;
     NEUIK_WindowConfig  * wCfg       = NULL;
     static char           funcName[] = "NEUIK_Window_Recreate";
     static char         * errMsgs[]  = {"", // [0] no error
@@ -980,11 +1062,13 @@ int NEUIK_Window_Recreate(
     if (w->shown)           winFlags |= SDL_WINDOW_SHOWN;
     if (wCfg->isResizable)  winFlags |= SDL_WINDOW_RESIZABLE;
     if (wCfg->isBorderless) winFlags |= SDL_WINDOW_BORDERLESS;
+    if (wCfg->isVSync)      rendFlags |= SDL_RENDERER_PRESENTVSYNC;
 
     /*------------------------------------------------------------------------*/
     /* Destroy the old window                                                 */
     /*------------------------------------------------------------------------*/
     SDL_GetWindowPosition(w->win, &oldX, &oldY);
+    neuik_DropRendererTextures(w->rend); /* destroyed along with the window */
     SDL_DestroyWindow(w->win);
 
     /*------------------------------------------------------------------------*/
@@ -1012,7 +1096,18 @@ int NEUIK_Window_Recreate(
     w->rend = SDL_CreateRenderer(
         w->win, 
         -1, 
-        SDL_RENDERER_ACCELERATED);
+        rendFlags);
+    if (w->rend == NULL)
+    {
+        /*--------------------------------------------------------------------*/
+        /* No accelerated renderer is available (e.g. a headless machine      */
+        /* using the `dummy` video driver); fall back to software rendering.  */
+        /*--------------------------------------------------------------------*/
+        rendFlags &= ~SDL_RENDERER_ACCELERATED;
+        w->rend = SDL_CreateRenderer(w->win, -1, 
+            rendFlags | SDL_RENDERER_SOFTWARE);
+    }
+    w->frameNext = 0.0;
     if (w->rend == NULL)
     {
         NEUIK_RaiseError(funcName, SDL_GetError());
@@ -1055,7 +1150,10 @@ int NEUIK_Window_Create(
     int                   availH;       /* available element height */
     int                   doResize   = 0;
     int                   eNum       = 0;
+    float                 scale      = 1.0;
+    float                 prevScale  = neuik__HighDPI_Scaling;
     Uint32                winFlags   = 0;
+    Uint32                rendFlags  = SDL_RENDERER_ACCELERATED;
     RenderSize            rSize      = {0, 0};
     SDL_Rect              dispBnds;
     NEUIK_WindowConfig  * wCfg       = NULL;
@@ -1071,6 +1169,7 @@ int NEUIK_Window_Create(
         "SDL_GetDisplayBounds() failed.",                                     // [7]
         "Aborting... Errors were already present before attempted creation.", // [8]
         "Failure in `neuik_MakeMaskMap()`",                                   // [9]
+        "Failure in `neuik_Window_UpdateScale()`.",                           // [10]
     };
 
     if (NEUIK_HasErrors())
@@ -1091,6 +1190,7 @@ int NEUIK_Window_Create(
     if (wCfg->isBorderless) winFlags |= SDL_WINDOW_BORDERLESS;
     if (wCfg->isMinimized)  winFlags |= SDL_WINDOW_MINIMIZED;
     if (wCfg->isMaximized)  winFlags |= SDL_WINDOW_MAXIMIZED;
+    if (wCfg->isVSync)      rendFlags |= SDL_RENDERER_PRESENTVSYNC;
 
     if (SDL_GetDisplayBounds(0, &dispBnds) != 0)
     {
@@ -1098,6 +1198,21 @@ int NEUIK_Window_Create(
         goto out;
     }
 
+    /*------------------------------------------------------------------------*/
+    /* Size the contents using the scale of the display the window opens on.  */
+    /*------------------------------------------------------------------------*/
+    if (!w->scaleFixed)
+    {
+        scale = neuik_Window_DetectScale(w, 0);
+        if (scale != w->scale)
+        {
+            w->sizeW = (int)((float)(w->sizeW)*scale/w->scale + 0.5);
+            w->sizeH = (int)((float)(w->sizeH)*scale/w->scale + 0.5);
+            w->scale = scale;
+        }
+    }
+    neuik_Window_MakeScaleCurrent(w);
+
     /*------------------------------------------------------------------------*/
     /* Perform initial calculations to determine the required size of the     */
     /* window                                                                 */
@@ -1199,7 +1314,18 @@ int NEUIK_Window_Create(
     w->rend = SDL_CreateRenderer(
         w->win, 
         -1, 
-        SDL_RENDERER_ACCELERATED);
+        rendFlags);
+    if (w->rend == NULL)
+    {
+        /*--------------------------------------------------------------------*/
+        /* No accelerated renderer is available (e.g. a headless machine      */
+        /* using the `dummy` video driver); fall back to software rendering.  */
+        /*--------------------------------------------------------------------*/
+        rendFlags &= ~SDL_RENDERER_ACCELERATED;
+        w->rend = SDL_CreateRenderer(w->win, -1, 
+            rendFlags | SDL_RENDERER_SOFTWARE);
+    }
+    w->frameNext = 0.0;
     if (w->rend == NULL)
     {
         NEUIK_RaiseError(funcName, SDL_GetError());
@@ -1239,6 +1365,15 @@ int NEUIK_Window_Create(
         neuik_Element_SetWindowPointer(w->elem, w);
     }
 
+    /*------------------------------------------------------------------------*/
+    /* The window may have been placed on a display other than the primary.   */
+    /*------------------------------------------------------------------------*/
+    if (neuik_Window_UpdateScale(w))
+    {
+        eNum = 10;
+        goto out;
+    }
+    neuik_Window_MakeScaleCurrent(w);
 
     /*------------------------------------------------------------------------*/
     /* Register the window for event handling purposes                        */
@@ -1258,6 +1393,7 @@ int NEUIK_Window_Create(
 
     NEUIK_Window_TriggerCallback(w, NEUIK_CALLBACK_ON_CREATED);
 out:
+    neuik__HighDPI_Scaling = prevScale;
     if (eNum > 0)
     {
         NEUIK_RaiseError(funcName, errMsgs[eNum]);
@@ -1293,6 +1429,7 @@ int NEUIK_Window_CaptureEvent(
     int                   newW       = 0; /* new window width (px) */
     int                   newH       = 0; /* new window height (px) */
     Uint32                sdlWinID   = 0;
+    float                 prevScale  = neuik__HighDPI_Scaling;
     SDL_Event           * e          = NULL;
     SDL_KeyboardEvent   * keyEv      = NULL;
     NEUIK_WindowConfig  * wCfg       = NULL;
@@ -1326,6 +1463,7 @@ int NEUIK_Window_CaptureEvent(
         /* This event targets a different window... */
         goto out;
     }
+    neuik_Window_MakeScaleCurrent(w);
 
     if (e->type == SDL_WINDOWEVENT)
     {
@@ -1370,7 +1508,17 @@ int NEUIK_Window_CaptureEvent(
 
             case SDL_WINDOWEVENT_MOVED:
                 SDL_GetWindowPosition(w->win, &(w->posX), &(w->posY));
+                /* The window may have moved onto a display of another DPI */
+                neuik_Window_UpdateScale(w);
+                neuik_Window_MakeScaleCurrent(w);
+                break;
+
+            #if SDL_VERSION_ATLEAST(2, 0, 18)
+            case SDL_WINDOWEVENT_DISPLAY_CHANGED:
+                neuik_Window_UpdateScale(w);
+                neuik_Window_MakeScaleCurrent(w);
                 break;
+            #endif
         }
     }
 
@@ -1452,6 +1600,7 @@ int NEUIK_Window_CaptureEvent(
     }
     if (evCaputred) goto out;
 out:
+    neuik__HighDPI_Scaling = prevScale;
     return evCaputred;
 }
 
@@ -1706,6 +1855,275 @@ out:
 }
 
 
+/*----------------------------------------------------------------------------*/
+/* The time (ms) between presented frames; uses the configured `TargetFPS` or */
+/* the refresh rate of the display containing the window.                     */
+/*----------------------------------------------------------------------------*/
+static double neuik_Window_GetFrameInterval(
+    NEUIK_Window * w)
+{
+    int                  refresh = 60; /* used if the rate is not reported */
+    NEUIK_WindowConfig * aCfg    = NULL;
+    SDL_DisplayMode      mode;
+
+    aCfg = neuik_Window_GetConfig(w);
+    if (aCfg != NULL && aCfg->targetFPS > 0)
+    {
+        return 1000.0/(double)(aCfg->targetFPS);
+    }
+
+    if (w->win != NULL && SDL_GetWindowDisplayMode(w->win, &mode) == 0)
+    {
+        if (mode.refresh_rate > 0) refresh = mode.refresh_rate;
+    }
+    return 1000.0/(double)(refresh);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* The current time (ms) for frame pacing. SDL_GetTicks() only has whole      */
+/* millisecond resolution, which is too coarse to compare against fractional  */
+/* intervals (e.g., 16.67 ms at 60 Hz).                                       */
+/*----------------------------------------------------------------------------*/
+static double neuik_Window_FrameClock()
+{
+    return 1000.0*(double)(SDL_GetPerformanceCounter())/
+        (double)(SDL_GetPerformanceFrequency());
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Update the frame counters and schedule the earliest next present.          */
+/*----------------------------------------------------------------------------*/
+static void neuik_Window_EndFrame(
+    NEUIK_Window * w,
+    double         frameStart)
+{
+    double interval;
+    double elapsed;
+    double frameEnd;
+    double missed;
+
+    interval = neuik_Window_GetFrameInterval(w);
+    frameEnd = neuik_Window_FrameClock();
+    elapsed  = frameEnd - frameStart;
+
+    /*------------------------------------------------------------------------*/
+    /* A frame only counts as late once it overruns its interval by more than */
+    /* the scheduling jitter; it then caused one stale refresh for each whole */
+    /* interval it spanned.                                                   */
+    /*------------------------------------------------------------------------*/
+    w->framesPresented++;
+    missed = floor((elapsed - NEUIK_FRAME_TOLERANCE*interval)/interval);
+    if (missed >= 1.0)
+    {
+        w->framesLate++;
+        w->framesDropped += (unsigned int)(missed);
+    }
+
+    w->frameNext = frameStart + interval;
+    if (w->frameNext < frameEnd) w->frameNext = frameEnd;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Window_FrameIsDue
+ *
+ *  Description:   Returns whether or not a pending redraw of the window may be
+ *                 presented now. Any number of redraw requests made before the
+ *                 frame is due are coalesced into a single present.
+ *
+ *                 If the frame is not yet due, `waitMs` is lowered (if needed)
+ *                 to the number of milliseconds until it will be.
+ *
+ *  Returns:       1 if the frame is due, 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_Window_FrameIsDue(
+    NEUIK_Window * w,
+    unsigned int * waitMs)
+{
+    double now;
+    double remaining;
+
+    if (!w->doRedraw) return 0;
+
+    now = neuik_Window_FrameClock();
+    if (now >= w->frameNext) return 1;
+
+    remaining = w->frameNext - now;
+    if (waitMs != NULL && remaining < (double)(*waitMs))
+    {
+        *waitMs = (unsigned int)(remaining) + 1;
+    }
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Window_ResetClip
+ *
+ *  Description:   Prepare the clip-rectangle stack for a new frame; the stack 
+ *                 is left holding only the full area of the window. The 
+ *                 drawn/culled element counters are also cleared.
+ *
+ ******************************************************************************/
+void neuik_Window_ResetClip(
+    NEUIK_Window * w)
+{
+    w->clipStack[0].x = 0;
+    w->clipStack[0].y = 0;
+    w->clipStack[0].w = w->sizeW;
+    w->clipStack[0].h = w->sizeH;
+    w->clipDepth      = 1;
+    w->elemsDrawn     = 0;
+    w->elemsCulled    = 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Window_PushClip
+ *
+ *  Description:   Push the visible portion of a region (in window coordinates)
+ *                 on to the clip-rectangle stack; the new top of the stack is 
+ *                 the intersection of the region and the current top.
+ *
+ *                 If `rLoc` or `rSize` is NULL, an unbounded region is pushed;
+ *                 this suspends culling for content which is rendered into a 
+ *                 retained texture (and may be shown later at another spot).
+ *
+ *                 Every push must be matched by a `neuik_Window_PopClip()`.
+ *
+ ******************************************************************************/
+void neuik_Window_PushClip(
+    NEUIK_Window     * w,
+    const RenderLoc  * rLoc,
+    const RenderSize * rSize)
+{
+    int              x1;
+    int              y1;
+    int              x2;
+    int              y2;
+    neuik_ClipRect * top;
+    neuik_ClipRect * next;
+
+    if (w->clipDepth <= 0) return; /* a frame is not being rendered */
+
+    w->clipDepth++;
+    if (w->clipDepth > NEUIK_MAX_CLIP_DEPTH)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Too deep to store; the current top remains in effect. It contains  */
+        /* the true visible region so nothing visible will be culled.         */
+        /*--------------------------------------------------------------------*/
+        return;
+    }
+    top  = &w->clipStack[w->clipDepth - 2];
+    next = &w->clipStack[w->clipDepth - 1];
+
+    if (rLoc == NULL || rSize == NULL)
+    {
+        next->x = INT_MIN/2;
+        next->y = INT_MIN/2;
+        next->w = INT_MAX;
+        next->h = INT_MAX;
+        return;
+    }
+
+    x1 = (rLoc->x > top->x) ? rLoc->x : top->x;
+    y1 = (rLoc->y > top->y) ? rLoc->y : top->y;
+    x2 = rLoc->x + rSize->w;
+    y2 = rLoc->y + rSize->h;
+    if (x2 > top->x + top->w) x2 = top->x + top->w;
+    if (y2 > top->y + top->h) y2 = top->y + top->h;
+
+    next->x = x1;
+    next->y = y1;
+    next->w = (x2 > x1) ? x2 - x1 : 0;
+    next->h = (y2 > y1) ? y2 - y1 : 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Window_PopClip
+ *
+ *  Description:   Remove the top entry of the clip-rectangle stack.
+ *
+ ******************************************************************************/
+void neuik_Window_PopClip(
+    NEUIK_Window * w)
+{
+    if (w->clipDepth > 1) w->clipDepth--;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Window_GetClip
+ *
+ *  Description:   Get the current top of the clip-rectangle stack (in window 
+ *                 coordinates).
+ *
+ *  Returns:       1 if a frame is not being rendered (`clip` is unchanged); 
+ *                 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_Window_GetClip(
+    NEUIK_Window   * w,
+    neuik_ClipRect * clip)
+{
+    if (w->clipDepth <= 0) return 1; /* a frame is not being rendered */
+
+    if (w->clipDepth > NEUIK_MAX_CLIP_DEPTH)
+    {
+        (*clip) = w->clipStack[NEUIK_MAX_CLIP_DEPTH - 1];
+    }
+    else
+    {
+        (*clip) = w->clipStack[w->clipDepth - 1];
+    }
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Window_IsClipped
+ *
+ *  Description:   Check whether a region (in window coordinates) lies 
+ *                 completely outside of the current clip rectangle.
+ *
+ *  Returns:       1 if nothing of the region would be visible; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_Window_IsClipped(
+    NEUIK_Window     * w,
+    const RenderLoc  * rLoc,
+    const RenderSize * rSize)
+{
+    neuik_ClipRect * top;
+
+    if (w->clipDepth <= 0) return 0; /* a frame is not being rendered */
+    if (rSize->w <= 0 || rSize->h <= 0) return 0;
+
+    if (w->clipDepth > NEUIK_MAX_CLIP_DEPTH)
+    {
+        top = &w->clipStack[NEUIK_MAX_CLIP_DEPTH - 1];
+    }
+    else
+    {
+        top = &w->clipStack[w->clipDepth - 1];
+    }
+
+    return (rLoc->x >= top->x + top->w || rLoc->x + rSize->w <= top->x ||
+            rLoc->y >= top->y + top->h || rLoc->y + rSize->h <= top->y);
+}
+
+
 /*******************************************************************************
  *
  *  Name:          NEUIK_Window_Redraw
@@ -1719,6 +2137,7 @@ int NEUIK_Window_Redraw(
     NEUIK_Window  * w)
 {
     int                   doResize   = 0;
+    int                   profiled   = 0;       /* if this frame is being profiled */
     int                   rv         = 0;
     int                   eNum       = 0;       /* which error to report (if any) */
     int                   newW;                 /* used when autoresizing the window */
@@ -1731,9 +2150,11 @@ int NEUIK_Window_Redraw(
     int                   oldMinH;              /* old minimum element height */
     int                   lastFrameW;           /* width of Texture from last frame */
     int                   lastFrameH;           /* height of Texture from last frame */
+    double                frameStart = 0.0;     /* for frame pacing */
     unsigned int          timeBeforeRedraw = 0; /* for calculating frame time */
     unsigned int          frameTime;            /* time required to redraw elem */
     float                 equivFPS   = 0.0;     /* equivalent FPS (for frametime) */
+    float                 prevScale  = neuik__HighDPI_Scaling;
     NEUIK_WindowConfig  * aCfg       = NULL;
     NEUIK_ElementConfig * eCfg       = NULL;
     // NEUIK_PopUp         * popup      = NULL;
@@ -1771,7 +2192,10 @@ int NEUIK_Window_Redraw(
         eNum = 6;
         goto out;
     }
+    neuik_Window_MakeScaleCurrent(w);
+    profiled = neuik_Profile_Begin(NEUIK_PROFILE_FRAME, w, w);
 
+    frameStart  = neuik_Window_FrameClock();
     w->doRedraw = 0;
 
     /*------------------------------------------------------------------------*/
@@ -1800,7 +2224,7 @@ int NEUIK_Window_Redraw(
         aCfg = w->cfg;
     }
 
-    bgTex = SDL_CreateTexture(w->rend, 
+    bgTex = neuik_TexturePool_Acquire(w->rend, 
         SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
         w->sizeW, w->sizeH);
     if (bgTex == NULL)
@@ -2045,6 +2469,7 @@ int NEUIK_Window_Redraw(
         {
             timeBeforeRedraw = SDL_GetTicks();
         }
+        neuik_Window_ResetClip(w);
         if (neuik_Element_Render(w->elem, &rSize, NULL, w->rend, FALSE))
         {
             eNum = 3;
@@ -2178,12 +2603,8 @@ int NEUIK_Window_Redraw(
     }
 
     /*------------------------------------------------------------------------*/
-    /* Complete the rendering to the bgTex texture.                           */
-    /*------------------------------------------------------------------------*/
-    SDL_RenderPresent(w->rend);
-
-    /*------------------------------------------------------------------------*/
-    /* Now copy the bgTex texture on to the window.                           */
+    /* Now copy the bgTex texture on to the window; this is the only present  */
+    /* of the frame.                                                          */
     /*------------------------------------------------------------------------*/
     if (SDL_SetRenderTarget(w->rend, NULL))
     {
@@ -2197,14 +2618,22 @@ int NEUIK_Window_Redraw(
         goto out;
     }
     SDL_RenderPresent(w->rend);
+    neuik_Window_EndFrame(w, frameStart);
 
     /*------------------------------------------------------------------------*/
-    /* Save the fully rendered texture to Window->lastFrame.                  */
+    /* Save the fully rendered texture to Window->lastFrame; the texture of   */
+    /* the previous frame is pooled and will be drawn into on the next frame. */
     /*------------------------------------------------------------------------*/
-    ConditionallyDestroyTexture((SDL_Texture**)&w->lastFrame);
+    neuik_TexturePool_Release(w->rend, (SDL_Texture**)&w->lastFrame);
     w->lastFrame = bgTex;
+    bgTex        = NULL;
+    neuik_Pool_EndFrame();
 out:
+    if (bgTex != NULL) neuik_TexturePool_Release(w->rend, &bgTex);
+    neuik_Profile_End(profiled);
+    neuik__HighDPI_Scaling = prevScale;
     w->redrawAll = 0;
+    w->clipDepth = 0;
 
     if (eNum > 0)
     {
@@ -2387,8 +2816,8 @@ int NEUIK_Window_SetSize(
         eNum = 3;
         goto out;
     }
-    widthSc  = (int)((float)(width)*neuik__HighDPI_Scaling);
-    heightSc = (int)((float)(height)*neuik__HighDPI_Scaling);
+    widthSc  = (int)((float)(width)*w->scale);
+    heightSc = (int)((float)(height)*w->scale);
 
     if (neuik_Window_SetSizeNoScaling(w, widthSc, heightSc))
     {
@@ -2405,6 +2834,207 @@ out:
 }
 
 
+/*******************************************************************************
+ *
+ *  Name:          neuik_Window_DetectScale
+ *
+ *  Description:   Determine the HighDPI scaling to use for a window on the 
+ *                 specified display. A numeric `NEUIK_HIGHDPI_SCALING` 
+ *                 environment setting takes precedence over the display DPI.
+ *
+ *                 The display DPI is only used if detection was requested,
+ *                 either by the window (`DetectScale`) or for all windows 
+ *                 (`NEUIK_HIGHDPI_SCALING=auto`).
+ *
+ *  Returns:       The scaling factor (1.0 if not detected or unavailable).
+ *
+ ******************************************************************************/
+static float neuik_Window_DetectScale(
+    NEUIK_Window * w,
+    int            dispIdx)
+{
+    float                scale = 1.0;
+    float                hdpi  = 0.0; /* horizontal DPI of the display */
+    NEUIK_WindowConfig * wCfg  = NULL;
+
+    if (neuik__HighDPI_Override > 0.0) return neuik__HighDPI_Override;
+
+    wCfg = neuik_Window_GetConfig(w);
+    if (!neuik__HighDPI_Detect && (wCfg == NULL || !wCfg->detectScale))
+    {
+        return scale;
+    }
+    if (dispIdx < 0) return scale;
+    if (SDL_GetDisplayDPI(dispIdx, NULL, &hdpi, NULL) != 0 || hdpi <= 0.0)
+    {
+        return scale;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* The physical DPI reported for ordinary monitors scatters around the    */
+    /* reference value; use quarter steps and only round up once a DPI is     */
+    /* well into the next step.                                               */
+    /*------------------------------------------------------------------------*/
+    scale = (float)((int)(4.0*hdpi/NEUIK_WINDOW_REFERENCE_DPI + 0.25))/4.0;
+    if (scale < 1.0) scale = 1.0;
+
+    return scale;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Window_MakeScaleCurrent
+ *
+ *  Description:   Make the scaling of this window the one used by the layout 
+ *                 and font lookups of its elements. This is called when the 
+ *                 window begins handling an event or redrawing itself; the 
+ *                 caller saves the previous value of `neuik__HighDPI_Scaling` 
+ *                 and restores it once done, so that one window's scaling 
+ *                 never leaks into code running outside of it.
+ *
+ ******************************************************************************/
+void neuik_Window_MakeScaleCurrent(
+    NEUIK_Window * w)
+{
+    if (w == NULL) return;
+    neuik__HighDPI_Scaling = w->scale;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Window_ApplyScale
+ *
+ *  Description:   Change the HighDPI scaling of a window. The window size is 
+ *                 adjusted by the same ratio (unless maximized/fullscreen) and 
+ *                 the contents are relaid out and redrawn.
+ *
+ *                 Fonts are looked up by their scaled point size, so the fonts
+ *                 (and their glyph metrics) for the new scale are simply 
+ *                 opened alongside the existing ones; the element tree itself 
+ *                 is left untouched.
+ *
+ *  Returns:       A non-zero value if there was an error.
+ *
+ ******************************************************************************/
+static int neuik_Window_ApplyScale(
+    NEUIK_Window * w,
+    float          scale)
+{
+    int                  eNum       = 0; /* which error to report (if any) */
+    int                  newW       = 0;
+    int                  newH       = 0;
+    float                oldScale   = 1.0;
+    float                prevScale  = neuik__HighDPI_Scaling;
+    NEUIK_WindowConfig * wCfg       = NULL;
+    static char          funcName[] = "neuik_Window_ApplyScale";
+    static char        * errMsgs[]  = {"", // [0] no error
+        "Failure in `neuik_Window_SetSizeNoScaling()`.",  // [1]
+        "Failure in `neuik_Element_ForceRedraw()`.",      // [2]
+        "Failure in `neuik_Window_RequestFullRedraw()`.", // [3]
+    };
+
+    if (scale == w->scale) goto out;
+
+    oldScale = w->scale;
+    w->scale = scale;
+    neuik_Window_MakeScaleCurrent(w);
+
+    if (neuik__Report_Debug)
+    {
+        printf("Window scaling changed: %g -> %g\n", oldScale, scale);
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Keep the window the same apparent size on the new display.             */
+    /*------------------------------------------------------------------------*/
+    wCfg = neuik_Window_GetConfig(w);
+    if (w->win == NULL || (!wCfg->isMaximized && !wCfg->isFullscreen))
+    {
+        newW = (int)((float)(w->sizeW)*scale/oldScale + 0.5);
+        newH = (int)((float)(w->sizeH)*scale/oldScale + 0.5);
+        if (neuik_Window_SetSizeNoScaling(w, newW, newH))
+        {
+            eNum = 1;
+            goto out;
+        }
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* The minimum sizes and cached renders of the elements are now stale.    */
+    /*------------------------------------------------------------------------*/
+    if (w->win == NULL) goto out;
+    if (w->elem != NULL)
+    {
+        if (neuik_Element_ForceRedraw(w->elem))
+        {
+            eNum = 2;
+            goto out;
+        }
+    }
+    if (neuik_Window_RequestFullRedraw(w))
+    {
+        eNum = 3;
+        goto out;
+    }
+out:
+    neuik__HighDPI_Scaling = prevScale;
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Window_UpdateScale
+ *
+ *  Description:   Match the HighDPI scaling of a window to the display which 
+ *                 it is currently on (unless it was set explicitly).
+ *
+ *  Returns:       A non-zero value if there was an error.
+ *
+ ******************************************************************************/
+int neuik_Window_UpdateScale(
+    NEUIK_Window * w)
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    float         scale      = 1.0;
+    static char   funcName[] = "neuik_Window_UpdateScale";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `w` does not implement Window class.", // [1]
+        "Failure in `neuik_Window_ApplyScale()`.",       // [2]
+    };
+
+    if (!neuik_Object_IsClass(w, neuik__Class_Window))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (w->scaleFixed || w->win == NULL) goto out;
+
+    scale = neuik_Window_DetectScale(w, SDL_GetWindowDisplayIndex(w->win));
+    if (neuik_Window_ApplyScale(w, scale))
+    {
+        eNum = 2;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
 /*******************************************************************************
  *
  *  Name:          NEUIK_Window_SetTitle
@@ -3172,3 +3802,233 @@ out:
     return eNum;
 }
 
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_Window_GetFrameStats
+ *
+ *  Description:   Get the frame counters of the window; any of the output 
+ *                 arguments may be NULL.
+ *
+ *                 nPresented : number of frames presented
+ *                 nDropped   : number of display refreshes missed because a 
+ *                              frame took longer than the frame interval
+ *                 nLate      : number of frames which took longer than the 
+ *                              frame interval
+ *
+ *  Returns:       1 if there is an error, 0 otherwise
+ *
+ ******************************************************************************/
+int NEUIK_Window_GetFrameStats(
+    NEUIK_Window * w,
+    unsigned int * nPresented,
+    unsigned int * nDropped,
+    unsigned int * nLate)
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "NEUIK_Window_GetFrameStats";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `w` does not implement Window class.", // [1]
+    };
+
+    if (!neuik_Object_IsClass(w, neuik__Class_Window))
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    if (nPresented != NULL) *nPresented = w->framesPresented;
+    if (nDropped   != NULL) *nDropped   = w->framesDropped;
+    if (nLate      != NULL) *nLate      = w->framesLate;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_Window_ResetFrameStats
+ *
+ *  Description:   Reset the frame counters of the window to zero.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise
+ *
+ ******************************************************************************/
+int NEUIK_Window_ResetFrameStats(
+    NEUIK_Window * w)
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "NEUIK_Window_ResetFrameStats";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `w` does not implement Window class.", // [1]
+    };
+
+    if (!neuik_Object_IsClass(w, neuik__Class_Window))
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    w->framesPresented = 0;
+    w->framesDropped   = 0;
+    w->framesLate      = 0;
+    w->elemsDrawn      = 0;
+    w->elemsCulled     = 0;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_Window_GetCullStats
+ *
+ *  Description:   Get the number of elements which were rendered and the 
+ *                 number which were skipped (because they lay completely 
+ *                 outside of the visible area) during the last frame; either 
+ *                 of the output arguments may be NULL.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise
+ *
+ ******************************************************************************/
+int NEUIK_Window_GetCullStats(
+    NEUIK_Window * w,
+    unsigned int * nDrawn,
+    unsigned int * nCulled)
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "NEUIK_Window_GetCullStats";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `w` does not implement Window class.", // [1]
+    };
+
+    if (!neuik_Object_IsClass(w, neuik__Class_Window))
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    if (nDrawn  != NULL) *nDrawn  = w->elemsDrawn;
+    if (nCulled != NULL) *nCulled = w->elemsCulled;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_Window_SetScale
+ *
+ *  Description:   Set the HighDPI scaling used by the contents of a window. 
+ *                 A scale of zero (or less) returns the window to its default 
+ *                 scaling (that of the display it is on, if `DetectScale` is 
+ *                 set).
+ *
+ *  Returns:       1 if there is an error, 0 otherwise
+ *
+ ******************************************************************************/
+int NEUIK_Window_SetScale(
+    NEUIK_Window * w,
+    float          scale)
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    int           dispIdx    = 0;
+    static char   funcName[] = "NEUIK_Window_SetScale";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `w` does not implement Window class.", // [1]
+        "Failure in `neuik_Window_ApplyScale()`.",       // [2]
+    };
+
+    if (!neuik_Object_IsClass(w, neuik__Class_Window))
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    if (scale > 0.0)
+    {
+        if (scale < 0.5) scale = 0.5;
+        w->scaleFixed = TRUE;
+    }
+    else
+    {
+        w->scaleFixed = FALSE;
+        if (w->win != NULL) dispIdx = SDL_GetWindowDisplayIndex(w->win);
+        scale = neuik_Window_DetectScale(w, dispIdx);
+    }
+
+    if (neuik_Window_ApplyScale(w, scale))
+    {
+        eNum = 2;
+        goto out;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_Window_GetScale
+ *
+ *  Description:   Get the HighDPI scaling currently used by a window.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise
+ *
+ ******************************************************************************/
+int NEUIK_Window_GetScale(
+    NEUIK_Window * w,
+    float        * scale)
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "NEUIK_Window_GetScale";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `w` does not implement Window class.", // [1]
+        "Output argument `scale` is NULL.",              // [2]
+    };
+
+    if (!neuik_Object_IsClass(w, neuik__Class_Window))
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (scale == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+
+    *scale = w->scale;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
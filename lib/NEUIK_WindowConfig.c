@@ -76,6 +76,7 @@ int neuik_RegisterClass_WindowConfig()
         "Configuration for NEUIK_Window Object.", // classDescription
         neuik__Set_NEUIK,                         // classSet
         NULL,                                     // superClass
+        sizeof(NEUIK_WindowConfig),               // objSize
         &neuik_WindowConfig_BaseFuncs,            // baseFuncs
         NULL,                                     // classFuncs
         &neuik__Class_WindowConfig))              // newClass
@@ -130,6 +131,9 @@ NEUIK_WindowConfig * NEUIK_GetDefaultWindowConfig()
         dCfg.isFullscreen = 0;
         dCfg.isMaximized  = 0;
         dCfg.isMinimized  = 0;
+        dCfg.isVSync      = 0;
+        dCfg.targetFPS    = 0;
+        dCfg.detectScale  = 0;
     }
 
     return &dCfg;
@@ -179,7 +183,8 @@ int NEUIK_NewWindowConfig(
         goto out;
     }
 
-    (*cfgPtr) = (NEUIK_WindowConfig*) malloc(sizeof(NEUIK_WindowConfig));
+    (*cfgPtr) = (NEUIK_WindowConfig*) neuik_Object_Alloc(
+        neuik__Class_WindowConfig, (void**)cfgPtr);
     cfg = (*cfgPtr);
     if (cfg == NULL)
     {
@@ -275,6 +280,9 @@ int NEUIK_WindowConfig_Copy(
     dst->isFullscreen = src->isFullscreen;
     dst->isMaximized  = src->isMaximized;
     dst->isMinimized  = src->isMinimized;
+    dst->isVSync      = src->isVSync;
+    dst->targetFPS    = src->targetFPS;
+    dst->detectScale  = src->detectScale;
 out:
     if (eNum > 0)
     {
@@ -333,7 +341,7 @@ int NEUIK_WindowConfig_Free(
         goto out;
     }
 
-    free(cfg);
+    neuik_Object_Release(cfg);
 out:
     if (eNum > 0)
     {
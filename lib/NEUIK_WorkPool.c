@@ -0,0 +1,319 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#include <SDL.h>
+#include <stdlib.h>
+
+#include "NEUIK_error.h"
+#include "NEUIK_neuik.h"
+#include "NEUIK_WorkPool_internal.h"
+
+#define NEUIK_WORKPOOL_MAX_THREADS 64
+
+/*----------------------------------------------------------------------------*/
+/* Typedef(s)                                                                 */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    neuik_WorkFn    fn;
+    void         ** jobs;
+    int             nJobs;
+    SDL_atomic_t    next;    /* index of the next unclaimed job */
+    SDL_atomic_t    nFailed; /* number of jobs which returned nonzero */
+    int             users;   /* worker threads still working on this batch */
+} neuik_WorkBatch;
+
+/*----------------------------------------------------------------------------*/
+/* The pool runs one batch at a time. Idle workers sleep on `neuik_pool_Wake` */
+/* and claim jobs from the current batch with an atomic counter, so that a    */
+/* worker which finishes early simply takes more of the remaining jobs.       */
+/*----------------------------------------------------------------------------*/
+static SDL_mutex        * neuik_pool_Mutex    = NULL;
+static SDL_cond         * neuik_pool_Wake     = NULL; /* a batch is available */
+static SDL_cond         * neuik_pool_Idle     = NULL; /* a batch was released */
+static SDL_mutex        * neuik_pool_RunMutex = NULL; /* one caller at a time */
+static SDL_Thread       * neuik_pool_Threads[NEUIK_WORKPOOL_MAX_THREADS];
+static int                neuik_pool_nThreads = 0;
+static int                neuik_pool_Quit     = 0;
+static unsigned long      neuik_pool_BatchGen = 0;
+static neuik_WorkBatch  * neuik_pool_Batch    = NULL;
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_WorkBatch_RunJobs
+ *
+ *  Description:   Claim and run jobs from a batch until none are left.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+static void neuik_WorkBatch_RunJobs(
+    neuik_WorkBatch * batch)
+{
+    int jobNum = 0;
+
+    for (;;)
+    {
+        jobNum = SDL_AtomicAdd(&batch->next, 1);
+        if (jobNum >= batch->nJobs) break;
+
+        if (batch->fn(batch->jobs[jobNum]))
+        {
+            SDL_AtomicAdd(&batch->nFailed, 1);
+        }
+    }
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_WorkPool_Thread
+ *
+ *  Description:   The main function of a worker thread.
+ *
+ *  Returns:       0.
+ *
+ ******************************************************************************/
+static int neuik_WorkPool_Thread(
+    void * unused)
+{
+    unsigned long     lastGen = 0;
+    neuik_WorkBatch * batch   = NULL;
+
+    (void)unused;
+
+    SDL_LockMutex(neuik_pool_Mutex);
+    lastGen = neuik_pool_BatchGen;
+    for (;;)
+    {
+        while (!neuik_pool_Quit &&
+            (neuik_pool_Batch == NULL || neuik_pool_BatchGen == lastGen))
+        {
+            SDL_CondWait(neuik_pool_Wake, neuik_pool_Mutex);
+        }
+        if (neuik_pool_Quit) break;
+
+        lastGen = neuik_pool_BatchGen;
+        batch   = neuik_pool_Batch;
+        batch->users++;
+        SDL_UnlockMutex(neuik_pool_Mutex);
+
+        neuik_WorkBatch_RunJobs(batch);
+
+        SDL_LockMutex(neuik_pool_Mutex);
+        batch->users--;
+        if (batch->users == 0)
+        {
+            SDL_CondBroadcast(neuik_pool_Idle);
+        }
+    }
+    SDL_UnlockMutex(neuik_pool_Mutex);
+
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_WorkPool_Shutdown
+ *
+ *  Description:   Stop and join all of the worker threads.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+void neuik_WorkPool_Shutdown()
+{
+    int ctr = 0;
+
+    if (neuik_pool_nThreads == 0) return;
+
+    SDL_LockMutex(neuik_pool_Mutex);
+    neuik_pool_Quit = 1;
+    SDL_CondBroadcast(neuik_pool_Wake);
+    SDL_UnlockMutex(neuik_pool_Mutex);
+
+    for (ctr = 0; ctr < neuik_pool_nThreads; ctr++)
+    {
+        SDL_WaitThread(neuik_pool_Threads[ctr], NULL);
+        neuik_pool_Threads[ctr] = NULL;
+    }
+    neuik_pool_nThreads = 0;
+    neuik_pool_Quit     = 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_SetRenderThreads
+ *
+ *  Description:   Set the number of worker threads used to prepare CPU-side
+ *                 render data (such as Plot2D line masks) in parallel. A value
+ *                 of zero (the default) does all such work on the UI thread;
+ *                 a negative value uses one thread per additional CPU core.
+ *
+ *                 This may only be called from the UI thread and not while
+ *                 an element is being rendered.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int NEUIK_SetRenderThreads(
+    int nThreads)
+{
+    int           ctr        = 0;
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "NEUIK_SetRenderThreads";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Failed to create pool synchronization objects.", // [1]
+        "Failed to create a worker thread.",              // [2]
+    };
+
+    if (nThreads < 0)
+    {
+        nThreads = SDL_GetCPUCount() - 1;
+    }
+    if (nThreads > NEUIK_WORKPOOL_MAX_THREADS)
+    {
+        nThreads = NEUIK_WORKPOOL_MAX_THREADS;
+    }
+
+    neuik_WorkPool_Shutdown();
+    if (nThreads <= 0) goto out;
+
+    if (neuik_pool_Mutex == NULL)
+    {
+        neuik_pool_Mutex    = SDL_CreateMutex();
+        neuik_pool_RunMutex = SDL_CreateMutex();
+        neuik_pool_Wake     = SDL_CreateCond();
+        neuik_pool_Idle     = SDL_CreateCond();
+        if (neuik_pool_Mutex == NULL || neuik_pool_RunMutex == NULL ||
+            neuik_pool_Wake == NULL || neuik_pool_Idle == NULL)
+        {
+            eNum = 1;
+            goto out;
+        }
+    }
+
+    for (ctr = 0; ctr < nThreads; ctr++)
+    {
+        neuik_pool_Threads[ctr] = SDL_CreateThread(
+            neuik_WorkPool_Thread, "neuik_worker", NULL);
+        if (neuik_pool_Threads[ctr] == NULL)
+        {
+            eNum = 2;
+            goto out;
+        }
+        neuik_pool_nThreads++;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_WorkPool_NumThreads
+ *
+ *  Description:   Report the number of worker threads in the pool.
+ *
+ *  Returns:       The number of worker threads (0 if work is done serially).
+ *
+ ******************************************************************************/
+int neuik_WorkPool_NumThreads()
+{
+    return neuik_pool_nThreads;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_WorkPool_Run
+ *
+ *  Description:   Run `fn` on each of the supplied jobs and wait for all of
+ *                 them to complete. The calling thread works on the batch as
+ *                 well; if the pool has no threads the jobs are run serially.
+ *
+ *  Returns:       1 if any of the jobs failed, 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_WorkPool_Run(
+    neuik_WorkFn    fn,
+    void         ** jobs,
+    int             nJobs)
+{
+    int              ctr        = 0;
+    int              eNum       = 0; /* which error to report (if any) */
+    neuik_WorkBatch  batch;
+    static char      funcName[] = "neuik_WorkPool_Run";
+    static char    * errMsgs[]  = {"", // [0] no error
+        "One or more jobs failed.", // [1]
+    };
+
+    if (nJobs <= 0) goto out;
+
+    if (neuik_pool_nThreads == 0 || nJobs == 1)
+    {
+        for (ctr = 0; ctr < nJobs; ctr++)
+        {
+            if (fn(jobs[ctr])) eNum = 1;
+        }
+        goto out;
+    }
+
+    batch.fn    = fn;
+    batch.jobs  = jobs;
+    batch.nJobs = nJobs;
+    batch.users = 0;
+    SDL_AtomicSet(&batch.next, 0);
+    SDL_AtomicSet(&batch.nFailed, 0);
+
+    SDL_LockMutex(neuik_pool_RunMutex);
+    SDL_LockMutex(neuik_pool_Mutex);
+    neuik_pool_Batch = &batch;
+    neuik_pool_BatchGen++;
+    SDL_CondBroadcast(neuik_pool_Wake);
+    SDL_UnlockMutex(neuik_pool_Mutex);
+
+    neuik_WorkBatch_RunJobs(&batch);
+
+    /*------------------------------------------------------------------------*/
+    /* All jobs have been claimed; wait for any workers still running one.    */
+    /*------------------------------------------------------------------------*/
+    SDL_LockMutex(neuik_pool_Mutex);
+    while (batch.users > 0)
+    {
+        SDL_CondWait(neuik_pool_Idle, neuik_pool_Mutex);
+    }
+    neuik_pool_Batch = NULL;
+    SDL_UnlockMutex(neuik_pool_Mutex);
+    SDL_UnlockMutex(neuik_pool_RunMutex);
+
+    if (SDL_AtomicGet(&batch.nFailed) > 0) eNum = 1;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
@@ -22,6 +22,11 @@
 #include "neuik_classes.h"
 #include "NEUIK_neuik.h"
 #include "NEUIK_error.h"
+#include "NEUIK_Callback_internal.h"
+#include "NEUIK_Image_internal.h"
+#include "NEUIK_TextEdit_internal.h"
+#include "NEUIK_UIQueue_internal.h"
+#include "NEUIK_WorkPool_internal.h"
 
 int           neuik__isInitialized = 0;
 neuik_SetID   neuik__SetID_NEUIK   = -1;
@@ -30,13 +35,18 @@ char          neuik__AppName[2048];
 int           neuik__Report_About = 0;
 int           neuik__Report_Debug = 0;
 int           neuik__Report_Frametime = 0;
-float         neuik__HighDPI_Scaling = 1.0;
+float         neuik__HighDPI_Scaling  = 1.0; /* scale of the current window */
+float         neuik__HighDPI_Override = 0.0; /* >0 if set by the environment */
+int           neuik__HighDPI_Detect   = 0;   /* use the DPI of each display */
+SDL_atomic_t  neuik__ObjectsCreated;      /* NEUIK objects allocated */
+unsigned long neuik__TexturesCreated = 0; /* SDL_Textures created by NEUIK */
 
 
 int NEUIK_Init()
 {
     int           eNum   = 0;
     int           nRead  = 0;
+    int           nThr   = 0;
     int           rvErr  = 0;
     char        * envVar = NULL;
     static char   funcName[] = "NEUIK_Init";
@@ -45,6 +55,9 @@ int NEUIK_Init()
         "Failed to Initialize SDL2_ttf.",   // [2]
         "Failed to Initialize SDL2_image.", // [3]
         "Failed to Register Class Set.",    // [4]
+        "Failed to Initialize UI queue.",   // [5]
+        "Failed to start render threads.",  // [6]
+        "Failed to Initialize binding queue.", // [7]
     };
 
     if (!neuik__isInitialized)
@@ -86,6 +99,24 @@ int NEUIK_Init()
             goto out;
         }
 
+        /*--------------------------------------------------------------------*/
+        /* Register the event used to wake the loop for cross-thread updates  */
+        /*--------------------------------------------------------------------*/
+        if (neuik_UIQueue_Init())
+        {
+            eNum = 5;
+            goto out;
+        }
+
+        /*--------------------------------------------------------------------*/
+        /* Create the binding callback queue before any thread can push to it */
+        /*--------------------------------------------------------------------*/
+        if (neuik_BindingQueue_Init())
+        {
+            eNum = 7;
+            goto out;
+        }
+
         neuik__isInitialized = 1;
 
         /*--------------------------------------------------------------------*/
@@ -127,6 +158,7 @@ int NEUIK_Init()
         neuik_RegisterClass_ProgressBarConfig();
         neuik_RegisterClass_ProgressBar();
         neuik_RegisterClass_Stack();
+        neuik_RegisterClass_ScrollView();
 
 
         neuik_RegisterClass_MaskMap();
@@ -142,14 +174,21 @@ int NEUIK_Init()
         envVar = getenv("NEUIK_REPORT_ABOUT");
         if (envVar != NULL) neuik__Report_About = 1;
         envVar = getenv("NEUIK_HIGHDPI_SCALING");
-        if (envVar != NULL)
+        if (envVar != NULL && !strcmp(envVar, "auto"))
+        {
+            /*----------------------------------------------------------------*/
+            /* Scale every window to the DPI of the display that it is on.    */
+            /*----------------------------------------------------------------*/
+            neuik__HighDPI_Detect = 1;
+        }
+        else if (envVar != NULL)
         {
             nRead = sscanf(envVar, "%f", &neuik__HighDPI_Scaling);
             if (nRead == 0)
             {
                 printf("NOTE: Invalid ENVIRONMENT setting for "
                     "`NEUIK_HIGHDPI_SCALING`; it should be a float value "
-                    ">= 1.0 .\n");
+                    ">= 1.0 (or `auto`).\n");
                 neuik__HighDPI_Scaling = 1.0;
             }
             if (neuik__HighDPI_Scaling < 0.5)
@@ -160,6 +199,20 @@ int NEUIK_Init()
                 /*------------------------------------------------------------*/
                 neuik__HighDPI_Scaling = 0.5;
             }
+            /*----------------------------------------------------------------*/
+            /* An explicit setting overrides the per-window display scale.    */
+            /*----------------------------------------------------------------*/
+            if (nRead == 1) neuik__HighDPI_Override = neuik__HighDPI_Scaling;
+        }
+        envVar = getenv("NEUIK_RENDER_THREADS");
+        if (envVar != NULL)
+        {
+            nRead = sscanf(envVar, "%d", &nThr);
+            if (nRead == 1 && NEUIK_SetRenderThreads(nThr))
+            {
+                eNum = 6;
+                goto out;
+            }
         }
 
     }
@@ -178,6 +231,11 @@ void NEUIK_Quit()
 {
     if (neuik__isInitialized)
     {
+        neuik_ImageLoader_Shutdown();
+        neuik_TextEditLoader_Shutdown();
+        neuik_UIQueue_Discard();
+        neuik_BindingQueue_Shutdown();
+        neuik_WorkPool_Shutdown();
         IMG_Quit();
         TTF_Quit();
         SDL_Quit();
@@ -74,6 +74,18 @@ int neuik_KeyShortcut_Undo(
 }
 
 
+/* Cmd + Shift + Z */
+int neuik_KeyShortcut_Redo(
+        SDL_KeyboardEvent  * keyEv, 
+        SDL_Keymod           keyMod)
+{
+    if (keyMod & KMOD_GUI && keyMod & KMOD_SHIFT &&
+        keyEv->keysym.sym == SDLK_z) return 1;
+
+    return 0;
+}
+
+
 /* Cmd + S */
 int neuik_KeyShortcut_Save(
         SDL_KeyboardEvent  * keyEv, 
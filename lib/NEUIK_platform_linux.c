@@ -74,6 +74,19 @@ int neuik_KeyShortcut_Undo(
 }
 
 
+/* Ctrl + Y  or  Ctrl + Shift + Z */
+int neuik_KeyShortcut_Redo(
+        SDL_KeyboardEvent  * keyEv, 
+        SDL_Keymod           keyMod)
+{
+    if (keyMod & KMOD_CTRL && keyEv->keysym.sym == SDLK_y) return 1;
+    if (keyMod & KMOD_CTRL && keyMod & KMOD_SHIFT &&
+        keyEv->keysym.sym == SDLK_z) return 1;
+
+    return 0;
+}
+
+
 /* Ctrl + S */
 int neuik_KeyShortcut_Save(
         SDL_KeyboardEvent  * keyEv, 
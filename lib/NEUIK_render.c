@@ -21,6 +21,9 @@
 #include "NEUIK_colors.h"
 #include "NEUIK_error.h"
 #include "NEUIK_render.h"
+#include "NEUIK_Profile_internal.h"
+
+extern unsigned long neuik__TexturesCreated;
 
 
 void ConditionallyDestroyTexture(
@@ -37,6 +40,413 @@ void ConditionallyDestroyTexture(
 }
 
 
+/*******************************************************************************
+ *
+ *  Name:          neuik_CreateTexture
+ *
+ *  Description:   A wrapper around `SDL_CreateTexture()`; all of the textures
+ *                 created by NEUIK go through here so that texture creations
+ *                 can be counted (see NEUIK_Window_Benchmark()).
+ *
+ *  Returns:       NULL if there is a problem, otherwise a valid SDL_Texture*.
+ *
+ ******************************************************************************/
+SDL_Texture * neuik_CreateTexture(
+    SDL_Renderer * rend,
+    Uint32         format,
+    int            access,
+    int            w,
+    int            h)
+{
+    int           profiled;
+    SDL_Texture * tex;
+
+    neuik__TexturesCreated++;
+    profiled = neuik_Profile_Begin(NEUIK_PROFILE_TEXTUREUPLOAD, NULL, NULL);
+    tex = SDL_CreateTexture(rend, format, access, w, h);
+    neuik_Profile_End(profiled);
+
+    return tex;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_CreateTextureFromSurface
+ *
+ *  Description:   A wrapper around `SDL_CreateTextureFromSurface()`; see
+ *                 neuik_CreateTexture().
+ *
+ *  Returns:       NULL if there is a problem, otherwise a valid SDL_Texture*.
+ *
+ ******************************************************************************/
+SDL_Texture * neuik_CreateTextureFromSurface(
+    SDL_Renderer * rend,
+    SDL_Surface  * surf)
+{
+    int           profiled;
+    SDL_Texture * tex;
+
+    neuik__TexturesCreated++;
+    profiled = neuik_Profile_Begin(NEUIK_PROFILE_TEXTUREUPLOAD, NULL, NULL);
+    tex = SDL_CreateTextureFromSurface(rend, surf);
+    neuik_Profile_End(profiled);
+
+    return tex;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Texture and surface pools                                                  */
+/*                                                                            */
+/* Textures and surfaces which are only needed for the duration of a single   */
+/* render call (text, gradients, software rotation, window frames) are taken  */
+/* from and returned to these pools rather than being created and destroyed   */
+/* each time. Idle entries are kept in buckets according to their size class  */
+/* (area) and are matched exactly on (renderer, w, h, format, access). An     */
+/* entry which goes unused for NEUIK_POOL_MAXIDLE frames is destroyed; when a */
+/* bucket is full the least recently used entry is replaced.                  */
+/*----------------------------------------------------------------------------*/
+#define NEUIK_POOL_BUCKETS          16  /* size classes; by log4 of the area */
+#define NEUIK_TEXTUREPOOL_PERBUCKET 8   /* idle textures kept per size class */
+#define NEUIK_SURFACEPOOL_PERBUCKET 4   /* idle surfaces kept per size class */
+#define NEUIK_POOL_MAXIDLE          120 /* frames an idle entry is kept */
+
+typedef struct {
+    SDL_Renderer * rend;     /* renderer which owns `tex` (NULL if unused) */
+    SDL_Texture  * tex;      /* idle texture */
+    Uint32         format;   /* pixel format of the texture */
+    int            access;   /* SDL_TextureAccess of the texture */
+    int            w;        /* width of the texture (px) */
+    int            h;        /* height of the texture (px) */
+    unsigned int   lastUsed; /* frame in which the texture was released */
+} neuik_TexturePoolEntry;
+
+typedef struct {
+    SDL_Surface  * surf;     /* idle surface (NULL if unused) */
+    unsigned int   lastUsed; /* frame in which the surface was released */
+} neuik_SurfacePoolEntry;
+
+static neuik_TexturePoolEntry 
+    neuik_TexturePool[NEUIK_POOL_BUCKETS][NEUIK_TEXTUREPOOL_PERBUCKET];
+static neuik_SurfacePoolEntry 
+    neuik_SurfacePool[NEUIK_POOL_BUCKETS][NEUIK_SURFACEPOOL_PERBUCKET];
+static unsigned int neuik_Pool_Frame = 1;
+
+
+/*----------------------------------------------------------------------------*/
+/* Get the size class (bucket) of a region; bucket `n` holds the regions with */
+/* an area in the range [4^n, 4^(n+1)).                                       */
+/*----------------------------------------------------------------------------*/
+static int neuik_Pool_GetBucket(
+    int w,
+    int h)
+{
+    int           bucket = 0;
+    unsigned long area   = (unsigned long)w * (unsigned long)h;
+
+    while (area >= 4 && bucket < NEUIK_POOL_BUCKETS - 1)
+    {
+        area >>= 2;
+        bucket++;
+    }
+    return bucket;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TexturePool_Acquire
+ *
+ *  Description:   Get a texture with the specified properties; an idle pooled 
+ *                 texture is reused if one is available, otherwise a new one 
+ *                 is created. The contents of a reused texture are undefined 
+ *                 and its blend mode and color/alpha modulation are reset to 
+ *                 the SDL defaults.
+ *
+ *                 The texture belongs to the caller; it should be returned 
+ *                 using `neuik_TexturePool_Release()` (or destroyed).
+ *
+ *  Returns:       NULL if there is a problem, otherwise a valid SDL_Texture*.
+ *
+ ******************************************************************************/
+SDL_Texture * neuik_TexturePool_Acquire(
+    SDL_Renderer * rend,
+    Uint32         format,
+    int            access,
+    int            w,
+    int            h)
+{
+    int                      ctr;
+    neuik_TexturePoolEntry * entry;
+    SDL_Texture            * tex   = NULL;
+
+    if (rend == NULL || w <= 0 || h <= 0) return NULL;
+
+    entry = neuik_TexturePool[neuik_Pool_GetBucket(w, h)];
+    for (ctr = 0; ctr < NEUIK_TEXTUREPOOL_PERBUCKET; ctr++, entry++)
+    {
+        if (entry->rend   != rend   || 
+            entry->format != format || 
+            entry->access != access || 
+            entry->w      != w      || 
+            entry->h      != h)
+        {
+            continue;
+        }
+
+        tex = entry->tex;
+        entry->rend = NULL;
+        entry->tex  = NULL;
+
+        SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_NONE);
+        SDL_SetTextureColorMod(tex, 255, 255, 255);
+        SDL_SetTextureAlphaMod(tex, 255);
+        return tex;
+    }
+
+    return neuik_CreateTexture(rend, format, access, w, h);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TexturePool_Release
+ *
+ *  Description:   Return a texture (belonging to `rend`) to the texture pool 
+ *                 so that it may be reused; the texture pointer is nulled out.
+ *                 If the pool has no room, the least recently used texture of 
+ *                 the same size class is destroyed to make room.
+ *
+ ******************************************************************************/
+void neuik_TexturePool_Release(
+    SDL_Renderer  * rend,
+    SDL_Texture  ** tex)
+{
+    int                      ctr;
+    int                      w;
+    int                      h;
+    int                      access;
+    Uint32                   format;
+    neuik_TexturePoolEntry * bucket;
+    neuik_TexturePoolEntry * entry = NULL;
+
+    if (tex == NULL) return;
+    if (*tex == NULL) return;
+
+    if (rend == NULL || 
+        SDL_QueryTexture(*tex, &format, &access, &w, &h) ||
+        w <= 0 || h <= 0)
+    {
+        ConditionallyDestroyTexture(tex);
+        return;
+    }
+
+    bucket = neuik_TexturePool[neuik_Pool_GetBucket(w, h)];
+    entry  = &bucket[0];
+    for (ctr = 0; ctr < NEUIK_TEXTUREPOOL_PERBUCKET; ctr++)
+    {
+        if (bucket[ctr].rend == NULL)
+        {
+            entry = &bucket[ctr];
+            break;
+        }
+        if (bucket[ctr].lastUsed < entry->lastUsed)
+        {
+            entry = &bucket[ctr];
+        }
+    }
+    if (entry->tex != NULL) SDL_DestroyTexture(entry->tex);
+
+    entry->rend     = rend;
+    entry->tex      = *tex;
+    entry->format   = format;
+    entry->access   = access;
+    entry->w        = w;
+    entry->h        = h;
+    entry->lastUsed = neuik_Pool_Frame;
+    (*tex) = NULL;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_SurfacePool_Acquire
+ *
+ *  Description:   Get a 32bpp surface with the specified size and color masks
+ *                 (see `SDL_CreateRGBSurface()`); an idle pooled surface is 
+ *                 reused if one is available. The contents of a reused surface
+ *                 are undefined.
+ *
+ *                 The surface belongs to the caller; it should be returned 
+ *                 using `neuik_SurfacePool_Release()` (or freed).
+ *
+ *  Returns:       NULL if there is a problem, otherwise a valid SDL_Surface*.
+ *
+ ******************************************************************************/
+SDL_Surface * neuik_SurfacePool_Acquire(
+    int    w,
+    int    h,
+    Uint32 rmask,
+    Uint32 gmask,
+    Uint32 bmask,
+    Uint32 amask)
+{
+    int                      ctr;
+    neuik_SurfacePoolEntry * entry;
+    SDL_Surface            * surf;
+    SDL_PixelFormat        * fmt;
+
+    if (w <= 0 || h <= 0) return NULL;
+
+    entry = neuik_SurfacePool[neuik_Pool_GetBucket(w, h)];
+    for (ctr = 0; ctr < NEUIK_SURFACEPOOL_PERBUCKET; ctr++, entry++)
+    {
+        surf = entry->surf;
+        if (surf == NULL) continue;
+        if (surf->w != w || surf->h != h) continue;
+
+        fmt = surf->format;
+        if (fmt->BitsPerPixel != 32) continue;
+        if (rmask != 0 || gmask != 0 || bmask != 0)
+        {
+            /* default masks (all zero) are matched by any 32bpp surface */
+            if (fmt->Rmask != rmask || fmt->Gmask != gmask ||
+                fmt->Bmask != bmask || fmt->Amask != amask)
+            {
+                continue;
+            }
+        }
+        else if (fmt->Amask != amask)
+        {
+            continue;
+        }
+
+        entry->surf = NULL;
+        return surf;
+    }
+
+    return SDL_CreateRGBSurface(0, w, h, 32, rmask, gmask, bmask, amask);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_SurfacePool_Release
+ *
+ *  Description:   Return a surface to the surface pool so that it may be 
+ *                 reused; the surface pointer is nulled out.
+ *
+ ******************************************************************************/
+void neuik_SurfacePool_Release(
+    SDL_Surface ** surf)
+{
+    int                      ctr;
+    neuik_SurfacePoolEntry * bucket;
+    neuik_SurfacePoolEntry * entry = NULL;
+
+    if (surf == NULL) return;
+    if (*surf == NULL) return;
+
+    if ((*surf)->format->BitsPerPixel != 32 || (*surf)->refcount > 1)
+    {
+        SDL_FreeSurface(*surf);
+        (*surf) = NULL;
+        return;
+    }
+
+    bucket = neuik_SurfacePool[neuik_Pool_GetBucket((*surf)->w, (*surf)->h)];
+    entry  = &bucket[0];
+    for (ctr = 0; ctr < NEUIK_SURFACEPOOL_PERBUCKET; ctr++)
+    {
+        if (bucket[ctr].surf == NULL)
+        {
+            entry = &bucket[ctr];
+            break;
+        }
+        if (bucket[ctr].lastUsed < entry->lastUsed)
+        {
+            entry = &bucket[ctr];
+        }
+    }
+    if (entry->surf != NULL) SDL_FreeSurface(entry->surf);
+
+    entry->surf     = *surf;
+    entry->lastUsed = neuik_Pool_Frame;
+    (*surf) = NULL;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Pool_EndFrame
+ *
+ *  Description:   Advance the frame counter of the texture and surface pools 
+ *                 and destroy any pooled entries which have not been used 
+ *                 within the last NEUIK_POOL_MAXIDLE frames. This should be 
+ *                 called once after each completed frame.
+ *
+ ******************************************************************************/
+void neuik_Pool_EndFrame()
+{
+    int                      bCtr;
+    int                      ctr;
+    neuik_TexturePoolEntry * tEntry;
+    neuik_SurfacePoolEntry * sEntry;
+
+    neuik_Pool_Frame++;
+    if (neuik_Pool_Frame <= NEUIK_POOL_MAXIDLE) return;
+
+    for (bCtr = 0; bCtr < NEUIK_POOL_BUCKETS; bCtr++)
+    {
+        for (ctr = 0; ctr < NEUIK_TEXTUREPOOL_PERBUCKET; ctr++)
+        {
+            tEntry = &neuik_TexturePool[bCtr][ctr];
+            if (tEntry->tex == NULL) continue;
+            if (tEntry->lastUsed + NEUIK_POOL_MAXIDLE > neuik_Pool_Frame) continue;
+
+            SDL_DestroyTexture(tEntry->tex);
+            tEntry->tex  = NULL;
+            tEntry->rend = NULL;
+        }
+        for (ctr = 0; ctr < NEUIK_SURFACEPOOL_PERBUCKET; ctr++)
+        {
+            sEntry = &neuik_SurfacePool[bCtr][ctr];
+            if (sEntry->surf == NULL) continue;
+            if (sEntry->lastUsed + NEUIK_POOL_MAXIDLE > neuik_Pool_Frame) continue;
+
+            SDL_FreeSurface(sEntry->surf);
+            sEntry->surf = NULL;
+        }
+    }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Destroy all of the pooled textures which belong to the specified renderer. */
+/*----------------------------------------------------------------------------*/
+static void neuik_TexturePool_DropRenderer(
+    SDL_Renderer * rend)
+{
+    int                      bCtr;
+    int                      ctr;
+    neuik_TexturePoolEntry * entry;
+
+    for (bCtr = 0; bCtr < NEUIK_POOL_BUCKETS; bCtr++)
+    {
+        for (ctr = 0; ctr < NEUIK_TEXTUREPOOL_PERBUCKET; ctr++)
+        {
+            entry = &neuik_TexturePool[bCtr][ctr];
+            if (entry->rend != rend) continue;
+
+            if (entry->tex != NULL) SDL_DestroyTexture(entry->tex);
+            entry->tex  = NULL;
+            entry->rend = NULL;
+        }
+    }
+}
+
+
 /*******************************************************************************
  *
  *  Name:          RenderArrowDown
@@ -109,7 +519,7 @@ SDL_Texture * NEUIK_RenderArrowDown(
     /* Present the renderer and update the texture                            */
     /*------------------------------------------------------------------------*/
     SDL_RenderPresent(iRend);
-    rvTex = SDL_CreateTextureFromSurface(xRend, iSurf);
+    rvTex = neuik_CreateTextureFromSurface(xRend, iSurf);
     if (rvTex == NULL)
     {
         eNum = 3;
@@ -131,7 +541,9 @@ out:
  *
  *  Name:          RenderText
  *
- *  Description:   Renders a string of text as a SDL_Texture*.
+ *  Description:   Renders a string of text as a SDL_Texture*. The texture is
+ *                 taken from the texture pool; once it has been drawn it 
+ *                 should be returned using `neuik_TexturePool_Release()`.
  *
  *  Returns:       NULL if there is a problem, otherwise a valid SDL_Texture*.
  *
@@ -144,6 +556,7 @@ SDL_Texture * NEUIK_RenderText(
     int           *rvW,      /* [out] best width for resulting surface */
     int           *rvH)      /* [out] best height for resulting surface */
 {
+    int            profiled;     /* if text rasterization is being profiled */
     SDL_Color      color;
     SDL_Surface  * surf  = NULL;
     SDL_Texture  * rvTex = NULL;
@@ -168,10 +581,33 @@ SDL_Texture * NEUIK_RenderText(
 
     TTF_SizeText(font, textStr, rvW, rvH);
 
+    profiled = neuik_Profile_Begin(NEUIK_PROFILE_RENDERTEXT, NULL, NULL);
     surf = TTF_RenderText_Blended(font, textStr, color);
+    neuik_Profile_End(profiled);
     if (surf != NULL)
     {
-        rvTex = SDL_CreateTextureFromSurface(renderer, surf);
+        /*--------------------------------------------------------------------*/
+        /* Upload the text into a pooled texture; text is usually redrawn at  */
+        /* the same size so this avoids a texture creation per draw.          */
+        /*--------------------------------------------------------------------*/
+        rvTex = neuik_TexturePool_Acquire(renderer, surf->format->format,
+            SDL_TEXTUREACCESS_STATIC, surf->w, surf->h);
+        if (rvTex != NULL)
+        {
+            if (SDL_UpdateTexture(rvTex, NULL, surf->pixels, surf->pitch))
+            {
+                SDL_DestroyTexture(rvTex);
+                rvTex = NULL;
+            }
+        }
+        if (rvTex != NULL)
+        {
+            SDL_SetTextureBlendMode(rvTex, SDL_BLENDMODE_BLEND);
+        }
+        else
+        {
+            rvTex = neuik_CreateTextureFromSurface(renderer, surf);
+        }
         if (rvTex == NULL)
         {
             eNum = 3;
@@ -213,6 +649,7 @@ SDL_Surface * NEUIK_RenderTextAsSurface(
     int           *rvW,      /* [out] best width for resulting surface */
     int           *rvH)      /* [out] best height for resulting surface */
 {
+    int            profiled;     /* if text rasterization is being profiled */
     SDL_Color      color;
     SDL_Surface  * surf  = NULL;
     int            eNum  = 0;    /* which error to report (if any) */
@@ -236,7 +673,9 @@ SDL_Surface * NEUIK_RenderTextAsSurface(
 
     TTF_SizeText(font, textStr, rvW, rvH);
 
+    profiled = neuik_Profile_Begin(NEUIK_PROFILE_RENDERTEXT, NULL, NULL);
     surf = TTF_RenderText_Blended(font, textStr, color);
+    neuik_Profile_End(profiled);
     if (surf == NULL)
     {
         eNum = 2;
@@ -251,61 +690,124 @@ out:
 }
 
 
+/*----------------------------------------------------------------------------*/
+/* Compiled gradients                                                         */
+/*                                                                            */
+/* A set of ColorStops is validated once and sampled into a lookup table of   */
+/* NEUIK_GRADIENT_LUTSIZE colors. A gradient of any length is then generated  */
+/* by interpolating between neighbouring table entries in fixed point; this   */
+/* needs neither a search of the ColorStops nor any floating point math for   */
+/* each line, and the row fills are simple enough to be vectorized.           */
+/*----------------------------------------------------------------------------*/
+
 /*******************************************************************************
  *
- *  Name:          NEUIK_RenderGradient
+ *  Name:          neuik_Gradient_EvaluateStops
  *
- *  Description:   Renders a color gradient using the specified ColorStops.
+ *  Description:   Calculate the color of a gradient at the specified fraction 
+ *                 directly from its ColorStops.
  *
- *                 Vertical gradients start at the top and go down from there.
- *                 Horizontal gradients start at the left and go right from there.
+ *                 The ColorStops must already have been validated.
  *
- *  Returns:       NULL if there is a problem, otherwise a valid SDL_Texture*.
+ *  Returns:       The color as an RGBA8888 pixel.
  *
  ******************************************************************************/
-SDL_Texture * NEUIK_RenderGradient(
-    NEUIK_ColorStop  ** cs,       /* [in] ColorStops which define the gradient */
-                                  /*  this array should be NULL-ptr terminated */
-    char                dirn,     /* [in] Direction of the gradient 'v' or 'h' */
-    SDL_Renderer      * renderer, /* [in] Renderer to make the texture for */
-    RenderSize          rSize)    /* [in] Desired size of the gradient */
+static Uint32 neuik_Gradient_EvaluateStops(
+    NEUIK_ColorStop ** cs,
+    float              frac)
 {
-    int             ctr;
-    int             gCtr;             /* gradient counter */
-    int             nClrs;
-    int             eNum      = 0;    /* which error to report (if any) */
-    int             clrR;
-    int             clrG;
-    int             clrB;
-    int             clrFound;
-    float           lastFrac  = -1.0;
-    float           frac;
-    float           fracDelta;        /* fraction between ColorStop 1 & 2 */
-    float           fracStart = 0.0;  /* fraction at ColorStop 1 */
-    float           fracEnd   = 1.0;  /* fraction at ColorStop 2 */
-    SDL_Renderer  * rend      = NULL;
-    SDL_Surface   * surf      = NULL;
-    SDL_Texture   * rvTex     = NULL;
-    colorDeltas   * deltaPP   = NULL;
-    colorDeltas   * clrDelta;
-    NEUIK_Color   * clr;
-    static char     funcName[] = "NEUIK_RenderGradient";
-    static char   * errMsgs[] = {"", // [0] no error
+    int           ctr;
+    int           clrR;
+    int           clrG;
+    int           clrB;
+    int           clrA;
+    float         fracDelta;        /* fraction between ColorStop 1 & 2 */
+    float         fracStart;        /* fraction at ColorStop 1 */
+    float         fracEnd   = 1.0;  /* fraction at ColorStop 2 */
+    NEUIK_Color * clr;
+    NEUIK_Color * nextClr   = NULL;
+
+    /*------------------------------------------------------------------------*/
+    /* Determine which ColorStops should be blended                           */
+    /*------------------------------------------------------------------------*/
+    fracStart = cs[0]->frac;
+    clr       = &(cs[0]->color);
+    for (ctr = 0;; ctr++)
+    {
+        if (cs[ctr] == NULL)
+        {
+            /* beyond the final ColorStop; use that color */
+            nextClr = NULL;
+            break;
+        }
+
+        if (frac < cs[ctr]->frac)
+        {
+            fracEnd = cs[ctr]->frac;
+            if (ctr > 0) nextClr = &(cs[ctr]->color);
+            break;
+        }
+
+        fracStart = cs[ctr]->frac;
+        clr       = &(cs[ctr]->color);
+    }
+
+    if (nextClr != NULL)
+    {
+        /* between two ColorStops, blend the color */
+        fracDelta = (frac - fracStart)/(fracEnd - fracStart);
+        clrR = clr->r + (int)((float)(nextClr->r - clr->r)*fracDelta);
+        clrG = clr->g + (int)((float)(nextClr->g - clr->g)*fracDelta);
+        clrB = clr->b + (int)((float)(nextClr->b - clr->b)*fracDelta);
+        clrA = clr->a + (int)((float)(nextClr->a - clr->a)*fracDelta);
+    }
+    else
+    {
+        /* not between two ColorStops, use a single color */
+        clrR = clr->r;
+        clrG = clr->g;
+        clrB = clr->b;
+        clrA = clr->a;
+    }
+
+    return ((Uint32)(clrR & 0xFF) << 24) |
+           ((Uint32)(clrG & 0xFF) << 16) |
+           ((Uint32)(clrB & 0xFF) <<  8) |
+            (Uint32)(clrA & 0xFF);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Gradient_Compile
+ *
+ *  Description:   Validate a set of ColorStops and sample them into the lookup
+ *                 table of a compiled gradient.
+ *
+ *  Returns:       1 if there is an error; 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_Gradient_Compile(
+    NEUIK_ColorStop  ** cs,   /* [in] ColorStops which define the gradient */
+                              /*  this array should be NULL-ptr terminated */
+    char                dirn, /* [in] Direction of the gradient 'v' or 'h' */
+    neuik_Gradient    * grad) /* [out] The compiled gradient */
+{
+    int           ctr;
+    int           nClrs;
+    int           eNum      = 0; /* which error to report (if any) */
+    float         lastFrac  = -1.0;
+    Uint32        hash      = 2166136261u; /* FNV-1a offset basis */
+    static char   funcName[] = "neuik_Gradient_Compile";
+    static char * errMsgs[] = {"", // [0] no error
         "Pointer to ColorStops is NULL.",                     // [1]
         "Unsupported gradient direction.",                    // [2]
-        "Invalid RenderSize supplied.",                       // [3]
-        "Unable to create RGB surface.",                      // [4]
-        "SDL_CreateTextureFromSurface failed.",               // [5]
-        "ColorStops array is empty.",                         // [6]
-        "Invalid ColorStop fraction (<0 or >1).",             // [7]
-        "ColorStops array fractions not in ascending order.", // [8]
-        "Failure to allocate memory.",                        // [9]
-        "Failed to create software renderer.",                // [10]
+        "Output argument `grad` is NULL.",                    // [3]
+        "ColorStops array is empty.",                         // [4]
+        "Invalid ColorStop fraction (<0 or >1).",             // [5]
+        "ColorStops array fractions not in ascending order.", // [6]
     };
 
-    /*------------------------------------------------------------------------*/
-    /* Check for easily issues before attempting to render the gradient       */
-    /*------------------------------------------------------------------------*/
     if (cs == NULL)
     {
         eNum = 1;
@@ -313,7 +815,7 @@ SDL_Texture * NEUIK_RenderGradient(
     }
     else if (*cs == NULL)
     {
-        eNum = 6;
+        eNum = 4;
         goto out;
     }
     if (dirn != 'v' && dirn != 'h')
@@ -321,7 +823,7 @@ SDL_Texture * NEUIK_RenderGradient(
         eNum = 2;
         goto out;
     }
-    if (rSize.w <= 0 || rSize.h <= 0)
+    if (grad == NULL)
     {
         eNum = 3;
         goto out;
@@ -336,12 +838,12 @@ SDL_Texture * NEUIK_RenderGradient(
         if (cs[nClrs] == NULL) break; /* this is the number of ColorStops */
         if (cs[nClrs]->frac < 0.0 || cs[nClrs]->frac > 1.0)
         {
-            eNum = 7;
+            eNum = 5;
             goto out;
         }
         else if (cs[nClrs]->frac < lastFrac)
         {
-            eNum = 8;
+            eNum = 6;
             goto out;
         }
         else
@@ -351,122 +853,199 @@ SDL_Texture * NEUIK_RenderGradient(
     }
 
     /*------------------------------------------------------------------------*/
-    /* Allocate memory for delta-per-px array and calculate the ColorStop     */
-    /* delta-per-px values.                                                   */
+    /* Sample the ColorStops into the lookup table.                           */
     /*------------------------------------------------------------------------*/
-    if (nClrs > 1)
+    grad->dirn   = dirn;
+    grad->nStops = nClrs;
+    for (ctr = 0; ctr < NEUIK_GRADIENT_LUTSIZE; ctr++)
     {
-        deltaPP = (colorDeltas *)malloc((nClrs - 1)*sizeof(colorDeltas));
-        if (deltaPP == NULL)
-        {
-            eNum = 9;
-            goto out;
-        }
-        for (ctr = 0; ctr < nClrs-1; ctr++)
-        {
-            deltaPP[ctr].r = (float)((cs[ctr+1]->color).r - (cs[ctr]->color).r);
-            deltaPP[ctr].g = (float)((cs[ctr+1]->color).g - (cs[ctr]->color).g);
-            deltaPP[ctr].b = (float)((cs[ctr+1]->color).b - (cs[ctr]->color).b);
-        }
+        grad->lut[ctr] = neuik_Gradient_EvaluateStops(cs,
+            (float)(ctr)/(float)(NEUIK_GRADIENT_LUTSIZE - 1));
+        hash = (hash ^ grad->lut[ctr]) * 16777619u;
+    }
+    grad->hash = hash;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
     }
 
+    return eNum;
+}
 
-    surf = SDL_CreateRGBSurface(0, rSize.w, rSize.h, 32, 0, 0, 0, 0);
-    if (surf == NULL)
+
+/*----------------------------------------------------------------------------*/
+/* Sample a compiled gradient at line `gCtr` of a gradient `length` lines     */
+/* long. Lines are sampled at frac = (gCtr+1)/length, which is converted to   */
+/* a fixed point (8-bit fraction) position within the lookup table.           */
+/*----------------------------------------------------------------------------*/
+static inline Uint32 neuik_Gradient_Sample(
+    const neuik_Gradient * grad,
+    int                    gCtr,
+    int                    length)
+{
+    Uint32 pos;
+    Uint32 idx;
+    Uint32 t;
+    Uint32 c0;
+    Uint32 c1;
+    Uint32 rb;
+    Uint32 ga;
+
+    pos = (Uint32)(((Uint64)(gCtr + 1)*((NEUIK_GRADIENT_LUTSIZE - 1) << 8))/
+        (Uint64)(length));
+    idx = pos >> 8;
+    if (idx >= NEUIK_GRADIENT_LUTSIZE - 1)
     {
-        eNum = 4;
-        goto out;
+        return grad->lut[NEUIK_GRADIENT_LUTSIZE - 1];
+    }
+    t  = pos & 0xFF;
+    c0 = grad->lut[idx];
+    c1 = grad->lut[idx + 1];
+
+    /* blend two channels at a time (R|B and G|A) */
+    rb = ((c0 >> 8) & 0x00FF00FF);
+    ga = ( c0       & 0x00FF00FF);
+    rb = (rb + ((((c1 >> 8) & 0x00FF00FF) - rb)*t >> 8)) & 0x00FF00FF;
+    ga = (ga + ((( c1       & 0x00FF00FF) - ga)*t >> 8)) & 0x00FF00FF;
+
+    return (rb << 8) | ga;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Gradient_FillPixels
+ *
+ *  Description:   Calculate the color of each line of a gradient and store it
+ *                 as an RGBA8888 pixel.
+ *
+ ******************************************************************************/
+static void neuik_Gradient_FillPixels(
+    const neuik_Gradient * grad,
+    int                    length,
+    Uint32               * pixels)
+{
+    int gCtr; /* gradient counter */
+
+    for (gCtr = 0; gCtr < length; gCtr++)
+    {
+        pixels[gCtr] = neuik_Gradient_Sample(grad, gCtr, length);
     }
+}
+
 
-    rend = SDL_CreateSoftwareRenderer(surf);
-    if (rend == NULL)
+/*******************************************************************************
+ *
+ *  Name:          NEUIK_RenderGradient
+ *
+ *  Description:   Renders a color gradient using the specified ColorStops.
+ *
+ *                 Vertical gradients start at the top and go down from there.
+ *                 Horizontal gradients start at the left and go right from there.
+ *
+ *                 The texture is taken from the texture pool; once it has been
+ *                 drawn it should be returned using `neuik_TexturePool_Release()`.
+ *
+ *  Returns:       NULL if there is a problem, otherwise a valid SDL_Texture*.
+ *
+ ******************************************************************************/
+SDL_Texture * NEUIK_RenderGradient(
+    NEUIK_ColorStop  ** cs,       /* [in] ColorStops which define the gradient */
+                                  /*  this array should be NULL-ptr terminated */
+    char                dirn,     /* [in] Direction of the gradient 'v' or 'h' */
+    SDL_Renderer      * renderer, /* [in] Renderer to make the texture for */
+    RenderSize          rSize)    /* [in] Desired size of the gradient */
+{
+    int             x;
+    int             y;
+    int             eNum      = 0;    /* which error to report (if any) */
+    Uint32          clr;
+    Uint32        * row;
+    SDL_Surface   * surf      = NULL;
+    SDL_Texture   * rvTex     = NULL;
+    neuik_Gradient  grad;
+    static char     funcName[] = "NEUIK_RenderGradient";
+    static char   * errMsgs[] = {"", // [0] no error
+        "Failure in `neuik_Gradient_Compile()`.", // [1]
+        "Invalid RenderSize supplied.",           // [2]
+        "Unable to create RGB surface.",          // [3]
+        "SDL_CreateTextureFromSurface failed.",   // [4]
+    };
+
+    if (neuik_Gradient_Compile(cs, dirn, &grad))
     {
-        eNum = 10;
+        eNum = 1;
+        goto out;
+    }
+    if (rSize.w <= 0 || rSize.h <= 0)
+    {
+        eNum = 2;
         goto out;
     }
 
+    surf = neuik_SurfacePool_Acquire(rSize.w, rSize.h,
+        0xFF000000, 0x00FF0000, 0x0000FF00, 0x000000FF);
+    if (surf == NULL)
+    {
+        eNum = 3;
+        goto out;
+    }
 
     /*------------------------------------------------------------------------*/
-    /* Fill in the colors of the gradient                                     */
+    /* Fill in the colors of the gradient; the gradient is drawn opaque.      */
     /*------------------------------------------------------------------------*/
-    if (nClrs == 1)
+    if (dirn == 'v')
     {
         /*--------------------------------------------------------------------*/
-        /* A single color; this will just be a filled rectangle               */
-        /*--------------------------------------------------------------------*/
-        clr = &(cs[0]->color);
-        SDL_SetRenderDrawColor(rend, clr->r, clr->g, clr->b, 255);
-        SDL_RenderClear(rend);
-    }
-    else if (dirn == 'v')
-    {
+        /* Vertical gradient; each row is a single color                      */
         /*--------------------------------------------------------------------*/
-        /* Draw a vertical gradient                                           */
-        /*--------------------------------------------------------------------*/
-        for (gCtr = 0; gCtr < rSize.h; gCtr++)
+        for (y = 0; y < rSize.h; y++)
         {
-            /* calculate the fractional position within the gradient */
-            frac = (float)(gCtr+1)/(float)(rSize.h);
-
-
-            /* determine which ColorStops/colorDeltas should be used */
-            fracStart = cs[0]->frac;
-            clr       = &(cs[0]->color);
-            clrDelta  = NULL;
-            clrFound  = 0;
-            for (ctr = 0;;ctr++)
-            {
-                if (cs[ctr] == NULL) break;
-
-                if (frac < cs[ctr]->frac)
-                {
-                    /* apply delta from this clr */
-                    fracEnd  = cs[ctr]->frac;
-                    clrFound = 1;
-                    break;
-                }
-
-                clr      = &(cs[ctr]->color);
-                clrDelta = &(deltaPP[ctr]);
-            }
-
-            if (!clrFound)
-            {
-                /* line is beyond the final ColorStop; use that color */
-                clrDelta = NULL;
-            }
-
-            /* calculate and set the color for this gradient line */
-            if (clrDelta != NULL)
-            {
-                /* between two ColorStops, blend the color */
-                fracDelta = (frac - fracStart)/(fracEnd - fracStart);
-                clrR = clr->r + (int)((clrDelta->r)*fracDelta);
-                clrG = clr->g + (int)((clrDelta->g)*fracDelta);
-                clrB = clr->b + (int)((clrDelta->b)*fracDelta);
-                SDL_SetRenderDrawColor(rend, clrR, clrG, clrB, 255);
-            }
-            else
+            row = (Uint32 *)((Uint8 *)(surf->pixels) + y*surf->pitch);
+            clr = neuik_Gradient_Sample(&grad, y, rSize.h) | 0x000000FF;
+            for (x = 0; x < rSize.w; x++)
             {
-                /* not between two ColorStops, use a single color */
-                SDL_SetRenderDrawColor(rend, clr->r, clr->g, clr->b, 255);
+                row[x] = clr;
             }
-
-            SDL_RenderDrawLine(rend, 0, gCtr, rSize.w - 1, gCtr); 
         }
     }
-    else if (dirn == 'h')
+    else
     {
         /*--------------------------------------------------------------------*/
-        /* Draw a horizontal gradient                                         */
+        /* Horizontal gradient; fill in the first row and copy it down        */
         /*--------------------------------------------------------------------*/
+        row = (Uint32 *)(surf->pixels);
+        neuik_Gradient_FillPixels(&grad, rSize.w, row);
+        for (x = 0; x < rSize.w; x++)
+        {
+            row[x] |= 0x000000FF;
+        }
+        for (y = 1; y < rSize.h; y++)
+        {
+            memcpy((Uint8 *)(surf->pixels) + y*surf->pitch, row,
+                rSize.w*sizeof(Uint32));
+        }
     }
 
-
-    rvTex = SDL_CreateTextureFromSurface(renderer, surf);
+    rvTex = neuik_TexturePool_Acquire(renderer, surf->format->format,
+        SDL_TEXTUREACCESS_STATIC, surf->w, surf->h);
+    if (rvTex != NULL)
+    {
+        if (SDL_UpdateTexture(rvTex, NULL, surf->pixels, surf->pitch))
+        {
+            SDL_DestroyTexture(rvTex);
+            rvTex = NULL;
+        }
+    }
+    if (rvTex == NULL)
+    {
+        rvTex = neuik_CreateTextureFromSurface(renderer, surf);
+    }
     if (rvTex == NULL)
     {
-        eNum = 5;
+        eNum = 4;
         goto out;
     }
     // SDL_SetTextureBlendMode(rvTex, SDL_BLENDMODE_NONE);
@@ -477,9 +1056,7 @@ out:
         NEUIK_RaiseError(funcName, errMsgs[eNum]);
     }
 
-    if (rend    != NULL) SDL_DestroyRenderer(rend);
-    if (surf    != NULL) SDL_FreeSurface(surf);
-    if (deltaPP != NULL) free(deltaPP);
+    if (surf != NULL) neuik_SurfacePool_Release(&surf);
 
     return rvTex;
 }
@@ -502,6 +1079,7 @@ SDL_Texture* NEUIK_RenderText_Solid(
     int           *rvW,      /* [out] best width for resulting surface */
     int           *rvH)      /* [out] best height for resulting surface */
 {
+    int           profiled; /* if text rasterization is being profiled */
     int           eNum = 0; /* which error to report (if any) */
     SDL_Color     color;
     SDL_Surface * surf  = NULL;
@@ -527,10 +1105,12 @@ SDL_Texture* NEUIK_RenderText_Solid(
 
     TTF_SizeText(font, textStr, rvW, rvH);
 
+    profiled = neuik_Profile_Begin(NEUIK_PROFILE_RENDERTEXT, NULL, NULL);
     surf = TTF_RenderText_Solid(font, textStr, color);
+    neuik_Profile_End(profiled);
     if (surf != NULL)
     {
-        rvTex = SDL_CreateTextureFromSurface(renderer, surf);
+        rvTex = neuik_CreateTextureFromSurface(renderer, surf);
         if (rvTex == NULL)
         {
             eNum = 3;
@@ -572,6 +1152,7 @@ SDL_Texture* NEUIK_RenderTextSolid(
     int           *rvW,      /* [out] best width for resulting surface */
     int           *rvH)      /* [out] best height for resulting surface */
 {
+    int           profiled; /* if text rasterization is being profiled */
     int           eNum = 0; /* which error to report (if any) */
     SDL_Color     color;
     SDL_Surface * surf  = NULL;
@@ -597,10 +1178,12 @@ SDL_Texture* NEUIK_RenderTextSolid(
 
     TTF_SizeText(font, textStr, rvW, rvH);
 
+    profiled = neuik_Profile_Begin(NEUIK_PROFILE_RENDERTEXT, NULL, NULL);
     surf = TTF_RenderText_Solid(font, textStr, color);
+    neuik_Profile_End(profiled);
     if (surf != NULL)
     {
-        rvTex = SDL_CreateTextureFromSurface(renderer, surf);
+        rvTex = neuik_CreateTextureFromSurface(renderer, surf);
         if (rvTex == NULL)
         {
             eNum = 3;
@@ -624,6 +1207,364 @@ out:
 }
 
 
+/*----------------------------------------------------------------------------*/
+/* Gradient texture cache                                                     */
+/*                                                                            */
+/* A linear gradient only varies along one axis; it is stored as a texture    */
+/* that is one pixel wide (vertical) or one pixel tall (horizontal) and is    */
+/* stretched across the full background with SDL_RenderCopy. Textures are     */
+/* kept per-renderer and are reused for as long as the compiled gradient,     */
+/* direction and length of the gradient remain the same.                      */
+/*----------------------------------------------------------------------------*/
+#define NEUIK_GRADIENTCACHE_SIZE 64
+#define NEUIK_GRADIENT_MAXSTACK  2048 /* longest gradient filled on the stack */
+
+typedef struct {
+    SDL_Renderer    * rend;     /* renderer which owns `tex` (NULL if unused) */
+    SDL_Texture     * tex;      /* cached 1px gradient texture */
+    char              dirn;     /* direction of the gradient 'v' or 'h' */
+    int               length;   /* length of the gradient (px) */
+    Uint32            hash;     /* hash of the compiled gradient lookup table */
+    Uint32            lut[NEUIK_GRADIENT_LUTSIZE];
+    unsigned int      lastUsed; /* used for least-recently-used eviction */
+} neuik_GradientCacheEntry;
+
+static neuik_GradientCacheEntry neuik_GradientCache[NEUIK_GRADIENTCACHE_SIZE];
+static unsigned int             neuik_GradientCache_Clock = 0;
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_GradientCache_Matches
+ *
+ *  Description:   Check if a cache entry holds the described gradient.
+ *
+ *  Returns:       1 if the entry matches, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_GradientCache_Matches(
+    neuik_GradientCacheEntry * entry,
+    const neuik_Gradient     * grad,
+    int                        length,
+    SDL_Renderer             * rend)
+{
+    if (entry->rend   != rend       ||
+        entry->hash   != grad->hash ||
+        entry->dirn   != grad->dirn ||
+        entry->length != length)
+    {
+        return 0;
+    }
+
+    return !memcmp(entry->lut, grad->lut, sizeof(entry->lut));
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_GetGradientTexture
+ *
+ *  Description:   Get a texture containing the described gradient. For a
+ *                 vertical gradient the texture is 1 x length pixels, for a
+ *                 horizontal gradient it is length x 1 pixels.
+ *
+ *                 The returned texture is owned by the gradient cache and must
+ *                 not be destroyed by the caller. It remains valid until the
+ *                 entry is evicted; callers should not keep it between redraws.
+ *
+ *  Returns:       NULL if there is a problem, otherwise a valid SDL_Texture*.
+ *
+ ******************************************************************************/
+SDL_Texture * neuik_GetGradientTexture(
+    const neuik_Gradient * grad,   /* [in] The compiled gradient */
+    int                    length, /* [in] Length of the gradient (px) */
+    SDL_Renderer         * rend)   /* [in] Renderer to make the texture for */
+{
+    int                        ctr;
+    int                        eNum     = 0; /* which error to report (if any) */
+    Uint32                   * pixels   = NULL;
+    Uint32                     stackPx[NEUIK_GRADIENT_MAXSTACK];
+    SDL_Texture              * rvTex    = NULL;
+    neuik_GradientCacheEntry * entry    = NULL;
+    static char                funcName[] = "neuik_GetGradientTexture";
+    static char              * errMsgs[] = {"", // [0] no error
+        "Invalid arguments supplied.",         // [1]
+        "Failure to allocate memory.",         // [2]
+        "SDL_CreateTexture failed.",           // [3]
+        "SDL_UpdateTexture failed.",           // [4]
+    };
+
+    if (grad == NULL || rend == NULL || length <= 0)
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    neuik_GradientCache_Clock++;
+
+    /*------------------------------------------------------------------------*/
+    /* Look for a matching entry; otherwise pick an unused (or the least      */
+    /* recently used) entry to hold the new gradient.                         */
+    /*------------------------------------------------------------------------*/
+    for (ctr = 0; ctr < NEUIK_GRADIENTCACHE_SIZE; ctr++)
+    {
+        if (neuik_GradientCache_Matches(
+            &neuik_GradientCache[ctr], grad, length, rend))
+        {
+            neuik_GradientCache[ctr].lastUsed = neuik_GradientCache_Clock;
+            rvTex = neuik_GradientCache[ctr].tex;
+            goto out;
+        }
+    }
+
+    entry = &neuik_GradientCache[0];
+    for (ctr = 0; ctr < NEUIK_GRADIENTCACHE_SIZE; ctr++)
+    {
+        if (neuik_GradientCache[ctr].rend == NULL)
+        {
+            entry = &neuik_GradientCache[ctr];
+            break;
+        }
+        if (neuik_GradientCache[ctr].lastUsed < entry->lastUsed)
+        {
+            entry = &neuik_GradientCache[ctr];
+        }
+    }
+    if (entry->tex != NULL) SDL_DestroyTexture(entry->tex);
+    entry->rend = NULL;
+    entry->tex  = NULL;
+
+    /*------------------------------------------------------------------------*/
+    /* Calculate the gradient and upload it as a static texture.              */
+    /*------------------------------------------------------------------------*/
+    pixels = stackPx;
+    if (length > NEUIK_GRADIENT_MAXSTACK)
+    {
+        pixels = (Uint32 *)malloc(length*sizeof(Uint32));
+        if (pixels == NULL)
+        {
+            eNum = 2;
+            goto out;
+        }
+    }
+    neuik_Gradient_FillPixels(grad, length, pixels);
+
+    rvTex = neuik_CreateTexture(rend, SDL_PIXELFORMAT_RGBA8888,
+        SDL_TEXTUREACCESS_STATIC,
+        (grad->dirn == 'v') ? 1 : length,
+        (grad->dirn == 'v') ? length : 1);
+    if (rvTex == NULL)
+    {
+        eNum = 3;
+        goto out;
+    }
+    if (SDL_UpdateTexture(rvTex, NULL, pixels,
+        (grad->dirn == 'v') ? sizeof(Uint32) : length*sizeof(Uint32)))
+    {
+        SDL_DestroyTexture(rvTex);
+        rvTex = NULL;
+        eNum = 4;
+        goto out;
+    }
+
+    entry->rend     = rend;
+    entry->tex      = rvTex;
+    entry->dirn     = grad->dirn;
+    entry->length   = length;
+    entry->hash     = grad->hash;
+    entry->lastUsed = neuik_GradientCache_Clock;
+    memcpy(entry->lut, grad->lut, sizeof(entry->lut));
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+    }
+    if (pixels != NULL && pixels != stackPx) free(pixels);
+
+    return rvTex;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_GradientCache_DropRenderer
+ *
+ *  Description:   Release all of the cached gradient textures which belong to
+ *                 the specified renderer.
+ *
+ ******************************************************************************/
+static void neuik_GradientCache_DropRenderer(
+    SDL_Renderer * rend)
+{
+    int ctr;
+
+    if (rend == NULL) return;
+
+    for (ctr = 0; ctr < NEUIK_GRADIENTCACHE_SIZE; ctr++)
+    {
+        if (neuik_GradientCache[ctr].rend != rend) continue;
+
+        if (neuik_GradientCache[ctr].tex != NULL)
+        {
+            SDL_DestroyTexture(neuik_GradientCache[ctr].tex);
+        }
+        neuik_GradientCache[ctr].rend     = NULL;
+        neuik_GradientCache[ctr].tex      = NULL;
+        neuik_GradientCache[ctr].lastUsed = 0;
+    }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Renderer-owned texture slots                                               */
+/*                                                                            */
+/* Objects which keep a texture between redraws register the location of     */
+/* their texture pointer (a slot) along with the renderer that owns it. When  */
+/* the renderer is destroyed the texture is destroyed and the slot is nulled  */
+/* out; the object then simply recreates the texture on its next redraw.      */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    SDL_Texture  ** slot; /* location of the texture pointer */
+    SDL_Renderer  * rend; /* renderer which owns the texture */
+} neuik_TextureSlot;
+
+static neuik_TextureSlot * neuik_TextureSlots      = NULL;
+static int                 neuik_TextureSlots_Used  = 0;
+static int                 neuik_TextureSlots_Alloc = 0;
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextureSlot_Set
+ *
+ *  Description:   Store a texture in a slot and register the slot so that the
+ *                 texture is released when its renderer is destroyed. Any
+ *                 texture previously held by the slot is destroyed.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextureSlot_Set(
+    SDL_Texture  ** slot, /* [in/out] location of the texture pointer */
+    SDL_Texture   * tex,  /* [in] texture to store (owned by the slot) */
+    SDL_Renderer  * rend) /* [in] renderer which owns `tex` */
+{
+    int                 ctr;
+    int                 eNum       = 0; /* which error to report (if any) */
+    neuik_TextureSlot * newSlots   = NULL;
+    static char         funcName[] = "neuik_TextureSlot_Set";
+    static char       * errMsgs[]  = {"", // [0] no error
+        "Argument `slot` is NULL.",     // [1]
+        "Failure to allocate memory.",  // [2]
+    };
+
+    if (slot == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    neuik_TextureSlot_Clear(slot);
+    if (tex == NULL) goto out;
+
+    if (neuik_TextureSlots_Used == neuik_TextureSlots_Alloc)
+    {
+        ctr = (neuik_TextureSlots_Alloc == 0) ? 16 : 2*neuik_TextureSlots_Alloc;
+        newSlots = (neuik_TextureSlot *)realloc(neuik_TextureSlots,
+            ctr*sizeof(neuik_TextureSlot));
+        if (newSlots == NULL)
+        {
+            SDL_DestroyTexture(tex);
+            eNum = 2;
+            goto out;
+        }
+        neuik_TextureSlots       = newSlots;
+        neuik_TextureSlots_Alloc = ctr;
+    }
+
+    neuik_TextureSlots[neuik_TextureSlots_Used].slot = slot;
+    neuik_TextureSlots[neuik_TextureSlots_Used].rend = rend;
+    neuik_TextureSlots_Used++;
+    *slot = tex;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextureSlot_Clear
+ *
+ *  Description:   Destroy the texture held by a registered slot (if any) and
+ *                 unregister the slot. Objects must call this on any slot they
+ *                 own before they are freed.
+ *
+ ******************************************************************************/
+void neuik_TextureSlot_Clear(
+    SDL_Texture ** slot)
+{
+    int ctr;
+
+    if (slot == NULL) return;
+
+    for (ctr = 0; ctr < neuik_TextureSlots_Used; ctr++)
+    {
+        if (neuik_TextureSlots[ctr].slot != slot) continue;
+
+        if (*slot != NULL) SDL_DestroyTexture(*slot);
+        *slot = NULL;
+
+        neuik_TextureSlots_Used--;
+        neuik_TextureSlots[ctr] = neuik_TextureSlots[neuik_TextureSlots_Used];
+        return;
+    }
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_DropRendererTextures
+ *
+ *  Description:   Release all of the cached textures (gradients, pooled 
+ *                 textures and registered texture slots) which belong to the 
+ *                 specified renderer. This should be called immediately 
+ *                 before the renderer is destroyed.
+ *
+ ******************************************************************************/
+void neuik_DropRendererTextures(
+    SDL_Renderer * rend)
+{
+    int ctr;
+
+    if (rend == NULL) return;
+
+    neuik_GradientCache_DropRenderer(rend);
+    neuik_TexturePool_DropRenderer(rend);
+
+    for (ctr = 0; ctr < neuik_TextureSlots_Used;)
+    {
+        if (neuik_TextureSlots[ctr].rend != rend)
+        {
+            ctr++;
+            continue;
+        }
+
+        if (*(neuik_TextureSlots[ctr].slot) != NULL)
+        {
+            SDL_DestroyTexture(*(neuik_TextureSlots[ctr].slot));
+        }
+        *(neuik_TextureSlots[ctr].slot) = NULL;
+
+        neuik_TextureSlots_Used--;
+        neuik_TextureSlots[ctr] = neuik_TextureSlots[neuik_TextureSlots_Used];
+    }
+}
+
+
 /*******************************************************************************
  *
  *  Name:          String_Duplicate
@@ -77,6 +77,7 @@ int neuik_RegisterClass_MaskMap()
         "The neuik_MaskMap Object.", // classDescription
         neuik__Set_NEUIK,            // classSet
         NULL,                        // superClass
+        sizeof(neuik_MaskMap),       // objSize
         &neuik_MaskMap_BaseFuncs,    // baseFuncs
         NULL,                        // classFuncs
         &neuik__Class_MaskMap))      // newClass
@@ -138,7 +139,8 @@ int neuik_NewMaskMap(
         goto out;
     }
 
-    (*mapPtr) = (neuik_MaskMap*) malloc(sizeof(neuik_MaskMap));
+    (*mapPtr) = (neuik_MaskMap*) neuik_Object_Alloc(
+        neuik__Class_MaskMap, (void**)mapPtr);
     map = (*mapPtr);
     if (map == NULL)
     {
@@ -242,7 +244,8 @@ int neuik_MakeMaskMap(
         goto out;
     }
 
-    (*mapPtr) = (neuik_MaskMap*) malloc(sizeof(neuik_MaskMap));
+    (*mapPtr) = (neuik_MaskMap*) neuik_Object_Alloc(
+        neuik__Class_MaskMap, (void**)mapPtr);
     map = (*mapPtr);
     if (map == NULL)
     {
@@ -359,7 +362,7 @@ int neuik_MaskMap_Free(
         free(map->regEnd);
     }
 
-    free(map);
+    neuik_Object_Release(map);
 out:
     if (eNum > 0)
     {
@@ -945,19 +948,17 @@ out:
 
 /*******************************************************************************
  *
- *  Name:          neuik_MaskMap_SetUnboundedMaskPoint
+ *  Name:          neuik_MaskMap_SetUnboundedMaskPoint_NoError
  *
- *  Description:   Set the mask setting for a point within the map. 
- *                 Masked points are used to identify portions of an image that
- *                 should not be rendered. The unbounded variant of this 
- *                 function will only apply the setting if pixel actually lies
- *                 within the mask bounds, the main difference being that it
- *                 will not throw an error if the pixel is out of bounds.
+ *  Description:   The implementation of
+ *                 `neuik_MaskMap_SetUnboundedMaskPoint()`. Errors are not
+ *                 raised, so this may be used from worker threads.
  *
- *  Returns:       A non-zero value if there was an error.
+ *  Returns:       The index of the error within the error messages of
+ *                 `neuik_MaskMap_SetUnboundedMaskPoint()`; 0 if there was none.
  *
  ******************************************************************************/
-int neuik_MaskMap_SetUnboundedMaskPoint(
+static int neuik_MaskMap_SetUnboundedMaskPoint_NoError(
     neuik_MaskMap * map, 
     int             maskVal, /* 0 (unmaksed) or 1 (masked) */
     int             x,
@@ -966,12 +967,8 @@ int neuik_MaskMap_SetUnboundedMaskPoint(
     int           pos      = 0; /* position of point within mapData */
     int           eNum     = 0; /* which error to report (if any) */
     int           inBounds = TRUE;
-    static char   funcName[] = "neuik_MaskMap_SetUnboundedMaskPoint";
-    static char * errMsgs[]  = {"", // [0] no error
-        "Argument `map` does not implement MaskMap class.", // [1]
-    };
 
-    if (!neuik_Object_IsClass(map, neuik__Class_MaskMap))
+    if (!neuik_Object_IsClass_NoErr(map, neuik__Class_MaskMap))
     {
         eNum = 1;
         goto out;
@@ -1004,6 +1001,37 @@ int neuik_MaskMap_SetUnboundedMaskPoint(
         map->mapData[pos] = maskVal;
     }
 out:
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_MaskMap_SetUnboundedMaskPoint
+ *
+ *  Description:   Set the mask setting for a point within the map. 
+ *                 Masked points are used to identify portions of an image that
+ *                 should not be rendered. The unbounded variant of this 
+ *                 function will only apply the setting if pixel actually lies
+ *                 within the mask bounds, the main difference being that it
+ *                 will not throw an error if the pixel is out of bounds.
+ *
+ *  Returns:       A non-zero value if there was an error.
+ *
+ ******************************************************************************/
+int neuik_MaskMap_SetUnboundedMaskPoint(
+    neuik_MaskMap * map, 
+    int             maskVal, /* 0 (unmaksed) or 1 (masked) */
+    int             x,
+    int             y)
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "neuik_MaskMap_SetUnboundedMaskPoint";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `map` does not implement MaskMap class.", // [1]
+    };
+
+    eNum = neuik_MaskMap_SetUnboundedMaskPoint_NoError(map, maskVal, x, y);
     if (eNum > 0)
     {
         NEUIK_RaiseError(funcName, errMsgs[eNum]);
@@ -1087,16 +1115,35 @@ int neuik_MaskMap_UnmaskUnboundedPoint(
 
 /*******************************************************************************
  *
- *  Name:          neuik_MaskMap_SetMaskLine
+ *  Name:          neuik_MaskMap_UnmaskUnboundedPoint_NoError
  *
- *  Description:   Set the mask setting for a line of points within the map. 
- *                 Masked points are used to identify portions of an image that
- *                 should not be rendered.
+ *  Description:   A variant of `neuik_MaskMap_UnmaskUnboundedPoint()` which
+ *                 does not raise errors; for use from worker threads.
  *
  *  Returns:       A non-zero value if there was an error.
  *
  ******************************************************************************/
-int neuik_MaskMap_SetMaskLine(
+int neuik_MaskMap_UnmaskUnboundedPoint_NoError(
+    neuik_MaskMap * map, 
+    int             x,
+    int             y)
+{
+    return (neuik_MaskMap_SetUnboundedMaskPoint_NoError(map, 0, x, y) != 0);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_MaskMap_SetMaskLine_NoError
+ *
+ *  Description:   The implementation of `neuik_MaskMap_SetMaskLine()`. Errors
+ *                 are not raised, so this may be used from worker threads.
+ *
+ *  Returns:       The index of the error within the error messages of
+ *                 `neuik_MaskMap_SetMaskLine()`; 0 if there was none.
+ *
+ ******************************************************************************/
+static int neuik_MaskMap_SetMaskLine_NoError(
     neuik_MaskMap * map, 
     int             maskVal, /* 0 (unmaksed) or 1 (masked) */
     int             x1,
@@ -1119,21 +1166,8 @@ int neuik_MaskMap_SetMaskLine(
     double        dyInt = 0.0; /* dy resulting from a single loop interval */
     double        hyp   = 0.0; /* length of the hypotenuse */
     double        fCtr  = 0.0; /* float counter */
-    static char   funcName[] = "neuik_MaskMap_SetMaskLine";
-    static char * errMsgs[]  = {"", // [0] no error
-        "Argument `map` does not implement MaskMap class.",  // [1]
-        "Argument `x1` invalid; value (<0) supplied.",       // [2]
-        "Argument `y1` invalid; value (<0) supplied.",       // [3]
-        "Argument `x1` invalid; exceeds mask bounds.",       // [4]
-        "Argument `y1` invalid; exceeds mask bounds..",      // [5]
-        "Argument `x2` invalid; value (<0) supplied.",       // [6]
-        "Argument `y2` invalid; value (<0) supplied.",       // [7]
-        "Argument `x2` invalid; exceeds mask bounds.",       // [8]
-        "Argument `y2` invalid; exceeds mask bounds..",      // [9]
-        "Argument `maskVal` invalid; value must be 0 or 1.", // [10]
-    };
 
-    if (!neuik_Object_IsClass(map, neuik__Class_MaskMap))
+    if (!neuik_Object_IsClass_NoErr(map, neuik__Class_MaskMap))
     {
         eNum = 1;
         goto out;
@@ -1281,6 +1315,45 @@ int neuik_MaskMap_SetMaskLine(
         map->mapData[pos] = maskVal;
     }
 out:
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_MaskMap_SetMaskLine
+ *
+ *  Description:   Set the mask setting for a line of points within the map. 
+ *                 Masked points are used to identify portions of an image that
+ *                 should not be rendered.
+ *
+ *  Returns:       A non-zero value if there was an error.
+ *
+ ******************************************************************************/
+int neuik_MaskMap_SetMaskLine(
+    neuik_MaskMap * map, 
+    int             maskVal, /* 0 (unmaksed) or 1 (masked) */
+    int             x1,
+    int             y1,
+    int             x2,
+    int             y2)
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "neuik_MaskMap_SetMaskLine";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `map` does not implement MaskMap class.",  // [1]
+        "Argument `x1` invalid; value (<0) supplied.",       // [2]
+        "Argument `y1` invalid; value (<0) supplied.",       // [3]
+        "Argument `x1` invalid; exceeds mask bounds.",       // [4]
+        "Argument `y1` invalid; exceeds mask bounds..",      // [5]
+        "Argument `x2` invalid; value (<0) supplied.",       // [6]
+        "Argument `y2` invalid; value (<0) supplied.",       // [7]
+        "Argument `x2` invalid; exceeds mask bounds.",       // [8]
+        "Argument `y2` invalid; exceeds mask bounds..",      // [9]
+        "Argument `maskVal` invalid; value must be 0 or 1.", // [10]
+    };
+
+    eNum = neuik_MaskMap_SetMaskLine_NoError(map, maskVal, x1, y1, x2, y2);
     if (eNum > 0)
     {
         NEUIK_RaiseError(funcName, errMsgs[eNum]);
@@ -1292,20 +1365,17 @@ out:
 
 /*******************************************************************************
  *
- *  Name:          neuik_MaskMap_SetUnboundedMaskLine
+ *  Name:          neuik_MaskMap_SetUnboundedMaskLine_NoError
  *
- *  Description:   Set the mask setting for a line of points within the map. 
- *                 Masked points are used to identify portions of an image that
- *                 should not be rendered. The unbounded variant of this 
- *                 function does not check perform bounds checking on the line
- *                 to be (un)masked. Instead the individual pixels of the 
- *                 resulting line are bounds checked and are applied only if 
- *                 they are actually within the mask bounds.
+ *  Description:   The implementation of `neuik_MaskMap_SetUnboundedMaskLine()`.
+ *                 Errors are not raised, so this may be used from worker
+ *                 threads.
  *
- *  Returns:       A non-zero value if there was an error.
+ *  Returns:       The index of the error within the error messages of
+ *                 `neuik_MaskMap_SetUnboundedMaskLine()`; 0 if there was none.
  *
  ******************************************************************************/
-int neuik_MaskMap_SetUnboundedMaskLine(
+static int neuik_MaskMap_SetUnboundedMaskLine_NoError(
     neuik_MaskMap * map, 
     int             maskVal, /* 0 (unmaksed) or 1 (masked) */
     int             x1,
@@ -1330,13 +1400,8 @@ int neuik_MaskMap_SetUnboundedMaskLine(
     double        dyInt = 0.0; /* dy resulting from a single loop interval */
     double        hyp   = 0.0; /* length of the hypotenuse */
     double        fCtr  = 0.0; /* float counter */
-    static char   funcName[] = "neuik_MaskMap_SetUnboundedMaskLine";
-    static char * errMsgs[]  = {"", // [0] no error
-        "Argument `map` does not implement MaskMap class.",  // [1]
-        "Argument `maskVal` invalid; value must be 0 or 1.", // [2]
-    };
 
-    if (!neuik_Object_IsClass(map, neuik__Class_MaskMap))
+    if (!neuik_Object_IsClass_NoErr(map, neuik__Class_MaskMap))
     {
         eNum = 1;
         goto out;
@@ -1444,6 +1509,42 @@ int neuik_MaskMap_SetUnboundedMaskLine(
         }
     }
 out:
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_MaskMap_SetUnboundedMaskLine
+ *
+ *  Description:   Set the mask setting for a line of points within the map. 
+ *                 Masked points are used to identify portions of an image that
+ *                 should not be rendered. The unbounded variant of this 
+ *                 function does not check perform bounds checking on the line
+ *                 to be (un)masked. Instead the individual pixels of the 
+ *                 resulting line are bounds checked and are applied only if 
+ *                 they are actually within the mask bounds.
+ *
+ *  Returns:       A non-zero value if there was an error.
+ *
+ ******************************************************************************/
+int neuik_MaskMap_SetUnboundedMaskLine(
+    neuik_MaskMap * map, 
+    int             maskVal, /* 0 (unmaksed) or 1 (masked) */
+    int             x1,
+    int             y1,
+    int             x2,
+    int             y2)
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "neuik_MaskMap_SetUnboundedMaskLine";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `map` does not implement MaskMap class.",  // [1]
+        "Argument `maskVal` invalid; value must be 0 or 1.", // [2]
+    };
+
+    eNum = neuik_MaskMap_SetUnboundedMaskLine_NoError(
+        map, maskVal, x1, y1, x2, y2);
     if (eNum > 0)
     {
         NEUIK_RaiseError(funcName, errMsgs[eNum]);
@@ -1521,6 +1622,27 @@ int neuik_MaskMap_UnmaskLine(
 }
 
 
+/*******************************************************************************
+ *
+ *  Name:          neuik_MaskMap_UnmaskLine_NoError
+ *
+ *  Description:   A variant of `neuik_MaskMap_UnmaskLine()` which does not
+ *                 raise errors; for use from worker threads.
+ *
+ *  Returns:       A non-zero value if there was an error.
+ *
+ ******************************************************************************/
+int neuik_MaskMap_UnmaskLine_NoError(
+    neuik_MaskMap * map, 
+    int             x1,
+    int             y1,
+    int             x2,
+    int             y2)
+{
+    return (neuik_MaskMap_SetMaskLine_NoError(map, 0, x1, y1, x2, y2) != 0);
+}
+
+
 /*******************************************************************************
  *
  *  Name:          neuik_MaskMap_UnmaskUnboundedLine
@@ -1559,6 +1681,28 @@ int neuik_MaskMap_UnmaskUnboundedLine(
 }
 
 
+/*******************************************************************************
+ *
+ *  Name:          neuik_MaskMap_UnmaskUnboundedLine_NoError
+ *
+ *  Description:   A variant of `neuik_MaskMap_UnmaskUnboundedLine()` which does
+ *                 not raise errors; for use from worker threads.
+ *
+ *  Returns:       A non-zero value if there was an error.
+ *
+ ******************************************************************************/
+int neuik_MaskMap_UnmaskUnboundedLine_NoError(
+    neuik_MaskMap * map, 
+    int             x1,
+    int             y1,
+    int             x2,
+    int             y2)
+{
+    return (neuik_MaskMap_SetUnboundedMaskLine_NoError(
+        map, 0, x1, y1, x2, y2) != 0);
+}
+
+
 /*******************************************************************************
  *
  *  Name:          neuik_MaskMap_SetMaskRect
@@ -29,6 +29,11 @@
  *  Description:   Renders a 1-4 pixel wide X-Y scatter line plot to a maskMap.
  *                 This version handles rendering of 32bit floating point data.
  *
+ *                 The line is unmasked within `lineMask`, which must be a 
+ *                 fully masked `maskW` x `maskH` map. This may be run on a 
+ *                 worker thread; errors are not raised, instead a description
+ *                 of the error is stored in `errMsg` for the caller to raise.
+ *
  *  Returns:       1 if there is an error; 0 otherwise.
  *
  ******************************************************************************/
@@ -43,7 +48,8 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
     int                     ticZoneH,
     int                     ticZoneOffsetX,
     int                     ticZoneOffsetY,
-    neuik_MaskMap        ** lineMask)
+    neuik_MaskMap         * lineMask,
+    const char           ** errMsg)
 {
     unsigned int  uCtr       = 0;
     int           firstPt    = TRUE;
@@ -72,36 +78,48 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
     double        pxDeltaY   = 0.0; /* y-axis height represented by one pixel */
     NEUIK_Plot  * plot       = NULL;
     int           eNum       = 0; /* which error to report (if any) */
-    static char   funcName[] = "neuik_Plot2D_Render32_SimpleLineToMask";
     static char * errMsgs[]  = {"", // [0] no error
         "Argument `plot2d` is not of Plot2D class.",                           // [1]
         "Argument `plot2d` caused `neuik_Object_GetClassObject` to fail.",     // [2]
-        "Output Argument `lineMask` is NULL.",                                 // [3]
-        "Failure in `neuik_MakeMaskMap()`.",                                   // [4]
-        "Failure in `neuik_MaskAll()`.",                                       // [5]
-        "Failure in `neuik_MaskMap_UnmaskUnboundedPoint()`.",                  // [6]
-        "Failure in `neuik_MaskMap_UnmaskLine()`.",                            // [7]
+        "Argument `lineMask` is not of MaskMap class.",                        // [3]
+        "Argument `lineMask` does not match the size `maskW` x `maskH`.",      // [4]
+        "Output Argument `errMsg` is NULL.",                                   // [5]
+        "Failure in `neuik_MaskMap_UnmaskUnboundedPoint_NoError()`.",          // [6]
+        "Failure in `neuik_MaskMap_UnmaskLine_NoError()`.",                    // [7]
         "Argument `data` has an unsupported value for precision.",             // [8]
         "Argument `thickness` has an invalid value (values `1-4` are valid).", // [9]
-        "Failure in `neuik_MaskMap_UnmaskUnboundedLine()`.",                   // [10]
+        "Failure in `neuik_MaskMap_UnmaskUnboundedLine_NoError()`.",           // [10]
     };
 
-    if (!neuik_Object_IsClass(plot2d, neuik__Class_Plot2D))
+    if (errMsg == NULL)
+    {
+        eNum = 5;
+        goto out;
+    }
+    (*errMsg) = NULL;
+
+    if (!neuik_Object_IsClass_NoErr(plot2d, neuik__Class_Plot2D))
     {
         eNum = 1;
         goto out;
     }
 
-    if (neuik_Object_GetClassObject(plot2d, neuik__Class_Plot, (void**)&plot))
+    if (neuik_Object_GetClassObject_NoError(
+        plot2d, neuik__Class_Plot, (void**)&plot))
     {
         eNum = 2;
         goto out;
     }
-    if (lineMask == NULL)
+    if (!neuik_Object_IsClass_NoErr(lineMask, neuik__Class_MaskMap))
     {
         eNum = 3;
         goto out;
     }
+    if (lineMask->sizeW != maskW || lineMask->sizeH != maskH)
+    {
+        eNum = 4;
+        goto out;
+    }
     if (data->precision != 32)
     {
         eNum = 8;
@@ -118,23 +136,6 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
     yRangeMin = plot->y_range_min;
     yRangeMax = plot->y_range_max;
 
-    if (neuik_MakeMaskMap(lineMask, maskW, maskH))
-    {
-        eNum = 4;
-        goto out;
-    }
-
-    /*------------------------------------------------------------------------*/
-    /* There are built-in methods for getting easy access to collapsed        */
-    /* unmasked regions; leverage this by setting pixels not encompassed as   */
-    /* masked.                                                                */
-    /*------------------------------------------------------------------------*/
-    if (neuik_MaskMap_MaskAll(*lineMask))
-    {
-        eNum = 5;
-        goto out;
-    }
-
     pxDeltaX = (xRangeMax - xRangeMin)/((double)(ticZoneW));
     pxDeltaY = (yRangeMax - yRangeMin)/((double)(ticZoneH));
 
@@ -274,7 +275,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                 switch (thickness)
                 {
                 case 1:
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX, 
                         maskPtY1 + ticZoneOffsetY,
                         maskPtX2 + ticZoneOffsetX, 
@@ -285,7 +286,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                     }
                     break;
                 case 2:
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX - 1, 
                         maskPtY1 + ticZoneOffsetY,
                         maskPtX2 + ticZoneOffsetX - 1, 
@@ -294,7 +295,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX, 
                         maskPtY1 + ticZoneOffsetY,
                         maskPtX2 + ticZoneOffsetX, 
@@ -303,7 +304,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX, 
                         maskPtY1 + ticZoneOffsetY + 1,
                         maskPtX2 + ticZoneOffsetX, 
@@ -312,7 +313,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX - 1, 
                         maskPtY1 + ticZoneOffsetY + 1,
                         maskPtX2 + ticZoneOffsetX - 1, 
@@ -326,7 +327,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Top y-axis row (of three).                             */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX - 1, 
                         maskPtY1 + ticZoneOffsetY - 1,
                         maskPtX2 + ticZoneOffsetX - 1, 
@@ -335,7 +336,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX, 
                         maskPtY1 + ticZoneOffsetY - 1,
                         maskPtX2 + ticZoneOffsetX, 
@@ -344,7 +345,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX + 1, 
                         maskPtY1 + ticZoneOffsetY - 1,
                         maskPtX2 + ticZoneOffsetX + 1, 
@@ -357,7 +358,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Middle y-axis row (of three).                          */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX - 1, 
                         maskPtY1 + ticZoneOffsetY,
                         maskPtX2 + ticZoneOffsetX - 1, 
@@ -366,7 +367,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX, 
                         maskPtY1 + ticZoneOffsetY,
                         maskPtX2 + ticZoneOffsetX, 
@@ -375,7 +376,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX + 1, 
                         maskPtY1 + ticZoneOffsetY,
                         maskPtX2 + ticZoneOffsetX + 1, 
@@ -388,7 +389,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Bottom y-axis row (of three).                          */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX - 1, 
                         maskPtY1 + ticZoneOffsetY + 1,
                         maskPtX2 + ticZoneOffsetX - 1, 
@@ -397,7 +398,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX, 
                         maskPtY1 + ticZoneOffsetY + 1,
                         maskPtX2 + ticZoneOffsetX, 
@@ -406,7 +407,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX + 1, 
                         maskPtY1 + ticZoneOffsetY + 1,
                         maskPtX2 + ticZoneOffsetX + 1, 
@@ -420,7 +421,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Top y-axis row (first of four).                        */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX, 
                         maskPtY1 + ticZoneOffsetY - 1,
                         maskPtX2 + ticZoneOffsetX, 
@@ -429,7 +430,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX + 1, 
                         maskPtY1 + ticZoneOffsetY + 2,
                         maskPtX2 + ticZoneOffsetX + 1, 
@@ -442,7 +443,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Upper-middle y-axis row (second of four).              */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX - 1, 
                         maskPtY1 + ticZoneOffsetY,
                         maskPtX2 + ticZoneOffsetX - 1, 
@@ -451,7 +452,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX, 
                         maskPtY1 + ticZoneOffsetY,
                         maskPtX2 + ticZoneOffsetX, 
@@ -460,7 +461,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX + 1, 
                         maskPtY1 + ticZoneOffsetY,
                         maskPtX2 + ticZoneOffsetX + 1, 
@@ -469,7 +470,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX + 2, 
                         maskPtY1 + ticZoneOffsetY,
                         maskPtX2 + ticZoneOffsetX + 2, 
@@ -482,7 +483,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Lower-middle y-axis row (third of four).               */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX - 1, 
                         maskPtY1 + ticZoneOffsetY + 1,
                         maskPtX2 + ticZoneOffsetX - 1, 
@@ -491,7 +492,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX, 
                         maskPtY1 + ticZoneOffsetY + 1,
                         maskPtX2 + ticZoneOffsetX, 
@@ -500,7 +501,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX + 1, 
                         maskPtY1 + ticZoneOffsetY + 1,
                         maskPtX2 + ticZoneOffsetX + 1, 
@@ -509,7 +510,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX + 2, 
                         maskPtY1 + ticZoneOffsetY + 1,
                         maskPtX2 + ticZoneOffsetX + 2, 
@@ -522,7 +523,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Bottom y-axis row (of four).                           */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX, 
                         maskPtY1 + ticZoneOffsetY + 2,
                         maskPtX2 + ticZoneOffsetX, 
@@ -531,7 +532,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX + 1, 
                         maskPtY1 + ticZoneOffsetY + 2,
                         maskPtX2 + ticZoneOffsetX + 1, 
@@ -701,7 +702,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                     switch (thickness)
                     {
                     case 1:
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX, 
                             maskPtY1 + ticZoneOffsetY,
                             maskPtX2 + ticZoneOffsetX, 
@@ -712,7 +713,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                         }
                         break;
                     case 2:
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX - 1, 
                             maskPtY1 + ticZoneOffsetY,
                             maskPtX2 + ticZoneOffsetX - 1, 
@@ -721,7 +722,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX, 
                             maskPtY1 + ticZoneOffsetY,
                             maskPtX2 + ticZoneOffsetX, 
@@ -730,7 +731,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX, 
                             maskPtY1 + ticZoneOffsetY + 1,
                             maskPtX2 + ticZoneOffsetX, 
@@ -739,7 +740,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX - 1, 
                             maskPtY1 + ticZoneOffsetY + 1,
                             maskPtX2 + ticZoneOffsetX - 1, 
@@ -753,7 +754,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                         /*----------------------------------------------------*/
                         /* Top y-axis row (of three).                         */
                         /*----------------------------------------------------*/
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX - 1, 
                             maskPtY1 + ticZoneOffsetY - 1,
                             maskPtX2 + ticZoneOffsetX - 1, 
@@ -762,7 +763,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX, 
                             maskPtY1 + ticZoneOffsetY - 1,
                             maskPtX2 + ticZoneOffsetX, 
@@ -771,7 +772,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX + 1, 
                             maskPtY1 + ticZoneOffsetY - 1,
                             maskPtX2 + ticZoneOffsetX + 1, 
@@ -784,7 +785,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                         /*----------------------------------------------------*/
                         /* Middle y-axis row (of three).                      */
                         /*----------------------------------------------------*/
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX - 1, 
                             maskPtY1 + ticZoneOffsetY,
                             maskPtX2 + ticZoneOffsetX - 1, 
@@ -793,7 +794,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX, 
                             maskPtY1 + ticZoneOffsetY,
                             maskPtX2 + ticZoneOffsetX, 
@@ -802,7 +803,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX + 1, 
                             maskPtY1 + ticZoneOffsetY,
                             maskPtX2 + ticZoneOffsetX + 1, 
@@ -815,7 +816,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                         /*----------------------------------------------------*/
                         /* Bottom y-axis row (of three).                      */
                         /*----------------------------------------------------*/
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX - 1, 
                             maskPtY1 + ticZoneOffsetY + 1,
                             maskPtX2 + ticZoneOffsetX - 1, 
@@ -824,7 +825,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX, 
                             maskPtY1 + ticZoneOffsetY + 1,
                             maskPtX2 + ticZoneOffsetX, 
@@ -833,7 +834,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX + 1, 
                             maskPtY1 + ticZoneOffsetY + 1,
                             maskPtX2 + ticZoneOffsetX + 1, 
@@ -847,7 +848,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                         /*----------------------------------------------------*/
                         /* Top y-axis row (first of four).                    */
                         /*----------------------------------------------------*/
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX, 
                             maskPtY1 + ticZoneOffsetY - 1,
                             maskPtX2 + ticZoneOffsetX, 
@@ -856,7 +857,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX + 1, 
                             maskPtY1 + ticZoneOffsetY + 2,
                             maskPtX2 + ticZoneOffsetX + 1, 
@@ -869,7 +870,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                         /*----------------------------------------------------*/
                         /* Upper-middle y-axis row (second of four).          */
                         /*----------------------------------------------------*/
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX - 1, 
                             maskPtY1 + ticZoneOffsetY,
                             maskPtX2 + ticZoneOffsetX - 1, 
@@ -878,7 +879,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX, 
                             maskPtY1 + ticZoneOffsetY,
                             maskPtX2 + ticZoneOffsetX, 
@@ -887,7 +888,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX + 1, 
                             maskPtY1 + ticZoneOffsetY,
                             maskPtX2 + ticZoneOffsetX + 1, 
@@ -896,7 +897,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX + 2, 
                             maskPtY1 + ticZoneOffsetY,
                             maskPtX2 + ticZoneOffsetX + 2, 
@@ -909,7 +910,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                         /*----------------------------------------------------*/
                         /* Lower-middle y-axis row (third of four).           */
                         /*----------------------------------------------------*/
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX - 1, 
                             maskPtY1 + ticZoneOffsetY + 1,
                             maskPtX2 + ticZoneOffsetX - 1, 
@@ -918,7 +919,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX, 
                             maskPtY1 + ticZoneOffsetY + 1,
                             maskPtX2 + ticZoneOffsetX, 
@@ -927,7 +928,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX + 1, 
                             maskPtY1 + ticZoneOffsetY + 1,
                             maskPtX2 + ticZoneOffsetX + 1, 
@@ -936,7 +937,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX + 2, 
                             maskPtY1 + ticZoneOffsetY + 1,
                             maskPtX2 + ticZoneOffsetX + 2, 
@@ -949,7 +950,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                         /*----------------------------------------------------*/
                         /* Bottom y-axis row (of four).                       */
                         /*----------------------------------------------------*/
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX, 
                             maskPtY1 + ticZoneOffsetY + 2,
                             maskPtX2 + ticZoneOffsetX, 
@@ -958,7 +959,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX + 1, 
                             maskPtY1 + ticZoneOffsetY + 2,
                             maskPtX2 + ticZoneOffsetX + 1, 
@@ -1002,7 +1003,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                 switch (thickness)
                 {
                 case 1:
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX, 
                         maskPtY + ticZoneOffsetY))
                     {
@@ -1011,28 +1012,28 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                     }
                     break;
                 case 2:
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX - 1, 
                         maskPtY + ticZoneOffsetY))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX, 
                         maskPtY + ticZoneOffsetY))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX, 
                         maskPtY + ticZoneOffsetY + 1))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX - 1, 
                         maskPtY + ticZoneOffsetY + 1))
                     {
@@ -1044,21 +1045,21 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Top y-axis row (of three).                             */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX - 1, 
                         maskPtY + ticZoneOffsetY - 1))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX, 
                         maskPtY + ticZoneOffsetY - 1))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX + 1, 
                         maskPtY + ticZoneOffsetY - 1))
                     {
@@ -1069,21 +1070,21 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Middle y-axis row (of three).                          */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX - 1, 
                         maskPtY + ticZoneOffsetY))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX, 
                         maskPtY + ticZoneOffsetY))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX + 1, 
                         maskPtY + ticZoneOffsetY))
                     {
@@ -1094,21 +1095,21 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Bottom y-axis row (of three).                          */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX - 1, 
                         maskPtY + ticZoneOffsetY + 1))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX, 
                         maskPtY + ticZoneOffsetY + 1))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX + 1, 
                         maskPtY + ticZoneOffsetY + 1))
                     {
@@ -1120,14 +1121,14 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Top y-axis row (first of four).                        */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX, 
                         maskPtY + ticZoneOffsetY - 1))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX + 1, 
                         maskPtY + ticZoneOffsetY - 1))
                     {
@@ -1138,28 +1139,28 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Upper-middle y-axis row (second of four).              */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX - 1, 
                         maskPtY + ticZoneOffsetY))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX, 
                         maskPtY + ticZoneOffsetY))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX + 1, 
                         maskPtY + ticZoneOffsetY))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX + 2, 
                         maskPtY + ticZoneOffsetY))
                     {
@@ -1170,28 +1171,28 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Lower-middle y-axis row (third of four).               */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX - 1, 
                         maskPtY + ticZoneOffsetY + 1))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX, 
                         maskPtY + ticZoneOffsetY + 1))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX + 1, 
                         maskPtY + ticZoneOffsetY + 1))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX + 2, 
                         maskPtY + ticZoneOffsetY + 1))
                     {
@@ -1202,14 +1203,14 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Bottom y-axis row (of four).                           */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX, 
                         maskPtY + ticZoneOffsetY + 2))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX + 1, 
                         maskPtY + ticZoneOffsetY + 2))
                     {
@@ -1227,7 +1228,7 @@ int neuik_Plot2D_Render32_SimpleLineToMask(
 out:
     if (eNum > 0)
     {
-        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        if (errMsg != NULL) (*errMsg) = errMsgs[eNum];
         eNum = 1;
     }
 
@@ -29,6 +29,11 @@
  *  Description:   Renders a 1-4 pixel wide X-Y scatter line plot to a maskMap.
  *                 This version handles rendering of 64bit floating point data.
  *
+ *                 The line is unmasked within `lineMask`, which must be a 
+ *                 fully masked `maskW` x `maskH` map. This may be run on a 
+ *                 worker thread; errors are not raised, instead a description
+ *                 of the error is stored in `errMsg` for the caller to raise.
+ *
  *  Returns:       1 if there is an error; 0 otherwise.
  *
  ******************************************************************************/
@@ -43,7 +48,8 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
     int                     ticZoneH,
     int                     ticZoneOffsetX,
     int                     ticZoneOffsetY,
-    neuik_MaskMap        ** lineMask)
+    neuik_MaskMap         * lineMask,
+    const char           ** errMsg)
 {
     unsigned int  uCtr       = 0;
     int           firstPt    = TRUE;
@@ -72,36 +78,48 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
     double        pxDeltaY   = 0.0; /* y-axis height represented by one pixel */
     NEUIK_Plot  * plot       = NULL;
     int           eNum       = 0; /* which error to report (if any) */
-    static char   funcName[] = "neuik_Plot2D_Render64_SimpleLineToMask";
     static char * errMsgs[]  = {"", // [0] no error
         "Argument `plot2d` is not of Plot2D class.",                           // [1]
         "Argument `plot2d` caused `neuik_Object_GetClassObject` to fail.",     // [2]
-        "Output Argument `lineMask` is NULL.",                                 // [3]
-        "Failure in `neuik_MakeMaskMap()`.",                                   // [4]
-        "Failure in `neuik_MaskAll()`.",                                       // [5]
-        "Failure in `neuik_MaskMap_UnmaskUnboundedPoint()`.",                  // [6]
-        "Failure in `neuik_MaskMap_UnmaskLine()`.",                            // [7]
+        "Argument `lineMask` is not of MaskMap class.",                        // [3]
+        "Argument `lineMask` does not match the size `maskW` x `maskH`.",      // [4]
+        "Output Argument `errMsg` is NULL.",                                   // [5]
+        "Failure in `neuik_MaskMap_UnmaskUnboundedPoint_NoError()`.",          // [6]
+        "Failure in `neuik_MaskMap_UnmaskLine_NoError()`.",                    // [7]
         "Argument `data` has an unsupported value for precision.",             // [8]
         "Argument `thickness` has an invalid value (values `1-4` are valid).", // [9]
-        "Failure in `neuik_MaskMap_UnmaskUnboundedLine()`.",                   // [10]
+        "Failure in `neuik_MaskMap_UnmaskUnboundedLine_NoError()`.",           // [10]
     };
 
-    if (!neuik_Object_IsClass(plot2d, neuik__Class_Plot2D))
+    if (errMsg == NULL)
+    {
+        eNum = 5;
+        goto out;
+    }
+    (*errMsg) = NULL;
+
+    if (!neuik_Object_IsClass_NoErr(plot2d, neuik__Class_Plot2D))
     {
         eNum = 1;
         goto out;
     }
 
-    if (neuik_Object_GetClassObject(plot2d, neuik__Class_Plot, (void**)&plot))
+    if (neuik_Object_GetClassObject_NoError(
+        plot2d, neuik__Class_Plot, (void**)&plot))
     {
         eNum = 2;
         goto out;
     }
-    if (lineMask == NULL)
+    if (!neuik_Object_IsClass_NoErr(lineMask, neuik__Class_MaskMap))
     {
         eNum = 3;
         goto out;
     }
+    if (lineMask->sizeW != maskW || lineMask->sizeH != maskH)
+    {
+        eNum = 4;
+        goto out;
+    }
     if (data->precision != 64)
     {
         eNum = 8;
@@ -118,23 +136,6 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
     yRangeMin = plot->y_range_min;
     yRangeMax = plot->y_range_max;
 
-    if (neuik_MakeMaskMap(lineMask, maskW, maskH))
-    {
-        eNum = 4;
-        goto out;
-    }
-
-    /*------------------------------------------------------------------------*/
-    /* There are built-in methods for getting easy access to collapsed        */
-    /* unmasked regions; leverage this by setting pixels not encompassed as   */
-    /* masked.                                                                */
-    /*------------------------------------------------------------------------*/
-    if (neuik_MaskMap_MaskAll(*lineMask))
-    {
-        eNum = 5;
-        goto out;
-    }
-
     pxDeltaX = (xRangeMax - xRangeMin)/((double)(ticZoneW));
     pxDeltaY = (yRangeMax - yRangeMin)/((double)(ticZoneH));
 
@@ -274,7 +275,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                 switch (thickness)
                 {
                 case 1:
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX, 
                         maskPtY1 + ticZoneOffsetY,
                         maskPtX2 + ticZoneOffsetX, 
@@ -285,7 +286,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                     }
                     break;
                 case 2:
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX - 1, 
                         maskPtY1 + ticZoneOffsetY,
                         maskPtX2 + ticZoneOffsetX - 1, 
@@ -294,7 +295,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX, 
                         maskPtY1 + ticZoneOffsetY,
                         maskPtX2 + ticZoneOffsetX, 
@@ -303,7 +304,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX, 
                         maskPtY1 + ticZoneOffsetY + 1,
                         maskPtX2 + ticZoneOffsetX, 
@@ -312,7 +313,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX - 1, 
                         maskPtY1 + ticZoneOffsetY + 1,
                         maskPtX2 + ticZoneOffsetX - 1, 
@@ -326,7 +327,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Top y-axis row (of three).                             */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX - 1, 
                         maskPtY1 + ticZoneOffsetY - 1,
                         maskPtX2 + ticZoneOffsetX - 1, 
@@ -335,7 +336,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX, 
                         maskPtY1 + ticZoneOffsetY - 1,
                         maskPtX2 + ticZoneOffsetX, 
@@ -344,7 +345,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX + 1, 
                         maskPtY1 + ticZoneOffsetY - 1,
                         maskPtX2 + ticZoneOffsetX + 1, 
@@ -357,7 +358,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Middle y-axis row (of three).                          */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX - 1, 
                         maskPtY1 + ticZoneOffsetY,
                         maskPtX2 + ticZoneOffsetX - 1, 
@@ -366,7 +367,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX, 
                         maskPtY1 + ticZoneOffsetY,
                         maskPtX2 + ticZoneOffsetX, 
@@ -375,7 +376,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX + 1, 
                         maskPtY1 + ticZoneOffsetY,
                         maskPtX2 + ticZoneOffsetX + 1, 
@@ -388,7 +389,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Bottom y-axis row (of three).                          */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX - 1, 
                         maskPtY1 + ticZoneOffsetY + 1,
                         maskPtX2 + ticZoneOffsetX - 1, 
@@ -397,7 +398,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX, 
                         maskPtY1 + ticZoneOffsetY + 1,
                         maskPtX2 + ticZoneOffsetX, 
@@ -406,7 +407,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX + 1, 
                         maskPtY1 + ticZoneOffsetY + 1,
                         maskPtX2 + ticZoneOffsetX + 1, 
@@ -420,7 +421,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Top y-axis row (first of four).                        */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX, 
                         maskPtY1 + ticZoneOffsetY - 1,
                         maskPtX2 + ticZoneOffsetX, 
@@ -429,7 +430,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX + 1, 
                         maskPtY1 + ticZoneOffsetY + 2,
                         maskPtX2 + ticZoneOffsetX + 1, 
@@ -442,7 +443,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Upper-middle y-axis row (second of four).              */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX - 1, 
                         maskPtY1 + ticZoneOffsetY,
                         maskPtX2 + ticZoneOffsetX - 1, 
@@ -451,7 +452,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX, 
                         maskPtY1 + ticZoneOffsetY,
                         maskPtX2 + ticZoneOffsetX, 
@@ -460,7 +461,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX + 1, 
                         maskPtY1 + ticZoneOffsetY,
                         maskPtX2 + ticZoneOffsetX + 1, 
@@ -469,7 +470,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX + 2, 
                         maskPtY1 + ticZoneOffsetY,
                         maskPtX2 + ticZoneOffsetX + 2, 
@@ -482,7 +483,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Lower-middle y-axis row (third of four).               */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX - 1, 
                         maskPtY1 + ticZoneOffsetY + 1,
                         maskPtX2 + ticZoneOffsetX - 1, 
@@ -491,7 +492,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX, 
                         maskPtY1 + ticZoneOffsetY + 1,
                         maskPtX2 + ticZoneOffsetX, 
@@ -500,7 +501,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX + 1, 
                         maskPtY1 + ticZoneOffsetY + 1,
                         maskPtX2 + ticZoneOffsetX + 1, 
@@ -509,7 +510,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX + 2, 
                         maskPtY1 + ticZoneOffsetY + 1,
                         maskPtX2 + ticZoneOffsetX + 2, 
@@ -522,7 +523,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Bottom y-axis row (of four).                           */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX, 
                         maskPtY1 + ticZoneOffsetY + 2,
                         maskPtX2 + ticZoneOffsetX, 
@@ -531,7 +532,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                         eNum = 7;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskLine(*lineMask,
+                    if (neuik_MaskMap_UnmaskLine_NoError(lineMask,
                         maskPtX1 + ticZoneOffsetX + 1, 
                         maskPtY1 + ticZoneOffsetY + 2,
                         maskPtX2 + ticZoneOffsetX + 1, 
@@ -694,7 +695,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                     switch (thickness)
                     {
                     case 1:
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX, 
                             maskPtY1 + ticZoneOffsetY,
                             maskPtX2 + ticZoneOffsetX, 
@@ -705,7 +706,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                         }
                         break;
                     case 2:
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX - 1, 
                             maskPtY1 + ticZoneOffsetY,
                             maskPtX2 + ticZoneOffsetX - 1, 
@@ -714,7 +715,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX, 
                             maskPtY1 + ticZoneOffsetY,
                             maskPtX2 + ticZoneOffsetX, 
@@ -723,7 +724,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX, 
                             maskPtY1 + ticZoneOffsetY + 1,
                             maskPtX2 + ticZoneOffsetX, 
@@ -732,7 +733,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX - 1, 
                             maskPtY1 + ticZoneOffsetY + 1,
                             maskPtX2 + ticZoneOffsetX - 1, 
@@ -746,7 +747,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                         /*----------------------------------------------------*/
                         /* Top y-axis row (of three).                         */
                         /*----------------------------------------------------*/
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX - 1, 
                             maskPtY1 + ticZoneOffsetY - 1,
                             maskPtX2 + ticZoneOffsetX - 1, 
@@ -755,7 +756,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX, 
                             maskPtY1 + ticZoneOffsetY - 1,
                             maskPtX2 + ticZoneOffsetX, 
@@ -764,7 +765,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX + 1, 
                             maskPtY1 + ticZoneOffsetY - 1,
                             maskPtX2 + ticZoneOffsetX + 1, 
@@ -777,7 +778,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                         /*----------------------------------------------------*/
                         /* Middle y-axis row (of three).                      */
                         /*----------------------------------------------------*/
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX - 1, 
                             maskPtY1 + ticZoneOffsetY,
                             maskPtX2 + ticZoneOffsetX - 1, 
@@ -786,7 +787,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX, 
                             maskPtY1 + ticZoneOffsetY,
                             maskPtX2 + ticZoneOffsetX, 
@@ -795,7 +796,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX + 1, 
                             maskPtY1 + ticZoneOffsetY,
                             maskPtX2 + ticZoneOffsetX + 1, 
@@ -808,7 +809,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                         /*----------------------------------------------------*/
                         /* Bottom y-axis row (of three).                      */
                         /*----------------------------------------------------*/
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX - 1, 
                             maskPtY1 + ticZoneOffsetY + 1,
                             maskPtX2 + ticZoneOffsetX - 1, 
@@ -817,7 +818,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX, 
                             maskPtY1 + ticZoneOffsetY + 1,
                             maskPtX2 + ticZoneOffsetX, 
@@ -826,7 +827,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX + 1, 
                             maskPtY1 + ticZoneOffsetY + 1,
                             maskPtX2 + ticZoneOffsetX + 1, 
@@ -840,7 +841,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                         /*----------------------------------------------------*/
                         /* Top y-axis row (first of four).                    */
                         /*----------------------------------------------------*/
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX, 
                             maskPtY1 + ticZoneOffsetY - 1,
                             maskPtX2 + ticZoneOffsetX, 
@@ -849,7 +850,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX + 1, 
                             maskPtY1 + ticZoneOffsetY + 2,
                             maskPtX2 + ticZoneOffsetX + 1, 
@@ -862,7 +863,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                         /*----------------------------------------------------*/
                         /* Upper-middle y-axis row (second of four).          */
                         /*----------------------------------------------------*/
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX - 1, 
                             maskPtY1 + ticZoneOffsetY,
                             maskPtX2 + ticZoneOffsetX - 1, 
@@ -871,7 +872,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX, 
                             maskPtY1 + ticZoneOffsetY,
                             maskPtX2 + ticZoneOffsetX, 
@@ -880,7 +881,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX + 1, 
                             maskPtY1 + ticZoneOffsetY,
                             maskPtX2 + ticZoneOffsetX + 1, 
@@ -889,7 +890,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX + 2, 
                             maskPtY1 + ticZoneOffsetY,
                             maskPtX2 + ticZoneOffsetX + 2, 
@@ -902,7 +903,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                         /*----------------------------------------------------*/
                         /* Lower-middle y-axis row (third of four).           */
                         /*----------------------------------------------------*/
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX - 1, 
                             maskPtY1 + ticZoneOffsetY + 1,
                             maskPtX2 + ticZoneOffsetX - 1, 
@@ -911,7 +912,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX, 
                             maskPtY1 + ticZoneOffsetY + 1,
                             maskPtX2 + ticZoneOffsetX, 
@@ -920,7 +921,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX + 1, 
                             maskPtY1 + ticZoneOffsetY + 1,
                             maskPtX2 + ticZoneOffsetX + 1, 
@@ -929,7 +930,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX + 2, 
                             maskPtY1 + ticZoneOffsetY + 1,
                             maskPtX2 + ticZoneOffsetX + 2, 
@@ -942,7 +943,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                         /*----------------------------------------------------*/
                         /* Bottom y-axis row (of four).                       */
                         /*----------------------------------------------------*/
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX, 
                             maskPtY1 + ticZoneOffsetY + 2,
                             maskPtX2 + ticZoneOffsetX, 
@@ -951,7 +952,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                             eNum = 10;
                             goto out;
                         }
-                        if (neuik_MaskMap_UnmaskUnboundedLine(*lineMask,
+                        if (neuik_MaskMap_UnmaskUnboundedLine_NoError(lineMask,
                             maskPtX1 + ticZoneOffsetX + 1, 
                             maskPtY1 + ticZoneOffsetY + 2,
                             maskPtX2 + ticZoneOffsetX + 1, 
@@ -995,7 +996,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                 switch (thickness)
                 {
                 case 1:
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX, 
                         maskPtY + ticZoneOffsetY))
                     {
@@ -1004,28 +1005,28 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                     }
                     break;
                 case 2:
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX - 1, 
                         maskPtY + ticZoneOffsetY))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX, 
                         maskPtY + ticZoneOffsetY))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX, 
                         maskPtY + ticZoneOffsetY + 1))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX - 1, 
                         maskPtY + ticZoneOffsetY + 1))
                     {
@@ -1037,21 +1038,21 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Top y-axis row (of three).                             */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX - 1, 
                         maskPtY + ticZoneOffsetY - 1))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX, 
                         maskPtY + ticZoneOffsetY - 1))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX + 1, 
                         maskPtY + ticZoneOffsetY - 1))
                     {
@@ -1062,21 +1063,21 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Middle y-axis row (of three).                          */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX - 1, 
                         maskPtY + ticZoneOffsetY))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX, 
                         maskPtY + ticZoneOffsetY))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX + 1, 
                         maskPtY + ticZoneOffsetY))
                     {
@@ -1087,21 +1088,21 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Bottom y-axis row (of three).                          */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX - 1, 
                         maskPtY + ticZoneOffsetY + 1))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX, 
                         maskPtY + ticZoneOffsetY + 1))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX + 1, 
                         maskPtY + ticZoneOffsetY + 1))
                     {
@@ -1113,14 +1114,14 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Top y-axis row (first of four).                        */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX, 
                         maskPtY + ticZoneOffsetY - 1))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX + 1, 
                         maskPtY + ticZoneOffsetY - 1))
                     {
@@ -1131,28 +1132,28 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Upper-middle y-axis row (second of four).              */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX - 1, 
                         maskPtY + ticZoneOffsetY))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX, 
                         maskPtY + ticZoneOffsetY))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX + 1, 
                         maskPtY + ticZoneOffsetY))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX + 2, 
                         maskPtY + ticZoneOffsetY))
                     {
@@ -1163,28 +1164,28 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Lower-middle y-axis row (third of four).               */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX - 1, 
                         maskPtY + ticZoneOffsetY + 1))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX, 
                         maskPtY + ticZoneOffsetY + 1))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX + 1, 
                         maskPtY + ticZoneOffsetY + 1))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX + 2, 
                         maskPtY + ticZoneOffsetY + 1))
                     {
@@ -1195,14 +1196,14 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
                     /*--------------------------------------------------------*/
                     /* Bottom y-axis row (of four).                           */
                     /*--------------------------------------------------------*/
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX, 
                         maskPtY + ticZoneOffsetY + 2))
                     {
                         eNum = 6;
                         goto out;
                     }
-                    if (neuik_MaskMap_UnmaskUnboundedPoint(*lineMask, 
+                    if (neuik_MaskMap_UnmaskUnboundedPoint_NoError(lineMask, 
                         maskPtX + ticZoneOffsetX + 1, 
                         maskPtY + ticZoneOffsetY + 2))
                     {
@@ -1220,7 +1221,7 @@ int neuik_Plot2D_Render64_SimpleLineToMask(
 out:
     if (eNum > 0)
     {
-        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        if (errMsg != NULL) (*errMsg) = errMsgs[eNum];
         eNum = 1;
     }
 
@@ -0,0 +1,299 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "NEUIK_error.h"
+#include "neuik_PrefixWidths.h"
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_NewPrefixWidths
+ *
+ *  Description:   Allocate an (empty) prefix width cache.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_NewPrefixWidths(
+    neuik_PrefixWidths ** pwPtr)
+{
+    int                  eNum       = 0; /* which error to report (if any) */
+    neuik_PrefixWidths * pw         = NULL;
+    static char          funcName[] = "neuik_NewPrefixWidths";
+    static char        * errMsgs[]  = {"", // [0] no error
+        "Output Argument `pwPtr` is NULL.", // [1]
+        "Failure to allocate memory.",      // [2]
+    };
+
+    if (pwPtr == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+
+    pw = (neuik_PrefixWidths *)malloc(sizeof(neuik_PrefixWidths));
+    (*pwPtr) = pw;
+    if (pw == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    pw->font   = NULL;
+    pw->text   = NULL;
+    pw->len    = 0;
+    pw->cap    = 0;
+    pw->widths = NULL;
+    pw->valid  = 0;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_PrefixWidths_Free
+ *
+ *  Description:   Free a prefix width cache.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+void neuik_PrefixWidths_Free(
+    neuik_PrefixWidths * pw)
+{
+    if (pw == NULL) return;
+
+    if (pw->text   != NULL) free(pw->text);
+    if (pw->widths != NULL) free(pw->widths);
+    free(pw);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_PrefixWidths_Update
+ *
+ *  Description:   Make sure that the cached widths are those of the supplied
+ *                 text and font; if not, rebuild them.
+ *
+ *                 The widths are accumulated in the same manner as
+ *                 `TTF_SizeText()` (glyph advances plus kerning, extended by
+ *                 any glyph overhang) so that widths[i] matches the size of
+ *                 the first `i` characters.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_PrefixWidths_Update(
+    neuik_PrefixWidths * pw,
+    TTF_Font           * font,
+    const char         * text)
+{
+    size_t        ctr        = 0;
+    size_t        len        = 0;
+    size_t        newCap     = 0;
+    int           x          = 0; /* pen position */
+    int           minX       = 0; /* leftmost extent so far */
+    int           maxX       = 0; /* rightmost extent so far */
+    int           gMinX      = 0;
+    int           gMaxX      = 0;
+    int           gMinY      = 0;
+    int           gMaxY      = 0;
+    int           advance    = 0;
+    int           useKerning = 0;
+    Uint16        ch         = 0;
+    Uint16        prevCh     = 0;
+    char        * newText    = NULL;
+    int         * newWidths  = NULL;
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "neuik_PrefixWidths_Update";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `pw` is NULL.",      // [1]
+        "Argument `font` is NULL.",    // [2]
+        "Failure to allocate memory.", // [3]
+    };
+
+    if (pw == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (font == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (text == NULL) text = "";
+
+    len = strlen(text);
+    if (pw->valid && pw->font == font && pw->len == len &&
+        !memcmp(pw->text, text, len))
+    {
+        /*--------------------------------------------------------------------*/
+        /* The cached widths are still current.                               */
+        /*--------------------------------------------------------------------*/
+        goto out;
+    }
+
+    pw->valid = 0;
+    if (len + 1 > pw->cap)
+    {
+        newCap = 2*(len + 1);
+        newText   = (char *)realloc(pw->text, newCap);
+        if (newText == NULL)
+        {
+            eNum = 3;
+            goto out;
+        }
+        pw->text = newText;
+
+        newWidths = (int *)realloc(pw->widths, newCap*sizeof(int));
+        if (newWidths == NULL)
+        {
+            eNum = 3;
+            goto out;
+        }
+        pw->widths = newWidths;
+        pw->cap    = newCap;
+    }
+    memcpy(pw->text, text, len + 1);
+
+    useKerning = TTF_GetFontKerning(font);
+
+    pw->widths[0] = 0;
+    for (ctr = 0; ctr < len; ctr++)
+    {
+        /* TTF_SizeText() treats the text as Latin-1 */
+        ch = (Uint16)((unsigned char)text[ctr]);
+        if (useKerning && ctr > 0)
+        {
+            x += TTF_GetFontKerningSizeGlyphs(font, prevCh, ch);
+        }
+        if (TTF_GlyphMetrics(font, ch, &gMinX, &gMaxX, &gMinY, &gMaxY, &advance))
+        {
+            /* This glyph isn't available; it won't be drawn */
+            gMinX   = 0;
+            gMaxX   = 0;
+            advance = 0;
+        }
+
+        if (x + gMinX < minX) minX = x + gMinX;
+        if (x + (advance > gMaxX ? advance : gMaxX) > maxX)
+        {
+            maxX = x + (advance > gMaxX ? advance : gMaxX);
+        }
+        x += advance;
+
+        pw->widths[ctr + 1] = maxX - minX;
+        prevCh = ch;
+    }
+
+    pw->font  = font;
+    pw->len   = len;
+    pw->valid = 1;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_PrefixWidths_GetWidth
+ *
+ *  Description:   Get the rendered width of the first `pos` characters of the
+ *                 cached text; positions beyond the end are clamped.
+ *
+ *  Returns:       The width in pixels.
+ *
+ ******************************************************************************/
+int neuik_PrefixWidths_GetWidth(
+    const neuik_PrefixWidths * pw,
+    size_t                     pos)
+{
+    if (pw == NULL || !pw->valid) return 0;
+
+    if (pos > pw->len) pos = pw->len;
+    return pw->widths[pos];
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_PrefixWidths_HitTest
+ *
+ *  Description:   Find the cursor position for a click at the pixel offset `x`
+ *                 (relative to the start of the text). A click within the
+ *                 final third of a character places the cursor after it.
+ *
+ *  Returns:       The cursor position (0 through the text length).
+ *
+ ******************************************************************************/
+size_t neuik_PrefixWidths_HitTest(
+    const neuik_PrefixWidths * pw,
+    int                        x)
+{
+    size_t lo    = 1;
+    size_t hi    = 0;
+    size_t mid   = 0;
+    int    charW = 0;
+
+    if (pw == NULL || !pw->valid || pw->len == 0) return 0;
+    if (x <= 0) return 0;
+
+    /*------------------------------------------------------------------------*/
+    /* Find the first character whose right edge is at or beyond `x`.         */
+    /*------------------------------------------------------------------------*/
+    hi = pw->len;
+    if (x > pw->widths[hi]) return pw->len;
+
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo)/2;
+        if (pw->widths[mid] >= x)
+        {
+            hi = mid;
+        }
+        else
+        {
+            lo = mid + 1;
+        }
+    }
+
+    charW = pw->widths[lo] - pw->widths[lo - 1];
+    if (x <= pw->widths[lo] - charW/3)
+    {
+        /* cursor will be before this char */
+        return lo - 1;
+    }
+    /* cursor will be after char */
+    return lo;
+}
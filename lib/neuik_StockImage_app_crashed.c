@@ -14,526 +14,318 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  ******************************************************************************/
 
-/* GIMP RGBA C-Source image dump (app_crashed_64x64.c) */
+/* PNG encoded image (stock_images/app_crashed_64x64.png) */
 #include <SDL.h>
 #include "NEUIK_Image.h"
+#include "NEUIK_StockImage_internal.h"
 
-static const struct {
-    unsigned int     width;
-    unsigned int     height;
-    unsigned int     bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
-    unsigned char    pixel_data[64 * 64 * 4 + 1];
-} neuik_StockImageData_app_crashed = {
-    64, 64, 4,
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\001\000\000\000\002\000\000\000\002"
-    "\000\000\000\002\000\000\000\002\000\000\000\001\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\003\000\000\000\006"
-    "\000\000\000\015\000\000\000\023\000\000\000\032\000\000\000#\000\000\000+\000\000\000\061\000\000\000\067\000\000\000=\000\000\000"
-    "C\000\000\000G\000\000\000F\000\000\000B\000\000\000=\000\000\000\061\000\000\000\040\000\000\000\020\000\000\000\005\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\003\000\000\000\007\000\000\000\022\000\000\000\"\000\000\000\067\000\000\000"
-    "N\000\000\000d\000\000\000y\000\000\000\213\000\000\000\230\000\000\000\245\000\000\000\256\000\000\000\266\000\000\000\276"
-    "\000\000\000\302\000\000\000\305\000\000\000\315\000\000\000\313\000\000\000\304\000\000\000\300\000\000\000\263\000"
-    "\000\000\235\000\000\000|\000\000\000U\000\000\000\061\000\000\000\023\000\000\000\005\000\000\000\001\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\013\000\000\000\040\000\000\000@\000\000\000d"
-    "\000\000\000\207\000\000\000\244\000\000\000\276\000\000\000\321\000\000\000\340\000\000\000\352\000\000\000\360\000"
-    "\000\000\363\000\000\000\367\000\000\000\371\000\000\000\371\000\000\000\373\000\000\000\374\000\000\000\373\000\000"
-    "\000\375\000\000\000\374\000\000\000\374\000\000\000\373\000\000\000\371\000\000\000\365\000\000\000\352\000\000\000"
-    "\325\000\000\000\263\000\000\000\206\000\000\000T\000\000\000)\000\000\000\014\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\014\000\000\000\061\000\000\000e\000\000\000\231\000\000\000\303\000\000\000\334\000\000\000\356\000"
-    "\000\000\367\000\000\000\373\000\000\000\376\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\376\000\000\000\376\000\000\000\371"
-    "\000\000\000\353\000\000\000\317\000\000\000\245\000\000\000l\000\000\000\065\000\000\000\015\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\003\000\000\000$\000\000"
-    "\000e\000\000\000\250\000\000\000\333\000\000\000\361\000\000\000\373\000\000\000\376\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\374\000\000\000\364\000\000\000\337\000\000\000\257\000\000\000d\000\000\000$\000\000\000\002\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\016\000\000\000D\000\000\000\222\000\000"
-    "\000\324\000\000\000\366\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\376\000\000\000\376\000\000\000\373\000\000\000\372\000\000\000\370\000\000\000\366"
-    "\000\000\000\363\000\000\000\357\000\000\000\356\000\000\000\353\000\000\000\347\000\000\000\350\000\000\000\346\000"
-    "\000\000\350\000\000\000\355\000\000\000\364\000\000\000\371\000\000\000\375\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\376\000\000\000\376\000\000\000\367\000\000\000\322\000\000\000\216\000\000\000"
-    "B\000\000\000\016\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\000\000\000^\000\000\000\266\000\000"
-    "\000\354\000\000\000\374\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\376\000\000\000"
-    "\375\000\000\000\372\000\000\000\362\000\000\000\346\000\000\000\326\000\000\000\310\000\000\000\273\000\000\000\257"
-    "\000\000\000\242\000\000\000\225\000\000\000\212\000\000\000\203\000\000\000|\000\000\000t\000\000\000s\000\000\000r\000\000"
-    "\000w\000\000\000\204\000\000\000\233\000\000\000\267\000\000\000\325\000\000\000\356\000\000\000\373\000\000\000\376"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\373\000\000\000\351\000\000\000\267\000"
-    "\000\000j\000\000\000\"\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\030\000\000\000i\000\000\000\306\000\000\000\367\000\000\000\376"
-    "\000\000\000\377\000\000\000\377\000\000\000\376\000\000\000\374\000\000\000\366\000\000\000\345\000\000\000\320\000"
-    "\000\000\264\000\000\000\224\000\000\000v\000\000\000X\000\000\000B\000\000\000\066\000\000\000*\000\000\000\036\000\000\000\027"
-    "\000\000\000\021\000\000\000\017\000\000\000\014\000\000\000\012\000\000\000\012\000\000\000\011\000\000\000\013\000\000\000\020"
-    "\000\000\000\033\000\000\000\064\000\000\000\\\000\000\000\211\000\000\000\273\000\000\000\335\000\000\000\363\000\000\000"
-    "\374\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\370\000\000\000\324\000\000\000\210"
-    "\000\000\000\066\000\000\000\006\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\035\000\000\000o\000\000\000\314\000\000\000\370\000\000\000\377\000\000\000\377\000\000\000\376"
-    "\000\000\000\376\000\000\000\365\000\000\000\331\000\000\000\250\000\000\000v\000\000\000L\000\000\000-\000\000\000\031\000"
-    "\000\000\013\000\000\000\004\000\000\000\001\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\006\000"
-    "\000\000\027\000\000\000\071\000\000\000h\000\000\000\240\000\000\000\324\000\000\000\366\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\374\000\000\000\344\000\000\000\235\000\000\000@\000\000\000\007\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\030\000\000\000n\000\000\000\317\000\000\000"
-    "\371\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\374\000\000\000\350\000\000\000\261\000\000\000f\000"
-    "\000\000,\000\000\000\013\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\010\000\000\000'\000"
-    "\000\000f\000\000\000\263\000\000\000\352\000\000\000\374\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000\375"
-    "\000\000\000\353\000\000\000\244\000\000\000D\000\000\000\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\021\000\000\000c\000\000\000\313\000\000\000\371\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\373\000"
-    "\000\000\332\000\000\000\214\000\000\000\071\000\000\000\013\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015\000\000\000>\000\000\000\215\000\000\000\324"
-    "\000\000\000\370\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000\375\000\000\000\354\000\000\000\245\000"
-    "\000\000<\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\012\000\000\000S\000\000\000\276\000\000\000\367\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\371\000\000\000\323\000\000\000z\000\000\000%\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\003\000\000\000#\000\000\000i\000\000\000\273\000\000\000\357\000\000\000\375\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\351\000\000\000\224\000\000\000,\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\002\000\000\000\071\000\000\000"
-    "\253\000\000\000\362\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000\371\000\000\000\316\000\000\000r\000"
-    "\000\000\035\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\020\000\000\000J\000"
-    "\000\000\246\000\000\000\352\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000\375\000\000\000\335\000\000"
-    "\000x\000\000\000\023\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\035\000\000\000\206\000\000\000\347\000\000\000\376\000\000\000\377\000\000\000\377\000"
-    "\000\000\373\000\000\000\325\000\000\000t\000\000\000\034\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\003\000\000\000\012\000\000\000\015\000\000\000\006\000\000\000\001\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\002\000\000\000\004\000\000\000\003\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\002\000\000\000\002\000\000"
-    "\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\007\000\000\000=\000\000\000\241\000\000\000\353\000\000\000\376"
-    "\000\000\000\377\000\000\000\377\000\000\000\373\000\000\000\303\000\000\000K\000\000\000\004\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\010\000\000\000\\\000\000\000\315\000\000\000\373"
-    "\000\000\000\377\000\000\000\377\000\000\000\375\000\000\000\340\000\000\000\204\000\000\000(\000\000\000\024\000\000\000"
-    "\027\000\000\000\014\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\011\000\000\000)\000\000\000E\000\000\000H\000\000\000"
-    ",\000\000\000\017\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\013\000\000\000"
-    "#\000\000\000\070\000\000\000\070\000\000\000!\000\000\000\011\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\003\000\000\000\026\000\000\000'\000\000\000&\000\000\000\025\000\000\000\005\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\003\000\000\000>\000\000\000\257\000\000\000\364\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000\355\000\000"
-    "\000\224\000\000\000$\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\061\000\000\000\247\000\000\000\364\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000\355\000\000\000\233"
-    "\000\000\000;\000\000\000\062\000\000\000[\000\000\000c\000\000\000D\000\000\000\031\000\000\000\001\000\000\000\012\000\000\000?\000"
-    "\000\000\203\000\000\000\263\000\000\000\263\000\000\000z\000\000\000/\000\000\000\010\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\010\000\000\000\060\000\000\000t\000\000\000\247\000\000\000\254\000\000\000\214\000\000\000Z"
-    "\000\000\000(\000\000\000\013\000\000\000\001\000\000\000\013\000\000\000\065\000\000\000k\000\000\000\215\000\000\000\206\000\000"
-    "\000U\000\000\000\036\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\010\000\000\000Y\000\000\000\312\000"
-    "\000\000\371\000\000\000\377\000\000\000\377\000\000\000\373\000\000\000\322\000\000\000_\000\000\000\011\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\017\000\000\000r\000\000\000\337\000\000\000\376\000\000"
-    "\000\377\000\000\000\377\000\000\000\371\000\000\000\273\000\000\000I\000\000\000+\000\000\000w\000\000\000\306\000\000\000"
-    "\321\000\000\000\251\000\000\000]\000\000\000#\000\000\000D\000\000\000\232\000\000\000\334\000\000\000\366\000\000\000\373"
-    "\000\000\000\276\000\000\000Q\000\000\000\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\025\000\000\000"
-    "`\000\000\000\312\000\000\000\367\000\000\000\366\000\000\000\354\000\000\000\316\000\000\000\237\000\000\000h\000\000"
-    "\000M\000\000\000d\000\000\000\240\000\000\000\324\000\000\000\355\000\000\000\350\000\000\000\250\000\000\000C\000\000\000"
-    "\013\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\030\000\000\000\200\000\000\000\345\000\000\000\376"
-    "\000\000\000\377\000\000\000\377\000\000\000\364\000\000\000\233\000\000\000&\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\002\000\000\000\071\000\000\000\263\000\000\000\367\000\000\000\376\000\000\000\377\000\000\000\374"
-    "\000\000\000\331\000\000\000m\000\000\000\026\000\000\000\071\000\000\000\245\000\000\000\367\000\000\000\375\000\000\000\356"
-    "\000\000\000\267\000\000\000\205\000\000\000\246\000\000\000\344\000\000\000\373\000\000\000\377\000\000\000\373\000"
-    "\000\000\306\000\000\000U\000\000\000\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\032\000\000\000p"
-    "\000\000\000\340\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\374\000\000\000\361\000\000\000\340\000"
-    "\000\000\325\000\000\000\336\000\000\000\362\000\000\000\374\000\000\000\377\000\000\000\377\000\000\000\313\000\000"
-    "\000X\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\070\000\000\000\263\000"
-    "\000\000\367\000\000\000\377\000\000\000\377\000\000\000\375\000\000\000\320\000\000\000R\000\000\000\005\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\014\000\000\000o\000\000\000\341\000\000\000\375\000\000\000\377\000\000\000\377\000"
-    "\000\000\361\000\000\000\235\000\000\000)\000\000\000\004\000\000\000\067\000\000\000\244\000\000\000\363\000\000\000\377"
-    "\000\000\000\375\000\000\000\360\000\000\000\342\000\000\000\357\000\000\000\375\000\000\000\376\000\000\000\375\000"
-    "\000\000\354\000\000\000\234\000\000\000\067\000\000\000\006\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\016\000\000\000R\000\000\000\274\000\000\000\366\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\367\000\000"
-    "\000\265\000\000\000F\000\000\000\012\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\016\000"
-    "\000\000q\000\000\000\341\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000\354\000\000\000\202\000\000\000\024"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000&\000\000\000\244\000\000\000\365\000\000\000\377\000\000\000\377\000"
-    "\000\000\375\000\000\000\320\000\000\000X\000\000\000\004\000\000\000\000\000\000\000\040\000\000\000|\000\000\000\334\000\000\000"
-    "\374\000\000\000\377\000\000\000\376\000\000\000\376\000\000\000\377\000\000\000\376\000\000\000\377\000\000\000\361"
-    "\000\000\000\266\000\000\000Y\000\000\000\022\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\003\000\000\000\"\000\000\000k\000\000\000\274\000\000\000\353\000\000\000\373\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\374\000\000\000\344\000\000\000\215"
-    "\000\000\000&\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\071"
-    "\000\000\000\266\000\000\000\371\000\000\000\377\000\000\000\377\000\000\000\367\000\000\000\256\000\000\000/\000\000\000"
-    "\001\000\000\000\000\000\000\000\003\000\000\000N\000\000\000\315\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000\364"
-    "\000\000\000\237\000\000\000\"\000\000\000\000\000\000\000\000\000\000\000\010\000\000\000?\000\000\000\245\000\000\000\356\000"
-    "\000\000\376\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\373\000\000\000\323\000\000"
-    "\000n\000\000\000\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\003\000\000\000\034\000\000\000^\000\000\000\265\000\000\000\355\000\000\000\375\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\376\000\000\000\353\000\000\000\234\000\000"
-    "\000\064\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\025\000"
-    "\000\000\213\000\000\000\355\000\000\000\377\000\000\000\377\000\000\000\375\000\000\000\321\000\000\000T\000\000\000\004"
-    "\000\000\000\000\000\000\000\017\000\000\000{\000\000\000\351\000\000\000\376\000\000\000\377\000\000\000\376\000\000\000\337"
-    "\000\000\000j\000\000\000\012\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\034\000\000\000\203\000\000\000\343\000\000"
-    "\000\376\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\372\000\000\000\314\000\000\000"
-    "[\000\000\000\014\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\007\000\000\000A\000\000\000\256\000\000\000\362\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\373\000\000\000\314\000\000\000a\000"
-    "\000\000\023\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\005\000\000\000^\000"
-    "\000\000\331\000\000\000\377\000\000\000\377\000\000\000\376\000\000\000\351\000\000\000~\000\000\000\020\000\000\000\000"
-    "\000\000\000)\000\000\000\251\000\000\000\367\000\000\000\377\000\000\000\377\000\000\000\372\000\000\000\277\000\000\000"
-    "<\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\013\000\000\000N\000\000\000\264\000\000\000\362\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\376\000\000\000\343\000\000\000\177\000\000"
-    "\000$\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000"
-    "\024\000\000\000a\000\000\000\321\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000\375\000\000\000\370\000"
-    "\000\000\364\000\000\000\366\000\000\000\375\000\000\000\377\000\000\000\377\000\000\000\345\000\000\000|\000\000\000!"
-    "\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\067\000\000\000\275"
-    "\000\000\000\374\000\000\000\377\000\000\000\377\000\000\000\370\000\000\000\247\000\000\000$\000\000\000\003\000\000\000J"
-    "\000\000\000\312\000\000\000\374\000\000\000\377\000\000\000\377\000\000\000\361\000\000\000\224\000\000\000\032\000\000"
-    "\000\000\000\000\000\000\000\000\000\007\000\000\000A\000\000\000\246\000\000\000\354\000\000\000\376\000\000\000\376\000\000\000"
-    "\377\000\000\000\374\000\000\000\373\000\000\000\375\000\000\000\377\000\000\000\362\000\000\000\227\000\000\000\060"
-    "\000\000\000\005\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\023"
-    "\000\000\000[\000\000\000\313\000\000\000\374\000\000\000\371\000\000\000\355\000\000\000\320\000\000\000\245\000\000\000"
-    "\215\000\000\000\243\000\000\000\316\000\000\000\355\000\000\000\370\000\000\000\325\000\000\000m\000\000\000\034\000"
-    "\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\033\000\000\000\225"
-    "\000\000\000\363\000\000\000\377\000\000\000\377\000\000\000\375\000\000\000\305\000\000\000;\000\000\000\013\000\000\000"
-    "n\000\000\000\343\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\337\000\000\000h\000\000\000\007\000\000\000"
-    "\000\000\000\000\005\000\000\000\062\000\000\000\223\000\000\000\345\000\000\000\376\000\000\000\377\000\000\000\376\000\000"
-    "\000\367\000\000\000\330\000\000\000\313\000\000\000\337\000\000\000\355\000\000\000\325\000\000\000z\000\000\000%\000"
-    "\000\000\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\012\000"
-    "\000\000\065\000\000\000\202\000\000\000\271\000\000\000\274\000\000\000\226\000\000\000^\000\000\000(\000\000\000\017\000"
-    "\000\000,\000\000\000c\000\000\000\226\000\000\000\247\000\000\000\200\000\000\000;\000\000\000\015\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\011\000\000\000q\000\000\000\344\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\330\000\000\000Q\000\000\000\026\000\000\000\220\000\000\000\361"
-    "\000\000\000\376\000\000\000\377\000\000\000\375\000\000\000\304\000\000\000@\000\000\000\001\000\000\000\001\000\000\000\033"
-    "\000\000\000n\000\000\000\320\000\000\000\373\000\000\000\377\000\000\000\377\000\000\000\367\000\000\000\307\000\000\000"
-    "v\000\000\000U\000\000\000t\000\000\000\214\000\000\000t\000\000\000:\000\000\000\021\000\000\000\001\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\002\000\000\000\021\000\000\000.\000\000\000K\000"
-    "\000\000I\000\000\000.\000\000\000\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\024\000\000\000/\000\000\000:\000\000"
-    "\000*\000\000\000\022\000\000\000\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\004\000\000\000U\000\000\000\325\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000\344\000\000"
-    "\000c\000\000\000&\000\000\000\254\000\000\000\370\000\000\000\377\000\000\000\377\000\000\000\367\000\000\000\242\000"
-    "\000\000\"\000\000\000\000\000\000\000\005\000\000\000\062\000\000\000\231\000\000\000\357\000\000\000\377\000\000\000\376\000"
-    "\000\000\367\000\000\000\312\000\000\000n\000\000\000\035\000\000\000\011\000\000\000\033\000\000\000(\000\000\000\040\000\000"
-    "\000\017\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\001\000\000\000\006\000\000\000\014\000\000\000\011\000\000\000\003\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\004\000\000\000\007\000\000\000\006\000\000\000\001\000\000\000\000\000\000\000\000\000"
-    "\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000B\000\000\000\307\000"
-    "\000\000\374\000\000\000\377\000\000\000\377\000\000\000\350\000\000\000n\000\000\000\070\000\000\000\303\000\000\000\374"
-    "\000\000\000\377\000\000\000\377\000\000\000\356\000\000\000\206\000\000\000\020\000\000\000\000\000\000\000\007\000\000\000\062"
-    "\000\000\000\231\000\000\000\361\000\000\000\374\000\000\000\357\000\000\000\303\000\000\000q\000\000\000!\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\002\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\001\000\000\000\015\000\000\000\034\000\000\000\037\000\000\000\023\000\000\000\007\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\066\000\000\000\275\000\000\000\373\000\000\000\377\000\000\000\377\000\000"
-    "\000\354\000\000\000s\000\000\000I\000\000\000\323\000\000\000\376\000\000\000\377\000\000\000\376\000\000\000\343\000"
-    "\000\000p\000\000\000\010\000\000\000\000\000\000\000\004\000\000\000\037\000\000\000c\000\000\000\255\000\000\000\302\000\000\000"
-    "\242\000\000\000a\000\000\000!\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\012\000\000\000-\000\000\000[\000\000\000}\000\000\000}\000"
-    "\000\000S\000\000\000\040\000\000\000\005\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\063\000\000\000\271\000\000\000\372"
-    "\000\000\000\377\000\000\000\377\000\000\000\354\000\000\000w\000\000\000W\000\000\000\334\000\000\000\377\000\000\000\377"
-    "\000\000\000\376\000\000\000\335\000\000\000`\000\000\000\004\000\000\000\000\000\000\000\001\000\000\000\012\000\000\000%\000\000\000"
-    "F\000\000\000Q\000\000\000<\000\000\000\030\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\015\000\000\000,\000\000\000]\000\000\000\233\000\000\000\314"
-    "\000\000\000\344\000\000\000\343\000\000\000\256\000\000\000L\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\063\000\000\000\271\000\000\000\372\000\000\000\377\000\000\000\377\000\000\000\354\000\000\000v\000\000\000Z\000"
-    "\000\000\337\000\000\000\377\000\000\000\377\000\000\000\376\000\000\000\332\000\000\000Y\000\000\000\004\000\000\000\000\000"
-    "\000\000\000\000\000\000\001\000\000\000\006\000\000\000\015\000\000\000\017\000\000\000\010\000\000\000\001\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\022\000\000\000\067\000\000\000"
-    "j\000\000\000\243\000\000\000\322\000\000\000\357\000\000\000\374\000\000\000\376\000\000\000\377\000\000\000\327\000"
-    "\000\000j\000\000\000\027\000\000\000\001\000\000\000\000\000\000\000\001\000\000\000:\000\000\000\300\000\000\000\373\000\000\000\377"
-    "\000\000\000\377\000\000\000\353\000\000\000r\000\000\000T\000\000\000\333\000\000\000\377\000\000\000\377\000\000\000\376"
-    "\000\000\000\331\000\000\000\\\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\005\000\000\000"
-    "\027\000\000\000<\000\000\000s\000\000\000\253\000\000\000\331\000\000\000\363\000\000\000\375\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\371\000\000\000\306\000\000\000X\000\000\000\021\000\000\000\000\000\000\000\000\000\000\000"
-    "\002\000\000\000G\000\000\000\313\000\000\000\375\000\000\000\377\000\000\000\377\000\000\000\347\000\000\000j\000\000\000"
-    "K\000\000\000\324\000\000\000\376\000\000\000\377\000\000\000\376\000\000\000\341\000\000\000h\000\000\000\007\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\017\000\000\000+\000\000\000T\000\000\000\206\000\000\000\270\000\000\000\337\000\000\000\365"
-    "\000\000\000\374\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\371\000\000\000\327\000"
-    "\000\000\204\000\000\000,\000\000\000\005\000\000\000\000\000\000\000\000\000\000\000\005\000\000\000Z\000\000\000\331\000\000\000\376"
-    "\000\000\000\377\000\000\000\377\000\000\000\340\000\000\000[\000\000\000A\000\000\000\316\000\000\000\376\000\000\000\377"
-    "\000\000\000\377\000\000\000\350\000\000\000v\000\000\000\014\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\003\000\000\000\024\000\000\000;\000\000\000o\000\000\000\242\000\000"
-    "\000\315\000\000\000\351\000\000\000\371\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\376\000\000\000\372\000\000\000\352\000\000\000\301\000\000\000{\000\000\000\061\000\000\000\011\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\012\000\000\000t\000\000\000\347\000\000\000\377\000\000\000\377\000\000\000\376\000\000\000"
-    "\324\000\000\000J\000\000\000\065\000\000\000\300\000\000\000\375\000\000\000\377\000\000\000\377\000\000\000\355\000"
-    "\000\000\203\000\000\000\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001"
-    "\000\000\000\026\000\000\000@\000\000\000y\000\000\000\265\000\000\000\336\000\000\000\364\000\000\000\374\000\000\000\376"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\376\000\000\000\371\000\000\000\350\000\000\000\304\000"
-    "\000\000\215\000\000\000O\000\000\000\035\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\024"
-    "\000\000\000\216\000\000\000\361\000\000\000\377\000\000\000\377\000\000\000\374\000\000\000\301\000\000\000\067\000\000"
-    "\000+\000\000\000\265\000\000\000\373\000\000\000\377\000\000\000\377\000\000\000\364\000\000\000\231\000\000\000\032"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\005\000\000\000\032\000\000\000E\000\000\000|\000\000\000\265"
-    "\000\000\000\341\000\000\000\370\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\376\000"
-    "\000\000\375\000\000\000\366\000\000\000\342\000\000\000\272\000\000\000\206\000\000\000N\000\000\000!\000\000\000\010\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000+\000\000\000\257\000\000\000\371"
-    "\000\000\000\377\000\000\000\377\000\000\000\371\000\000\000\251\000\000\000$\000\000\000\040\000\000\000\242\000\000\000"
-    "\366\000\000\000\377\000\000\000\377\000\000\000\373\000\000\000\267\000\000\000/\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\006\000\000\000#\000\000\000O\000\000\000\207\000\000\000\276\000\000\000\343\000\000\000\367\000\000\000\375\000\000\000"
-    "\377\000\000\000\377\000\000\000\376\000\000\000\377\000\000\000\374\000\000\000\364\000\000\000\333\000\000\000\260"
-    "\000\000\000z\000\000\000A\000\000\000\027\000\000\000\006\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\002\000\000\000R\000\000\000\323\000\000\000\376\000\000\000\377\000\000\000\377\000\000"
-    "\000\360\000\000\000\213\000\000\000\024\000\000\000\021\000\000\000\203\000\000\000\354\000\000\000\377\000\000\000\377"
-    "\000\000\000\376\000\000\000\321\000\000\000P\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\005\000\000\000\036\000\000\000O\000\000\000\215\000\000\000\305\000"
-    "\000\000\352\000\000\000\372\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\375\000\000"
-    "\000\366\000\000\000\346\000\000\000\313\000\000\000\237\000\000\000l\000\000\000:\000\000\000\026\000\000\000\003\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\022\000\000\000\177\000\000\000\351\000\000\000\376\000\000\000\377\000\000\000\376\000\000\000\332\000\000\000c\000"
-    "\000\000\010\000\000\000\007\000\000\000\\\000\000\000\327\000\000\000\375\000\000\000\377\000\000\000\377\000\000\000\350"
-    "\000\000\000{\000\000\000\017\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\027\000\000\000F\000\000\000\207\000\000\000\304\000\000\000\352\000\000\000\373\000\000\000\376\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\375\000\000\000\366\000\000\000\335\000\000\000\263\000\000\000\177"
-    "\000\000\000O\000\000\000'\000\000\000\014\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\066\000\000\000\264\000\000\000\370"
-    "\000\000\000\377\000\000\000\377\000\000\000\371\000\000\000\272\000\000\000\071\000\000\000\001\000\000\000\001\000\000\000\071"
-    "\000\000\000\271\000\000\000\371\000\000\000\377\000\000\000\377\000\000\000\367\000\000\000\252\000\000\000,\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\005\000\000\000\030\000\000\000A\000\000\000|\000\000\000\271\000\000\000"
-    "\345\000\000\000\373\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\375\000\000\000\364"
-    "\000\000\000\334\000\000\000\256\000\000\000r\000\000\000:\000\000\000\026\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\016\000\000\000s\000\000\000\336\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000"
-    "\356\000\000\000\215\000\000\000\030\000\000\000\000\000\000\000\000\000\000\000\032\000\000\000\223\000\000\000\361\000\000"
-    "\000\377\000\000\000\377\000\000\000\375\000\000\000\331\000\000\000e\000\000\000\012\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\005\000\000"
-    "\000\036\000\000\000M\000\000\000\206\000\000\000\273\000\000\000\342\000\000\000\367\000\000\000\375\000\000\000\377"
-    "\000\000\000\377\000\000\000\376\000\000\000\374\000\000\000\362\000\000\000\330\000\000\000\250\000\000\000m\000\000\000"
-    "\067\000\000\000\021\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\002\000\000"
-    "\000B\000\000\000\271\000\000\000\371\000\000\000\377\000\000\000\377\000\000\000\375\000\000\000\324\000\000\000X\000"
-    "\000\000\005\000\000\000\000\000\000\000\000\000\000\000\010\000\000\000c\000\000\000\334\000\000\000\376\000\000\000\377\000\000"
-    "\000\377\000\000\000\365\000\000\000\260\000\000\000>\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\004\000\000\000&\000\000\000n\000\000\000\274\000\000\000\347"
-    "\000\000\000\371\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\373\000\000\000\357\000"
-    "\000\000\321\000\000\000\236\000\000\000e\000\000\000\064\000\000\000\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000%\000\000\000\221\000\000\000\352\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\364\000\000\000\241\000\000\000)\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\061\000\000\000\252\000\000\000\370\000\000\000\377\000\000\000\377\000\000\000\376\000\000\000\352"
-    "\000\000\000\230\000\000\000/\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\021\000\000\000T\000\000\000\302\000\000\000\366\000\000\000\375\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\376\000\000\000\364\000\000\000\325\000\000\000\234\000\000\000^\000\000\000+\000\000\000\014"
-    "\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\023\000\000\000q\000\000\000\330\000\000\000\374\000\000\000\377\000\000\000\377\000\000\000\374\000\000\000"
-    "\320\000\000\000^\000\000\000\012\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\015\000\000\000k\000\000"
-    "\000\327\000\000\000\374\000\000\000\377\000\000\000\377\000\000\000\375\000\000\000\342\000\000\000\211\000\000\000"
-    "'\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\031\000\000\000"
-    "o\000\000\000\336\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\375\000\000\000\365\000\000\000\333\000"
-    "\000\000\250\000\000\000f\000\000\000-\000\000\000\012\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\012\000\000\000X\000\000\000\304\000\000\000\371"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\350\000\000\000\213\000\000\000\"\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000)\000\000\000\222\000\000\000\354\000\000\000\376\000"
-    "\000\000\377\000\000\000\377\000\000\000\373\000\000\000\332\000\000\000\202\000\000\000)\000\000\000\001\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\022\000\000\000X\000\000\000\301\000\000\000\363\000\000\000"
-    "\367\000\000\000\357\000\000\000\330\000\000\000\253\000\000\000n\000\000\000\065\000\000\000\016\000\000\000\001\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\011\000\000\000P\000\000\000\265\000\000\000\364\000\000\000\376\000\000\000\377\000\000\000\376\000\000"
-    "\000\366\000\000\000\261\000\000\000=\000\000\000\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\004\000\000\000@\000\000\000\254\000\000\000\362\000\000\000\376\000\000\000\377\000\000\000\377\000"
-    "\000\000\373\000\000\000\335\000\000\000\213\000\000\000\060\000\000\000\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\007\000\000\000'\000\000\000g\000\000\000\234\000\000\000\251\000\000\000\224\000\000\000i\000\000\000\065"
-    "\000\000\000\022\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\012\000\000\000J\000\000\000\261\000\000\000\362\000\000"
-    "\000\376\000\000\000\377\000\000\000\377\000\000\000\372\000\000\000\314\000\000\000b\000\000\000\015\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\012\000\000\000R\000"
-    "\000\000\272\000\000\000\365\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000\374\000\000\000\342\000\000"
-    "\000\233\000\000\000B\000\000\000\012\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\010\000\000\000\033"
-    "\000\000\000.\000\000\000\063\000\000\000#\000\000\000\014\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\017"
-    "\000\000\000Q\000\000\000\261\000\000\000\360\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000\375\000\000\000"
-    "\335\000\000\000|\000\000\000\035\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\017\000\000\000[\000\000\000\300\000\000\000\367\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\375\000\000\000\354\000\000\000\262\000\000\000`\000\000\000\036\000\000\000"
-    "\004\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\002\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\005\000\000\000$\000\000\000j\000\000\000\277\000\000\000\362\000\000\000\376\000\000\000\377"
-    "\000\000\000\377\000\000\000\375\000\000\000\345\000\000\000\220\000\000\000*\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\023\000\000\000`\000\000\000\302\000\000\000\366\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\375"
-    "\000\000\000\364\000\000\000\321\000\000\000\220\000\000\000I\000\000\000\024\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\024\000\000\000H\000\000\000\226\000\000\000\330"
-    "\000\000\000\367\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000\376\000\000\000\351\000\000\000\230\000"
-    "\000\000\066\000\000\000\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\023\000\000\000^\000\000\000\274"
-    "\000\000\000\363\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\375\000\000\000\354\000"
-    "\000\000\276\000\000\000\202\000\000\000B\000\000\000\026\000\000\000\003\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000"
-    "\015\000\000\000\066\000\000\000x\000\000\000\300\000\000\000\355\000\000\000\375\000\000\000\376\000\000\000\377\000\000"
-    "\000\377\000\000\000\375\000\000\000\350\000\000\000\235\000\000\000;\000\000\000\003\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\021\000\000\000R\000\000\000\252\000\000\000\351\000\000\000\374"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\372\000\000\000\347\000\000\000\300\000"
-    "\000\000\205\000\000\000G\000\000\000\031\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\005\000\000\000\023\000\000\000\065\000\000\000n\000\000\000\257\000\000\000\342\000\000"
-    "\000\371\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\376\000\000\000\374\000\000\000\340\000\000\000"
-    "\223\000\000\000\070\000\000\000\006\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\011\000\000\000=\000\000\000\217\000\000\000\327\000\000\000\367\000\000\000\376\000\000"
-    "\000\377\000\000\000\377\000\000\000\376\000\000\000\377\000\000\000\373\000\000\000\353\000\000\000\300\000\000\000"
-    "\210\000\000\000N\000\000\000$\000\000\000\016\000\000\000\004\000\000\000\001\000\000\000\000\000\000\000\001\000\000\000\001\000\000\000"
-    "\001\000\000\000\002\000\000\000\002\000\000\000\002\000\000\000\006\000\000\000\007\000\000\000\006\000\000\000\021\000\000\000/\000\000\000"
-    "Y\000\000\000\207\000\000\000\266\000\000\000\335\000\000\000\367\000\000\000\376\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\376\000\000\000\366\000\000\000\317\000\000\000\204\000\000\000.\000\000\000\003\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\003\000\000\000&\000\000\000k\000\000\000\266\000\000\000\351\000\000\000\373\000\000\000\376\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\376\000\000\000\372\000\000\000\355\000\000\000\315\000\000\000\245\000\000"
-    "\000z\000\000\000T\000\000\000=\000\000\000\065\000\000\000\071\000\000\000A\000\000\000J\000\000\000V\000\000\000^\000\000\000e\000"
-    "\000\000m\000\000\000n\000\000\000p\000\000\000\206\000\000\000\256\000\000\000\327\000\000\000\354\000\000\000\371\000\000"
-    "\000\375\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\376\000\000\000\374\000\000\000\347\000\000\000"
-    "\262\000\000\000d\000\000\000\035\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\017\000\000"
-    "\000A\000\000\000\203\000\000\000\303\000\000\000\354\000\000\000\372\000\000\000\376\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\375\000\000\000\366\000\000\000\350\000\000\000\323\000\000\000\303\000"
-    "\000\000\276\000\000\000\303\000\000\000\315\000\000\000\332\000\000\000\346\000\000\000\353\000\000\000\356\000\000"
-    "\000\362\000\000\000\360\000\000\000\354\000\000\000\357\000\000\000\371\000\000\000\376\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\374\000\000\000\356\000\000\000\306\000\000\000\205"
-    "\000\000\000>\000\000\000\016\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\003\000\000\000\026\000\000\000J\000\000\000\211\000\000\000\307\000\000\000\355\000\000\000\374\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\376\000\000\000\375\000\000\000\373\000"
-    "\000\000\372\000\000\000\374\000\000\000\375\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\375\000\000\000\365\000\000\000\322\000\000\000\226\000\000\000N\000\000\000\032\000"
-    "\000\000\002\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\002\000\000\000\033\000\000\000N\000\000\000\213\000\000\000\305\000\000\000\353\000\000"
-    "\000\372\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\375\000\000\000\371\000"
-    "\000\000\354\000\000\000\324\000\000\000\243\000\000\000a\000\000\000%\000\000\000\005\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\004\000\000\000\032\000\000\000I\000\000\000\204\000\000\000\273\000\000\000\340"
-    "\000\000\000\363\000\000\000\374\000\000\000\376\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\374\000\000\000\361\000\000\000\327\000\000\000\262\000\000\000\206\000\000\000"
-    "X\000\000\000+\000\000\000\014\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\002\000\000\000\026\000\000\000>\000\000\000m\000\000\000\230\000\000\000\273\000\000\000"
-    "\324\000\000\000\343\000\000\000\353\000\000\000\356\000\000\000\362\000\000\000\366\000\000\000\373\000\000\000\376"
-    "\000\000\000\377\000\000\000\376\000\000\000\375\000\000\000\373\000\000\000\365\000\000\000\344\000\000\000\300\000"
-    "\000\000\221\000\000\000_\000\000\000\061\000\000\000\025\000\000\000\005\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\002\000\000\000\012\000\000\000\034\000\000\000\067\000\000\000R\000\000\000k\000\000\000~\000\000\000\205\000\000\000"
-    "\215\000\000\000\235\000\000\000\265\000\000\000\311\000\000\000\315\000\000\000\307\000\000\000\275\000\000\000\254"
-    "\000\000\000\217\000\000\000f\000\000\000<\000\000\000\032\000\000\000\007\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\003\000\000\000\011"
-    "\000\000\000\020\000\000\000\022\000\000\000\022\000\000\000\027\000\000\000#\000\000\000\061\000\000\000\063\000\000\000*\000\000"
-    "\000#\000\000\000\030\000\000\000\017\000\000\000\006\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+static const unsigned char neuik_StockImageData_app_crashed[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
+    0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40,
+    0x08, 0x06, 0x00, 0x00, 0x00, 0xaa, 0x69, 0x71, 0xde, 0x00, 0x00, 0x00,
+    0x06, 0x62, 0x4b, 0x47, 0x44, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xa0,
+    0xbd, 0xa7, 0x93, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00,
+    0x00, 0x0b, 0x13, 0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c, 0x18,
+    0x00, 0x00, 0x00, 0x07, 0x74, 0x49, 0x4d, 0x45, 0x07, 0xe0, 0x0a, 0x11,
+    0x04, 0x16, 0x1e, 0x99, 0x1b, 0xb9, 0x11, 0x00, 0x00, 0x00, 0x1d, 0x69,
+    0x54, 0x58, 0x74, 0x43, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77,
+    0x69, 0x74, 0x68, 0x20, 0x47, 0x49, 0x4d, 0x50, 0x64, 0x2e, 0x65, 0x07,
+    0x00, 0x00, 0x0c, 0xba, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xed, 0x9b,
+    0xeb, 0x73, 0x94, 0xe5, 0x19, 0xc6, 0xaf, 0xdd, 0x7d, 0x37, 0xd9, 0x64,
+    0x13, 0x12, 0x72, 0x06, 0x82, 0x96, 0x00, 0x22, 0x12, 0xa0, 0x98, 0x0a,
+    0x68, 0x6d, 0x3d, 0x54, 0x6d, 0xad, 0x6d, 0x1d, 0xb5, 0xd3, 0x71, 0xa6,
+    0xed, 0x4c, 0xed, 0xe9, 0x63, 0xff, 0x82, 0xfe, 0x27, 0xfd, 0xd0, 0x83,
+    0xce, 0x74, 0x6a, 0x6d, 0x1d, 0x8b, 0x6d, 0xb5, 0xb6, 0xa0, 0xb4, 0x2a,
+    0x22, 0xe0, 0x81, 0x00, 0x11, 0x03, 0x24, 0x31, 0xc6, 0x94, 0x1c, 0x48,
+    0x20, 0x21, 0xd9, 0xec, 0x66, 0xb7, 0x1f, 0xf2, 0x7b, 0xca, 0xcd, 0xe3,
+    0xbb, 0xd9, 0x4d, 0xd8, 0x4d, 0xfc, 0xe0, 0x33, 0xf3, 0xce, 0x9e, 0xde,
+    0xc3, 0x73, 0x9f, 0xae, 0xfb, 0xba, 0xef, 0xe7, 0xd9, 0x88, 0x56, 0x7f,
+    0x44, 0xbc, 0x57, 0x37, 0x72, 0xde, 0x6b, 0x59, 0x1f, 0x5e, 0xce, 0x11,
+    0xe3, 0xa8, 0x94, 0x54, 0xc1, 0x6b, 0x95, 0xa4, 0x04, 0x9f, 0xed, 0x11,
+    0x20, 0x70, 0x46, 0x52, 0x5a, 0xd2, 0x94, 0xa4, 0x4b, 0x92, 0x26, 0x24,
+    0x4d, 0xf3, 0xdd, 0x67, 0x5a, 0x01, 0x31, 0x84, 0x48, 0x4a, 0xaa, 0x97,
+    0xd4, 0x2c, 0xa9, 0x55, 0x52, 0x0b, 0xef, 0x1b, 0x24, 0xd5, 0x72, 0x38,
+    0x25, 0x24, 0xb8, 0x26, 0xc6, 0xfb, 0xac, 0xa4, 0x14, 0x4a, 0xb8, 0x22,
+    0xe9, 0xa2, 0xa4, 0x0b, 0x92, 0x3e, 0x90, 0xd4, 0x2b, 0x69, 0x40, 0xd2,
+    0x65, 0x7e, 0xcf, 0x7d, 0x56, 0x14, 0x90, 0x44, 0xc0, 0x2f, 0x48, 0xda,
+    0x22, 0x69, 0xb3, 0xa4, 0x8d, 0x92, 0xd6, 0x4b, 0x6a, 0x94, 0x54, 0x27,
+    0xa9, 0x1a, 0x2b, 0x3b, 0x25, 0x45, 0xb9, 0x36, 0xca, 0x3c, 0x72, 0xbc,
+    0xb7, 0xae, 0x9f, 0x45, 0xd0, 0x69, 0x49, 0x23, 0x92, 0xce, 0x4b, 0x3a,
+    0x29, 0xe9, 0x84, 0xa4, 0x53, 0x92, 0x3e, 0xc2, 0x4b, 0x56, 0x4d, 0x01,
+    0x35, 0x92, 0xb6, 0x4a, 0xfa, 0x12, 0xc7, 0x6d, 0x92, 0xd6, 0x61, 0xe9,
+    0x2a, 0x63, 0xd9, 0x1b, 0x7d, 0x96, 0x53, 0x4a, 0x1a, 0xeb, 0x0f, 0x4a,
+    0x3a, 0x2d, 0xe9, 0x4d, 0x49, 0x6f, 0x49, 0xea, 0xc1, 0x5b, 0x56, 0x4c,
+    0x01, 0x31, 0x49, 0x9b, 0x24, 0xdd, 0x27, 0xe9, 0x6b, 0x92, 0xba, 0x70,
+    0xf3, 0x6a, 0x7e, 0x2b, 0x65, 0x68, 0xe5, 0x42, 0xee, 0x37, 0x2f, 0x69,
+    0x16, 0xaf, 0x78, 0x57, 0xd2, 0x5f, 0x25, 0xbd, 0x8a, 0x87, 0x64, 0xcb,
+    0xad, 0x80, 0x35, 0x92, 0xf6, 0x4a, 0xfa, 0x8e, 0xa4, 0xfb, 0x25, 0x75,
+    0x10, 0xbb, 0x91, 0x02, 0xd6, 0x9b, 0x37, 0x6e, 0x9d, 0xe5, 0xb3, 0x8b,
+    0x63, 0xf7, 0x3e, 0xc2, 0x6f, 0x51, 0x49, 0x71, 0x00, 0x33, 0xee, 0x85,
+    0x8c, 0x7f, 0xdf, 0x94, 0xa4, 0x0f, 0x25, 0xfd, 0x53, 0xd2, 0x8b, 0x92,
+    0x8e, 0xe1, 0x0d, 0xb9, 0x72, 0x28, 0xa0, 0x59, 0xd2, 0xc3, 0x92, 0x9e,
+    0x44, 0x09, 0xf5, 0xc6, 0xc5, 0xed, 0xc4, 0x72, 0xc6, 0x4a, 0x53, 0xa0,
+    0xf8, 0x65, 0x26, 0x36, 0xc5, 0xeb, 0x15, 0x62, 0x3b, 0xc5, 0x31, 0x6b,
+    0xae, 0x8d, 0x03, 0x94, 0xad, 0x92, 0xda, 0x25, 0xdd, 0x44, 0x68, 0xd5,
+    0xe6, 0xf1, 0xb0, 0x8c, 0xa4, 0x71, 0xb0, 0xe1, 0x80, 0xa4, 0x97, 0x24,
+    0xf5, 0x15, 0xe3, 0x0d, 0x4b, 0x51, 0x40, 0x9b, 0xa4, 0xc7, 0x24, 0xfd,
+    0x50, 0xd2, 0x1e, 0xac, 0x13, 0xf1, 0x00, 0x6b, 0x8e, 0xb4, 0x35, 0x42,
+    0x9c, 0xf6, 0x81, 0xda, 0x03, 0xa0, 0xf9, 0x94, 0x39, 0x52, 0x9c, 0xef,
+    0xbc, 0x21, 0x6b, 0xee, 0xe5, 0x3c, 0x20, 0x89, 0xe0, 0xb7, 0x4a, 0xda,
+    0x29, 0xe9, 0x76, 0x3c, 0xae, 0x05, 0x8c, 0xf1, 0x95, 0x9f, 0x22, 0x53,
+    0xbc, 0x28, 0xe9, 0xcf, 0x84, 0xc7, 0x5c, 0x29, 0x14, 0xb0, 0x51, 0xd2,
+    0xe3, 0x08, 0xdf, 0x89, 0xf0, 0xd6, 0x0d, 0x67, 0x10, 0xf8, 0x1d, 0xac,
+    0x70, 0x5a, 0x52, 0xbf, 0xa4, 0x51, 0x2c, 0x9f, 0x42, 0xc8, 0xe5, 0x10,
+    0x9b, 0x08, 0xca, 0x58, 0x8b, 0xf0, 0xbb, 0x25, 0xed, 0x07, 0x74, 0x3b,
+    0x50, 0x84, 0x8f, 0x0f, 0xc3, 0x92, 0x5e, 0x96, 0xf4, 0x34, 0x40, 0x99,
+    0xba, 0x11, 0x10, 0x6a, 0x93, 0xf4, 0x0b, 0x84, 0x4b, 0x19, 0x37, 0x75,
+    0x84, 0x65, 0x58, 0xd2, 0x0b, 0x92, 0x7e, 0x8e, 0x72, 0x92, 0x65, 0x26,
+    0x58, 0x09, 0x49, 0xdb, 0x78, 0xde, 0x01, 0x3c, 0x2b, 0x83, 0x07, 0xd9,
+    0xf0, 0x1b, 0x91, 0xf4, 0x8c, 0xa4, 0x07, 0x8c, 0xc1, 0x42, 0xd1, 0x7c,
+    0xb1, 0xb1, 0x56, 0xd2, 0xa3, 0x92, 0x7e, 0x82, 0x70, 0x15, 0x5e, 0xdc,
+    0x5d, 0x90, 0xf4, 0x47, 0x49, 0xbf, 0x02, 0x84, 0x3e, 0x2e, 0x07, 0x5b,
+    0x0b, 0x89, 0xf7, 0x31, 0x49, 0x67, 0x41, 0xfd, 0x14, 0x58, 0x54, 0x67,
+    0xf0, 0x21, 0x82, 0xa2, 0xda, 0xc1, 0x8d, 0x21, 0x8e, 0xec, 0x52, 0x14,
+    0x50, 0x2d, 0xe9, 0x21, 0x84, 0xef, 0xf2, 0xb4, 0x38, 0x07, 0x33, 0x7b,
+    0x46, 0xd2, 0xef, 0x24, 0xbd, 0xb7, 0x02, 0x82, 0xfb, 0x63, 0x8e, 0xb0,
+    0xfb, 0x10, 0x00, 0x4c, 0x42, 0xba, 0x2a, 0x8c, 0x12, 0xaa, 0x01, 0xd2,
+    0x28, 0x78, 0x34, 0x52, 0xac, 0x02, 0xa2, 0x08, 0xfd, 0x33, 0x49, 0x5f,
+    0xe5, 0x46, 0x11, 0xf3, 0xe0, 0x53, 0x08, 0xfe, 0x7b, 0xbc, 0x60, 0xb5,
+    0x46, 0x0e, 0xd0, 0xed, 0xc5, 0xfb, 0xaa, 0x01, 0x4d, 0x3b, 0xdf, 0x2a,
+    0xb2, 0xd7, 0x94, 0xa4, 0x33, 0xe0, 0x55, 0x41, 0x05, 0xb4, 0x4b, 0xfa,
+    0x3e, 0xee, 0xdf, 0x60, 0x6e, 0x96, 0x41, 0xe3, 0x4f, 0x4b, 0xfa, 0x03,
+    0x16, 0xc8, 0x17, 0x5a, 0x8e, 0xeb, 0xab, 0x88, 0x74, 0x14, 0x35, 0xee,
+    0x9b, 0x2b, 0xe2, 0x5c, 0x1f, 0x63, 0x66, 0xc9, 0x34, 0x9f, 0xc0, 0x53,
+    0xda, 0x79, 0xbe, 0xf3, 0x84, 0x5a, 0x94, 0xd2, 0x87, 0xc1, 0xb2, 0x8b,
+    0x29, 0x20, 0x21, 0xe9, 0x9b, 0x92, 0x7e, 0x00, 0xdb, 0x8b, 0x19, 0x21,
+    0x06, 0x25, 0x3d, 0x2b, 0xe9, 0x39, 0xd0, 0xbd, 0x96, 0x07, 0xd8, 0xc2,
+    0xa4, 0x8a, 0x5a, 0xa0, 0x53, 0xd2, 0xcd, 0x20, 0x78, 0x8a, 0x10, 0xc9,
+    0x85, 0x20, 0x7c, 0x92, 0x2c, 0xb3, 0x55, 0xd2, 0x06, 0x73, 0x7e, 0x26,
+    0x44, 0xa9, 0xcd, 0x9c, 0xd3, 0x80, 0x22, 0xd2, 0x46, 0x98, 0x79, 0xbc,
+    0x60, 0x94, 0x73, 0x6e, 0xe2, 0x5e, 0x11, 0xce, 0xad, 0x41, 0x51, 0x3d,
+    0x84, 0x4c, 0x5e, 0x05, 0xec, 0x94, 0xf4, 0x94, 0xa4, 0xbb, 0xbc, 0x5c,
+    0x7f, 0x09, 0xca, 0xf9, 0x1c, 0xdf, 0xed, 0x87, 0xfb, 0xd7, 0x4a, 0xba,
+    0x0a, 0xa9, 0xa9, 0x86, 0x20, 0x3d, 0xca, 0xb1, 0x17, 0x01, 0x47, 0x20,
+    0x43, 0x99, 0x3c, 0x88, 0xfe, 0x08, 0x1c, 0xe3, 0x2b, 0x92, 0x6e, 0x01,
+    0xd4, 0xd2, 0xb8, 0x6b, 0x86, 0x7b, 0xec, 0x02, 0x93, 0x1e, 0x60, 0x8e,
+    0x09, 0x49, 0x93, 0x3c, 0xd7, 0x72, 0x88, 0xff, 0xf2, 0x79, 0x0b, 0x0a,
+    0x73, 0x32, 0x3a, 0x5e, 0x31, 0x08, 0x80, 0x66, 0x04, 0xc5, 0xb4, 0xa3,
+    0x0e, 0x7e, 0xbf, 0x3f, 0x24, 0xee, 0x4f, 0x40, 0x2e, 0x26, 0x24, 0x7d,
+    0x0b, 0x01, 0x93, 0x68, 0xf4, 0x45, 0x49, 0x6f, 0xe0, 0x31, 0xdf, 0x83,
+    0x22, 0xaf, 0x37, 0x0f, 0x3d, 0x83, 0xfb, 0xcd, 0x7a, 0xd6, 0xaf, 0x95,
+    0xf4, 0x45, 0xae, 0xd9, 0x89, 0x00, 0x57, 0xb9, 0xfe, 0x3d, 0x0a, 0x9d,
+    0x8f, 0x01, 0xb2, 0xbb, 0xc9, 0xfd, 0xeb, 0x50, 0xce, 0xab, 0x58, 0x72,
+    0xcc, 0x53, 0xec, 0xac, 0xa4, 0x43, 0x28, 0x76, 0x03, 0xe7, 0x47, 0x90,
+    0xb5, 0x83, 0xfb, 0xbc, 0x89, 0x12, 0xae, 0x53, 0x40, 0x14, 0x8b, 0xde,
+    0x47, 0xee, 0xb7, 0xc4, 0xa2, 0x4f, 0xd2, 0x5f, 0x24, 0x1d, 0xc7, 0xbd,
+    0x77, 0xc1, 0x06, 0x2b, 0x70, 0xdf, 0x35, 0xb0, 0xb5, 0x4d, 0x80, 0x66,
+    0x2b, 0xf7, 0xce, 0x98, 0x7a, 0x3f, 0x6c, 0xc4, 0xb1, 0x76, 0x8b, 0xc1,
+    0x8b, 0x2a, 0xbe, 0xdb, 0xcc, 0x5c, 0xa6, 0xf9, 0xae, 0xc9, 0x14, 0x5b,
+    0xe2, 0xf7, 0x66, 0xee, 0xe1, 0x8f, 0x61, 0xe8, 0x70, 0x17, 0x1e, 0x63,
+    0xef, 0x7d, 0x07, 0xe1, 0x79, 0x41, 0x52, 0x3a, 0xf0, 0xd2, 0xde, 0x5e,
+    0x84, 0xab, 0x30, 0xd6, 0x9f, 0x96, 0xf4, 0x1f, 0xf2, 0xfc, 0x38, 0x42,
+    0xe6, 0x8c, 0x70, 0x75, 0x92, 0xee, 0x94, 0xb4, 0x03, 0x8b, 0xae, 0x31,
+    0x45, 0xcd, 0x24, 0xac, 0x70, 0xc0, 0x47, 0x5f, 0xee, 0x31, 0xc5, 0x6f,
+    0xbd, 0x46, 0x09, 0x11, 0x84, 0x5c, 0xc3, 0x91, 0xcb, 0x03, 0x7a, 0x17,
+    0x99, 0x4f, 0x3e, 0xaa, 0x7b, 0x5a, 0xd2, 0x41, 0xe4, 0xd9, 0x68, 0xb0,
+    0xa0, 0x1d, 0xaf, 0x3b, 0x2c, 0x69, 0xd4, 0x56, 0x58, 0xeb, 0xd1, 0x4e,
+    0x93, 0xa9, 0xbc, 0xb2, 0x68, 0xea, 0x15, 0xd0, 0x3f, 0x43, 0x8c, 0xf5,
+    0xf0, 0x3a, 0xcf, 0xb9, 0x0e, 0x79, 0xeb, 0x0d, 0xf2, 0x4e, 0x49, 0x3a,
+    0x2a, 0xe9, 0x5f, 0x5c, 0x1b, 0x36, 0xd1, 0x69, 0xf8, 0xfa, 0xf3, 0x84,
+    0xd0, 0x58, 0x08, 0x4e, 0x84, 0x95, 0xc2, 0x63, 0xcc, 0xc1, 0x0f, 0x2b,
+    0x3b, 0xae, 0x48, 0x3a, 0x42, 0xca, 0x4e, 0x7b, 0xcd, 0x9b, 0x4e, 0xc2,
+    0x23, 0x12, 0x35, 0x60, 0x78, 0xab, 0xa4, 0xed, 0x1e, 0xb7, 0x9e, 0x81,
+    0x02, 0x1f, 0x35, 0x13, 0x1b, 0x96, 0xf4, 0x6f, 0xe2, 0xf3, 0xb2, 0xb1,
+    0x90, 0x6d, 0x6e, 0x66, 0xb0, 0xec, 0x4b, 0xc4, 0xe3, 0x78, 0x9e, 0x49,
+    0xce, 0x53, 0x33, 0xbc, 0x00, 0xaf, 0x38, 0xca, 0x3d, 0xb3, 0x05, 0xd2,
+    0x60, 0x25, 0x9e, 0xb7, 0x26, 0xa4, 0x4c, 0xb6, 0x1e, 0xd6, 0x8b, 0x02,
+    0x6c, 0xd7, 0xa8, 0x82, 0xf0, 0xd9, 0x2a, 0x29, 0x16, 0x35, 0x9d, 0x9d,
+    0x9d, 0x58, 0xd1, 0xde, 0x60, 0x44, 0xd2, 0xdb, 0x08, 0x6d, 0xdd, 0xef,
+    0x1c, 0x34, 0x74, 0x7a, 0x91, 0x87, 0xa7, 0xb0, 0x54, 0xa1, 0x96, 0x95,
+    0xe3, 0xed, 0x1f, 0x71, 0x4d, 0x7c, 0x11, 0xa1, 0x9c, 0x82, 0xeb, 0x71,
+    0xe3, 0x9d, 0x28, 0x22, 0xdf, 0x98, 0xa0, 0x85, 0x36, 0xea, 0x5d, 0xdf,
+    0x06, 0xde, 0xd5, 0x44, 0x8d, 0xfb, 0xef, 0x32, 0xf1, 0xeb, 0x48, 0x4f,
+    0x9f, 0xa4, 0xf7, 0x3d, 0x37, 0x4b, 0x52, 0x96, 0xee, 0xe1, 0xe1, 0x61,
+    0x85, 0x4f, 0x00, 0x10, 0x6e, 0xe1, 0x61, 0x85, 0x04, 0xaa, 0xa5, 0x9f,
+    0xb8, 0x19, 0x63, 0xc8, 0x84, 0x60, 0x0a, 0x45, 0xcf, 0x18, 0xcf, 0x08,
+    0x40, 0xf7, 0x0d, 0xde, 0x9c, 0xfd, 0x91, 0x86, 0xb2, 0x0f, 0x9a, 0x6a,
+    0x34, 0xc2, 0xbc, 0xb7, 0x4b, 0x6a, 0x0a, 0x4c, 0x7b, 0x6b, 0x93, 0x87,
+    0xa8, 0x33, 0xb8, 0x8f, 0x6d, 0x33, 0x55, 0x02, 0x94, 0x4f, 0x92, 0x2a,
+    0x6b, 0x4c, 0x08, 0xcc, 0x9b, 0x5a, 0x3e, 0xca, 0x43, 0xda, 0x38, 0x27,
+    0x56, 0xc0, 0xad, 0x73, 0x60, 0x84, 0xed, 0x0f, 0x4c, 0xe1, 0x15, 0xa7,
+    0xf0, 0xc0, 0x16, 0x80, 0xf6, 0x66, 0x8c, 0x30, 0x01, 0xc8, 0x16, 0xaa,
+    0x41, 0x06, 0xc1, 0x8b, 0xbd, 0x46, 0xb9, 0x71, 0x88, 0x52, 0x6b, 0x00,
+    0xf2, 0x6e, 0x41, 0xa3, 0x96, 0x18, 0x8d, 0x4b, 0xea, 0xc6, 0x8d, 0xdd,
+    0x45, 0x3b, 0xe8, 0x0b, 0xdc, 0x63, 0x28, 0x72, 0x0e, 0x0f, 0xe9, 0x07,
+    0x78, 0x9a, 0xb0, 0xca, 0x30, 0x02, 0x4c, 0x17, 0x21, 0xfc, 0x0c, 0x79,
+    0xf9, 0xef, 0x3c, 0x37, 0xc6, 0xe7, 0x23, 0xe0, 0xc2, 0x27, 0x20, 0xf9,
+    0x3e, 0x52, 0xdb, 0x5a, 0x2c, 0x7b, 0x02, 0x25, 0x2c, 0x46, 0x9f, 0xc7,
+    0xc1, 0x82, 0x49, 0xa3, 0x80, 0x28, 0x85, 0x53, 0x8b, 0xeb, 0xe1, 0x77,
+    0x78, 0x29, 0x27, 0x0b, 0x01, 0xe9, 0xc1, 0x2a, 0x11, 0x2c, 0x70, 0x37,
+    0x6c, 0xad, 0xc5, 0xb8, 0x5d, 0xca, 0x20, 0xf9, 0x05, 0x2c, 0xd4, 0x86,
+    0x02, 0xde, 0x20, 0xfe, 0x0a, 0xd5, 0x02, 0xb3, 0x4c, 0xf2, 0x39, 0xc0,
+    0xd5, 0x3d, 0xbf, 0x9f, 0x89, 0x8b, 0xd7, 0x61, 0x7a, 0x7e, 0xce, 0x03,
+    0x86, 0x21, 0x4e, 0x8b, 0x8d, 0x34, 0x5e, 0x30, 0x49, 0xa8, 0x47, 0x0c,
+    0xee, 0x35, 0x04, 0x00, 0x4a, 0xbb, 0x47, 0x7b, 0xe7, 0x70, 0xfd, 0x01,
+    0xd3, 0xa3, 0x6b, 0x35, 0x2e, 0x18, 0x18, 0xa0, 0x3b, 0x49, 0x55, 0xf8,
+    0x3c, 0xc2, 0xba, 0xc5, 0x8f, 0x59, 0xe8, 0x73, 0x31, 0x0d, 0xca, 0xac,
+    0x59, 0xfd, 0x39, 0x4f, 0x08, 0xcc, 0x99, 0xb8, 0x75, 0x63, 0x94, 0xf3,
+    0x62, 0xdc, 0xd3, 0xd6, 0x17, 0xf9, 0x0a, 0x29, 0x97, 0x36, 0x5d, 0x76,
+    0x89, 0x19, 0x1c, 0x49, 0x06, 0x4c, 0xb8, 0xd5, 0x63, 0x6b, 0xae, 0xc5,
+    0x35, 0x6e, 0x5c, 0xc6, 0xa6, 0xa1, 0x79, 0x04, 0xeb, 0x86, 0x1e, 0x1f,
+    0xc0, 0xdd, 0x85, 0xe5, 0xa2, 0x45, 0x56, 0x81, 0xf9, 0x70, 0xa0, 0x50,
+    0x43, 0x24, 0xe3, 0x01, 0xa8, 0x6b, 0x86, 0xd8, 0x7e, 0xa3, 0x4f, 0xb8,
+    0xae, 0x7a, 0x0a, 0x0a, 0x24, 0xc5, 0x03, 0xe2, 0xa9, 0xde, 0x4c, 0x3a,
+    0x87, 0x25, 0x2e, 0x1a, 0xf4, 0x77, 0x5a, 0x3c, 0x4a, 0x8c, 0x37, 0x93,
+    0x21, 0x0e, 0xc1, 0xc9, 0xfb, 0x43, 0x2c, 0x5a, 0xee, 0x51, 0x6d, 0x68,
+    0x79, 0x87, 0x61, 0x7f, 0xc7, 0x43, 0x3a, 0x53, 0xf3, 0x79, 0x96, 0xd2,
+    0x82, 0x80, 0xd8, 0xaf, 0xf2, 0x52, 0xc9, 0x9c, 0x57, 0xbd, 0xb9, 0x5c,
+    0x7d, 0x18, 0x4b, 0xbb, 0x0a, 0xaf, 0x17, 0x45, 0xad, 0x84, 0xc0, 0xce,
+    0xe2, 0x35, 0x84, 0xe1, 0x1e, 0xea, 0x8e, 0x3d, 0x60, 0x4e, 0x0e, 0xce,
+    0x92, 0x62, 0xee, 0x13, 0xc5, 0x78, 0x9d, 0x4b, 0x83, 0xb1, 0x90, 0xb8,
+    0x49, 0x85, 0x20, 0x75, 0x3f, 0xc0, 0x13, 0x35, 0xfd, 0xfc, 0xdc, 0x0a,
+    0x09, 0xdf, 0x00, 0x7b, 0xeb, 0xa2, 0xf6, 0xd8, 0x4d, 0x66, 0xa8, 0x35,
+    0x4d, 0x92, 0x29, 0xd2, 0x5b, 0xa5, 0xc1, 0x84, 0x08, 0x9f, 0x2b, 0x3d,
+    0x23, 0xe7, 0x24, 0x65, 0x02, 0xac, 0x9d, 0x09, 0x89, 0xc7, 0xd8, 0x32,
+    0x63, 0xb4, 0x94, 0x23, 0x6e, 0x04, 0xdf, 0x07, 0xf7, 0xd8, 0x05, 0x9a,
+    0x57, 0x7b, 0xd8, 0xe4, 0xd6, 0x24, 0x5c, 0x81, 0x94, 0xf3, 0x70, 0x22,
+    0xe9, 0x9d, 0x9f, 0x91, 0x34, 0x1b, 0x60, 0xd9, 0x94, 0x57, 0x75, 0x25,
+    0x0c, 0x81, 0xc9, 0xac, 0x42, 0xaf, 0xaf, 0x8e, 0xcc, 0xb4, 0x1d, 0xd6,
+    0x79, 0x3b, 0xf5, 0x7d, 0x0b, 0x96, 0x8c, 0x85, 0x34, 0x48, 0xcf, 0x53,
+    0xfd, 0x75, 0x7b, 0xf4, 0x3b, 0x46, 0xce, 0xf7, 0x19, 0x63, 0x4a, 0xd2,
+    0x64, 0x00, 0x3a, 0xce, 0x79, 0x71, 0x56, 0xc9, 0x05, 0xf1, 0x1b, 0x5d,
+    0x54, 0x58, 0xc2, 0x88, 0x01, 0xc8, 0xdb, 0x68, 0x7c, 0x74, 0x91, 0x76,
+    0x5d, 0x95, 0x19, 0x0f, 0x73, 0x61, 0x62, 0xfd, 0x8c, 0xa4, 0x7f, 0x48,
+    0xfa, 0x1b, 0x75, 0x4a, 0xda, 0xf3, 0xa2, 0xf5, 0x9e, 0x02, 0x5c, 0x66,
+    0xb8, 0x14, 0xf0, 0xe6, 0xb2, 0xe7, 0x01, 0x71, 0xb3, 0x0e, 0xb7, 0x12,
+    0xc0, 0xd6, 0x4c, 0x71, 0x72, 0x27, 0x64, 0x6b, 0xbb, 0xe9, 0x0f, 0x44,
+    0x43, 0x04, 0x4f, 0x9b, 0x6e, 0xf0, 0x5b, 0x80, 0xf3, 0x09, 0x18, 0x63,
+    0x26, 0x24, 0x5b, 0xb8, 0x90, 0xb1, 0x59, 0x6a, 0x4c, 0xd2, 0x58, 0x60,
+    0xfa, 0x79, 0x59, 0x13, 0x23, 0x95, 0x4c, 0x20, 0x69, 0x98, 0x58, 0x39,
+    0xe2, 0xbb, 0x19, 0x2b, 0xef, 0x43, 0xf8, 0x4e, 0x38, 0x49, 0x45, 0x88,
+    0xd0, 0x8e, 0x78, 0x8d, 0xc2, 0x50, 0x8f, 0x41, 0x95, 0x4f, 0x22, 0x78,
+    0xbe, 0xbe, 0x40, 0x2b, 0x75, 0x4e, 0x22, 0x64, 0xf9, 0x6c, 0x2c, 0x40,
+    0xf8, 0x31, 0xb4, 0x1a, 0x18, 0x05, 0xdc, 0xc4, 0x04, 0x87, 0x4a, 0x2c,
+    0xb8, 0x6b, 0xa3, 0x75, 0x02, 0x6a, 0xfb, 0x00, 0xb9, 0x26, 0x7e, 0xb3,
+    0x7c, 0xc4, 0x15, 0x59, 0xb3, 0x08, 0x79, 0x0a, 0x2e, 0xf2, 0x26, 0x39,
+    0xff, 0x52, 0x01, 0x50, 0x8e, 0x12, 0x52, 0x5b, 0x42, 0x0a, 0xbd, 0x01,
+    0x49, 0x13, 0x01, 0x16, 0xee, 0xc7, 0x13, 0xaa, 0x4c, 0x3c, 0xae, 0x47,
+    0x73, 0x27, 0x4b, 0x94, 0xe7, 0xe3, 0x14, 0x5c, 0x2e, 0x7f, 0xef, 0x47,
+    0xf0, 0x7a, 0x14, 0x1f, 0x09, 0x29, 0x83, 0x27, 0x20, 0x35, 0xdd, 0x10,
+    0x9c, 0x13, 0xb8, 0xfd, 0x58, 0x08, 0x4d, 0x0e, 0x1b, 0xf5, 0xf4, 0x0c,
+    0x5a, 0x3c, 0x6f, 0xba, 0x88, 0x17, 0x4d, 0xb9, 0x10, 0xf8, 0x00, 0x62,
+    0xb3, 0xd6, 0xc4, 0x9c, 0xe3, 0xfe, 0x87, 0x4a, 0x10, 0x06, 0xad, 0xe4,
+    0xed, 0xfb, 0x4c, 0xeb, 0x7b, 0xad, 0x3e, 0xbd, 0xd6, 0xef, 0x04, 0xff,
+    0x04, 0x0b, 0x1f, 0xa3, 0xd0, 0xea, 0x41, 0x11, 0x57, 0x97, 0x60, 0x8c,
+    0x08, 0x96, 0xbf, 0xc3, 0xeb, 0x5b, 0xa4, 0x61, 0xb1, 0xa7, 0x25, 0xa5,
+    0x1c, 0x0f, 0x38, 0x87, 0x4b, 0x74, 0xe8, 0xda, 0x02, 0x68, 0x9d, 0x21,
+    0x1b, 0x93, 0xcb, 0x00, 0xb6, 0x80, 0xf4, 0xb3, 0x5d, 0xd2, 0x97, 0x11,
+    0xbc, 0x13, 0x6b, 0x04, 0x21, 0xd4, 0x79, 0x86, 0xb8, 0x7c, 0x9f, 0x26,
+    0xec, 0x11, 0xac, 0x3d, 0xba, 0x4c, 0x0f, 0xac, 0xe5, 0x99, 0xb7, 0xe9,
+    0xfa, 0x45, 0xdd, 0x69, 0xbc, 0xfa, 0x82, 0x63, 0x82, 0x39, 0x42, 0xe0,
+    0x2c, 0x6e, 0x59, 0x61, 0x62, 0x75, 0x37, 0xe0, 0x74, 0xbe, 0x88, 0xb2,
+    0xd3, 0x77, 0x75, 0x77, 0xed, 0x1d, 0xc4, 0x61, 0x73, 0x48, 0x8c, 0x67,
+    0xb9, 0xef, 0x10, 0x96, 0x7e, 0x9d, 0x18, 0x3f, 0x8b, 0xd2, 0x97, 0x1b,
+    0x7a, 0x51, 0x52, 0xe9, 0x43, 0xae, 0xf9, 0x69, 0x14, 0x3d, 0x04, 0x65,
+    0x1e, 0xb3, 0xeb, 0x02, 0xe3, 0x4c, 0xe0, 0x61, 0xb3, 0xdc, 0xe5, 0x5a,
+    0xc8, 0x8f, 0x10, 0x22, 0x6f, 0x14, 0x41, 0x8a, 0x02, 0x70, 0xe3, 0x1b,
+    0x5a, 0xd8, 0x43, 0xb4, 0x03, 0x26, 0xe7, 0xe7, 0xf0, 0x8c, 0x69, 0x89,
+    0x1f, 0x07, 0xd4, 0xde, 0xc1, 0xe2, 0x13, 0x25, 0xc0, 0x9b, 0xcd, 0x2c,
+    0xdc, 0xec, 0xf1, 0xac, 0x3f, 0xc3, 0xf3, 0xfe, 0xbf, 0x9a, 0x1d, 0x98,
+    0x86, 0xc4, 0x09, 0x0e, 0xd7, 0x1b, 0x70, 0x0b, 0x09, 0x77, 0xe1, 0x9a,
+    0x93, 0x5c, 0x58, 0xc8, 0xed, 0x76, 0x49, 0xfa, 0x2e, 0x16, 0xa8, 0xf4,
+    0xe8, 0xa7, 0x5b, 0xf9, 0xe9, 0x47, 0xe8, 0xc3, 0x4c, 0xa8, 0x1f, 0xd7,
+    0x2c, 0x45, 0x5d, 0xd1, 0xc8, 0xca, 0xd5, 0xd7, 0x51, 0xbe, 0x4d, 0x7d,
+    0xbd, 0xb4, 0xe9, 0xfb, 0xad, 0xc5, 0xdc, 0xe8, 0x95, 0xf4, 0x1a, 0xa8,
+    0xb9, 0xd5, 0x00, 0x54, 0x23, 0x8b, 0xa5, 0x93, 0x28, 0xea, 0x83, 0x45,
+    0xe2, 0x3e, 0x81, 0xcb, 0xb5, 0x7b, 0xed, 0xf5, 0x2c, 0xd7, 0x0e, 0x21,
+    0xf0, 0x41, 0x14, 0x70, 0x6e, 0x09, 0xa1, 0x55, 0x6c, 0x89, 0xfc, 0xa0,
+    0xa4, 0x27, 0x74, 0xfd, 0xc2, 0xae, 0x6b, 0xa6, 0xbc, 0x02, 0xbe, 0x5c,
+    0x0d, 0x5b, 0x1c, 0x4d, 0xd3, 0xe4, 0x70, 0xc5, 0x87, 0x5d, 0x5e, 0x4e,
+    0x9a, 0xee, 0xee, 0xb0, 0xe9, 0x13, 0x86, 0xe5, 0xf8, 0x36, 0x50, 0xbe,
+    0x11, 0xc1, 0x9d, 0xab, 0xbf, 0xae, 0x85, 0xdd, 0x24, 0xcf, 0xa2, 0xe8,
+    0x41, 0x95, 0x76, 0x53, 0x45, 0x15, 0x56, 0x7f, 0x0a, 0x2c, 0x4b, 0x78,
+    0x3d, 0xcb, 0xc3, 0x92, 0x7e, 0x4d, 0x4a, 0xcd, 0x85, 0x29, 0x40, 0xa6,
+    0x2d, 0xd5, 0x02, 0xfa, 0x57, 0x18, 0x3c, 0xa8, 0xa3, 0x0e, 0x4f, 0x90,
+    0x47, 0xc3, 0xd0, 0xd9, 0x59, 0xfa, 0x0a, 0x24, 0xa5, 0x0f, 0x34, 0x3f,
+    0x80, 0xf0, 0xaf, 0x61, 0xf5, 0x52, 0xd7, 0x17, 0xd5, 0xa4, 0xd8, 0x9f,
+    0xd2, 0xb0, 0x4d, 0x7a, 0xed, 0xfd, 0x6e, 0x2d, 0xec, 0x66, 0x39, 0xb8,
+    0x08, 0x63, 0xbc, 0xee, 0x66, 0x8f, 0x53, 0x5c, 0x38, 0x8a, 0x6c, 0x37,
+    0x45, 0x0d, 0x68, 0x61, 0x4f, 0xd0, 0xfd, 0x1e, 0xbf, 0x96, 0xa9, 0x24,
+    0x37, 0x80, 0x05, 0x5d, 0xa6, 0xd7, 0x1f, 0x2d, 0x63, 0xe5, 0xf8, 0x18,
+    0xab, 0x4b, 0x13, 0xfa, 0xf4, 0x66, 0xa9, 0x73, 0x92, 0x7e, 0x89, 0x41,
+    0x43, 0x2b, 0xb0, 0xb0, 0x2e, 0xea, 0x10, 0x88, 0xd9, 0xc6, 0x11, 0x98,
+    0xf4, 0xe2, 0x16, 0x31, 0x36, 0xf0, 0x79, 0xdc, 0x6b, 0x7d, 0x3b, 0x84,
+    0x1f, 0x81, 0xd0, 0xf8, 0xf5, 0x79, 0x29, 0x6b, 0x89, 0x0e, 0x84, 0xff,
+    0x31, 0x60, 0x5d, 0xeb, 0xa5, 0xbc, 0x61, 0x9a, 0xb5, 0xcf, 0xa0, 0x88,
+    0xa2, 0x14, 0xe0, 0x6a, 0x65, 0xa7, 0x04, 0xb7, 0xdd, 0x3d, 0xee, 0x81,
+    0xdd, 0x46, 0xf2, 0xfb, 0x3a, 0x84, 0x9b, 0xf0, 0x00, 0xad, 0x9c, 0x9d,
+    0xa2, 0x26, 0xaa, 0xc6, 0x1f, 0xb1, 0x48, 0xd3, 0xa9, 0xeb, 0xf7, 0x33,
+    0xe4, 0x08, 0x51, 0xb7, 0xe6, 0x78, 0x32, 0xdf, 0x7c, 0x16, 0x2b, 0x77,
+    0x67, 0x74, 0x6d, 0x3b, 0x7a, 0x83, 0x51, 0x82, 0x03, 0xc6, 0x0a, 0xc8,
+    0xcd, 0x2d, 0x66, 0x61, 0x25, 0x82, 0x37, 0xcc, 0x96, 0x41, 0x01, 0x76,
+    0x43, 0xc5, 0x13, 0x08, 0x7f, 0x3f, 0x9e, 0x18, 0x78, 0x96, 0x1f, 0xd1,
+    0xc2, 0x6e, 0x96, 0xdf, 0x42, 0x7a, 0xe6, 0x17, 0x6b, 0x42, 0xa8, 0x80,
+    0x12, 0x06, 0xd0, 0x66, 0x02, 0x81, 0x13, 0x26, 0x9e, 0xdd, 0x56, 0x34,
+    0xd7, 0xbd, 0xe9, 0xa4, 0x88, 0x8a, 0xe1, 0x0d, 0x57, 0x4b, 0xa0, 0x08,
+    0xb7, 0x4b, 0x74, 0x87, 0xa4, 0x6f, 0x6b, 0x61, 0xb7, 0xea, 0xa3, 0x5a,
+    0x58, 0xcd, 0xae, 0x31, 0x06, 0x71, 0xcc, 0x72, 0x10, 0xb7, 0xff, 0x0d,
+    0x29, 0x37, 0x53, 0xa8, 0x0b, 0x53, 0x68, 0xcc, 0x82, 0xe6, 0x83, 0xdc,
+    0xac, 0xc1, 0xb4, 0xcb, 0x22, 0x1e, 0x36, 0xb4, 0x33, 0xd1, 0x6d, 0x86,
+    0x0b, 0xb8, 0x96, 0xf4, 0xbc, 0xd7, 0xa7, 0x8b, 0x98, 0x0c, 0xe3, 0xde,
+    0xbb, 0x9d, 0xe1, 0x6e, 0x83, 0xc4, 0x36, 0x50, 0xfd, 0x31, 0x5c, 0xfd,
+    0x11, 0xd8, 0x5d, 0x83, 0xc7, 0x61, 0x5c, 0xaa, 0x3b, 0x2d, 0xe9, 0x4f,
+    0x5a, 0xd8, 0xc5, 0xf6, 0x6e, 0x31, 0xed, 0xbc, 0xa5, 0x6c, 0x69, 0x8d,
+    0x81, 0xe8, 0x0f, 0x32, 0x91, 0x2e, 0x26, 0x12, 0xcb, 0xd3, 0xaa, 0xba,
+    0x82, 0xe2, 0x7a, 0xa8, 0xe3, 0xcf, 0x6a, 0x61, 0x53, 0xc5, 0x2c, 0x93,
+    0x4f, 0xa0, 0xa0, 0x1a, 0xde, 0x57, 0x9a, 0xdc, 0x1d, 0x25, 0xe4, 0xdc,
+    0x9e, 0x85, 0x66, 0x14, 0x1c, 0x84, 0x30, 0x4b, 0xe7, 0xf2, 0x6f, 0x6b,
+    0x61, 0x1b, 0xcf, 0xcb, 0x54, 0x8e, 0xd9, 0x62, 0xe3, 0x6a, 0x39, 0x69,
+    0xe7, 0x76, 0xe2, 0xef, 0x5e, 0x26, 0xb8, 0x26, 0xa4, 0xa6, 0xb7, 0xe5,
+    0xed, 0x65, 0x5d, 0xdb, 0x29, 0x96, 0xc6, 0xd2, 0xd5, 0x08, 0x55, 0xc3,
+    0x67, 0xf7, 0x57, 0x1a, 0xf7, 0x37, 0x99, 0x18, 0xe7, 0xc4, 0xf3, 0xcc,
+    0x73, 0x9e, 0xfb, 0xf6, 0x50, 0xb2, 0xbf, 0x8c, 0xd5, 0x2f, 0x2f, 0x15,
+    0x58, 0x96, 0xdb, 0xc0, 0x6c, 0x84, 0xef, 0xdf, 0x43, 0x83, 0xe3, 0x16,
+    0x5d, 0x5b, 0xa2, 0x52, 0x48, 0x4b, 0x3d, 0x67, 0x72, 0x74, 0xd4, 0x58,
+    0x7a, 0xa9, 0xc3, 0x91, 0xad, 0x73, 0xd0, 0xda, 0x97, 0xe8, 0x1b, 0x0c,
+    0x2f, 0xa7, 0x7a, 0xbc, 0xd1, 0x5d, 0xdd, 0x51, 0xd0, 0xbf, 0x8b, 0xda,
+    0xfb, 0x2e, 0xa3, 0x88, 0x40, 0xa5, 0xdb, 0x35, 0x9e, 0x35, 0x61, 0x35,
+    0x4c, 0xe5, 0x78, 0x10, 0x05, 0xf4, 0xdd, 0x08, 0xa5, 0x2e, 0xd5, 0x04,
+    0x03, 0x62, 0x76, 0x37, 0xcd, 0x0f, 0xd7, 0xe7, 0x6b, 0x24, 0xce, 0xa3,
+    0xcb, 0x7c, 0xd6, 0x3c, 0x69, 0x75, 0x48, 0x0b, 0x1b, 0xad, 0xba, 0x69,
+    0x98, 0x9c, 0xa4, 0xa2, 0x9b, 0xba, 0xd1, 0x89, 0x97, 0x7a, 0x5f, 0x7f,
+    0x14, 0x92, 0x72, 0x2b, 0xca, 0xd8, 0x01, 0x70, 0xae, 0xc3, 0x2b, 0x12,
+    0x26, 0xd6, 0x03, 0x13, 0xfb, 0x11, 0x2f, 0x4c, 0xe6, 0x4c, 0xdb, 0xfb,
+    0x3d, 0xca, 0xf4, 0xf7, 0xc9, 0x44, 0x13, 0xa5, 0x2c, 0xa2, 0xca, 0xf5,
+    0xc7, 0x86, 0x28, 0xc2, 0x36, 0x40, 0x54, 0xdc, 0x8e, 0xcd, 0x46, 0x83,
+    0xf6, 0xf5, 0xd0, 0xec, 0x26, 0x94, 0x31, 0x07, 0x6f, 0xb8, 0x04, 0x01,
+    0x3b, 0x43, 0x5a, 0x3b, 0x4f, 0xf5, 0x59, 0x96, 0x05, 0x9a, 0x95, 0xf8,
+    0xeb, 0xac, 0x03, 0xcd, 0x0a, 0xaf, 0x41, 0x12, 0x27, 0x03, 0xb8, 0xad,
+    0x6e, 0x6e, 0x89, 0xce, 0x6d, 0x88, 0x9a, 0xd1, 0xca, 0xae, 0x43, 0xae,
+    0xda, 0x88, 0xe8, 0xf3, 0xf1, 0xf9, 0x58, 0xb5, 0xf1, 0x3f, 0x93, 0xf2,
+    0xee, 0xa8, 0x80, 0xc4, 0xa7, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45,
+    0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
 };
 
+/* decoded on first use; kept for the lifetime of the process */
+static SDL_Surface * neuik_StockImageSurf_app_crashed = NULL;
+
 
 /*******************************************************************************
  *
  *  Name:          neuik_GetStockImage_app_crashed
  *
- *  Description:   Return a pointer to the .
+ *  Description:   Create a new NEUIK_Image containing the stock image.
  *
- *  Returns:       NULL if there is a problem; otherwise a valid string
+ *  Returns:       1 if there is an error; 0 otherwise.
  *
  ******************************************************************************/
 int neuik_GetStockImage_app_crashed(
     NEUIK_Image ** imgPtr)
 {
-    return NEUIK_MakeImage_FromSource(
+    return neuik_MakeImage_FromEncodedStock(
         imgPtr,
-        neuik_StockImageData_app_crashed.width,
-        neuik_StockImageData_app_crashed.height,
-        neuik_StockImageData_app_crashed.bytes_per_pixel,
-        neuik_StockImageData_app_crashed.pixel_data);
+        neuik_StockImageData_app_crashed,
+        sizeof(neuik_StockImageData_app_crashed),
+        &neuik_StockImageSurf_app_crashed);
 }
-
@@ -14,5770 +14,349 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  ******************************************************************************/
 
-/* GIMP RGBA C-Source image dump (neuik_icon_191x191.c) */
+/* PNG encoded image (stock_images/neuik_icon_191x191.png) */
 #include <SDL.h>
 #include "NEUIK_Image.h"
+#include "NEUIK_StockImage_internal.h"
 
-static const struct {
-    unsigned int     width;
-    unsigned int     height;
-    unsigned int     bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
-    unsigned char    pixel_data[191 * 191 * 4 + 1];
-} neuik_StockImageData_neuik_icon = {
-    191, 191, 4,
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\371\000\000\000~\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\370\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\300\300\300\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\300"
-    "\300\300\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335"
-    "\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335"
-    "\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335"
-    "\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\365\365"
-    "\365\377\306\306\306\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\347\347\347"
-    "\377\273\273\273\377\273\273\273\377\273\273\273\377\273\273\273\377\273"
-    "\273\273\377\273\273\273\377\273\273\273\377\273\273\273\377\273\273\273"
-    "\377\273\273\273\377\273\273\273\377\273\273\273\377\273\273\273\377\273"
-    "\273\273\377\273\273\273\377\273\273\273\377\347\347\347\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\337\337\337\377\212\212\212\377\212"
-    "\212\212\377\212\212\212\377\212\212\212\377\212\212\212\377\212\212\212"
-    "\377\212\212\212\377\212\212\212\377\212\212\212\377\212\212\212\377\212"
-    "\212\212\377\226\226\226\377\274\274\274\377\274\274\274\377\274\274\274"
-    "\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274"
-    "\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274"
-    "\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274"
-    "\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274"
-    "\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274"
-    "\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274"
-    "\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274"
-    "\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274"
-    "\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274"
-    "\274\274\377\274\274\274\377\341\341\341\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\372\372\372\377\371\371\371\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\364\364\364\377sss\377\241\241"
-    "\241\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377QQQ\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\211\211"
-    "\211\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\360\360\360\377~~~\377\372\372\372\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\365\365\365\377sss\377"
-    "MMM\377\241\241\241\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\306\306\306\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\211\211\211\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\360\360\360\377MMM\377\206\206\206\377\375\375\375\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\365\365\365\377sss\377M"
-    "MM\377MMM\377\241\241\241\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244"
-    "\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377>>>\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\211\211\211\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\360\360\360\377MMM\377MMM\377\220\220\220\377\376\376\376\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\365\365\365\377sss\377MMM\377MMM\377MMM\377\241"
-    "\241\241\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\272\272\272\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\211\211"
-    "\211\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\360\360\360\377MMM\377MMM\377MMM\377\232\232\232\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\365\365\365"
-    "\377sss\377MMM\377MMM\377MMM\377MMM\377\241\241\241\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335"
-    "\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\063\063"
-    "\063\377\376\376\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\211\211\211\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\360\360\360\377MMM\377MMM\377MMM\377MMM"
-    "\377\253\253\253\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\365"
-    "\365\365\377sss\377MMM\377MMM\377MMM\377MMM\377MMM\377\241\241\241\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\253\253\253\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\211\211\211\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\360\360\360\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377\266\266\266\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\364\364\364"
-    "\377rrr\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377\247\247\247\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377&&&\377\373\373\373\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\211\211\211\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\360\360\360\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377NNN\377\273\273\273\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\365\365\365\377sss\377MMM\377MMM\377MMM\377MMM\377M"
-    "MM\377MMM\377}}}\377\371\371\371\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\235"
-    "\235\235\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217"
-    "\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\211\211\211\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\376\376\376\377\207\207\207\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377PPP\377\311\311\311\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\363\363\363\377qqq\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377~~~\377\371\371\371\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\033\033\033\377\366\366\366\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\211\211\211\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\373"
-    "\373\373\377\201\201\201\377MMM\377MMM\377MMM\377MMM\377MMM\377QQQ\377\316"
-    "\316\316\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\364\364\364\377sss\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377}}}"
-    "\377\371\371\371\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335"
-    "\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\216\216\216\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\211\211\211\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\371\371\371\377xxx\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377UUU\377\327\327\327\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\364\364\364\377sss\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377}}}\377\371\371\371\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\024\024\024\377\361\361\361"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\304\304\304\377\326\326\326\377\326\326\326\377\326\326"
-    "\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377"
-    "\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326"
-    "\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377"
-    "\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326"
-    "\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377"
-    "\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326"
-    "\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377"
-    "\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326"
-    "\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377"
-    "\326\326\326\377\355\355\355\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\365\365\365\377qqq\377MMM\377MMM\377MMM\377MMM\377MMM\377XXX\377\335\335"
-    "\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\364\364\364\377sss\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "~~~\377\371\371\371\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\177\177"
-    "\177\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\361\361\361\377jjj\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377\\\\\\\377\344\344\344\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\364\364\364\377rrr\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377~~~\377"
-    "\371\371\371\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\014\014\014\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\354\354\354\377ddd\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377bbb\377\353\353\353\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\364\364\364\377"
-    "rrr\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377~~~\377\371\371\371\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377qqq\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\347\347\347\377^^^\377M"
-    "MM\377MMM\377MMM\377MMM\377MMM\377kkk\377\362\362\362\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\364\364\364\377rrr\377MMM\377MMM\377MMM"
-    "\377MMM\377MMM\377MMM\377~~~\377\371\371\371\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\006\006\006\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\010\010\010\377\341\341\341\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\340\340"
-    "\340\377ZZZ\377MMM\377MMM\377MMM\377MMM\377MMM\377rrr\377\366\366\366\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\364\364\364\377rrr\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377~~~\377\371\371\371\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377UUU\377\034\034\034\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377bbb\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351"
-    "\351\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\331\331\331"
-    "\377VVV\377MMM\377MMM\377MMM\377MMM\377MMM\377zzz\377\371\371\371\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\364\364\364\377rrr\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377~~~\377\371\371\371\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377^^^\377\226\226\226\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\003\003\003"
-    "\377\325\325\325\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217"
-    "\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\321"
-    "\321\321\377SSS\377MMM\377MMM\377MMM\377MMM\377MMM\377\203\203\203\377\374"
-    "\374\374\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\364\364\364\377rrr\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377~~~\377\371\371\371\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377^^^\377\372\372\372\377###\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "SSS\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\311"
-    "\311\311\377PPP\377MMM\377MMM\377MMM\377MMM\377MMM\377\214\214\214\377\376"
-    "\376\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\364\364\364\377rrr\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377~~~"
-    "\377\371\371\371\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335"
-    "\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^"
-    "^\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\001\001\001\377\310\310\310\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\277\277\277\377NNN\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "\226\226\226\377\377\377\377\377\377\377\377\377\377\377\377\377\364\364"
-    "\364\377rrr\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377~~~\377\371\371"
-    "\371\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "^^^\377\377\377\377\377\375\375\375\377\060\060\060\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377EEE\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\266\266\266\377MMM\377MMM\377MMM\377MMM"
-    "\377MMM\377MMM\377\241\241\241\377\377\377\377\377\364\364\364\377rrr\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377~~~\377\371\371\371\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "^^^\377\377\377\377\377\377\377\377\377\263\263\263\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\274\274\274\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\253\253\253\377MMM\377M"
-    "MM\377MMM\377MMM\377MMM\377MMM\377\244\244\244\377ooo\377MMM\377MMM\377M"
-    "MM\377MMM\377MMM\377MMM\377\177\177\177\377\371\371\371\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377^^^\377\377\377\377\377\377\377\377\377\377\377\377\377???\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\065\065\065\377\376\376\376\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\240\240"
-    "\240\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377M"
-    "MM\377MMM\377MMM\377~~~\377\371\371\371\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377^^^\377\377\377\377\377\377\377\377\377\377\377\377\377\303\303\303"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\256\256\256\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217"
-    "\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\376\376\376\377\226\226\226\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377~~~\377\371\371\371\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377III\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377'''\377\373\373\373\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351"
-    "\351\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\376\376\376\377\221\221\221\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377~~~\377\371\371\371\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335"
-    "\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335"
-    "\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\321\321"
-    "\321\377\002\002\002\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\240\240\240\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\375\375\375\377\207\207\207\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377~~~\377\371\371\371\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335"
-    "\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335"
-    "\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377XXX\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\037\037\037\377\370\370\370"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\373\373\373\377\177\177\177\377MMM\377MMM\377"
-    "MMM\377MMM\377~~~\377\371\371\371\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335"
-    "\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^"
-    "^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\332\332\332\377\005\005\005\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\221\221\221\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\365\365\365\377"
-    "|||\377|||\377|||\377|||\377|||\377|||\377|||\377|||\377|||\377|||\377||"
-    "|\377|||\377|||\377|||\377|||\377|||\377|||\377ttt\377MMM\377MMM\377MMM\377"
-    "MMM\377www\377|||\377|||\377|||\377|||\377|||\377|||\377|||\377|||\377||"
-    "|\377|||\377|||\377|||\377|||\377|||\377|||\377|||\377|||\377|||\377|||\377"
-    "\272\272\272\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377ggg\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\025\025\025\377\362\362\362\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\360\360\360\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377\241\241\241\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335"
-    "\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335"
-    "\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\346\346\346\377\012\012\012\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\202\202\202\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\360\360\360\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "\241\241\241\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377vvv\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\015\015\015\377\351\351\351"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\360\360\360\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377\241\241\241\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335"
-    "\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\357\357\357\377\021\021\021\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377ttt\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\360\360\360\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377\241\241\241\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\204\204\204\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\010\010\010\377\342"
-    "\342\342\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351"
-    "\351\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\360\360\360\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM"
-    "\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377\241\241\241\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\364\364\364\377\030\030\030\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377eee\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\223\223\223\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\003\003\003\377\326\326\326\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\372\372\372\377\"\"\"\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377VVV\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351"
-    "\351\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377^^^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\241\241\241\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\001\001\001\377\315\315\315\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217"
-    "\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335"
-    "\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335"
-    "\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\375\375\375\377///\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377HHH\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\260\260\260\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\276"
-    "\276\276\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377;;;\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377"
-    "@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@"
-    "@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377"
-    "@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@"
-    "@\377@@@\377@@@\377@@@\377\223\223\223\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335"
-    "\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335"
-    "\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377:::\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\066\066\066\377\376\376\376\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377nnn\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335"
-    "\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\302\302\302\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\261\261\261\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377nnn\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335"
-    "\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377GGG\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377,,,\377\375\375\375\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377nnn\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244"
-    "\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\320\320\320\377\002\002\002\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\242\242\242\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377nnn\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377UUU\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\040\040\040\377\370\370\370\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377nnn\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244"
-    "\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\331\331\331"
-    "\377\004\004\004\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\224\224\224\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377nnn\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\370\370\370\377\254\254"
-    "\254\377\254\254\254\377\254\254\254\377\254\254\254\377\254\254\254\377"
-    "\254\254\254\377\254\254\254\377\254\254\254\377\254\254\254\377\254\254"
-    "\254\377\254\254\254\377\254\254\254\377\254\254\254\377\254\254\254\377"
-    "\254\254\254\377\254\254\254\377\254\254\254\377\254\254\254\377\254\254"
-    "\254\377\254\254\254\377\254\254\254\377\254\254\254\377\254\254\254\377"
-    "\254\254\254\377\254\254\254\377\254\254\254\377\254\254\254\377\254\254"
-    "\254\377\254\254\254\377\254\254\254\377\254\254\254\377\254\254\254\377"
-    "\254\254\254\377\254\254\254\377\254\254\254\377\254\254\254\377\254\254"
-    "\254\377\254\254\254\377\254\254\254\377\254\254\254\377\254\254\254\377"
-    "\254\254\254\377\323\323\323\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244"
-    "\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377ddd\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\026\026\026\377\362\362\362"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377nnn\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\360\360\360\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377\241\241\241"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\345\345\345\377\011\011\011"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\205\205\205\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377nnn\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\360\360\360\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377\241\241\241\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "^^^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377sss\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\017\017\017\377\355\355\355\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377nnn\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\360"
-    "\360\360\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377\241\241\241\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244"
-    "\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\354\354\354\377\016\016\016\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377www\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377KKK\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377"
-    "RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RR"
-    "R\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377"
-    "RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RR"
-    "R\377RRR\377RRR\377RRR\377\236\236\236\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\360\360"
-    "\360\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377M"
-    "MM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM"
-    "\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377\241\241\241\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244"
-    "\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\201\201\201\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\010\010\010\377\343\343\343\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\360\360\360\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377\241\241\241\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\363\363\363\377\027\027\027\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377hh"
-    "h\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217"
-    "\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\372"
-    "\372\372\377\304\304\304\377\304\304\304\377\304\304\304\377\304\304\304"
-    "\377\304\304\304\377\304\304\304\377\304\304\304\377\304\304\304\377\304"
-    "\304\304\377\304\304\304\377\304\304\304\377\304\304\304\377\304\304\304"
-    "\377\304\304\304\377\304\304\304\377\304\304\304\377\304\304\304\377\304"
-    "\304\304\377\304\304\304\377\304\304\304\377\304\304\304\377\304\304\304"
-    "\377\304\304\304\377\304\304\304\377\304\304\304\377\304\304\304\377\304"
-    "\304\304\377\304\304\304\377\304\304\304\377\304\304\304\377\304\304\304"
-    "\377\304\304\304\377\304\304\304\377\304\304\304\377\304\304\304\377\304"
-    "\304\304\377\304\304\304\377\304\304\304\377\304\304\304\377\304\304\304"
-    "\377\304\304\304\377\304\304\304\377\340\340\340\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335"
-    "\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^"
-    "^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\220\220\220\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\004\004\004\377\330"
-    "\330\330\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\371\371"
-    "\371\377\"\"\"\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377YYY\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\237\237\237"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\001\001\001\377\316\316\316\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\374\374\374\377***\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377KKK\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351"
-    "\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "^^^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\255\255\255\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\277\277\277\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\070\070\070\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377;;;\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\300\300\300\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\264\264\264\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377DDD\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377---\377"
-    "\375\375\375\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351"
-    "\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "^^^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\313"
-    "\313\313\377\001\001\001\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\245\245\245"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "RRR\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377!!!\377\371\371\371\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\330\330\330\377\004\004\004\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\227\227\227\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\363\363\363\377qqq\377qqq\377qqq\377qqq\377qqq\377qqq\377"
-    "qqq\377qqq\377qqq\377qqq\377qqq\377qqq\377qqq\377qqq\377qqq\377qqq\377qq"
-    "q\377qqq\377qqq\377qqq\377qqq\377qqq\377qqq\377qqq\377qqq\377qqq\377qqq\377"
-    "xxx\377\203\203\203\377\217\217\217\377\235\235\235\377\275\275\275\377\343"
-    "\343\343\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244"
-    "\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377aaa\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\031\031\031\377\365\365\365"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\360\360\360\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377ccc\377\241\241\241\377"
-    "\347\347\347\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "^^^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\341\341\341\377\007\007\007\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\210\210\210\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\360\360\360\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377PPP\377\224\224\224\377\363\363\363\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377ppp\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\020\020\020\377\355\355\355\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351"
-    "\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\360\360\360\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377___\377\327\327\327"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\353\353\353"
-    "\377\016\016\016\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377zzz\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217"
-    "\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\360"
-    "\360\360\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377SSS\377\315\315\315"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335"
-    "\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^"
-    "^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\177\177\177"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\011\011\011\377\344\344\344\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\360\360\360\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377UUU\377\336\336\336"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\363\363\363\377\026\026\026\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377kkk\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\375\375\375\377\363\363\363\377\352"
-    "\352\352\377\327\327\327\377\270\270\270\377\230\230\230\377bbb\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377jjj\377\373\373\373\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\215\215\215\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\005\005\005\377\334\334\334\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\376\376\376\377\326\326\326\377"
-    "|||\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377\262\262\262\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\367\367\367\377\036\036\036\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\\\\\\\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\272\272\272\377OOO\377MMM\377MMM\377MMM\377MMM\377aaa\377\374"
-    "\374\374\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\234\234\234\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\002\002\002\377\317\317\317\377\377\377\377\377\377"
-    "\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\272\272\272\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377\312\312\312\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\374\374\374"
-    "\377)))\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377MMM\377\377\377\377\377\377"
-    "\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\201\201\201\377MMM\377MMM\377"
-    "MMM\377MMM\377\223\223\223\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244"
-    "\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\252\252\252\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\305\305\305\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\333"
-    "\333\333\377MMM\377MMM\377MMM\377MMM\377hhh\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335"
-    "\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\376\376\376\377\067\067\067\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377===\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377bbb\377MMM\377MMM\377MMM\377NNN\377\367\367\367\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335"
-    "\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\271\271\271\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\267\267\267\377\217\217\217\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\220\220\220\377MMM\377MMM\377MMM\377MMM\377\346\346"
-    "\346\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377^^^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377BBB\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377...\377\216\216\216\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\253\253\253\377MMM\377MMM\377MMM\377MMM\377"
-    "\331\331\331\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\312\312\312\377\001\001\001\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377PPP\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\270\270\270\377MMM\377MMM\377"
-    "MMM\377MMM\377\315\315\315\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377PPP\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\004\004\004\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351"
-    "\351\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\302\302\302\377MMM\377"
-    "MMM\377MMM\377MMM\377\303\303\303\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\330\330\330\377\004\004"
-    "\004\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\267\267\267\377MMM\377MMM\377MMM\377MMM\377\315\315\315\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335"
-    "\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377^^^\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\252\252\252\377MMM\377MMM\377MMM\377MMM\377\331\331"
-    "\331\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377^^^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\340\340\340\377\007\007\007\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351"
-    "\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\221\221\221\377MMM\377M"
-    "MM\377MMM\377MMM\377\345\345\345\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377mmm\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\304\304\304\377\326\326\326\377\326\326\326\377\326"
-    "\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326"
-    "\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326"
-    "\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326"
-    "\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326"
-    "\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326"
-    "\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326"
-    "\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326"
-    "\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326"
-    "\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326"
-    "\377\326\326\326\377\326\326\326\377\350\350\350\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377ddd\377MMM\377MMM\377MMM\377NNN\377\366\366\366\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\352\352\352\377\015\015\015\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "ooo\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\336\336\336\377MMM\377MMM\377MMM\377MMM\377ggg\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377^^^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377|||\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377ooo\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\204\204\204\377MMM\377MMM\377MMM\377MMM"
-    "\377\222\222\222\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\360\360\360\377\023\023\023\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377ooo\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\300\300\300"
-    "\377NNN\377MMM\377MMM\377MMM\377MMM\377\307\307\307\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335"
-    "\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^"
-    "^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\212\212\212\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377ooo\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\303\303\303\377QQQ\377MMM\377MMM\377MMM\377MMM\377^^^\377\374\374"
-    "\374\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\367\367\367\377\035\035\035\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377ooo\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\335\335\335\377\203\203\203\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377\255\255\255\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\231\231\231\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377ooo\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\374\374\374\377\363\363\363\377\336\336\336\377\300\300"
-    "\300\377\240\240\240\377iii\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377eee\377\371\371\371\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335"
-    "\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\374\374\374\377(((\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377ooo\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\361\361\361\377YYY\377YYY\377YYY\377YYY\377YYY\377YYY\377YYY\377YYY\377"
-    "YYY\377YYY\377YYY\377YYY\377YYY\377YYY\377YYY\377YYY\377YYY\377YYY\377YY"
-    "Y\377YYY\377YYY\377YYY\377YYY\377YYY\377YYY\377YYY\377SSS\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377RR"
-    "R\377\331\331\331\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335"
-    "\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^"
-    "^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\247\247\247\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377ooo\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\360\360\360\377MMM\377MMM\377MMM\377MMM\377MMM\377M"
-    "MM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM"
-    "\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377PPP\377\303\303\303\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\376\376"
-    "\376\377\062\062\062\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377oo"
-    "o\377\377\377\377\377\377\377\377\377\377\377\377\377\360\360\360\377MMM"
-    "\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377ZZZ\377\315\315\315\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335"
-    "\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335"
-    "\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\266\266\266\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377ooo\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\360\360\360\377MMM\377MMM\377MMM\377MMM\377MMM\377M"
-    "MM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM"
-    "\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377NNN\377\211"
-    "\211\211\377\356\356\356\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\347\347\347\377\273\273\273\377\273\273\273\377\273\273\273\377\273\273"
-    "\273\377\273\273\273\377\273\273\273\377\273\273\273\377\273\273\273\377"
-    "\273\273\273\377\273\273\273\377\273\273\273\377\324\324\324\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\276\276\276\377"
-    "\273\273\273\377\273\273\273\377\273\273\273\377\257\257\257\377\212\212"
-    "\212\377\212\212\212\377\212\212\212\377\212\212\212\377\212\212\212\377"
-    "\212\212\212\377\212\212\212\377\212\212\212\377\212\212\212\377\212\212"
-    "\212\377\212\212\212\377\226\226\226\377\274\274\274\377\274\274\274\377"
-    "\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274"
-    "\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377"
-    "\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274"
-    "\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377"
-    "\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274"
-    "\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377"
-    "\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274"
-    "\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377"
-    "\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274"
-    "\274\377\274\274\274\377\274\274\274\377\274\274\274\377\332\332\332\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\360\360\360\377MMM\377M"
-    "MM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM"
-    "\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377ZZZ\377\227\227\227\377\340\340\340\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\362\362\362\377eee\377eee\377eee\377eee\377eee\377e"
-    "ee\377eee\377eee\377eee\377eee\377eee\377eee\377eee\377eee\377eee\377eee"
-    "\377eee\377eee\377eee\377eee\377eee\377eee\377eee\377eee\377eee\377eee\377"
-    "eee\377ooo\377zzz\377\206\206\206\377\226\226\226\377\264\264\264\377\332"
-    "\332\332\377\376\376\376\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\300\300\300\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\300\300\300\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\370\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\370\000\000\000~\000\000\000\371\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\371\000\000\000~\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000",
+static const unsigned char neuik_StockImageData_neuik_icon[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
+    0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0xbf,
+    0x08, 0x06, 0x00, 0x00, 0x00, 0xaf, 0xea, 0x0d, 0x06, 0x00, 0x00, 0x00,
+    0x06, 0x62, 0x4b, 0x47, 0x44, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xa0,
+    0xbd, 0xa7, 0x93, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00,
+    0x00, 0x0b, 0x13, 0x00, 0x00, 0x0b, 0x13, 0x01, 0x00, 0x9a, 0x9c, 0x18,
+    0x00, 0x00, 0x00, 0x07, 0x74, 0x49, 0x4d, 0x45, 0x07, 0xe1, 0x02, 0x08,
+    0x06, 0x02, 0x29, 0xda, 0xb1, 0x9f, 0x54, 0x00, 0x00, 0x00, 0x1d, 0x69,
+    0x54, 0x58, 0x74, 0x43, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77,
+    0x69, 0x74, 0x68, 0x20, 0x47, 0x49, 0x4d, 0x50, 0x64, 0x2e, 0x65, 0x07,
+    0x00, 0x00, 0x0e, 0x34, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xed, 0xdd,
+    0x7b, 0x50, 0x54, 0x65, 0x03, 0x06, 0xf0, 0x67, 0x77, 0xc1, 0x0b, 0xae,
+    0x28, 0x12, 0x0a, 0x19, 0xd0, 0x94, 0x2c, 0x99, 0x0e, 0x02, 0x83, 0x5d,
+    0x0c, 0x6f, 0x99, 0x3a, 0x4c, 0x3a, 0xa4, 0x32, 0x35, 0x36, 0xe9, 0x58,
+    0x36, 0x21, 0x86, 0x81, 0xc1, 0x24, 0x08, 0xec, 0x2e, 0x17, 0x65, 0x41,
+    0x0d, 0x18, 0x31, 0x94, 0x18, 0x0a, 0xa7, 0x1c, 0x1b, 0x31, 0x1a, 0xc9,
+    0xc1, 0x86, 0x2c, 0x35, 0xcd, 0xc0, 0x29, 0x2a, 0xac, 0x4c, 0x44, 0x10,
+    0x32, 0x0d, 0xd0, 0x54, 0xee, 0x97, 0x75, 0xbf, 0x3f, 0xbe, 0x8f, 0x06,
+    0xdd, 0xe5, 0x6b, 0x0f, 0x97, 0xe5, 0x9c, 0xdd, 0xe7, 0x37, 0xe3, 0x1f,
+    0xee, 0x39, 0xef, 0x72, 0xf6, 0x7d, 0x9f, 0x3d, 0xfb, 0x9e, 0xcb, 0xfb,
+    0x1e, 0x80, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x24,
+    0x40, 0x06, 0xc0, 0xc0, 0x6a, 0x20, 0x1b, 0xd3, 0x05, 0x60, 0x1b, 0xc3,
+    0x4f, 0xb6, 0xaa, 0x93, 0xe1, 0x27, 0x9b, 0x65, 0xd7, 0xf7, 0x3f, 0x27,
+    0x4e, 0x9c, 0x80, 0xbb, 0xbb, 0x3b, 0x6b, 0x85, 0xac, 0x52, 0x7d, 0x7d,
+    0x3d, 0x16, 0x2c, 0x58, 0x60, 0x3a, 0xfc, 0xee, 0xee, 0xee, 0x78, 0xe4,
+    0x91, 0x47, 0x58, 0x4b, 0x64, 0x13, 0xe4, 0xac, 0x02, 0x62, 0xf8, 0x89,
+    0x18, 0x7e, 0x22, 0x86, 0x9f, 0x88, 0xe1, 0x27, 0x12, 0xa3, 0xb6, 0xb6,
+    0x36, 0x9c, 0x3d, 0x7b, 0x76, 0xc0, 0xe5, 0xed, 0x06, 0x52, 0xe8, 0xfa,
+    0xf5, 0xeb, 0x38, 0x7f, 0xfe, 0xfc, 0xa0, 0x36, 0x7c, 0xe6, 0xcc, 0x99,
+    0x70, 0x75, 0x75, 0x15, 0x6d, 0xc5, 0xd6, 0xd6, 0xd6, 0xe2, 0xd0, 0xa1,
+    0x43, 0x66, 0xaf, 0xaf, 0x54, 0x2a, 0xa1, 0x52, 0xa9, 0x24, 0x17, 0x20,
+    0x2f, 0x2f, 0x2f, 0x78, 0x78, 0x78, 0xdc, 0xf3, 0x5a, 0x77, 0x77, 0x37,
+    0x0c, 0x06, 0x03, 0x46, 0x8d, 0x1a, 0x25, 0xda, 0xed, 0x6e, 0x6d, 0x6d,
+    0x85, 0x46, 0xa3, 0x81, 0x8f, 0x8f, 0x0f, 0x9e, 0x7e, 0xfa, 0xe9, 0x01,
+    0xbf, 0x8f, 0xa1, 0xf7, 0x5f, 0x75, 0x75, 0xb5, 0xc1, 0x1c, 0x1f, 0x7d,
+    0xf4, 0x91, 0xa1, 0x6f, 0xb9, 0x81, 0xfc, 0x5b, 0xb1, 0x62, 0x85, 0x41,
+    0xcc, 0x32, 0x32, 0x32, 0x06, 0xfd, 0x19, 0xa5, 0xf0, 0x2f, 0x2d, 0x2d,
+    0xcd, 0xe8, 0xb3, 0xdf, 0xba, 0x75, 0xcb, 0xa0, 0x56, 0xab, 0x0d, 0x5d,
+    0x5d, 0x5d, 0xa2, 0x6c, 0x9b, 0xd6, 0xd6, 0x56, 0x43, 0x54, 0x54, 0x94,
+    0x61, 0xf9, 0xf2, 0xe5, 0x86, 0x82, 0x82, 0x02, 0xb3, 0xcb, 0x55, 0x57,
+    0x57, 0xdf, 0xf3, 0xd9, 0x47, 0xac, 0xdb, 0x53, 0x54, 0x54, 0x34, 0xa8,
+    0x9f, 0x2c, 0x1a, 0x5e, 0x15, 0x15, 0x15, 0xd8, 0xb9, 0x73, 0x27, 0xee,
+    0xde, 0xbd, 0x2b, 0xba, 0xae, 0x8e, 0x5a, 0xad, 0xc6, 0xc5, 0x8b, 0x17,
+    0xa5, 0xdd, 0xe7, 0x8f, 0x89, 0x89, 0x61, 0xca, 0x44, 0xec, 0xec, 0xd9,
+    0xb3, 0xd8, 0xbd, 0x7b, 0x37, 0x0c, 0x06, 0x83, 0xd5, 0x05, 0x7f, 0xc4,
+    0xc3, 0x7f, 0xea, 0xd4, 0x29, 0x94, 0x96, 0x96, 0x32, 0x65, 0x22, 0x76,
+    0xfc, 0xf8, 0x71, 0xe4, 0xe5, 0xe5, 0x59, 0x5d, 0xf0, 0x45, 0x71, 0xb6,
+    0x27, 0x36, 0x36, 0x56, 0x34, 0x7b, 0x16, 0x32, 0xad, 0xb8, 0xb8, 0x18,
+    0x85, 0x85, 0x85, 0x56, 0x15, 0x7c, 0x51, 0x84, 0xff, 0xfb, 0xef, 0xbf,
+    0xc7, 0xe1, 0xc3, 0x87, 0x99, 0x30, 0x91, 0xdb, 0xbf, 0x7f, 0x3f, 0x4a,
+    0x4a, 0x4a, 0x46, 0xe4, 0xac, 0x4e, 0x42, 0x42, 0x42, 0xbf, 0xc1, 0x1f,
+    0xcc, 0x19, 0x29, 0x51, 0x9c, 0xe7, 0x8f, 0x8b, 0x8b, 0x43, 0x4f, 0x4f,
+    0x0f, 0x13, 0x26, 0x72, 0x7b, 0xf7, 0xee, 0xc5, 0x97, 0x5f, 0x7e, 0x69,
+    0xd1, 0x3d, 0xbe, 0x46, 0xa3, 0x41, 0x55, 0x55, 0x95, 0xc9, 0xe5, 0xbe,
+    0xbe, 0xbe, 0x58, 0xb9, 0x72, 0xa5, 0xb4, 0xc3, 0x7f, 0xf1, 0xe2, 0x45,
+    0xec, 0xdf, 0xbf, 0x9f, 0xe9, 0x12, 0x09, 0x47, 0x47, 0x47, 0xcc, 0x99,
+    0x33, 0xc7, 0xe8, 0x75, 0x83, 0xc1, 0x80, 0x3d, 0x7b, 0xf6, 0xa0, 0xbc,
+    0xbc, 0x7c, 0xd8, 0xb7, 0xa1, 0xa5, 0xa5, 0x05, 0xf1, 0xf1, 0xf1, 0xfd,
+    0xee, 0xf1, 0xfd, 0xfc, 0xfc, 0x10, 0x1f, 0x1f, 0x2f, 0xfd, 0x3d, 0x3f,
+    0x00, 0xa8, 0xd5, 0x6a, 0xb4, 0xb7, 0xb7, 0x33, 0x79, 0x22, 0x20, 0x93,
+    0xc9, 0x10, 0x1d, 0x1d, 0x8d, 0x80, 0x80, 0x00, 0xa3, 0x65, 0x7a, 0xbd,
+    0x1e, 0x3a, 0x9d, 0x0e, 0x15, 0x15, 0x15, 0xc3, 0xda, 0xd5, 0xd1, 0x6a,
+    0xb5, 0xb8, 0x74, 0xe9, 0x52, 0xbf, 0x7b, 0xfc, 0xb8, 0xb8, 0xb8, 0x41,
+    0x5f, 0x84, 0x13, 0x4d, 0xf8, 0xaf, 0x5e, 0xbd, 0x8a, 0xbd, 0x7b, 0xf7,
+    0x32, 0x79, 0x22, 0x61, 0x67, 0x67, 0x87, 0x98, 0x98, 0x18, 0xcc, 0x98,
+    0x31, 0xc3, 0x68, 0x59, 0x4f, 0x4f, 0x0f, 0x52, 0x53, 0x53, 0x71, 0xe1,
+    0xc2, 0x85, 0x61, 0x09, 0xbe, 0x46, 0xa3, 0xe9, 0x77, 0x8f, 0xef, 0xeb,
+    0xeb, 0x3b, 0xe8, 0x3d, 0xfe, 0x3f, 0x9f, 0x51, 0x4c, 0x15, 0xbe, 0x7d,
+    0xfb, 0x76, 0xac, 0x5f, 0xbf, 0x1e, 0x8e, 0x8e, 0x8e, 0x92, 0x0c, 0xcc,
+    0xe9, 0xd3, 0xa7, 0x31, 0x69, 0xd2, 0x24, 0x49, 0x6d, 0xf3, 0x94, 0x29,
+    0x53, 0xfa, 0x5d, 0x36, 0x6a, 0xd4, 0x28, 0x24, 0x24, 0x24, 0x20, 0x3e,
+    0x3e, 0xde, 0x68, 0x2f, 0xdc, 0xd1, 0xd1, 0x81, 0xc4, 0xc4, 0x44, 0x6c,
+    0xdb, 0xb6, 0x6d, 0xc8, 0x06, 0x40, 0xfd, 0x5b, 0xf0, 0xfd, 0xfc, 0xfc,
+    0x86, 0x64, 0x8f, 0x2f, 0xca, 0xf0, 0x37, 0x35, 0x35, 0xe1, 0xdd, 0x77,
+    0xdf, 0x85, 0x56, 0xab, 0x95, 0x64, 0xf8, 0xbd, 0xbc, 0xbc, 0x30, 0x79,
+    0xf2, 0x64, 0xab, 0xfa, 0x05, 0x70, 0x70, 0x70, 0x80, 0x56, 0xab, 0x45,
+    0x6c, 0x6c, 0x2c, 0xea, 0xeb, 0xeb, 0x4d, 0x86, 0x55, 0xa7, 0xd3, 0x61,
+    0xea, 0xd4, 0xa9, 0x83, 0x0e, 0xbe, 0x5a, 0xad, 0xee, 0xf7, 0xe0, 0x76,
+    0xa8, 0x83, 0x2f, 0xaa, 0x6e, 0x4f, 0xaf, 0x5d, 0xbb, 0x76, 0xa1, 0xa1,
+    0xa1, 0x81, 0xfd, 0x0e, 0x91, 0x1d, 0x00, 0x27, 0x25, 0x25, 0x99, 0xfc,
+    0x95, 0xb8, 0x7d, 0xfb, 0x36, 0xd4, 0x6a, 0x35, 0x9a, 0x9a, 0x9a, 0x24,
+    0x15, 0x7c, 0x51, 0x86, 0xbf, 0xa5, 0xa5, 0x05, 0x3a, 0x9d, 0x8e, 0x89,
+    0x13, 0x19, 0x67, 0x67, 0x67, 0x24, 0x27, 0x27, 0xc3, 0xc9, 0xc9, 0xc9,
+    0x68, 0x59, 0x63, 0x63, 0x23, 0xb4, 0x5a, 0x2d, 0x9a, 0x9b, 0x9b, 0x25,
+    0x13, 0x7c, 0x8b, 0x85, 0x5f, 0xe8, 0x86, 0xe7, 0xe4, 0xe4, 0xa0, 0xae,
+    0xae, 0x8e, 0x89, 0x13, 0x19, 0x57, 0x57, 0x57, 0x24, 0x25, 0x25, 0x61,
+    0xfc, 0xf8, 0xf1, 0x46, 0xcb, 0xea, 0xea, 0xea, 0xa0, 0xd5, 0x6a, 0x05,
+    0x9d, 0xb1, 0x1b, 0xc9, 0xe0, 0x5b, 0x2c, 0xfc, 0xc1, 0xc1, 0xc1, 0x78,
+    0xe8, 0xa1, 0x87, 0xcc, 0x5e, 0xbf, 0xf7, 0x60, 0x8a, 0xc4, 0xc7, 0xd3,
+    0xd3, 0x13, 0x1a, 0x8d, 0x06, 0x63, 0xc7, 0x8e, 0x35, 0x5a, 0x56, 0x55,
+    0x55, 0x85, 0x94, 0x94, 0x14, 0x74, 0x75, 0x75, 0x89, 0x3e, 0xf8, 0x16,
+    0x0b, 0xff, 0xd8, 0xb1, 0x63, 0xb1, 0x75, 0xeb, 0x56, 0x41, 0x65, 0x0a,
+    0x0a, 0x0a, 0xf0, 0xeb, 0xaf, 0xbf, 0x32, 0x6d, 0x22, 0xa4, 0x52, 0xa9,
+    0xfa, 0x0d, 0x66, 0x65, 0x65, 0x25, 0xd2, 0xd3, 0xd3, 0xa1, 0xd7, 0xeb,
+    0x45, 0x1d, 0x7c, 0x8b, 0xf6, 0xf9, 0x5f, 0x7f, 0xfd, 0x75, 0x3c, 0xfa,
+    0xe8, 0xa3, 0x66, 0xaf, 0xaf, 0xd7, 0xeb, 0xa1, 0x56, 0xab, 0x99, 0x34,
+    0x91, 0xf2, 0xf1, 0xf1, 0xc1, 0x3b, 0xef, 0xbc, 0x03, 0x85, 0x42, 0x61,
+    0xb4, 0xac, 0xbc, 0xbc, 0x1c, 0x99, 0x99, 0x99, 0x26, 0x6f, 0x58, 0x14,
+    0x4b, 0xf0, 0x2d, 0x1a, 0x7e, 0x7b, 0x7b, 0x7b, 0xc1, 0x5d, 0x99, 0x4f,
+    0x3f, 0xfd, 0x14, 0x65, 0x65, 0x65, 0x4c, 0x9a, 0x48, 0x3d, 0xf1, 0xc4,
+    0x13, 0x88, 0x88, 0x88, 0x80, 0x4c, 0x26, 0x33, 0x5a, 0x76, 0xf2, 0xe4,
+    0x49, 0xa3, 0x8b, 0x96, 0x62, 0x0a, 0xbe, 0x45, 0xc3, 0x0f, 0x00, 0xab,
+    0x57, 0xaf, 0x86, 0xaf, 0xaf, 0xaf, 0xd9, 0xeb, 0x1b, 0x0c, 0x06, 0x24,
+    0x24, 0x24, 0x30, 0x65, 0x22, 0xb6, 0x60, 0xc1, 0x02, 0x6c, 0xd8, 0xb0,
+    0xc1, 0xe4, 0xb2, 0x92, 0x92, 0x92, 0x7f, 0xee, 0xd9, 0x12, 0x5b, 0xf0,
+    0x01, 0x0b, 0x5f, 0xe4, 0x92, 0xcb, 0xe5, 0x48, 0x4e, 0x4e, 0xc6, 0xf2,
+    0xe5, 0xcb, 0xcd, 0x2e, 0x53, 0x5a, 0x5a, 0x8a, 0xe3, 0xc7, 0x8f, 0x63,
+    0xd1, 0xa2, 0x45, 0x4c, 0x9a, 0x48, 0x05, 0x05, 0x05, 0xa1, 0xb5, 0xb5,
+    0xd5, 0xe4, 0xcd, 0x89, 0x85, 0x85, 0x85, 0x50, 0x28, 0x14, 0x38, 0x77,
+    0xee, 0x1c, 0x2e, 0x5f, 0xbe, 0x6c, 0xb2, 0xbc, 0xbf, 0xbf, 0x3f, 0xb6,
+    0x6e, 0xdd, 0x6a, 0xf1, 0x01, 0xf3, 0x16, 0x3f, 0xcf, 0xbf, 0x6c, 0xd9,
+    0x32, 0xcc, 0x9f, 0x3f, 0x5f, 0x50, 0x19, 0x0e, 0x78, 0x11, 0xbf, 0x90,
+    0x90, 0x10, 0xac, 0x5a, 0xb5, 0xca, 0xe4, 0xb2, 0x4f, 0x3e, 0xf9, 0xa4,
+    0xdf, 0xe0, 0xfb, 0xf9, 0xf9, 0x8d, 0x48, 0xf0, 0x47, 0x24, 0xfc, 0x00,
+    0x90, 0x92, 0x92, 0x22, 0x68, 0xfd, 0x73, 0xe7, 0xce, 0xe1, 0xb3, 0xcf,
+    0x3e, 0x63, 0xc2, 0x44, 0x6e, 0xed, 0xda, 0xb5, 0x08, 0x0a, 0x0a, 0x32,
+    0x7b, 0xfd, 0x91, 0xe8, 0xea, 0x8c, 0x78, 0xf8, 0x03, 0x03, 0x03, 0x05,
+    0x55, 0x52, 0xef, 0xde, 0x9f, 0x03, 0x5e, 0xc4, 0x4d, 0x26, 0x93, 0x61,
+    0xc3, 0x86, 0x0d, 0x78, 0xee, 0xb9, 0xe7, 0x44, 0x1f, 0xfc, 0x11, 0x0b,
+    0x3f, 0x00, 0xe8, 0x74, 0x3a, 0xc8, 0xe5, 0xe6, 0xff, 0xf9, 0xdf, 0x7f,
+    0xff, 0x1d, 0x1f, 0x7f, 0xfc, 0x31, 0x13, 0x26, 0x81, 0x2f, 0x40, 0x78,
+    0x78, 0xb8, 0xc9, 0xc1, 0x30, 0x62, 0x0a, 0xfe, 0x88, 0x86, 0xdf, 0xc7,
+    0xc7, 0x07, 0x2f, 0xbe, 0xf8, 0xa2, 0xa0, 0x32, 0x1a, 0x8d, 0x06, 0x9d,
+    0x9d, 0x9d, 0x4c, 0x98, 0xc8, 0xc9, 0xe5, 0x72, 0x44, 0x47, 0x47, 0xc3,
+    0xdf, 0xdf, 0x5f, 0xb4, 0xc1, 0x07, 0x46, 0xf8, 0x96, 0xe6, 0xa4, 0xa4,
+    0x24, 0x1c, 0x3e, 0x7c, 0x18, 0xdd, 0xdd, 0xdd, 0x66, 0xad, 0x7f, 0xe5,
+    0xca, 0x15, 0xec, 0xdb, 0xb7, 0x0f, 0x6f, 0xbd, 0xf5, 0x16, 0x13, 0x36,
+    0x8c, 0xda, 0xda, 0xda, 0x90, 0x9a, 0x9a, 0x3a, 0xe8, 0xf7, 0xe9, 0xe8,
+    0xe8, 0x30, 0x7a, 0xad, 0xb3, 0xb3, 0x13, 0xc9, 0xc9, 0xc9, 0x43, 0xb6,
+    0xad, 0xf3, 0xe6, 0xcd, 0xc3, 0xe2, 0xc5, 0x8b, 0xa5, 0x17, 0x7e, 0x2f,
+    0x2f, 0x2f, 0xbc, 0xf6, 0xda, 0x6b, 0xd8, 0xb7, 0x6f, 0x9f, 0xa0, 0x83,
+    0xe5, 0x57, 0x5f, 0x7d, 0xd5, 0xe4, 0xcd, 0x55, 0x34, 0x34, 0xba, 0xbb,
+    0xbb, 0xf1, 0xd3, 0x4f, 0x3f, 0x0d, 0xcb, 0x7b, 0x0f, 0xf5, 0x2d, 0x2b,
+    0x5e, 0x5e, 0x5e, 0xd2, 0xeb, 0xf6, 0xf4, 0xed, 0xca, 0x38, 0x38, 0x38,
+    0x98, 0xbd, 0x7e, 0x63, 0x63, 0x23, 0x32, 0x33, 0x33, 0x99, 0x50, 0x92,
+    0x6e, 0x9f, 0xbf, 0x97, 0x9b, 0x9b, 0x1b, 0xc2, 0xc3, 0xc3, 0x05, 0x95,
+    0xd9, 0xb1, 0x63, 0x07, 0x07, 0xbc, 0x90, 0xf4, 0xc3, 0x0f, 0xfc, 0xf7,
+    0x34, 0xa6, 0xa9, 0x41, 0x12, 0xfd, 0x69, 0x6e, 0x6e, 0xc6, 0x8e, 0x1d,
+    0x3b, 0xd8, 0x7a, 0x24, 0xfd, 0xf0, 0x4f, 0x9c, 0x38, 0x11, 0x51, 0x51,
+    0x51, 0x82, 0xca, 0x64, 0x67, 0x67, 0x1b, 0x8d, 0x29, 0x25, 0x92, 0xcc,
+    0x01, 0x6f, 0x5f, 0x91, 0x91, 0x91, 0xc8, 0xce, 0xce, 0xc6, 0xf5, 0xeb,
+    0xd7, 0xcd, 0x3e, 0x93, 0x90, 0x9c, 0x9c, 0x8c, 0xdc, 0xdc, 0x5c, 0xb6,
+    0xe2, 0x10, 0x9b, 0x30, 0x61, 0x02, 0x8e, 0x1c, 0x39, 0xc2, 0x3d, 0xbf,
+    0xa5, 0x8c, 0x1b, 0x37, 0x0e, 0x71, 0x71, 0x71, 0x82, 0xca, 0xe4, 0xe7,
+    0xe7, 0xe3, 0xb7, 0xdf, 0x7e, 0x63, 0x5a, 0x49, 0xda, 0xe1, 0x07, 0x80,
+    0xd0, 0xd0, 0x50, 0x41, 0x73, 0xc0, 0xe8, 0xf5, 0x7a, 0xc9, 0x4e, 0x73,
+    0x42, 0x0c, 0xff, 0x3d, 0xec, 0xed, 0xed, 0xa1, 0xd1, 0x68, 0x04, 0x95,
+    0x39, 0x74, 0xe8, 0x10, 0x7e, 0xf8, 0xe1, 0x07, 0xb6, 0x24, 0x49, 0x3b,
+    0xfc, 0x00, 0xf0, 0xca, 0x2b, 0xaf, 0x60, 0xd6, 0xac, 0x59, 0x66, 0xaf,
+    0x6f, 0x30, 0x18, 0x04, 0x77, 0x97, 0x88, 0x44, 0x75, 0xc0, 0xfb, 0xcf,
+    0xb7, 0x51, 0x2e, 0x47, 0x62, 0x62, 0x22, 0x5e, 0x78, 0xe1, 0x05, 0xb3,
+    0xcb, 0x1c, 0x3b, 0x76, 0x0c, 0x5f, 0x7f, 0xfd, 0x35, 0x16, 0x2e, 0x5c,
+    0x38, 0xa2, 0xdb, 0xbe, 0x72, 0xe5, 0x4a, 0xd8, 0xdb, 0xdb, 0x4b, 0xa2,
+    0xe1, 0x57, 0xad, 0x5a, 0x25, 0xf8, 0xfa, 0x0a, 0xc3, 0x6f, 0x01, 0xc1,
+    0xc1, 0xc1, 0x98, 0x33, 0x67, 0x0e, 0xbe, 0xfd, 0xf6, 0x5b, 0xb3, 0xcb,
+    0xc4, 0xc4, 0xc4, 0xe0, 0xbb, 0xef, 0xbe, 0x33, 0x39, 0x9e, 0xd4, 0x52,
+    0xce, 0x9c, 0x39, 0x23, 0x99, 0x86, 0xf7, 0xf1, 0xf1, 0x61, 0xb7, 0x47,
+    0xac, 0x1b, 0x26, 0x74, 0xd6, 0xb6, 0xf2, 0xf2, 0x72, 0x14, 0x17, 0x17,
+    0xf3, 0xb7, 0x9c, 0xa4, 0x1f, 0xfe, 0xb9, 0x73, 0xe7, 0x62, 0xe9, 0xd2,
+    0xa5, 0x82, 0xca, 0xc4, 0xc5, 0xc5, 0x89, 0xee, 0xd1, 0x99, 0xc4, 0xf0,
+    0x0f, 0x48, 0x5a, 0x5a, 0x9a, 0xa0, 0x01, 0x2f, 0xe7, 0xcf, 0x9f, 0xe7,
+    0x80, 0x17, 0xb2, 0x8e, 0xf0, 0xcf, 0x9a, 0x35, 0xab, 0xdf, 0x41, 0xd1,
+    0xfd, 0x51, 0xab, 0xd5, 0x1c, 0xf0, 0x42, 0xd2, 0x3d, 0xe0, 0xed, 0x2b,
+    0x25, 0x25, 0x05, 0x45, 0x45, 0x45, 0x66, 0x8f, 0xdf, 0xad, 0xad, 0xad,
+    0x45, 0x5e, 0x5e, 0x1e, 0xde, 0x7c, 0xf3, 0x4d, 0xb6, 0xee, 0x00, 0x75,
+    0x76, 0x76, 0xe2, 0xf3, 0xcf, 0x3f, 0x97, 0xc4, 0xb6, 0x7a, 0x7b, 0x7b,
+    0x63, 0xe6, 0xcc, 0x99, 0xd6, 0x19, 0x7e, 0x95, 0x4a, 0x85, 0x75, 0xeb,
+    0xd6, 0x09, 0x7a, 0x10, 0x72, 0x52, 0x52, 0x12, 0xd6, 0xae, 0x5d, 0xcb,
+    0x01, 0x2f, 0x03, 0xd4, 0xd1, 0xd1, 0x81, 0x82, 0x82, 0x02, 0x49, 0x6c,
+    0x6b, 0x48, 0x48, 0xc8, 0x80, 0xc3, 0x2f, 0x97, 0xc2, 0x07, 0x4c, 0x4c,
+    0x4c, 0x34, 0x39, 0x2b, 0x70, 0x7f, 0x1a, 0x1a, 0x1a, 0xb0, 0x7b, 0xf7,
+    0x6e, 0xa6, 0x98, 0xa4, 0x1f, 0xfe, 0x07, 0x1f, 0x7c, 0x10, 0x1b, 0x37,
+    0x6e, 0x14, 0x54, 0x26, 0x3d, 0x3d, 0x1d, 0x37, 0x6f, 0xde, 0x64, 0x0b,
+    0x93, 0x74, 0xbb, 0x3d, 0xbd, 0x62, 0x63, 0x63, 0xf1, 0xfe, 0xfb, 0xef,
+    0xe3, 0xce, 0x9d, 0x3b, 0x66, 0xad, 0x7f, 0xfb, 0xf6, 0x6d, 0xa4, 0xa7,
+    0xa7, 0x5b, 0xf4, 0x29, 0x2f, 0xcf, 0x3f, 0xff, 0x3c, 0x46, 0x8f, 0x1e,
+    0x2d, 0x89, 0xfa, 0x14, 0x32, 0x67, 0x2a, 0xc3, 0x3f, 0xc2, 0x9c, 0x9d,
+    0x9d, 0x11, 0x15, 0x15, 0x25, 0xe8, 0xc6, 0xb7, 0xac, 0xac, 0x2c, 0x84,
+    0x87, 0x87, 0x0b, 0x7a, 0x30, 0xc6, 0x60, 0xe4, 0xe7, 0xe7, 0x5b, 0xdd,
+    0x03, 0xe9, 0x18, 0x7e, 0x91, 0x78, 0xfb, 0xed, 0xb7, 0xf1, 0xde, 0x7b,
+    0xef, 0xe1, 0xaf, 0xbf, 0xfe, 0x32, 0xfb, 0xc0, 0x6d, 0xdb, 0xb6, 0x6d,
+    0xc8, 0xc9, 0xc9, 0x61, 0x4b, 0x0b, 0xe0, 0xe0, 0xe0, 0x80, 0x2d, 0x5b,
+    0xb6, 0x48, 0x62, 0x5b, 0x07, 0xb3, 0x63, 0x93, 0x54, 0xf8, 0x95, 0x4a,
+    0x25, 0x62, 0x63, 0x63, 0x11, 0x19, 0x19, 0x69, 0x76, 0x99, 0xbc, 0xbc,
+    0x3c, 0x44, 0x46, 0x46, 0xc2, 0xdb, 0xdb, 0x9b, 0xa9, 0x36, 0x93, 0xbd,
+    0xbd, 0x3d, 0x9e, 0x79, 0xe6, 0x19, 0x1e, 0xf0, 0x8a, 0x4d, 0x58, 0x58,
+    0x98, 0xa0, 0x01, 0x2f, 0x3d, 0x3d, 0x3d, 0x7c, 0xbe, 0x17, 0x59, 0x47,
+    0xf8, 0x7b, 0x9f, 0x0a, 0x2e, 0xc4, 0xc1, 0x83, 0x07, 0x51, 0x51, 0x51,
+    0xc1, 0xd6, 0x26, 0x69, 0x87, 0x1f, 0x00, 0xd6, 0xac, 0x59, 0x83, 0xc7,
+    0x1f, 0x7f, 0xdc, 0xec, 0xf5, 0xf9, 0x84, 0x17, 0xb2, 0x9a, 0xf0, 0x2b,
+    0x14, 0x0a, 0xc1, 0xf3, 0x3d, 0x1e, 0x3d, 0x7a, 0x14, 0x27, 0x4e, 0x9c,
+    0x60, 0x8b, 0x93, 0xb4, 0xc3, 0x0f, 0xfc, 0x77, 0xd4, 0xd4, 0x53, 0x4f,
+    0x3d, 0x25, 0xa8, 0x4c, 0x7c, 0x7c, 0x3c, 0x5b, 0x9c, 0xa4, 0x1f, 0x7e,
+    0x40, 0xf8, 0x80, 0x97, 0x33, 0x67, 0xce, 0xe0, 0xe8, 0xd1, 0xa3, 0x6c,
+    0x75, 0x92, 0x7e, 0xf8, 0xe7, 0xcf, 0x9f, 0x6f, 0xd6, 0x53, 0x40, 0xfa,
+    0x8a, 0x8d, 0x8d, 0xe5, 0x80, 0x17, 0x92, 0x7e, 0xf8, 0x01, 0x20, 0x35,
+    0x35, 0x55, 0xd0, 0xb8, 0xdd, 0xca, 0xca, 0x4a, 0x1c, 0x3c, 0x78, 0x90,
+    0x2d, 0x4f, 0xd2, 0x0f, 0x7f, 0x40, 0x40, 0x00, 0x56, 0xac, 0x58, 0x21,
+    0xb8, 0xef, 0xdf, 0xd5, 0xd5, 0xc5, 0xd6, 0xb7, 0x71, 0x76, 0xd6, 0xf0,
+    0x21, 0xb6, 0x6f, 0xdf, 0x8e, 0x23, 0x47, 0x8e, 0x98, 0x3d, 0xe0, 0xa5,
+    0xa6, 0xa6, 0x06, 0xf9, 0xf9, 0xf9, 0xfd, 0x3e, 0x3c, 0xd9, 0xd6, 0xb5,
+    0xb4, 0xb4, 0x40, 0xad, 0x56, 0x5b, 0xec, 0xef, 0x8d, 0x1e, 0x3d, 0x1a,
+    0xe3, 0xc6, 0x8d, 0x83, 0x52, 0xa9, 0x84, 0xa3, 0xa3, 0x23, 0x1e, 0x7e,
+    0xf8, 0x61, 0xa8, 0x54, 0xaa, 0x61, 0xbf, 0x27, 0xcb, 0x2a, 0xc2, 0xef,
+    0xed, 0xed, 0x8d, 0x35, 0x6b, 0xd6, 0xe0, 0x83, 0x0f, 0x3e, 0x30, 0xbb,
+    0x4c, 0xef, 0x80, 0x17, 0x21, 0x0f, 0xc6, 0xb0, 0x15, 0x7a, 0xbd, 0x1e,
+    0x97, 0x2e, 0x5d, 0x1a, 0xf1, 0xed, 0x98, 0x3c, 0x79, 0x32, 0xe6, 0xcd,
+    0x9b, 0x87, 0x25, 0x4b, 0x96, 0xc0, 0xd5, 0xd5, 0x95, 0xdd, 0x9e, 0xfe,
+    0x68, 0xb5, 0x5a, 0x41, 0xb7, 0x13, 0x5f, 0xbb, 0x76, 0x8d, 0x03, 0x5e,
+    0x44, 0xae, 0xa1, 0xa1, 0x01, 0x85, 0x85, 0x85, 0x08, 0x0b, 0x0b, 0xc3,
+    0x9e, 0x3d, 0x7b, 0xd0, 0xd2, 0xd2, 0xc2, 0xf0, 0x9b, 0xe2, 0xe1, 0xe1,
+    0x81, 0xb0, 0xb0, 0x30, 0x41, 0x65, 0x74, 0x3a, 0x1d, 0x07, 0xbc, 0x48,
+    0xe4, 0x97, 0xe8, 0x8b, 0x2f, 0xbe, 0x40, 0x78, 0x78, 0x38, 0x2e, 0x5c,
+    0xb8, 0xc0, 0xf0, 0x9b, 0x12, 0x17, 0x17, 0x07, 0x47, 0x47, 0x47, 0xb3,
+    0xd7, 0xbf, 0x75, 0xeb, 0x16, 0x76, 0xed, 0xda, 0xc5, 0x74, 0x49, 0xc4,
+    0xcd, 0x9b, 0x37, 0x11, 0x1f, 0x1f, 0x3f, 0x64, 0x13, 0x13, 0x5b, 0x55,
+    0xf8, 0x1f, 0x78, 0xe0, 0x01, 0x6c, 0xde, 0xbc, 0x59, 0x50, 0x99, 0x8c,
+    0x8c, 0x0c, 0x5c, 0xbd, 0x7a, 0x95, 0xc9, 0x92, 0x88, 0xae, 0xae, 0x2e,
+    0xe8, 0x74, 0x3a, 0xd4, 0xd4, 0xd4, 0xf0, 0x80, 0xf7, 0x7e, 0xd1, 0xd1,
+    0xd1, 0xc8, 0xc9, 0xc9, 0x31, 0xfb, 0x81, 0x75, 0xed, 0xed, 0xed, 0x48,
+    0x4d, 0x4d, 0x45, 0x76, 0x76, 0x36, 0x93, 0xf5, 0x3f, 0x96, 0x7c, 0x32,
+    0xcb, 0xdd, 0xbb, 0x77, 0xd1, 0xd6, 0xd6, 0x86, 0xf6, 0xf6, 0x76, 0xdc,
+    0xb8, 0x71, 0x03, 0x57, 0xae, 0x5c, 0x41, 0x6d, 0x6d, 0x2d, 0xca, 0xcb,
+    0xcb, 0xd1, 0xd8, 0xd8, 0x68, 0xb2, 0x4c, 0x47, 0x47, 0x07, 0x76, 0xee,
+    0xdc, 0x89, 0xac, 0xac, 0x2c, 0xd8, 0xd9, 0x0d, 0x3c, 0xc2, 0x72, 0x6b,
+    0x6b, 0x38, 0xa5, 0x52, 0x29, 0x78, 0x14, 0x52, 0x6e, 0x6e, 0x2e, 0xaa,
+    0xab, 0xab, 0x99, 0xfa, 0x11, 0x20, 0x97, 0xcb, 0xa1, 0x54, 0x2a, 0xe1,
+    0xe2, 0xe2, 0x82, 0xc7, 0x1e, 0x7b, 0x0c, 0x4b, 0x97, 0x2e, 0x45, 0x68,
+    0x68, 0x28, 0xf2, 0xf2, 0xf2, 0x90, 0x96, 0x96, 0xd6, 0xef, 0x74, 0xf5,
+    0xf5, 0xf5, 0xf5, 0x28, 0x29, 0x29, 0x61, 0xb7, 0xe7, 0x7e, 0x1b, 0x37,
+    0x6e, 0x84, 0x87, 0x87, 0x87, 0xd9, 0xeb, 0x77, 0x77, 0x77, 0xf3, 0x09,
+    0x2f, 0x22, 0x23, 0x93, 0xc9, 0x30, 0x7d, 0xfa, 0x74, 0x24, 0x27, 0x27,
+    0x63, 0xd3, 0xa6, 0x4d, 0x26, 0xa7, 0xad, 0x2c, 0x2a, 0x2a, 0x82, 0x5e,
+    0xaf, 0x67, 0xf8, 0xfb, 0x1a, 0x33, 0x66, 0x8c, 0xe0, 0x8b, 0x34, 0x07,
+    0x0e, 0x1c, 0xc0, 0x8f, 0x3f, 0xfe, 0xc8, 0xd4, 0x89, 0xd0, 0xe2, 0xc5,
+    0x8b, 0x4d, 0xce, 0xc0, 0xd7, 0xd4, 0xd4, 0x34, 0xa8, 0x83, 0x5f, 0xb9,
+    0xb5, 0x56, 0xd8, 0xba, 0x75, 0xeb, 0x30, 0x7d, 0xfa, 0x74, 0x41, 0x7d,
+    0x4f, 0x4b, 0x5e, 0xd5, 0x24, 0xe1, 0x5f, 0x80, 0x80, 0x80, 0x00, 0xa3,
+    0xd7, 0xcb, 0xca, 0xca, 0x18, 0xfe, 0xfb, 0x29, 0x14, 0x0a, 0xc1, 0x63,
+    0x77, 0x8b, 0x8b, 0x8b, 0x05, 0x3d, 0x10, 0x83, 0x2c, 0xeb, 0xe5, 0x97,
+    0x5f, 0x36, 0x7a, 0xed, 0x97, 0x5f, 0x7e, 0x61, 0xf8, 0x4d, 0x09, 0x09,
+    0x09, 0xc1, 0x93, 0x4f, 0x3e, 0x29, 0xa8, 0x4c, 0x4c, 0x4c, 0x0c, 0x53,
+    0x26, 0x52, 0xd3, 0xa6, 0x4d, 0x83, 0x8b, 0x8b, 0xcb, 0x3d, 0xaf, 0xfd,
+    0xf9, 0xe7, 0x9f, 0xe8, 0xe8, 0xe8, 0x60, 0xf8, 0x4d, 0x1d, 0x34, 0x25,
+    0x25, 0x25, 0x09, 0x2a, 0xf3, 0xcd, 0x37, 0xdf, 0xe0, 0xd8, 0xb1, 0x63,
+    0x4c, 0x9a, 0x48, 0xdd, 0xff, 0x38, 0x25, 0x83, 0xc1, 0x80, 0xbf, 0xff,
+    0xfe, 0x9b, 0xe1, 0x37, 0x65, 0xc9, 0x92, 0x25, 0x78, 0xf6, 0xd9, 0x67,
+    0x05, 0x95, 0xd9, 0xb2, 0x65, 0x0b, 0x0c, 0x06, 0x03, 0x93, 0x26, 0x42,
+    0x53, 0xa7, 0x4e, 0x35, 0x7a, 0xad, 0xb9, 0xb9, 0x99, 0xe1, 0xef, 0x8f,
+    0x4e, 0xa7, 0x13, 0x34, 0xe0, 0xe5, 0xe7, 0x9f, 0x7f, 0xc6, 0xa9, 0x53,
+    0xa7, 0x98, 0x34, 0x11, 0x32, 0x35, 0xed, 0xfc, 0x40, 0x6f, 0x78, 0xb3,
+    0x89, 0xf0, 0xcf, 0x9e, 0x3d, 0x1b, 0xc1, 0xc1, 0xc1, 0x82, 0xca, 0x48,
+    0xe5, 0xe1, 0x0c, 0xb6, 0xc6, 0xd4, 0x2d, 0xe8, 0x6d, 0x6d, 0x6d, 0x0c,
+    0xff, 0xbf, 0xed, 0xfd, 0x85, 0x5c, 0x0a, 0x37, 0x77, 0x60, 0x0c, 0x59,
+    0x56, 0x6b, 0x6b, 0xab, 0x59, 0x5f, 0x08, 0x86, 0xbf, 0x0f, 0x6f, 0x6f,
+    0x6f, 0x93, 0xa7, 0xca, 0x48, 0x5a, 0x4c, 0xf5, 0xef, 0x95, 0x4a, 0x25,
+    0xc3, 0xff, 0x6f, 0x92, 0x92, 0x92, 0x24, 0x33, 0x7f, 0x3e, 0x99, 0x76,
+    0xed, 0xda, 0xb5, 0x21, 0x0b, 0xbf, 0x9d, 0x2d, 0x55, 0x9c, 0xa7, 0xa7,
+    0x27, 0xde, 0x78, 0xe3, 0x8d, 0x61, 0x1b, 0xc1, 0x55, 0x55, 0x55, 0x85,
+    0x1b, 0x37, 0x6e, 0x48, 0xae, 0x5e, 0x26, 0x4d, 0x9a, 0x84, 0x29, 0x53,
+    0xa6, 0x48, 0x62, 0x5b, 0x2b, 0x2b, 0x2b, 0xef, 0xf9, 0xbf, 0x4c, 0x26,
+    0x83, 0x93, 0x93, 0x13, 0xc3, 0x6f, 0x8e, 0x84, 0x84, 0x04, 0x7c, 0xf8,
+    0xe1, 0x87, 0x03, 0x3e, 0x3d, 0xf6, 0xff, 0x04, 0x06, 0x06, 0x4a, 0xb2,
+    0x4e, 0x22, 0x22, 0x22, 0x90, 0x99, 0x99, 0x29, 0xfa, 0xed, 0xac, 0xa9,
+    0xa9, 0x31, 0x7a, 0x36, 0x83, 0x9b, 0x9b, 0x9b, 0xa0, 0xe7, 0xb5, 0xd9,
+    0x6c, 0xb7, 0x07, 0x00, 0x5c, 0x5c, 0x5c, 0x10, 0x11, 0x11, 0xc1, 0xfe,
+    0x83, 0x04, 0x1d, 0x38, 0x70, 0xc0, 0xe8, 0xb5, 0x19, 0x33, 0x66, 0x0c,
+    0xf8, 0xfd, 0xe4, 0xb6, 0x58, 0x89, 0xd1, 0xd1, 0xd1, 0x70, 0x76, 0x76,
+    0x66, 0x9a, 0x24, 0xe4, 0xe4, 0xc9, 0x93, 0x28, 0x2f, 0x2f, 0x37, 0x7a,
+    0x7d, 0xf6, 0xec, 0xd9, 0x0c, 0xbf, 0x10, 0x13, 0x26, 0x4c, 0x90, 0xcc,
+    0x63, 0x77, 0x08, 0x38, 0x7d, 0xfa, 0x34, 0xb2, 0xb2, 0xb2, 0x8c, 0xae,
+    0xba, 0x3b, 0x39, 0x39, 0x31, 0xfc, 0x03, 0xb1, 0x69, 0xd3, 0x26, 0xb8,
+    0xbb, 0xbb, 0x33, 0x59, 0x22, 0x76, 0xf9, 0xf2, 0x65, 0xa4, 0xa4, 0xa4,
+    0x20, 0x3d, 0x3d, 0xdd, 0xe4, 0x75, 0x97, 0xe0, 0xe0, 0x60, 0x28, 0x14,
+    0x8a, 0x01, 0xbf, 0xbf, 0x9d, 0xad, 0x56, 0xec, 0x98, 0x31, 0x63, 0x10,
+    0x1f, 0x1f, 0x8f, 0xd0, 0xd0, 0x50, 0xa6, 0x6c, 0x84, 0xe9, 0xf5, 0x7a,
+    0xb4, 0xb7, 0xb7, 0xa3, 0xb1, 0xb1, 0x11, 0x75, 0x75, 0x75, 0xa8, 0xad,
+    0xad, 0x45, 0x59, 0x59, 0x19, 0xfe, 0xf8, 0xe3, 0x8f, 0x7e, 0xcb, 0xb8,
+    0xba, 0xba, 0x62, 0xd9, 0xb2, 0x65, 0x83, 0xfa, 0xbb, 0x76, 0xb6, 0x5c,
+    0xe9, 0xeb, 0xd7, 0xaf, 0x47, 0x46, 0x46, 0xc6, 0x90, 0xce, 0x05, 0x63,
+    0x0d, 0xee, 0xdc, 0xb9, 0x63, 0xb1, 0xa9, 0x1c, 0xbb, 0xba, 0xba, 0x04,
+    0xcf, 0x9b, 0x6a, 0x6f, 0x6f, 0x8f, 0xe8, 0xe8, 0x68, 0x8c, 0x1a, 0x35,
+    0x8a, 0xe1, 0x1f, 0x28, 0x85, 0x42, 0x01, 0x8d, 0x46, 0x83, 0xd5, 0xab,
+    0x57, 0x33, 0xf1, 0x7d, 0x18, 0x0c, 0x86, 0x21, 0x9f, 0x1d, 0x6d, 0x28,
+    0xdb, 0x6c, 0xf3, 0xe6, 0xcd, 0x50, 0xa9, 0x54, 0x83, 0x7e, 0x2f, 0xb9,
+    0xad, 0x37, 0xf4, 0x4b, 0x2f, 0xbd, 0x04, 0x7f, 0x7f, 0x7f, 0x26, 0x5e,
+    0x02, 0xc6, 0x8f, 0x1f, 0x8f, 0x84, 0x84, 0x84, 0x21, 0xbb, 0x9e, 0x62,
+    0xf3, 0xe1, 0x97, 0xc9, 0x64, 0x48, 0x49, 0x49, 0x61, 0xb2, 0x44, 0xde,
+    0x46, 0x81, 0x81, 0x81, 0xc8, 0xce, 0xce, 0x1e, 0xd2, 0x1d, 0xd5, 0x80,
+    0xba, 0x3d, 0x8b, 0x16, 0x2d, 0x42, 0x69, 0x69, 0xa9, 0xd9, 0xeb, 0xbb,
+    0xb9, 0xb9, 0x89, 0xba, 0x72, 0x83, 0x82, 0x82, 0xf0, 0xd5, 0x57, 0x5f,
+    0xdd, 0x33, 0x0d, 0x46, 0x4b, 0x4b, 0x0b, 0xaa, 0xaa, 0xaa, 0xcc, 0x7e,
+    0x0f, 0xa5, 0x52, 0x39, 0x24, 0x3f, 0xc5, 0x23, 0x41, 0xc8, 0x34, 0x2f,
+    0x96, 0xde, 0xd3, 0xcf, 0x9d, 0x3b, 0x17, 0x41, 0x41, 0x41, 0xf0, 0xf4,
+    0xf4, 0x1c, 0xf2, 0xf7, 0x1f, 0x50, 0xf8, 0x5d, 0x5d, 0x5d, 0x87, 0x65,
+    0xca, 0xe8, 0x91, 0xb4, 0x70, 0xe1, 0x42, 0xee, 0x62, 0x7b, 0xbb, 0x03,
+    0x72, 0xb9, 0x45, 0xdb, 0xd7, 0xc1, 0xc1, 0xe1, 0x9f, 0xf9, 0xf9, 0x27,
+    0x4e, 0x9c, 0x08, 0x0f, 0x0f, 0x0f, 0xa8, 0x54, 0x2a, 0x4c, 0x9b, 0x36,
+    0x4d, 0xd0, 0x20, 0x24, 0x1e, 0xf0, 0xd2, 0x90, 0xec, 0x71, 0x73, 0x73,
+    0x73, 0xad, 0xff, 0x4b, 0xce, 0xa6, 0x26, 0x9b, 0xfd, 0x85, 0x63, 0x15,
+    0x10, 0xc3, 0x4f, 0xc4, 0xf0, 0x13, 0xd9, 0x86, 0x7b, 0x0e, 0x78, 0xeb,
+    0xeb, 0xeb, 0x59, 0x23, 0x64, 0xb5, 0xee, 0xcf, 0xb7, 0x0c, 0x00, 0x67,
+    0x67, 0x22, 0x9b, 0xed, 0xf6, 0x74, 0xb2, 0x1a, 0xc8, 0x06, 0x75, 0x2a,
+    0xfe, 0xf7, 0x05, 0x78, 0x06, 0x80, 0x82, 0xf5, 0x41, 0x36, 0xa2, 0x0b,
+    0xc0, 0x76, 0x56, 0x03, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x91, 0x24, 0xfc, 0x07, 0xdd, 0x1e, 0xbc, 0xa4, 0x27, 0xef, 0xcc, 0x1a,
+    0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
 };
 
+/* decoded on first use; kept for the lifetime of the process */
+static SDL_Surface * neuik_StockImageSurf_neuik_icon = NULL;
+
 
 /*******************************************************************************
  *
  *  Name:          neuik_GetStockImage_neuik_icon
  *
- *  Description:   Return a pointer to the stock image.
+ *  Description:   Create a new NEUIK_Image containing the stock image.
  *
- *  Returns:       NULL if there is a problem; otherwise a valid string
+ *  Returns:       1 if there is an error; 0 otherwise.
  *
  ******************************************************************************/
 int neuik_GetStockImage_neuik_icon(
     NEUIK_Image ** imgPtr)
 {
-    return NEUIK_MakeImage_FromSource(
+    return neuik_MakeImage_FromEncodedStock(
         imgPtr,
-        neuik_StockImageData_neuik_icon.width,
-        neuik_StockImageData_neuik_icon.height,
-        neuik_StockImageData_neuik_icon.bytes_per_pixel,
-        neuik_StockImageData_neuik_icon.pixel_data);
+        neuik_StockImageData_neuik_icon,
+        sizeof(neuik_StockImageData_neuik_icon),
+        &neuik_StockImageSurf_neuik_icon);
 }
-
@@ -1,5831 +0,0 @@
-/*******************************************************************************
- * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
- *
- * Permission to use, copy, modify, and/or distribute this software for any
- * purpose with or without fee is hereby granted, provided that the above
- * copyright notice and this permission notice appear in all copies.
- * 
- * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
- * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
- * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
- * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
- * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
- * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
- * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
- ******************************************************************************/
-
-// #include <SDL.h>
-#include "NEUIK_Image.h"
-
-unsigned int icon_width           = 191;
-unsigned int icon_height          = 191;
-unsigned int icon_bytes_per_pixel = 4;
-
-// len(ipixel_data_1) = 54437
-static unsigned char ipixel_data_1[] =
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\371\000\000\000~\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\370\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\300\300\300\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335"
-    "\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335"
-    "\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\300"
-    "\300\300\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335"
-    "\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335"
-    "\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335"
-    "\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\365\365"
-    "\365\377\306\306\306\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\347\347\347"
-    "\377\273\273\273\377\273\273\273\377\273\273\273\377\273\273\273\377\273"
-    "\273\273\377\273\273\273\377\273\273\273\377\273\273\273\377\273\273\273"
-    "\377\273\273\273\377\273\273\273\377\273\273\273\377\273\273\273\377\273"
-    "\273\273\377\273\273\273\377\273\273\273\377\347\347\347\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\337\337\337\377\212\212\212\377\212"
-    "\212\212\377\212\212\212\377\212\212\212\377\212\212\212\377\212\212\212"
-    "\377\212\212\212\377\212\212\212\377\212\212\212\377\212\212\212\377\212"
-    "\212\212\377\226\226\226\377\274\274\274\377\274\274\274\377\274\274\274"
-    "\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274"
-    "\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274"
-    "\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274"
-    "\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274"
-    "\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274"
-    "\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274"
-    "\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274"
-    "\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274"
-    "\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274"
-    "\274\274\377\274\274\274\377\341\341\341\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\372\372\372\377\371\371\371\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\364\364\364\377sss\377\241\241"
-    "\241\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377QQQ\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\211\211"
-    "\211\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\360\360\360\377~~~\377\372\372\372\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\365\365\365\377sss\377"
-    "MMM\377\241\241\241\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\306\306\306\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\211\211\211\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\360\360\360\377MMM\377\206\206\206\377\375\375\375\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\365\365\365\377sss\377M"
-    "MM\377MMM\377\241\241\241\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244"
-    "\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377>>>\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\211\211\211\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\360\360\360\377MMM\377MMM\377\220\220\220\377\376\376\376\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\365\365\365\377sss\377MMM\377MMM\377MMM\377\241"
-    "\241\241\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\272\272\272\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\211\211"
-    "\211\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\360\360\360\377MMM\377MMM\377MMM\377\232\232\232\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\365\365\365"
-    "\377sss\377MMM\377MMM\377MMM\377MMM\377\241\241\241\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335"
-    "\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\063\063"
-    "\063\377\376\376\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\211\211\211\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\360\360\360\377MMM\377MMM\377MMM\377MMM"
-    "\377\253\253\253\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\365"
-    "\365\365\377sss\377MMM\377MMM\377MMM\377MMM\377MMM\377\241\241\241\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\253\253\253\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\211\211\211\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\360\360\360\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377\266\266\266\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\364\364\364"
-    "\377rrr\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377\247\247\247\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377&&&\377\373\373\373\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\211\211\211\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\360\360\360\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377NNN\377\273\273\273\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\365\365\365\377sss\377MMM\377MMM\377MMM\377MMM\377M"
-    "MM\377MMM\377}}}\377\371\371\371\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\235"
-    "\235\235\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217"
-    "\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\211\211\211\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\376\376\376\377\207\207\207\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377PPP\377\311\311\311\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\363\363\363\377qqq\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377~~~\377\371\371\371\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\033\033\033\377\366\366\366\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\211\211\211\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\373"
-    "\373\373\377\201\201\201\377MMM\377MMM\377MMM\377MMM\377MMM\377QQQ\377\316"
-    "\316\316\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\364\364\364\377sss\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377}}}"
-    "\377\371\371\371\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335"
-    "\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\216\216\216\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\211\211\211\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\371\371\371\377xxx\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377UUU\377\327\327\327\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\364\364\364\377sss\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377}}}\377\371\371\371\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\024\024\024\377\361\361\361"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\304\304\304\377\326\326\326\377\326\326\326\377\326\326"
-    "\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377"
-    "\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326"
-    "\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377"
-    "\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326"
-    "\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377"
-    "\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326"
-    "\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377"
-    "\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326"
-    "\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377"
-    "\326\326\326\377\355\355\355\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\365\365\365\377qqq\377MMM\377MMM\377MMM\377MMM\377MMM\377XXX\377\335\335"
-    "\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\364\364\364\377sss\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "~~~\377\371\371\371\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\177\177"
-    "\177\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\361\361\361\377jjj\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377\\\\\\\377\344\344\344\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\364\364\364\377rrr\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377~~~\377"
-    "\371\371\371\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\014\014\014\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\354\354\354\377ddd\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377bbb\377\353\353\353\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\364\364\364\377"
-    "rrr\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377~~~\377\371\371\371\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377qqq\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\347\347\347\377^^^\377M"
-    "MM\377MMM\377MMM\377MMM\377MMM\377kkk\377\362\362\362\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\364\364\364\377rrr\377MMM\377MMM\377MMM"
-    "\377MMM\377MMM\377MMM\377~~~\377\371\371\371\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\006\006\006\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\010\010\010\377\341\341\341\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\340\340"
-    "\340\377ZZZ\377MMM\377MMM\377MMM\377MMM\377MMM\377rrr\377\366\366\366\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\364\364\364\377rrr\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377~~~\377\371\371\371\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377UUU\377\034\034\034\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377bbb\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351"
-    "\351\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\331\331\331"
-    "\377VVV\377MMM\377MMM\377MMM\377MMM\377MMM\377zzz\377\371\371\371\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\364\364\364\377rrr\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377~~~\377\371\371\371\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377^^^\377\226\226\226\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\003\003\003"
-    "\377\325\325\325\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217"
-    "\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\321"
-    "\321\321\377SSS\377MMM\377MMM\377MMM\377MMM\377MMM\377\203\203\203\377\374"
-    "\374\374\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\364\364\364\377rrr\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377~~~\377\371\371\371\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377^^^\377\372\372\372\377###\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "SSS\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\311"
-    "\311\311\377PPP\377MMM\377MMM\377MMM\377MMM\377MMM\377\214\214\214\377\376"
-    "\376\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\364\364\364\377rrr\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377~~~"
-    "\377\371\371\371\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335"
-    "\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^"
-    "^\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\001\001\001\377\310\310\310\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\277\277\277\377NNN\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "\226\226\226\377\377\377\377\377\377\377\377\377\377\377\377\377\364\364"
-    "\364\377rrr\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377~~~\377\371\371"
-    "\371\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "^^^\377\377\377\377\377\375\375\375\377\060\060\060\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377EEE\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\266\266\266\377MMM\377MMM\377MMM\377MMM"
-    "\377MMM\377MMM\377\241\241\241\377\377\377\377\377\364\364\364\377rrr\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377~~~\377\371\371\371\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "^^^\377\377\377\377\377\377\377\377\377\263\263\263\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\274\274\274\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\253\253\253\377MMM\377M"
-    "MM\377MMM\377MMM\377MMM\377MMM\377\244\244\244\377ooo\377MMM\377MMM\377M"
-    "MM\377MMM\377MMM\377MMM\377\177\177\177\377\371\371\371\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377^^^\377\377\377\377\377\377\377\377\377\377\377\377\377???\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\065\065\065\377\376\376\376\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377";
-
-// len(ipexel_data_2) = 42232
-static unsigned char ipixel_data_2[] = 
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\240\240"
-    "\240\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377M"
-    "MM\377MMM\377MMM\377~~~\377\371\371\371\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377^^^\377\377\377\377\377\377\377\377\377\377\377\377\377\303\303\303"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\256\256\256\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217"
-    "\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\376\376\376\377\226\226\226\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377~~~\377\371\371\371\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377III\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377'''\377\373\373\373\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351"
-    "\351\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\376\376\376\377\221\221\221\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377~~~\377\371\371\371\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335"
-    "\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335"
-    "\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\321\321"
-    "\321\377\002\002\002\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\240\240\240\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\375\375\375\377\207\207\207\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377~~~\377\371\371\371\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335"
-    "\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335"
-    "\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377XXX\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\037\037\037\377\370\370\370"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\373\373\373\377\177\177\177\377MMM\377MMM\377"
-    "MMM\377MMM\377~~~\377\371\371\371\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335"
-    "\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^"
-    "^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\332\332\332\377\005\005\005\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\221\221\221\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\365\365\365\377"
-    "|||\377|||\377|||\377|||\377|||\377|||\377|||\377|||\377|||\377|||\377||"
-    "|\377|||\377|||\377|||\377|||\377|||\377|||\377ttt\377MMM\377MMM\377MMM\377"
-    "MMM\377www\377|||\377|||\377|||\377|||\377|||\377|||\377|||\377|||\377||"
-    "|\377|||\377|||\377|||\377|||\377|||\377|||\377|||\377|||\377|||\377|||\377"
-    "\272\272\272\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377ggg\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\025\025\025\377\362\362\362\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\360\360\360\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377\241\241\241\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335"
-    "\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335"
-    "\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\346\346\346\377\012\012\012\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\202\202\202\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\360\360\360\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "\241\241\241\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377vvv\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\015\015\015\377\351\351\351"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\360\360\360\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377\241\241\241\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335"
-    "\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\357\357\357\377\021\021\021\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377ttt\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\360\360\360\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377\241\241\241\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\204\204\204\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\010\010\010\377\342"
-    "\342\342\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351"
-    "\351\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\360\360\360\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM"
-    "\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377\241\241\241\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\364\364\364\377\030\030\030\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377eee\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\223\223\223\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\003\003\003\377\326\326\326\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\372\372\372\377\"\"\"\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377VVV\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351"
-    "\351\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377^^^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\241\241\241\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\001\001\001\377\315\315\315\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217"
-    "\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335"
-    "\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335"
-    "\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\375\375\375\377///\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377HHH\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\260\260\260\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\276"
-    "\276\276\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377;;;\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377"
-    "@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@"
-    "@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377"
-    "@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@@\377@@"
-    "@\377@@@\377@@@\377@@@\377\223\223\223\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335"
-    "\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335"
-    "\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377:::\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\066\066\066\377\376\376\376\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377nnn\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335"
-    "\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\302\302\302\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\261\261\261\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377nnn\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335"
-    "\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377GGG\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377,,,\377\375\375\375\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377nnn\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244"
-    "\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\320\320\320\377\002\002\002\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\242\242\242\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377nnn\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377UUU\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\040\040\040\377\370\370\370\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377nnn\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244"
-    "\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\331\331\331"
-    "\377\004\004\004\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\224\224\224\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377nnn\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\370\370\370\377\254\254"
-    "\254\377\254\254\254\377\254\254\254\377\254\254\254\377\254\254\254\377"
-    "\254\254\254\377\254\254\254\377\254\254\254\377\254\254\254\377\254\254"
-    "\254\377\254\254\254\377\254\254\254\377\254\254\254\377\254\254\254\377"
-    "\254\254\254\377\254\254\254\377\254\254\254\377\254\254\254\377\254\254"
-    "\254\377\254\254\254\377\254\254\254\377\254\254\254\377\254\254\254\377"
-    "\254\254\254\377\254\254\254\377\254\254\254\377\254\254\254\377\254\254"
-    "\254\377\254\254\254\377\254\254\254\377\254\254\254\377\254\254\254\377"
-    "\254\254\254\377\254\254\254\377\254\254\254\377\254\254\254\377\254\254"
-    "\254\377\254\254\254\377\254\254\254\377\254\254\254\377\254\254\254\377"
-    "\254\254\254\377\323\323\323\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244"
-    "\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377ddd\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\026\026\026\377\362\362\362"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377nnn\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\360\360\360\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377\241\241\241"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\345\345\345\377\011\011\011"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\205\205\205\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377nnn\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\360\360\360\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377\241\241\241\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "^^^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377sss\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\017\017\017\377\355\355\355\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377nnn\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\360"
-    "\360\360\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377\241\241\241\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244"
-    "\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\354\354\354\377\016\016\016\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377www\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377KKK\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377"
-    "RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RR"
-    "R\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377"
-    "RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RRR\377RR"
-    "R\377RRR\377RRR\377RRR\377\236\236\236\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\360\360"
-    "\360\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377M"
-    "MM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM"
-    "\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377\241\241\241\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244"
-    "\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\201\201\201\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\010\010\010\377\343\343\343\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\360\360\360\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377\241\241\241\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\363\363\363\377\027\027\027\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377hh"
-    "h\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217"
-    "\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\372"
-    "\372\372\377\304\304\304\377\304\304\304\377\304\304\304\377\304\304\304"
-    "\377\304\304\304\377\304\304\304\377\304\304\304\377\304\304\304\377\304"
-    "\304\304\377\304\304\304\377\304\304\304\377\304\304\304\377\304\304\304"
-    "\377\304\304\304\377\304\304\304\377\304\304\304\377\304\304\304\377\304"
-    "\304\304\377\304\304\304\377\304\304\304\377\304\304\304\377\304\304\304"
-    "\377\304\304\304\377\304\304\304\377\304\304\304\377\304\304\304\377\304"
-    "\304\304\377\304\304\304\377\304\304\304\377\304\304\304\377\304\304\304"
-    "\377\304\304\304\377\304\304\304\377\304\304\304\377\304\304\304\377\304"
-    "\304\304\377\304\304\304\377\304\304\304\377\304\304\304\377\304\304\304"
-    "\377\304\304\304\377\304\304\304\377\340\340\340\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335"
-    "\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^"
-    "^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\220\220\220\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\004\004\004\377\330"
-    "\330\330\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\371\371"
-    "\371\377\"\"\"\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377YYY\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\237\237\237"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\001\001\001\377\316\316\316\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\374\374\374\377***\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377KKK\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351"
-    "\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "^^^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\255\255\255\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\277\277\277\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\070\070\070\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377;;;\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\300\300\300\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\264\264\264\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377DDD\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377---\377"
-    "\375\375\375\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351"
-    "\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "^^^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\313"
-    "\313\313\377\001\001\001\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\245\245\245"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "RRR\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377!!!\377\371\371\371\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\330\330\330\377\004\004\004\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\227\227\227\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\363\363\363\377qqq\377qqq\377qqq\377qqq\377qqq\377qqq\377"
-    "qqq\377qqq\377qqq\377qqq\377qqq\377qqq\377qqq\377qqq\377qqq\377qqq\377qq"
-    "q\377qqq\377qqq\377qqq\377qqq\377qqq\377qqq\377qqq\377qqq\377qqq\377qqq\377"
-    "xxx\377\203\203\203\377\217\217\217\377\235\235\235\377\275\275\275\377\343"
-    "\343\343\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244"
-    "\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377aaa\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\031\031\031\377\365\365\365"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\360\360\360\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377ccc\377\241\241\241\377"
-    "\347\347\347\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "^^^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\341\341\341\377\007\007\007\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\210\210\210\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\360\360\360\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377PPP\377\224\224\224\377\363\363\363\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377ppp\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\020\020\020\377\355\355\355\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351"
-    "\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\360\360\360\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377___\377\327\327\327"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\353\353\353"
-    "\377\016\016\016\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377zzz\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217"
-    "\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\360"
-    "\360\360\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377SSS\377\315\315\315"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335"
-    "\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^"
-    "^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\177\177\177"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\011\011\011\377\344\344\344\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\217\217\217"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\360\360\360\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377UUU\377\336\336\336"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\363\363\363\377\026\026\026\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377kkk\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\375\375\375\377\363\363\363\377\352"
-    "\352\352\377\327\327\327\377\270\270\270\377\230\230\230\377bbb\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377jjj\377\373\373\373\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\215\215\215\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\005\005\005\377\334\334\334\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\376\376\376\377\326\326\326\377"
-    "|||\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377\262\262\262\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\367\367\367\377\036\036\036\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\\\\\\\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\272\272\272\377OOO\377MMM\377MMM\377MMM\377MMM\377aaa\377\374"
-    "\374\374\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\234\234\234\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\002\002\002\377\317\317\317\377\377\377\377\377\377"
-    "\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\272\272\272\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377\312\312\312\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\374\374\374"
-    "\377)))\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377MMM\377\377\377\377\377\377"
-    "\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\201\201\201\377MMM\377MMM\377"
-    "MMM\377MMM\377\223\223\223\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244"
-    "\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\252\252\252\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\305\305\305\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\333"
-    "\333\333\377MMM\377MMM\377MMM\377MMM\377hhh\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335"
-    "\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\376\376\376\377\067\067\067\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377===\377\377\377\377\377\217\217\217\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377bbb\377MMM\377MMM\377MMM\377NNN\377\367\367\367\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335"
-    "\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\271\271\271\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\267\267\267\377\217\217\217\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\220\220\220\377MMM\377MMM\377MMM\377MMM\377\346\346"
-    "\346\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377^^^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377BBB\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377...\377\216\216\216\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\253\253\253\377MMM\377MMM\377MMM\377MMM\377"
-    "\331\331\331\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\312\312\312\377\001\001\001\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377PPP\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\270\270\270\377MMM\377MMM\377"
-    "MMM\377MMM\377\315\315\315\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377PPP\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\004\004\004\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351"
-    "\351\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377";
-
-// len(ipexel_data_3) = 49255
-static unsigned char ipixel_data_3[] = 
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\302\302\302\377MMM\377"
-    "MMM\377MMM\377MMM\377\303\303\303\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\330\330\330\377\004\004"
-    "\004\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\267\267\267\377MMM\377MMM\377MMM\377MMM\377\315\315\315\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335"
-    "\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377^^^\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351\351\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\252\252\252\377MMM\377MMM\377MMM\377MMM\377\331\331"
-    "\331\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377^^^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\340\340\340\377\007\007\007\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\351\351"
-    "\351\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\221\221\221\377MMM\377M"
-    "MM\377MMM\377MMM\377\345\345\345\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377mmm\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\304\304\304\377\326\326\326\377\326\326\326\377\326"
-    "\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326"
-    "\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326"
-    "\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326"
-    "\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326"
-    "\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326"
-    "\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326"
-    "\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326"
-    "\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326"
-    "\326\326\377\326\326\326\377\326\326\326\377\326\326\326\377\326\326\326"
-    "\377\326\326\326\377\326\326\326\377\350\350\350\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377ddd\377MMM\377MMM\377MMM\377NNN\377\366\366\366\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\352\352\352\377\015\015\015\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "ooo\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\336\336\336\377MMM\377MMM\377MMM\377MMM\377ggg\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377^^^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377|||\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377ooo\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\204\204\204\377MMM\377MMM\377MMM\377MMM"
-    "\377\222\222\222\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\360\360\360\377\023\023\023\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377ooo\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\300\300\300"
-    "\377NNN\377MMM\377MMM\377MMM\377MMM\377\307\307\307\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335"
-    "\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^"
-    "^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\212\212\212\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377ooo\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\303\303\303\377QQQ\377MMM\377MMM\377MMM\377MMM\377^^^\377\374\374"
-    "\374\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\367\367\367\377\035\035\035\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377ooo\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\335\335\335\377\203\203\203\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377\255\255\255\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\231\231\231\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377ooo\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\374\374\374\377\363\363\363\377\336\336\336\377\300\300"
-    "\300\377\240\240\240\377iii\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377eee\377\371\371\371\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335"
-    "\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\374\374\374\377(((\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377ooo\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\361\361\361\377YYY\377YYY\377YYY\377YYY\377YYY\377YYY\377YYY\377YYY\377"
-    "YYY\377YYY\377YYY\377YYY\377YYY\377YYY\377YYY\377YYY\377YYY\377YYY\377YY"
-    "Y\377YYY\377YYY\377YYY\377YYY\377YYY\377YYY\377YYY\377SSS\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377RR"
-    "R\377\331\331\331\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335"
-    "\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\335\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^"
-    "^\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\247\247\247\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377ooo\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\360\360\360\377MMM\377MMM\377MMM\377MMM\377MMM\377M"
-    "MM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM"
-    "\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377PPP\377\303\303\303\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\244\244\244\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377^^^\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\376\376"
-    "\376\377\062\062\062\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377oo"
-    "o\377\377\377\377\377\377\377\377\377\377\377\377\377\360\360\360\377MMM"
-    "\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377ZZZ\377\315\315\315\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335"
-    "\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335"
-    "\335\335\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\244\244\244\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377^^^\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\266\266\266\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377ooo\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\360\360\360\377MMM\377MMM\377MMM\377MMM\377MMM\377M"
-    "MM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM"
-    "\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377NNN\377\211"
-    "\211\211\377\356\356\356\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\347\347\347\377\273\273\273\377\273\273\273\377\273\273\273\377\273\273"
-    "\273\377\273\273\273\377\273\273\273\377\273\273\273\377\273\273\273\377"
-    "\273\273\273\377\273\273\273\377\273\273\273\377\324\324\324\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\276\276\276\377"
-    "\273\273\273\377\273\273\273\377\273\273\273\377\257\257\257\377\212\212"
-    "\212\377\212\212\212\377\212\212\212\377\212\212\212\377\212\212\212\377"
-    "\212\212\212\377\212\212\212\377\212\212\212\377\212\212\212\377\212\212"
-    "\212\377\212\212\212\377\226\226\226\377\274\274\274\377\274\274\274\377"
-    "\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274"
-    "\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377"
-    "\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274"
-    "\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377"
-    "\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274"
-    "\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377"
-    "\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274"
-    "\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377"
-    "\274\274\274\377\274\274\274\377\274\274\274\377\274\274\274\377\274\274"
-    "\274\377\274\274\274\377\274\274\274\377\274\274\274\377\332\332\332\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\360\360\360\377MMM\377M"
-    "MM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM"
-    "\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377"
-    "MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MMM\377MM"
-    "M\377ZZZ\377\227\227\227\377\340\340\340\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\362\362\362\377eee\377eee\377eee\377eee\377eee\377e"
-    "ee\377eee\377eee\377eee\377eee\377eee\377eee\377eee\377eee\377eee\377eee"
-    "\377eee\377eee\377eee\377eee\377eee\377eee\377eee\377eee\377eee\377eee\377"
-    "eee\377ooo\377zzz\377\206\206\206\377\226\226\226\377\264\264\264\377\332"
-    "\332\332\377\376\376\376\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\335\335\335\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\335\335\335\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\300\300\300\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335"
-    "\335\377\335\335\335\377\335\335\335\377\335\335\335\377\335\335\335\377"
-    "\335\335\335\377\300\300\300\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\370\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\370\000\000\000~\000\000\000\371\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000"
-    "\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000"
-    "\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000"
-    "\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377"
-    "\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\377\000\000\000\371\000\000\000~\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000";
-
-
-/*******************************************************************************
- *
- *  Name:          neuik_GetStockImage_neuik_icon
- *
- *  Description:   Return a pointer to the .
- *
- *  Returns:       NULL if there is a problem; otherwise a valid string
- *
- ******************************************************************************/
-int neuik_GetStockImage_neuik_icon(
-    NEUIK_Image ** imgPtr)
-{
-    int             eNum            = 0;
-    unsigned char * pixel_data_full = NULL; /* MUST BE FREED on EXIT */
-    unsigned char * write_ptr       = NULL;
-    size_t          data_len_1;
-    size_t          data_len_2;
-    size_t          data_len_3;
-    static char     funcName[] = "neuik_GetStockImage_neuik_icon";
-    static char   * errMsgs[]  = {"",                 // [0] no error
-        "Failed to allocate memory.",                 // [1]
-        "Failure in `NEUIK_MakeImage_FromSource()`.", // [2]
-    };
-
-    data_len_1 = sizeof(ipixel_data_1) - 1;
-    data_len_2 = sizeof(ipixel_data_2) - 1;
-    data_len_3 = sizeof(ipixel_data_3);
-
-    pixel_data_full = malloc(
-        (data_len_1 + data_len_2 + data_len_3 +1) * sizeof(char));
-    if (pixel_data_full == NULL)
-    {
-        eNum = 1;
-        goto out;
-    }
-
-    write_ptr = pixel_data_full;
-    memcpy(write_ptr, ipixel_data_1, data_len_1);
-    write_ptr += data_len_1;
-    memcpy(write_ptr, ipixel_data_2, data_len_2);
-    write_ptr += data_len_2;
-    memcpy(write_ptr, ipixel_data_3, data_len_3);
-
-    if (NEUIK_MakeImage_FromSource(
-        imgPtr,
-        icon_width,
-        icon_height,
-        icon_bytes_per_pixel,
-        pixel_data_full))
-    {
-        eNum = 2;
-        goto out;
-    }
-out:
-    if (eNum != 0)
-    {
-        NEUIK_RaiseError(funcName, errMsgs[eNum]);
-        eNum = 1;
-    }
-    /* Free all dynamically allocated memory */
-    if (pixel_data_full != NULL) free(pixel_data_full);
-
-    return eNum;
-}
-
@@ -21,6 +21,7 @@
 #include "NEUIK_error.h"
 #include "neuik_TextBlock.h"
 #include "neuik_TextBlock_internal.h"
+#include "neuik_TextBlockJournal.h"
 #include "neuik_internal.h"
 #include "neuik_classes.h"
 
@@ -102,6 +103,7 @@ int neuik_RegisterClass_TextBlock()
         "Stores a (potentially) large block of text.", // classDescription
         neuik__Set_NEUIK,                              // classSet
         NULL,                                          // superClass
+        sizeof(neuik_TextBlock),                       // objSize
         &neuik_TextBlock_BaseFuncs,                    // baseFuncs
         NULL,                                          // classFuncs
         &neuik__Class_TextBlock))                      // newClass
@@ -344,7 +346,8 @@ int neuik_NewTextBlock(
         goto out;
     }
 
-    (*tblkPtr) = (neuik_TextBlock*) malloc(sizeof(neuik_TextBlock));
+    (*tblkPtr) = (neuik_TextBlock*) neuik_Object_Alloc(
+        neuik__Class_TextBlock, (void**)tblkPtr);
     tblk = (*tblkPtr);
     if (tblk == NULL)
     {
@@ -372,6 +375,7 @@ int neuik_NewTextBlock(
     tblk->nChapters         = 1;
     tblk->chaptersAllocated = DefaultChaptersAllocated;
     tblk->overProvisionPct  = DefaultOverProvisionPct;
+    tblk->journal           = NULL;
 
     /*------------------------------------------------------------------------*/
     /* Update TextBlock size and if a non-default value was specified.        */
@@ -476,11 +480,12 @@ int neuik_Object_Free__TextBlock(
     /* Free the list of pointers to chapters.                                 */
     /*------------------------------------------------------------------------*/
     if (tblk->chapters != NULL) free(tblk->chapters);
+    neuik_TextBlockJournal_Free((neuik_TextBlockJournal*)(tblk->journal));
 
     /*------------------------------------------------------------------------*/
     /* Free the memory used for the object structure itself.                  */
     /*------------------------------------------------------------------------*/
-    free(tblk);
+    neuik_Object_Release(tblk);
 out:
     if (eNum > 0)
     {
@@ -491,6 +496,61 @@ out:
 }
 
 
+/*----------------------------------------------------------------------------*/
+/* Link a data block onto the end of a TextBlock (starting a new chapter if   */
+/* required).                                                                 */
+/*                                                                            */
+/* Returns : 1 if the call failed; 0 if successful                            */
+/*                                                                            */
+/* [noErrChecks] :                                                            */
+/*    This function does not check for NULL pointer arguments. Appropriate    */
+/*    checks should be done externally before calling this function.          */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextBlock_LinkDataBlock__noErrChecks(
+    neuik_TextBlock     * tblk,
+    neuik_TextBlockData * block)
+{
+    int                    hasErr   = 0;
+    size_t                 nChapters;
+    size_t                 nChaptersOld;
+    neuik_TextBlockData ** chapters = NULL;
+
+    tblk->lastBlock->nextBlock = block;
+    block->previousBlock       = tblk->lastBlock;
+    block->nextBlock           = NULL;
+    tblk->lastBlock            = block;
+
+    nChaptersOld = 1 + (tblk->nDataBlocks/tblk->chapterSize);
+    tblk->nDataBlocks++;
+    nChapters = 1 + (tblk->nDataBlocks/tblk->chapterSize);
+
+    if (nChapters > nChaptersOld)
+    {
+        /*--------------------------------------------------------------------*/
+        /* This new data block is now the start of a new chapter              */
+        /*--------------------------------------------------------------------*/
+        if (tblk->nChapters >= tblk->chaptersAllocated)
+        {
+            chapters = (neuik_TextBlockData**) realloc(tblk->chapters,
+                (tblk->chaptersAllocated + DefaultChaptersAllocated)
+                * sizeof(neuik_TextBlockData*));
+            if (chapters == NULL)
+            {
+                hasErr = 1;
+                goto out;
+            }
+            tblk->chapters           = chapters;
+            tblk->chaptersAllocated += DefaultChaptersAllocated;
+        }
+
+        tblk->chapters[tblk->nChapters] = block;
+        tblk->nChapters++;
+    }
+out:
+    return hasErr;
+}
+
+
 /*----------------------------------------------------------------------------*/
 /* Append an empty data block to the end of a TextBlock.                      */
 /*----------------------------------------------------------------------------*/
@@ -498,9 +558,7 @@ int neuik_TextBlock_AppendDataBlock(
     neuik_TextBlock * tblk)
 {
     int                   eNum       = 0; /* which error to report (if any) */
-    size_t                nChapters;
-    size_t                nChaptersOld;
-    neuik_TextBlockData * lastBlock;
+    neuik_TextBlockData * newBlock   = NULL;
     static char           funcName[] = "neuik_TextBlock_AppendDataBlock";
     static char         * errMsgs[]  = {"", // [0] no error
         "Output argument `tblk` is NULL.",               // [1]
@@ -517,41 +575,15 @@ int neuik_TextBlock_AppendDataBlock(
     /*------------------------------------------------------------------------*/
     /* Go to the current final data block and add one more after that         */
     /*------------------------------------------------------------------------*/
-    lastBlock = tblk->lastBlock;
-    if (neuik_NewTextBlockData(
-        (neuik_TextBlockData **)&(lastBlock->nextBlock), tblk->blockSize))
+    if (neuik_NewTextBlockData(&newBlock, tblk->blockSize))
     {
         eNum = 2;
         goto out;
     }
-    lastBlock = lastBlock->nextBlock;
-    lastBlock->previousBlock = tblk->lastBlock;
-    tblk->lastBlock = lastBlock;
-
-    nChaptersOld = 1 + (tblk->nDataBlocks/tblk->chapterSize);
-    tblk->nDataBlocks++;
-    nChapters = 1 + (tblk->nDataBlocks/tblk->chapterSize);
-
-    if (nChapters > nChaptersOld)
+    if (neuik_TextBlock_LinkDataBlock__noErrChecks(tblk, newBlock))
     {
-        /*--------------------------------------------------------------------*/
-        /* This new data block is now the start of a new chapter              */
-        /*--------------------------------------------------------------------*/
-        if (tblk->nChapters >= tblk->chaptersAllocated)
-        {
-            tblk->chapters = (neuik_TextBlockData**) realloc(tblk->chapters,
-                (tblk->chaptersAllocated + DefaultChaptersAllocated)
-                * sizeof(neuik_TextBlockData*));
-            if (tblk->chapters == NULL)
-            {
-                eNum = 3;
-                goto out;
-            }
-
-        }
-
-        tblk->chapters[tblk->nChapters] = lastBlock;
-        tblk->nChapters++;
+        eNum = 3;
+        goto out;
     }
 out:
     if (eNum > 0)
@@ -593,6 +625,7 @@ int neuik_TextBlock_SetText(
         "Failure in function `neuik_TextBlock_AppendDataBlock`.", // [3]
         "Invalid value set for `tblk->overProvisionPct`.",        // [4]
         "A contained `TextBlockData` struct is NULL.",            // [5]
+        "Failure in function `neuik_TextBlock_ClearJournal`.",    // [6]
     };
 
     if (tblk == NULL)
@@ -611,6 +644,15 @@ int neuik_TextBlock_SetText(
         goto out;
     }
 
+    /*------------------------------------------------------------------------*/
+    /* Recorded edits do not apply to the replacement text.                   */
+    /*------------------------------------------------------------------------*/
+    if (neuik_TextBlock_ClearJournal(tblk))
+    {
+        eNum = 6;
+        goto out;
+    }
+
     /*------------------------------------------------------------------------*/
     /* Determine the number of data blocks required to load this text.        */
     /*------------------------------------------------------------------------*/
@@ -876,6 +918,207 @@ out:
 }
 
 
+/*----------------------------------------------------------------------------*/
+/* Make sure a data block has room for `nBytes` more bytes, reallocating its  */
+/* data buffer if it does not.                                                */
+/*                                                                            */
+/* Returns : 1 if the call failed; 0 if successful                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextBlockData_Reserve__noErrChecks(
+    neuik_TextBlockData * data,
+    size_t                nBytes)
+{
+    size_t   newSize = 0;
+    char   * newData = NULL;
+
+    if (data->bytesInUse + nBytes < data->bytesAllocated)
+    {
+        return 0;
+    }
+    newSize = data->bytesInUse + nBytes + 1;
+    newData = (char*) realloc(data->data, (newSize+1)*sizeof(char));
+    if (newData == NULL)
+    {
+        return 1;
+    }
+    data->data           = newData;
+    data->bytesAllocated = newSize;
+    data->data[newSize]  = '\0';
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlock_AppendBlocks
+ *
+ *  Description:   Append a chain of data blocks holding complete lines (as
+ *                 built by a neuik_TextBlockBuilder) to the end of a
+ *                 TextBlock. The TextBlock takes ownership of the blocks; the
+ *                 text is not copied.
+ *
+ *                 The loaded lines follow on after the current final line. If
+ *                 that line is empty it is replaced by the loaded lines, if
+ *                 not it is ended with a `\n`. Unless `isFinal` is set (the
+ *                 last block ends with the final line of the text), an empty
+ *                 final line is added after the loaded lines.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextBlock_AppendBlocks(
+    neuik_TextBlock     * tblk,
+    neuik_TextBlockData * first,
+    int                   isFinal)
+{
+    char                  lastChar   = '\0';
+    size_t                lineNo     = 0;
+    neuik_TextBlockData * aBlock     = NULL;
+    neuik_TextBlockData * nextBlock  = NULL;
+    neuik_TextBlockData * prevBlock  = NULL;
+    int                   eNum       = 0; /* which error to report (if any) */
+    static char           funcName[] = "neuik_TextBlock_AppendBlocks";
+    static char         * errMsgs[]  = {"", // [0] no error
+        "Argument `tblk` is NULL.",                         // [1]
+        "Failure to reallocate memory.",                    // [2]
+        "Malformed TextBlock (final line not terminated).", // [3]
+    };
+
+    if (tblk == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (first == NULL)
+    {
+        /*--------------------------------------------------------------------*/
+        /* There are no complete lines to append.                             */
+        /*--------------------------------------------------------------------*/
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Retire the current final line so that the loaded lines follow it.      */
+    /*------------------------------------------------------------------------*/
+    aBlock = tblk->lastBlock;
+    if (aBlock->bytesInUse == 0)
+    {
+        /*--------------------------------------------------------------------*/
+        /* A freshly allocated TextBlock holds a single (implicit) empty line */
+        /*--------------------------------------------------------------------*/
+        tblk->nLines--;
+    }
+    else
+    {
+        if (aBlock->data[aBlock->bytesInUse - 1] != '\0')
+        {
+            eNum = 3;
+            goto out;
+        }
+        if (aBlock->bytesInUse > 1)
+        {
+            lastChar = aBlock->data[aBlock->bytesInUse - 2];
+        }
+        else if (aBlock->previousBlock != NULL)
+        {
+            prevBlock = aBlock->previousBlock;
+            if (prevBlock->bytesInUse > 0)
+            {
+                lastChar = prevBlock->data[prevBlock->bytesInUse - 1];
+            }
+        }
+
+        if (lastChar == '\0' || lastChar == '\n' || lastChar == '\r')
+        {
+            /*----------------------------------------------------------------*/
+            /* The final line is empty; drop it.                              */
+            /*----------------------------------------------------------------*/
+            aBlock->bytesInUse--;
+            aBlock->nLines--;
+            tblk->nLines--;
+        }
+        else
+        {
+            /*----------------------------------------------------------------*/
+            /* The final line has text in it; end it with a newline.          */
+            /*----------------------------------------------------------------*/
+            if (neuik_TextBlockData_Reserve__noErrChecks(aBlock, 1))
+            {
+                eNum = 2;
+                goto out;
+            }
+            aBlock->data[aBlock->bytesInUse - 1] = '\n';
+            aBlock->data[aBlock->bytesInUse++]   = '\0';
+            tblk->length++;
+        }
+    }
+
+    if (aBlock->bytesInUse == 0)
+    {
+        /*--------------------------------------------------------------------*/
+        /* The final data block is now empty; rather than leaving an empty    */
+        /* block in the chain, it takes over the buffer of the first loaded   */
+        /* block.                                                             */
+        /*--------------------------------------------------------------------*/
+        free(aBlock->data);
+        aBlock->data           = first->data;
+        aBlock->bytesAllocated = first->bytesAllocated;
+        aBlock->bytesInUse     = first->bytesInUse;
+        aBlock->nLines         = first->nLines;
+        tblk->nLines          += first->nLines;
+        tblk->length          += first->bytesInUse - first->nLines;
+
+        nextBlock = first->nextBlock;
+        free(first);
+        first = nextBlock;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Link in the remaining loaded blocks.                                   */
+    /*------------------------------------------------------------------------*/
+    lineNo = tblk->lastBlock->firstLineNo + tblk->lastBlock->nLines;
+    for (aBlock = first; aBlock != NULL; aBlock = nextBlock)
+    {
+        nextBlock = aBlock->nextBlock;
+
+        aBlock->firstLineNo = lineNo;
+        lineNo       += aBlock->nLines;
+        tblk->nLines += aBlock->nLines;
+        tblk->length += aBlock->bytesInUse - aBlock->nLines;
+        if (neuik_TextBlock_LinkDataBlock__noErrChecks(tblk, aBlock))
+        {
+            /*----------------------------------------------------------------*/
+            /* The block was linked in; only the chapter index is incomplete. */
+            /*----------------------------------------------------------------*/
+            eNum = 2;
+        }
+    }
+
+    if (!isFinal)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Add back an empty final line.                                      */
+        /*--------------------------------------------------------------------*/
+        aBlock = tblk->lastBlock;
+        if (neuik_TextBlockData_Reserve__noErrChecks(aBlock, 1))
+        {
+            eNum = 2;
+            goto out;
+        }
+        aBlock->data[aBlock->bytesInUse++] = '\0';
+        aBlock->nLines++;
+        tblk->nLines++;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
+
+
 int neuik_TextBlock_GetLength(
     neuik_TextBlock * tblk,
     size_t          * length)
@@ -1474,7 +1717,8 @@ int neuik_TextBlock_GetLine(
         /*--------------------------------------------------------------------*/
         for (; position < final; position++)
         {
-            if (data->data[position] == '\n' || data->data[position] == '\r')
+            if (data->data[position] == '\n' || data->data[position] == '\r' ||
+                data->data[position] == '\0')
             {
                 /*------------------------------------------------------------*/
                 /* This is the end of the line that we were looking for.      */
@@ -2108,6 +2352,16 @@ int neuik_TextBlock_InsertChar(
             }
             aBlock->data[position+1] = '\0';
             aBlock->bytesInUse++;
+
+            neuik_TextBlockJournal_Record__noErrChecks(tblk, 
+                NEUIK_JOURNAL_INSERT, 0, lineNo, byteNo, lineNo + 1, 0,
+                &newChar, 1);
+        }
+        else
+        {
+            neuik_TextBlockJournal_Record__noErrChecks(tblk, 
+                NEUIK_JOURNAL_INSERT, 1, lineNo, byteNo, lineNo, byteNo + 1,
+                &newChar, 1);
         }
     }
     else
@@ -2119,6 +2373,15 @@ int neuik_TextBlock_InsertChar(
     {
         tblk->nLines++;
         aBlock->nLines++;
+
+        /*--------------------------------------------------------------------*/
+        /* Adjust subsequent blocks (after this block).                       */
+        /*--------------------------------------------------------------------*/
+        for (aBlock = aBlock->nextBlock; aBlock != NULL; 
+             aBlock = aBlock->nextBlock)
+        {
+            aBlock->firstLineNo++;
+        }
     }
     // printf("neuik_TextBlock_InsertChar(): [%u:%u] `%s`\n", 
     //  lineNo, byteNo, aBlock->data);
@@ -2211,57 +2474,22 @@ int neuik_TextBlock_InsertText(
     /* Count the number of (`\r`,`\n`, and `\r\n`) combos in the text and add */
     /* in the extra required space for line terminating `\0` chars.           */
     /*------------------------------------------------------------------------*/
-    if (textLen > 1)
+    for (charCtr = 0; charCtr < textLen; charCtr++)
     {
-        for (charCtr = 1; charCtr < textLen; charCtr++)
-        {
-            if (text[charCtr-1] == '\r' && text[charCtr-1] == '\n')
-            {
-                /*------------------------------------------------------------*/
-                /* This is a CR-LF line ending (m$-windows-style)             */
-                /*------------------------------------------------------------*/
-                lineCtr++;
-                charCtr++;
-                posCtr = 0;
-            }
-            else if (text[charCtr-1] == '\r')
-            {
-                /*------------------------------------------------------------*/
-                /* This is a CR line ending (macos-style)                     */
-                /*------------------------------------------------------------*/
-                lineCtr++;
-                posCtr = 0;
-            }
-            else if (text[charCtr-1] == '\n')
-            {
-                /*------------------------------------------------------------*/
-                /* This is a LF line ending (linux-style)                     */
-                /*------------------------------------------------------------*/
-                lineCtr++;
-                posCtr = 0;
-            }
-            else
-            {
-                posCtr++;
-            }
-        }
-        if (text[charCtr] == '\r' || text[charCtr] == '\n')
+        if (text[charCtr] == '\r' && text[charCtr+1] == '\n')
         {
             /*----------------------------------------------------------------*/
-            /* This would be a final single character trailing newline        */
+            /* This is a CR-LF line ending (m$-windows-style)                 */
             /*----------------------------------------------------------------*/
             lineCtr++;
+            charCtr++;
             posCtr = 0;
         }
-        else
-        {
-            posCtr++;
-        }
-    }
-    else if (textLen == 1)
-    {
-        if (text[0] == '\n' || text[0] == '\r')
+        else if (text[charCtr] == '\r' || text[charCtr] == '\n')
         {
+            /*----------------------------------------------------------------*/
+            /* This is a CR (macos-style) or LF (linux-style) line ending     */
+            /*----------------------------------------------------------------*/
             lineCtr++;
             posCtr = 0;
         }
@@ -2352,6 +2580,22 @@ int neuik_TextBlock_InsertText(
                 aBlock->nLines++;
             }
         }
+
+        /*--------------------------------------------------------------------*/
+        /* Adjust subsequent blocks (after this block).                       */
+        /*--------------------------------------------------------------------*/
+        if (lineCtr > 0)
+        {
+            for (aBlock = aBlock->nextBlock; aBlock != NULL; 
+                 aBlock = aBlock->nextBlock)
+            {
+                aBlock->firstLineNo += lineCtr;
+            }
+        }
+
+        neuik_TextBlockJournal_Record__noErrChecks(tblk, 
+            NEUIK_JOURNAL_INSERT, 0, lineNo, linePos, lineNo + lineCtr, 
+            (lineCtr > 0) ? posCtr : linePos + posCtr, text, textLen);
     }
     else
     {
@@ -2368,6 +2612,7 @@ int neuik_TextBlock_InsertText(
     }
     else
     {
+        *finalLineNo  = lineNo;
         *finalLinePos = linePos + posCtr;
     }
 out:
@@ -2460,6 +2705,20 @@ int neuik_TextBlock_DeleteChar(
             tblk->nLines--;
             aBlock->nLines--;
         }
+
+        if (remChar == '\0' || remChar == '\n' || remChar == '\r')
+        {
+            /*----------------------------------------------------------------*/
+            /* A partial line ending can't be reinserted; drop the history.   */
+            /*----------------------------------------------------------------*/
+            neuik_TextBlock_ClearJournal(tblk);
+        }
+        else
+        {
+            neuik_TextBlockJournal_Record__noErrChecks(tblk, 
+                NEUIK_JOURNAL_DELETE, 1, lineNo, byteNo, lineNo, byteNo + 1,
+                &remChar, 1);
+        }
     }
     // printf("neuik_TextBlock_InsertChar(): [%u:%u] `%s`\n", 
     //  lineNo, byteNo, aBlock->data);
@@ -2547,6 +2806,15 @@ int neuik_TextBlock_MergeLines(
         /* both within the same data block.                                   */
         /*--------------------------------------------------------------------*/
         aBlock = startBlock;
+
+        /*--------------------------------------------------------------------*/
+        /* The removed line ending lies between the end of the first line and */
+        /* the `\0` which terminates it.                                      */
+        /*--------------------------------------------------------------------*/
+        neuik_TextBlockJournal_Record__noErrChecks(tblk, 
+            NEUIK_JOURNAL_DELETE, 0, lineNo, lineLen, lineNo + 1, 0,
+            aBlock->data + position, position2 - position - 1);
+
         for (;position2 < aBlock->bytesInUse;)
         {
             aBlock->data[position] = aBlock->data[position2];
@@ -2554,6 +2822,7 @@ int neuik_TextBlock_MergeLines(
             position2++;
         }
         aBlock->bytesInUse -= (position2 - position);
+        aBlock->data[aBlock->bytesInUse] = '\0';
         aBlock->nLines--;
         tblk->nLines--;
     }
@@ -2610,6 +2879,7 @@ int neuik_TextBlock_DeleteSection(
     size_t                startPosition;
     size_t                endPosition;
     char                  remChar;
+    char                * secData    = NULL; /* copy of the deleted text */
     int                   zeroCtr;        /* counter for zeroing out trailing values */
     int                   nLineMod   = 0; /* modifier for number of lines */
     int                   eNum       = 0; /* which error to report (if any) */
@@ -2620,6 +2890,7 @@ int neuik_TextBlock_DeleteSection(
         "Argument `startLineNo` has value in excess of line length.",  // [3]
         "Argument `endLineNo` has value in excess of line length.",    // [4]
         "Fundamental error in basic function `GetPositionInLine`.",    // [5]
+        "Failure in function `neuik_TextBlock_GetSection`.",           // [6]
     };
 
     if (tblk == NULL)
@@ -2666,6 +2937,21 @@ int neuik_TextBlock_DeleteSection(
         goto out;
     }
 
+    /*------------------------------------------------------------------------*/
+    /* Keep a copy of the text being deleted so that it may be restored.      */
+    /*------------------------------------------------------------------------*/
+    if (neuik_TextBlockJournal_IsRecording__noErrChecks(tblk) &&
+        (endLineNo > startLineNo || 
+         (endLineNo == startLineNo && endLinePos > startLinePos)))
+    {
+        if (neuik_TextBlock_GetSection(tblk, 
+            startLineNo, startLinePos, endLineNo, endLinePos, &secData))
+        {
+            eNum = 6;
+            goto out;
+        }
+    }
+
     if (startBlock == endBlock)
     {
         /*--------------------------------------------------------------------*/
@@ -2710,7 +2996,7 @@ int neuik_TextBlock_DeleteSection(
             tblk->nLines++;
             nLineMod++;
             startBlock->nLines++;
-            startBlock->bytesInUse = startPosition;
+            startBlock->bytesInUse = startPosition + 1; /* keep final `\0` */
 
             for (zeroCtr = startPosition; 
                  zeroCtr <= startBlock->bytesAllocated; 
@@ -2924,6 +3210,16 @@ int neuik_TextBlock_DeleteSection(
         aBlock = aBlock->nextBlock;
     }
 out:
+    if (secData != NULL)
+    {
+        if (eNum == 0)
+        {
+            neuik_TextBlockJournal_Record__noErrChecks(tblk, 
+                NEUIK_JOURNAL_DELETE, 0, startLineNo, startLinePos, 
+                endLineNo, endLinePos, secData, strlen(secData));
+        }
+        free(secData);
+    }
     if (eNum > 0)
     {
         NEUIK_RaiseError(funcName, errMsgs[eNum]);
@@ -3012,6 +3308,11 @@ int neuik_TextBlock_ReplaceChar(
         /*--------------------------------------------------------------------*/
         aBlock->data[position] = newChar;
 
+        /*--------------------------------------------------------------------*/
+        /* Replacements aren't journaled; older records would no longer apply */
+        /*--------------------------------------------------------------------*/
+        neuik_TextBlock_ClearJournal(tblk);
+
         if (newChar == '\n')
         {
             /*----------------------------------------------------------------*/
@@ -0,0 +1,527 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "neuik_TextBlockBuilder.h"
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlockBuilder_NewBlock
+ *
+ *  Description:   Allocate an empty TextBlockData which can hold `size` bytes.
+ *
+ *  Returns:       The new block; NULL if memory could not be allocated.
+ *
+ ******************************************************************************/
+static neuik_TextBlockData * neuik_TextBlockBuilder_NewBlock(
+    size_t size)
+{
+    neuik_TextBlockData * data = NULL;
+
+    data = (neuik_TextBlockData*) malloc(sizeof(neuik_TextBlockData));
+    if (data == NULL)
+    {
+        return NULL;
+    }
+    data->data = (char*) malloc((size+1)*sizeof(char));
+    if (data->data == NULL)
+    {
+        free(data);
+        return NULL;
+    }
+    data->firstLineNo    = 0;
+    data->nLines         = 0;
+    data->bytesInUse     = 0;
+    data->bytesAllocated = size;
+    data->previousBlock  = NULL;
+    data->nextBlock      = NULL;
+    data->data[0]        = '\0';
+    data->data[size]     = '\0';
+
+    return data;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_NewTextBlockBuilder
+ *
+ *  Description:   Allocate a TextBlockBuilder. Blocks are filled to within
+ *                 `overProvisionPct` percent of `blockSize` so that they have
+ *                 room for later edits.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_NewTextBlockBuilder(
+    neuik_TextBlockBuilder ** bldPtr,
+    size_t                    blockSize,
+    unsigned int              overProvisionPct)
+{
+    neuik_TextBlockBuilder * bld = NULL;
+
+    if (bldPtr == NULL || blockSize < 2 || overProvisionPct > 99)
+    {
+        return 1;
+    }
+
+    bld = (neuik_TextBlockBuilder*) malloc(sizeof(neuik_TextBlockBuilder));
+    *bldPtr = bld;
+    if (bld == NULL)
+    {
+        return 1;
+    }
+    bld->blockSize  = blockSize;
+    bld->fillLimit  = (blockSize*(100 - overProvisionPct))/100;
+    bld->lineStart  = 0;
+    bld->pendingCR  = 0;
+    bld->firstBlock = NULL;
+    bld->lastBlock  = NULL;
+    if (bld->fillLimit < 1)
+    {
+        bld->fillLimit = 1;
+    }
+
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlockBuilder_FreeBlocks
+ *
+ *  Description:   Free a chain of TextBlockData blocks.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+void neuik_TextBlockBuilder_FreeBlocks(
+    neuik_TextBlockData * first)
+{
+    neuik_TextBlockData * next = NULL;
+
+    for (; first != NULL; first = next)
+    {
+        next = first->nextBlock;
+        if (first->data != NULL) free(first->data);
+        free(first);
+    }
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlockBuilder_Free
+ *
+ *  Description:   Free a TextBlockBuilder along with any blocks it still holds.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+void neuik_TextBlockBuilder_Free(
+    neuik_TextBlockBuilder * bld)
+{
+    if (bld == NULL)
+    {
+        return;
+    }
+    neuik_TextBlockBuilder_FreeBlocks(bld->firstBlock);
+    free(bld);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlockBuilder_Reserve
+ *
+ *  Description:   Make sure that the final block has room for `nBytes` more
+ *                 bytes of the line currently being built. Once a block is
+ *                 filled, the unterminated line is moved to a new block so
+ *                 that every built block begins at the start of a line. A
+ *                 single line which is larger than a block gets a block of
+ *                 its own which is grown as needed.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_TextBlockBuilder_Reserve(
+    neuik_TextBlockBuilder * bld,
+    size_t                   nBytes)
+{
+    size_t                partLen  = 0;
+    size_t                newSize  = 0;
+    size_t                needed   = 0;
+    char                * newData  = NULL;
+    neuik_TextBlockData * aBlock   = NULL;
+    neuik_TextBlockData * newBlock = NULL;
+
+    aBlock = bld->lastBlock;
+    if (aBlock == NULL)
+    {
+        newSize = bld->blockSize;
+        if (nBytes >= newSize)
+        {
+            newSize = nBytes + nBytes/2;
+        }
+        aBlock = neuik_TextBlockBuilder_NewBlock(newSize);
+        if (aBlock == NULL)
+        {
+            return 1;
+        }
+        bld->firstBlock = aBlock;
+        bld->lastBlock  = aBlock;
+        bld->lineStart  = 0;
+        return 0;
+    }
+
+    needed = aBlock->bytesInUse + nBytes;
+    if (needed <= bld->fillLimit && needed < aBlock->bytesAllocated)
+    {
+        return 0;
+    }
+
+    if (bld->lineStart > 0)
+    {
+        /*--------------------------------------------------------------------*/
+        /* This block holds complete lines; move the unterminated line (if    */
+        /* any) over to a new block.                                          */
+        /*--------------------------------------------------------------------*/
+        partLen = aBlock->bytesInUse - bld->lineStart;
+        newSize = bld->blockSize;
+        if (partLen + nBytes >= newSize)
+        {
+            newSize = partLen + nBytes + (partLen + nBytes)/2;
+        }
+        newBlock = neuik_TextBlockBuilder_NewBlock(newSize);
+        if (newBlock == NULL)
+        {
+            return 1;
+        }
+        memcpy(newBlock->data, aBlock->data + bld->lineStart, partLen);
+        newBlock->bytesInUse    = partLen;
+        newBlock->previousBlock = aBlock;
+        aBlock->bytesInUse      = bld->lineStart;
+        aBlock->nextBlock       = newBlock;
+        bld->lastBlock          = newBlock;
+        bld->lineStart          = 0;
+        return 0;
+    }
+
+    if (needed >= aBlock->bytesAllocated)
+    {
+        /*--------------------------------------------------------------------*/
+        /* The line being built is larger than a block; grow its block.       */
+        /*--------------------------------------------------------------------*/
+        newSize = needed + needed/2;
+        newData = (char*) realloc(aBlock->data, (newSize+1)*sizeof(char));
+        if (newData == NULL)
+        {
+            return 1;
+        }
+        aBlock->data           = newData;
+        aBlock->bytesAllocated = newSize;
+        aBlock->data[newSize]  = '\0';
+    }
+
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlockBuilder_AddText
+ *
+ *  Description:   Add a run of text (containing no line endings) to the line
+ *                 currently being built. Stray `\0` bytes are stored as spaces
+ *                 since a `\0` marks the end of a line within a block.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_TextBlockBuilder_AddText(
+    neuik_TextBlockBuilder * bld,
+    const char             * text,
+    size_t                   textLen)
+{
+    char * dst = NULL;
+    char * nul = NULL;
+    char * end = NULL;
+
+    if (textLen == 0)
+    {
+        return 0;
+    }
+    if (neuik_TextBlockBuilder_Reserve(bld, textLen))
+    {
+        return 1;
+    }
+
+    dst = bld->lastBlock->data + bld->lastBlock->bytesInUse;
+    end = dst + textLen;
+    memcpy(dst, text, textLen);
+    for (nul = memchr(dst, '\0', textLen); nul != NULL;
+         nul = memchr(nul, '\0', end - nul))
+    {
+        *nul++ = ' ';
+    }
+    bld->lastBlock->bytesInUse += textLen;
+
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlockBuilder_EndLine
+ *
+ *  Description:   Terminate the line currently being built with the specified
+ *                 line ending (which may be empty for the final line).
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_TextBlockBuilder_EndLine(
+    neuik_TextBlockBuilder * bld,
+    const char             * lineEnd,
+    size_t                   lineEndLen)
+{
+    neuik_TextBlockData * aBlock = NULL;
+
+    if (neuik_TextBlockBuilder_Reserve(bld, lineEndLen + 1))
+    {
+        return 1;
+    }
+
+    aBlock = bld->lastBlock;
+    memcpy(aBlock->data + aBlock->bytesInUse, lineEnd, lineEndLen);
+    aBlock->bytesInUse += lineEndLen;
+    aBlock->data[aBlock->bytesInUse++] = '\0';
+    aBlock->nLines++;
+    bld->lineStart = aBlock->bytesInUse;
+
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlockBuilder_Feed
+ *
+ *  Description:   Index the next chunk of text into the builder. Line endings
+ *                 (`\n`, `\r\n` and `\r`) are located with memchr; chunks
+ *                 without a `\r` skip looking for one entirely.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextBlockBuilder_Feed(
+    neuik_TextBlockBuilder * bld,
+    const char             * chunk,
+    size_t                   chunkLen)
+{
+    const char * pos    = NULL;
+    const char * end    = NULL;
+    const char * nextLF = NULL;
+    const char * nextCR = NULL;
+    const char * eol    = NULL;
+
+    if (bld == NULL || (chunk == NULL && chunkLen > 0))
+    {
+        return 1;
+    }
+    if (chunkLen == 0)
+    {
+        return 0;
+    }
+    pos = chunk;
+    end = chunk + chunkLen;
+
+    if (bld->pendingCR)
+    {
+        /*--------------------------------------------------------------------*/
+        /* The previous chunk ended with a `\r`; see if this is a CR-LF.      */
+        /*--------------------------------------------------------------------*/
+        bld->pendingCR = 0;
+        if (*pos == '\n')
+        {
+            pos++;
+            if (neuik_TextBlockBuilder_EndLine(bld, "\r\n", 2)) return 1;
+        }
+        else
+        {
+            if (neuik_TextBlockBuilder_EndLine(bld, "\r", 1)) return 1;
+        }
+    }
+
+    nextLF = memchr(pos, '\n', end - pos);
+    nextCR = memchr(pos, '\r', end - pos);
+    for (;;)
+    {
+        if (nextLF != NULL && nextLF < pos)
+        {
+            nextLF = memchr(pos, '\n', end - pos);
+        }
+        if (nextCR != NULL && nextCR < pos)
+        {
+            nextCR = memchr(pos, '\r', end - pos);
+        }
+
+        eol = nextLF;
+        if (nextCR != NULL && (eol == NULL || nextCR < eol))
+        {
+            eol = nextCR;
+        }
+        if (eol == NULL)
+        {
+            /*----------------------------------------------------------------*/
+            /* The rest of this chunk is part of an unterminated line.        */
+            /*----------------------------------------------------------------*/
+            return neuik_TextBlockBuilder_AddText(bld, pos, end - pos);
+        }
+
+        if (neuik_TextBlockBuilder_AddText(bld, pos, eol - pos))
+        {
+            return 1;
+        }
+        pos = eol + 1;
+
+        if (*eol == '\n')
+        {
+            if (neuik_TextBlockBuilder_EndLine(bld, "\n", 1)) return 1;
+        }
+        else if (pos == end)
+        {
+            /*----------------------------------------------------------------*/
+            /* A `\r` at the end of the chunk may be the start of a CR-LF.    */
+            /*----------------------------------------------------------------*/
+            bld->pendingCR = 1;
+            return 0;
+        }
+        else if (*pos == '\n')
+        {
+            pos++;
+            if (neuik_TextBlockBuilder_EndLine(bld, "\r\n", 2)) return 1;
+        }
+        else
+        {
+            if (neuik_TextBlockBuilder_EndLine(bld, "\r", 1)) return 1;
+        }
+
+        if (pos == end)
+        {
+            return 0;
+        }
+    }
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlockBuilder_Finish
+ *
+ *  Description:   Terminate the final line of the text. This is done even if
+ *                 the final line is empty, matching neuik_TextBlock_SetText.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextBlockBuilder_Finish(
+    neuik_TextBlockBuilder * bld)
+{
+    if (bld == NULL)
+    {
+        return 1;
+    }
+    if (bld->pendingCR)
+    {
+        bld->pendingCR = 0;
+        if (neuik_TextBlockBuilder_EndLine(bld, "\r", 1)) return 1;
+    }
+    return neuik_TextBlockBuilder_EndLine(bld, "", 0);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlockBuilder_TakeBlocks
+ *
+ *  Description:   Detach the chain of blocks holding completed lines from the
+ *                 builder. If the final block also holds the start of an
+ *                 unterminated line, that part is moved to a new block which
+ *                 the builder keeps.
+ *
+ *  Returns:       The first detached block; NULL if there are no completed
+ *                 lines (or if memory could not be allocated).
+ *
+ ******************************************************************************/
+neuik_TextBlockData * neuik_TextBlockBuilder_TakeBlocks(
+    neuik_TextBlockBuilder * bld)
+{
+    size_t                partLen  = 0;
+    size_t                newSize  = 0;
+    neuik_TextBlockData * first    = NULL;
+    neuik_TextBlockData * aBlock   = NULL;
+    neuik_TextBlockData * newBlock = NULL;
+
+    if (bld == NULL || bld->lastBlock == NULL)
+    {
+        return NULL;
+    }
+    first  = bld->firstBlock;
+    aBlock = bld->lastBlock;
+
+    if (bld->lineStart == 0)
+    {
+        /*--------------------------------------------------------------------*/
+        /* The final block only holds (part of) an unterminated line.         */
+        /*--------------------------------------------------------------------*/
+        if (aBlock == first)
+        {
+            return NULL;
+        }
+        bld->firstBlock = aBlock;
+        aBlock = aBlock->previousBlock;
+        aBlock->nextBlock = NULL;
+        bld->firstBlock->previousBlock = NULL;
+        return first;
+    }
+
+    partLen = aBlock->bytesInUse - bld->lineStart;
+    if (partLen > 0)
+    {
+        newSize = bld->blockSize;
+        if (partLen >= newSize)
+        {
+            newSize = partLen + partLen/2;
+        }
+        newBlock = neuik_TextBlockBuilder_NewBlock(newSize);
+        if (newBlock == NULL)
+        {
+            return NULL;
+        }
+        memcpy(newBlock->data, aBlock->data + bld->lineStart, partLen);
+        newBlock->bytesInUse = partLen;
+        aBlock->bytesInUse   = bld->lineStart;
+    }
+
+    bld->firstBlock = newBlock;
+    bld->lastBlock  = newBlock;
+    bld->lineStart  = 0;
+
+    return first;
+}
@@ -0,0 +1,784 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "NEUIK_error.h"
+#include "neuik_TextBlock.h"
+#include "neuik_TextBlockJournal.h"
+
+static const size_t DefaultJournalBudget  = 1048576; /* 1 MiB */
+static const size_t DefaultJournalRecords = 64;
+static const size_t MaxRunLength          = 256; /* longest coalesced run */
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlockJournal_GetRecord
+ *
+ *  Description:   Get the record at position `index` (0 = oldest) of the ring.
+ *
+ *  Returns:       A pointer to the record.
+ *
+ ******************************************************************************/
+static neuik_TextBlockJournalRecord * neuik_TextBlockJournal_GetRecord(
+    neuik_TextBlockJournal * journal,
+    size_t                   index)
+{
+    return &journal->records[(journal->first + index) % journal->nAllocated];
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlockJournal_ReleaseRecord
+ *
+ *  Description:   Free the text held by a record and remove it from the count
+ *                 of bytes in use.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+static void neuik_TextBlockJournal_ReleaseRecord(
+    neuik_TextBlockJournal       * journal,
+    neuik_TextBlockJournalRecord * rec)
+{
+    journal->bytesInUse -= 
+        rec->textAlloc + sizeof(neuik_TextBlockJournalRecord);
+    if (rec->text != NULL) free(rec->text);
+    rec->text      = NULL;
+    rec->textLen   = 0;
+    rec->textAlloc = 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlockJournal_DropRedo
+ *
+ *  Description:   Discard all of the undone records; a new edit makes them
+ *                 unreachable.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+static void neuik_TextBlockJournal_DropRedo(
+    neuik_TextBlockJournal * journal)
+{
+    size_t ctr;
+
+    for (ctr = 0; ctr < journal->nRedo; ctr++)
+    {
+        neuik_TextBlockJournal_ReleaseRecord(journal, 
+            neuik_TextBlockJournal_GetRecord(journal, journal->nUndo + ctr));
+    }
+    journal->nRedo = 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlockJournal_DropOldest
+ *
+ *  Description:   Discard the oldest steps (a record along with any records
+ *                 grouped with it) until the journal is within its byte budget.
+ *
+ *                 The newest step is never dropped, even if it alone exceeds
+ *                 the budget; it may be a group which is still open or a run
+ *                 which is still being extended.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+static void neuik_TextBlockJournal_DropOldest(
+    neuik_TextBlockJournal * journal)
+{
+    size_t ctr;
+    size_t stepLen;
+
+    while (journal->bytesInUse > journal->byteBudget)
+    {
+        stepLen = 1;
+        while (stepLen < journal->nUndo && 
+            neuik_TextBlockJournal_GetRecord(journal, stepLen)->joinPrev)
+        {
+            stepLen++;
+        }
+        if (stepLen >= journal->nUndo)
+        {
+            break;
+        }
+
+        for (ctr = 0; ctr < stepLen; ctr++)
+        {
+            neuik_TextBlockJournal_ReleaseRecord(journal, 
+                neuik_TextBlockJournal_GetRecord(journal, 0));
+            journal->first = (journal->first + 1) % journal->nAllocated;
+            journal->nUndo--;
+        }
+    }
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlockJournal_Reset
+ *
+ *  Description:   Discard every record held by the journal.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+static void neuik_TextBlockJournal_Reset(
+    neuik_TextBlockJournal * journal)
+{
+    neuik_TextBlockJournal_DropRedo(journal);
+    while (journal->nUndo > 0)
+    {
+        neuik_TextBlockJournal_ReleaseRecord(journal, 
+            neuik_TextBlockJournal_GetRecord(journal, 0));
+        journal->first = (journal->first + 1) % journal->nAllocated;
+        journal->nUndo--;
+    }
+    journal->first        = 0;
+    journal->groupStarted = 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlockJournal_Free
+ *
+ *  Description:   Free a journal along with all of its records.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+void neuik_TextBlockJournal_Free(
+    neuik_TextBlockJournal * journal)
+{
+    if (journal == NULL) return;
+
+    neuik_TextBlockJournal_Reset(journal);
+    if (journal->records != NULL) free(journal->records);
+    free(journal);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlock_EnableJournal
+ *
+ *  Description:   Start recording the edits made to a TextBlock so that they
+ *                 may be undone. Once the records exceed `byteBudget` bytes the
+ *                 oldest are dropped. If the journal is already enabled, only
+ *                 its budget is updated.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextBlock_EnableJournal(
+    neuik_TextBlock * tblk,
+    size_t            byteBudget)
+{
+    neuik_TextBlockJournal * journal    = NULL;
+    int                      eNum       = 0; /* which error to report (if any) */
+    static char              funcName[] = "neuik_TextBlock_EnableJournal";
+    static char            * errMsgs[]  = {"", // [0] no error
+        "Argument `tblk` is NULL.",    // [1]
+        "Failure to allocate memory.", // [2]
+    };
+
+    if (tblk == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (byteBudget == 0)
+    {
+        byteBudget = DefaultJournalBudget;
+    }
+
+    journal = (neuik_TextBlockJournal*)(tblk->journal);
+    if (journal != NULL)
+    {
+        journal->byteBudget = byteBudget;
+        neuik_TextBlockJournal_DropOldest(journal);
+        goto out;
+    }
+
+    journal = (neuik_TextBlockJournal*) malloc(sizeof(neuik_TextBlockJournal));
+    if (journal == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    journal->records = (neuik_TextBlockJournalRecord*) malloc(
+        DefaultJournalRecords*sizeof(neuik_TextBlockJournalRecord));
+    if (journal->records == NULL)
+    {
+        free(journal);
+        eNum = 2;
+        goto out;
+    }
+    journal->nAllocated   = DefaultJournalRecords;
+    journal->first        = 0;
+    journal->nUndo        = 0;
+    journal->nRedo        = 0;
+    journal->bytesInUse   = 0;
+    journal->byteBudget   = byteBudget;
+    journal->replaying    = 0;
+    journal->groupDepth   = 0;
+    journal->groupStarted = 0;
+
+    tblk->journal = journal;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlock_ClearJournal
+ *
+ *  Description:   Forget all of the recorded edits. This is required whenever
+ *                 the contents are changed without being journaled (e.g.,
+ *                 SetText), since the old records would no longer apply.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextBlock_ClearJournal(
+    neuik_TextBlock * tblk)
+{
+    int           eNum       = 0; /* which error to report (if any) */
+    static char   funcName[] = "neuik_TextBlock_ClearJournal";
+    static char * errMsgs[]  = {"", // [0] no error
+        "Argument `tblk` is NULL.", // [1]
+    };
+
+    if (tblk == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (tblk->journal != NULL)
+    {
+        neuik_TextBlockJournal_Reset((neuik_TextBlockJournal*)(tblk->journal));
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlock_BeginEditGroup
+ *
+ *  Description:   Start a group of edits which are to be undone/redone as a
+ *                 single step (e.g., replacing a selection). Groups may nest;
+ *                 only the outermost group has an effect.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextBlock_BeginEditGroup(
+    neuik_TextBlock * tblk)
+{
+    neuik_TextBlockJournal * journal    = NULL;
+    int                      eNum       = 0; /* which error to report (if any) */
+    static char              funcName[] = "neuik_TextBlock_BeginEditGroup";
+    static char            * errMsgs[]  = {"", // [0] no error
+        "Argument `tblk` is NULL.", // [1]
+    };
+
+    if (tblk == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    journal = (neuik_TextBlockJournal*)(tblk->journal);
+    if (journal == NULL)
+    {
+        goto out;
+    }
+
+    if (journal->groupDepth == 0)
+    {
+        journal->groupStarted = 0;
+    }
+    journal->groupDepth++;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlock_EndEditGroup
+ *
+ *  Description:   End a group of edits started by BeginEditGroup.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextBlock_EndEditGroup(
+    neuik_TextBlock * tblk)
+{
+    neuik_TextBlockJournal       * journal    = NULL;
+    neuik_TextBlockJournalRecord * rec        = NULL;
+    int                            eNum       = 0; /* which error to report (if any) */
+    static char                    funcName[] = "neuik_TextBlock_EndEditGroup";
+    static char                  * errMsgs[]  = {"", // [0] no error
+        "Argument `tblk` is NULL.",                   // [1]
+        "Call is not matched by a `BeginEditGroup`.", // [2]
+    };
+
+    if (tblk == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    journal = (neuik_TextBlockJournal*)(tblk->journal);
+    if (journal == NULL)
+    {
+        goto out;
+    }
+    if (journal->groupDepth == 0)
+    {
+        eNum = 2;
+        goto out;
+    }
+
+    journal->groupDepth--;
+    if (journal->groupDepth == 0 && journal->groupStarted && journal->nUndo > 0)
+    {
+        /*--------------------------------------------------------------------*/
+        /* Later typing must not be folded into the last record of the group. */
+        /*--------------------------------------------------------------------*/
+        rec = neuik_TextBlockJournal_GetRecord(journal, journal->nUndo - 1);
+        rec->isRun = 0;
+    }
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Check whether edits made to a TextBlock should currently be recorded.      */
+/*                                                                            */
+/* Returns : 1 if edits are to be recorded; 0 otherwise                       */
+/*                                                                            */
+/* [noErrChecks] :                                                            */
+/*    This function does not check for NULL pointer arguments. Appropriate    */
+/*    checks should be done externally before calling this function.          */
+/*----------------------------------------------------------------------------*/
+int neuik_TextBlockJournal_IsRecording__noErrChecks(
+    neuik_TextBlock * tblk)
+{
+    neuik_TextBlockJournal * journal = NULL;
+
+    journal = (neuik_TextBlockJournal*)(tblk->journal);
+    return (journal != NULL && !journal->replaying);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Try to fold a single character edit into the most recent record (a run of  */
+/* typing, backspacing or forward deleting within a line).                    */
+/*                                                                            */
+/* Returns : 1 if the edit was folded into the last record; 0 otherwise       */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextBlockJournal_ExtendRun(
+    neuik_TextBlockJournal * journal,
+    neuik_JournalOp          op,
+    size_t                   lineNo,
+    size_t                   linePos,
+    char                     aChar)
+{
+    int                            prepend = 0;
+    char                         * text    = NULL;
+    neuik_TextBlockJournalRecord * last    = NULL;
+
+    if (journal->nUndo == 0)
+    {
+        return 0;
+    }
+    if (journal->groupDepth > 0 && !journal->groupStarted)
+    {
+        /*--------------------------------------------------------------------*/
+        /* The first edit of a group may not join a record outside of it.     */
+        /*--------------------------------------------------------------------*/
+        return 0;
+    }
+
+    last = neuik_TextBlockJournal_GetRecord(journal, journal->nUndo - 1);
+    if (!last->isRun || last->op != op || last->textLen >= MaxRunLength)
+    {
+        return 0;
+    }
+
+    if (op == NEUIK_JOURNAL_INSERT)
+    {
+        if (lineNo != last->endLineNo || linePos != last->endLinePos)
+        {
+            return 0;
+        }
+        if (aChar != ' ' && last->text[last->textLen - 1] == ' ')
+        {
+            /*----------------------------------------------------------------*/
+            /* Start a new record with each new word.                         */
+            /*----------------------------------------------------------------*/
+            return 0;
+        }
+    }
+    else if (lineNo != last->startLineNo)
+    {
+        return 0;
+    }
+    else if (linePos + 1 == last->startLinePos)
+    {
+        prepend = 1; /* backspacing */
+    }
+    else if (linePos != last->startLinePos)
+    {
+        return 0;
+    }
+
+    if (last->textLen + 1 >= last->textAlloc)
+    {
+        text = (char*) realloc(last->text, 2*last->textAlloc);
+        if (text == NULL)
+        {
+            return 0;
+        }
+        journal->bytesInUse += last->textAlloc;
+        last->text       = text;
+        last->textAlloc *= 2;
+    }
+
+    if (prepend)
+    {
+        memmove(last->text + 1, last->text, last->textLen + 1);
+        last->text[0]      = aChar;
+        last->startLinePos = linePos;
+    }
+    else
+    {
+        last->text[last->textLen]     = aChar;
+        last->text[last->textLen + 1] = '\0';
+        last->endLinePos++;
+    }
+    last->textLen++;
+
+    return 1;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Record an insertion/deletion made to a TextBlock. A single character edit  */
+/* marked `isRun` may be folded into the previous record.                     */
+/*                                                                            */
+/* Should memory for the record not be available, the journal is cleared (the */
+/* edit itself has already been made) so that no stale record can be undone.  */
+/*                                                                            */
+/* [noErrChecks] :                                                            */
+/*    This function does not check for NULL pointer arguments. Appropriate    */
+/*    checks should be done externally before calling this function.          */
+/*----------------------------------------------------------------------------*/
+void neuik_TextBlockJournal_Record__noErrChecks(
+    neuik_TextBlock * tblk,
+    neuik_JournalOp   op,
+    int               isRun,
+    size_t            startLineNo,
+    size_t            startLinePos,
+    size_t            endLineNo,
+    size_t            endLinePos,
+    const char      * text,
+    size_t            textLen)
+{
+    size_t                         ctr;
+    neuik_TextBlockJournal       * journal = NULL;
+    neuik_TextBlockJournalRecord * records = NULL;
+    neuik_TextBlockJournalRecord * rec     = NULL;
+
+    journal = (neuik_TextBlockJournal*)(tblk->journal);
+    if (journal == NULL || journal->replaying || textLen == 0)
+    {
+        return;
+    }
+    neuik_TextBlockJournal_DropRedo(journal);
+
+    if (isRun && textLen == 1 && neuik_TextBlockJournal_ExtendRun(
+        journal, op, startLineNo, startLinePos, text[0]))
+    {
+        neuik_TextBlockJournal_DropOldest(journal);
+        return;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Grow the ring (unrolling it) if every slot is in use.                  */
+    /*------------------------------------------------------------------------*/
+    if (journal->nUndo == journal->nAllocated)
+    {
+        records = (neuik_TextBlockJournalRecord*) malloc(
+            2*journal->nAllocated*sizeof(neuik_TextBlockJournalRecord));
+        if (records == NULL)
+        {
+            neuik_TextBlockJournal_Reset(journal);
+            return;
+        }
+        for (ctr = 0; ctr < journal->nUndo; ctr++)
+        {
+            records[ctr] = *neuik_TextBlockJournal_GetRecord(journal, ctr);
+        }
+        free(journal->records);
+        journal->records     = records;
+        journal->first       = 0;
+        journal->nAllocated *= 2;
+    }
+
+    rec = neuik_TextBlockJournal_GetRecord(journal, journal->nUndo);
+    rec->textAlloc = textLen + 1;
+    if (isRun && rec->textAlloc < 16)
+    {
+        rec->textAlloc = 16;
+    }
+    rec->text = (char*) malloc(rec->textAlloc);
+    if (rec->text == NULL)
+    {
+        neuik_TextBlockJournal_Reset(journal);
+        return;
+    }
+    memcpy(rec->text, text, textLen);
+    rec->text[textLen] = '\0';
+
+    rec->op           = op;
+    rec->isRun        = isRun;
+    rec->joinPrev     = (journal->groupDepth > 0 && journal->groupStarted);
+    rec->startLineNo  = startLineNo;
+    rec->startLinePos = startLinePos;
+    rec->endLineNo    = endLineNo;
+    rec->endLinePos   = endLinePos;
+    rec->textLen      = textLen;
+
+    if (journal->groupDepth > 0)
+    {
+        journal->groupStarted = 1;
+    }
+    journal->nUndo++;
+    journal->bytesInUse += 
+        rec->textAlloc + sizeof(neuik_TextBlockJournalRecord);
+
+    neuik_TextBlockJournal_DropOldest(journal);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/* Apply a record in the forward (redo) or reverse (undo) direction and get   */
+/* the position the cursor should be placed at afterwards.                    */
+/*                                                                            */
+/* Returns : 1 if the call failed; 0 if successful                            */
+/*----------------------------------------------------------------------------*/
+static int neuik_TextBlockJournal_Apply(
+    neuik_TextBlock              * tblk,
+    neuik_TextBlockJournalRecord * rec,
+    int                            reverse,
+    size_t                       * cursorLineNo,
+    size_t                       * cursorLinePos)
+{
+    if ((rec->op == NEUIK_JOURNAL_INSERT) != (reverse != 0))
+    {
+        *cursorLineNo  = rec->startLineNo;
+        *cursorLinePos = rec->startLinePos;
+        return neuik_TextBlock_InsertText(tblk, 
+            rec->startLineNo, rec->startLinePos, rec->text,
+            cursorLineNo, cursorLinePos);
+    }
+
+    *cursorLineNo  = rec->startLineNo;
+    *cursorLinePos = rec->startLinePos;
+    return neuik_TextBlock_DeleteSection(tblk, 
+        rec->startLineNo, rec->startLinePos, rec->endLineNo, rec->endLinePos);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlock_Undo
+ *
+ *  Description:   Revert the most recent edit (or group of edits). The work
+ *                 done is proportional to the size of the edit, not to that of
+ *                 the text.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextBlock_Undo(
+    neuik_TextBlock * tblk,
+    int             * done,
+    size_t          * cursorLineNo,
+    size_t          * cursorLinePos)
+{
+    neuik_TextBlockJournal       * journal    = NULL;
+    neuik_TextBlockJournalRecord * rec        = NULL;
+    int                            eNum       = 0; /* which error to report (if any) */
+    static char                    funcName[] = "neuik_TextBlock_Undo";
+    static char                  * errMsgs[]  = {"", // [0] no error
+        "Argument `tblk` is NULL.",          // [1]
+        "Output argument is NULL.",          // [2]
+        "Failed to revert a recorded edit.", // [3]
+    };
+
+    if (tblk == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (done == NULL || cursorLineNo == NULL || cursorLinePos == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    *done = 0;
+
+    journal = (neuik_TextBlockJournal*)(tblk->journal);
+    if (journal == NULL || journal->nUndo == 0)
+    {
+        goto out;
+    }
+
+    journal->replaying = 1;
+    do
+    {
+        rec = neuik_TextBlockJournal_GetRecord(journal, journal->nUndo - 1);
+        if (neuik_TextBlockJournal_Apply(
+            tblk, rec, 1, cursorLineNo, cursorLinePos))
+        {
+            journal->replaying = 0;
+            neuik_TextBlockJournal_Reset(journal);
+            eNum = 3;
+            goto out;
+        }
+        rec->isRun = 0;
+        journal->nUndo--;
+        journal->nRedo++;
+    }
+    while (rec->joinPrev && journal->nUndo > 0);
+    journal->replaying = 0;
+
+    *done = 1;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlock_Redo
+ *
+ *  Description:   Reapply the most recently undone edit (or group of edits).
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextBlock_Redo(
+    neuik_TextBlock * tblk,
+    int             * done,
+    size_t          * cursorLineNo,
+    size_t          * cursorLinePos)
+{
+    neuik_TextBlockJournal       * journal    = NULL;
+    neuik_TextBlockJournalRecord * rec        = NULL;
+    int                            eNum       = 0; /* which error to report (if any) */
+    static char                    funcName[] = "neuik_TextBlock_Redo";
+    static char                  * errMsgs[]  = {"", // [0] no error
+        "Argument `tblk` is NULL.",           // [1]
+        "Output argument is NULL.",           // [2]
+        "Failed to reapply a recorded edit.", // [3]
+    };
+
+    if (tblk == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (done == NULL || cursorLineNo == NULL || cursorLinePos == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    *done = 0;
+
+    journal = (neuik_TextBlockJournal*)(tblk->journal);
+    if (journal == NULL || journal->nRedo == 0)
+    {
+        goto out;
+    }
+
+    journal->replaying = 1;
+    do
+    {
+        rec = neuik_TextBlockJournal_GetRecord(journal, journal->nUndo);
+        if (neuik_TextBlockJournal_Apply(
+            tblk, rec, 0, cursorLineNo, cursorLinePos))
+        {
+            journal->replaying = 0;
+            neuik_TextBlockJournal_Reset(journal);
+            eNum = 3;
+            goto out;
+        }
+        journal->nUndo++;
+        journal->nRedo--;
+    }
+    while (journal->nRedo > 0 && 
+        neuik_TextBlockJournal_GetRecord(journal, journal->nUndo)->joinPrev);
+    journal->replaying = 0;
+
+    *done = 1;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+    return eNum;
+}
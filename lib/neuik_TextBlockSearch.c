@@ -0,0 +1,663 @@
+/*******************************************************************************
+ * Copyright (c) 2014-2020, Michael Leimon <leimon@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "NEUIK_error.h"
+#include "neuik_TextBlock.h"
+#include "neuik_TextBlock_internal.h"
+#include "neuik_TextBlockBuilder.h"
+#include "neuik_TextBlockJournal.h"
+#include "neuik_TextBlockSearch.h"
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlockSearch_NextBlock
+ *
+ *  Description:   Move the scan position to the start of the following block,
+ *                 carrying over the part of the current line held by the
+ *                 block being left.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+static void neuik_TextBlockSearch_NextBlock(
+    neuik_TextBlockSearch * srch)
+{
+    srch->lineBase += srch->block->bytesInUse - srch->lineStart;
+    srch->lineStart = 0;
+    srch->offset    = 0;
+    srch->block     = srch->block->nextBlock;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlockSearch_Advance
+ *
+ *  Description:   Move the scan position forward to (block, offset), counting
+ *                 the line terminators (`\0`) which are passed over.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+static void neuik_TextBlockSearch_Advance(
+    neuik_TextBlockSearch * srch,
+    neuik_TextBlockData   * block,
+    size_t                  offset)
+{
+    size_t       stop = 0;
+    const char * data = NULL;
+    const char * nul  = NULL;
+
+    for (;;)
+    {
+        stop = srch->block->bytesInUse;
+        if (srch->block == block)
+        {
+            stop = offset;
+        }
+
+        data = srch->block->data;
+        for (;;)
+        {
+            nul = memchr(data + srch->offset, '\0', stop - srch->offset);
+            if (nul == NULL)
+            {
+                break;
+            }
+            srch->lineNo++;
+            srch->lineStart = (nul - data) + 1;
+            srch->lineBase  = 0;
+            srch->offset    = srch->lineStart;
+        }
+        srch->offset = stop;
+
+        if (srch->block == block)
+        {
+            return;
+        }
+        neuik_TextBlockSearch_NextBlock(srch);
+    }
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlockSearch_MatchAt
+ *
+ *  Description:   Check whether the needle occurs at (block, offset). The `\0`
+ *                 which follows each line ending is skipped over, so a needle
+ *                 may contain line endings; matches may continue into the
+ *                 following blocks. A match which ends with a line ending
+ *                 ends at the start of the following line.
+ *
+ *  Returns:       1 if the needle matches (and sets the end position); 0 if
+ *                 it does not.
+ *
+ ******************************************************************************/
+static int neuik_TextBlockSearch_MatchAt(
+    const neuik_TextBlockSearch  * srch,
+    neuik_TextBlockData          * block,
+    size_t                         offset,
+    neuik_TextBlockData         ** endBlock,
+    size_t                       * endOffset)
+{
+    size_t       n      = 0;
+    size_t       nLeft  = 0;
+    const char * data   = NULL;
+    const char * nul    = NULL;
+    const char * needle = NULL;
+
+    needle = srch->needle;
+    nLeft  = srch->needleLen;
+    while (nLeft > 0)
+    {
+        if (offset >= block->bytesInUse)
+        {
+            block  = block->nextBlock;
+            offset = 0;
+            if (block == NULL)
+            {
+                return 0;
+            }
+            continue;
+        }
+
+        data = block->data + offset;
+        if (*data == '\0')
+        {
+            offset++;
+            continue;
+        }
+
+        n = block->bytesInUse - offset;
+        if (n > nLeft)
+        {
+            n = nLeft;
+        }
+        nul = memchr(data, '\0', n);
+        if (nul != NULL)
+        {
+            n = nul - data;
+        }
+        if (memcmp(data, needle, n) != 0)
+        {
+            return 0;
+        }
+        offset += n;
+        needle += n;
+        nLeft  -= n;
+    }
+
+    if (needle[-1] == '\n' || needle[-1] == '\r')
+    {
+        /*--------------------------------------------------------------------*/
+        /* Step over the terminator of the line ended by the match.           */
+        /*--------------------------------------------------------------------*/
+        while (block != NULL && offset >= block->bytesInUse &&
+               block->nextBlock != NULL)
+        {
+            block  = block->nextBlock;
+            offset = 0;
+        }
+        if (offset < block->bytesInUse && block->data[offset] == '\0')
+        {
+            offset++;
+        }
+    }
+
+    *endBlock  = block;
+    *endOffset = offset;
+    return 1;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlockSearch_NextMatch
+ *
+ *  Description:   Find the next match at or after the scan position. Blocks
+ *                 are scanned for the first byte of the needle with memchr,
+ *                 and only those candidates are compared against the whole
+ *                 needle. On a match the scan position is left at the start
+ *                 of the match.
+ *
+ *  Returns:       1 if a match was found; 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_TextBlockSearch_NextMatch(
+    neuik_TextBlockSearch  * srch,
+    neuik_TextBlockData   ** endBlock,
+    size_t                 * endOffset)
+{
+    char                  first = '\0';
+    const char          * hit   = NULL;
+    neuik_TextBlockData * block = NULL;
+
+    first = srch->needle[0];
+    while (srch->block != NULL)
+    {
+        block = srch->block;
+        if (srch->offset >= block->bytesInUse)
+        {
+            neuik_TextBlockSearch_NextBlock(srch);
+            continue;
+        }
+
+        hit = memchr(block->data + srch->offset, first, 
+            block->bytesInUse - srch->offset);
+        if (hit == NULL)
+        {
+            neuik_TextBlockSearch_Advance(srch, block, block->bytesInUse);
+            neuik_TextBlockSearch_NextBlock(srch);
+            continue;
+        }
+
+        neuik_TextBlockSearch_Advance(srch, block, hit - block->data);
+        if (neuik_TextBlockSearch_MatchAt(srch, block, srch->offset, 
+            endBlock, endOffset))
+        {
+            return 1;
+        }
+        srch->offset++;
+    }
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlock_SearchBegin
+ *
+ *  Description:   Start a search of a TextBlock for the specified text,
+ *                 beginning at the specified line and position.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextBlock_SearchBegin(
+    neuik_TextBlock        * tblk,
+    const char             * needle,
+    size_t                   startLineNo,
+    size_t                   startLinePos,
+    neuik_TextBlockSearch ** srchPtr)
+{
+    int                     hasLine    = 0;
+    size_t                  n          = 0;
+    size_t                  nLeft      = 0;
+    neuik_TextBlockData   * block      = NULL;
+    neuik_TextBlockSearch * srch       = NULL;
+    int                     eNum       = 0; /* which error to report (if any) */
+    static char             funcName[] = "neuik_TextBlock_SearchBegin";
+    static char           * errMsgs[]  = {"", // [0] no error
+        "Argument `tblk` is NULL.",                               // [1]
+        "Argument `needle` is NULL or empty.",                    // [2]
+        "Output argument `srchPtr` is NULL.",                     // [3]
+        "Failure to allocate memory.",                            // [4]
+        "Argument `startLineNo` is beyond the last line.",        // [5]
+        "Failure in `neuik_TextBlock_GetPositionLineStart()`.",   // [6]
+        "Argument `startLinePos` is beyond the end of the line.", // [7]
+    };
+
+    if (tblk == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (needle == NULL || needle[0] == '\0')
+    {
+        eNum = 2;
+        goto out;
+    }
+    if (srchPtr == NULL)
+    {
+        eNum = 3;
+        goto out;
+    }
+    *srchPtr = NULL;
+
+    if (neuik_TextBlock_HasLine(tblk, startLineNo, &hasLine) || !hasLine)
+    {
+        eNum = 5;
+        goto out;
+    }
+
+    srch = (neuik_TextBlockSearch*) malloc(sizeof(neuik_TextBlockSearch));
+    if (srch == NULL)
+    {
+        eNum = 4;
+        goto out;
+    }
+    srch->needleLen = strlen(needle);
+    srch->needle    = (char*) malloc((srch->needleLen + 1)*sizeof(char));
+    if (srch->needle == NULL)
+    {
+        eNum = 4;
+        goto out;
+    }
+    memcpy(srch->needle, needle, srch->needleLen + 1);
+
+    if (neuik_TextBlock_GetPositionLineStart__noErrChecks(tblk, 
+        startLineNo, &block, &srch->offset))
+    {
+        eNum = 6;
+        goto out;
+    }
+    srch->tblk      = tblk;
+    srch->block     = block;
+    srch->lineNo    = startLineNo;
+    srch->lineStart = srch->offset;
+    srch->lineBase  = 0;
+
+    /*------------------------------------------------------------------------*/
+    /* Move along the starting line to the starting position.                 */
+    /*------------------------------------------------------------------------*/
+    for (nLeft = startLinePos; nLeft > 0;)
+    {
+        if (srch->block == NULL)
+        {
+            eNum = 7;
+            goto out;
+        }
+        if (srch->offset >= srch->block->bytesInUse)
+        {
+            neuik_TextBlockSearch_NextBlock(srch);
+            continue;
+        }
+        n = srch->block->bytesInUse - srch->offset;
+        if (n > nLeft)
+        {
+            n = nLeft;
+        }
+        if (memchr(srch->block->data + srch->offset, '\0', n) != NULL)
+        {
+            eNum = 7;
+            goto out;
+        }
+        srch->offset += n;
+        nLeft        -= n;
+    }
+
+    *srchPtr = srch;
+    srch     = NULL;
+out:
+    if (srch != NULL)
+    {
+        neuik_TextBlockSearch_Free(srch);
+    }
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlockSearch_Next
+ *
+ *  Description:   Find the next match of a search. The search continues from
+ *                 the end of this match on the following call.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextBlockSearch_Next(
+    neuik_TextBlockSearch * srch,
+    int                   * found,
+    size_t                * lineNo,
+    size_t                * linePos,
+    size_t                * endLineNo,
+    size_t                * endLinePos)
+{
+    size_t                endOffset  = 0;
+    neuik_TextBlockData * endBlock   = NULL;
+    int                   eNum       = 0; /* which error to report (if any) */
+    static char           funcName[] = "neuik_TextBlockSearch_Next";
+    static char         * errMsgs[]  = {"", // [0] no error
+        "Argument `srch` is NULL.",         // [1]
+        "Output argument `found` is NULL.", // [2]
+    };
+
+    if (srch == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (found == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+
+    *found = neuik_TextBlockSearch_NextMatch(srch, &endBlock, &endOffset);
+    if (!*found)
+    {
+        goto out;
+    }
+
+    if (lineNo  != NULL) *lineNo  = srch->lineNo;
+    if (linePos != NULL) *linePos = 
+        srch->lineBase + srch->offset - srch->lineStart;
+
+    neuik_TextBlockSearch_Advance(srch, endBlock, endOffset);
+    if (endLineNo  != NULL) *endLineNo  = srch->lineNo;
+    if (endLinePos != NULL) *endLinePos = 
+        srch->lineBase + srch->offset - srch->lineStart;
+out:
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlockSearch_Free
+ *
+ *  Description:   Free a TextBlock search.
+ *
+ *  Returns:       Nothing.
+ *
+ ******************************************************************************/
+void neuik_TextBlockSearch_Free(
+    neuik_TextBlockSearch * srch)
+{
+    if (srch == NULL)
+    {
+        return;
+    }
+    if (srch->needle != NULL) free(srch->needle);
+    free(srch);
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlock_FeedRange
+ *
+ *  Description:   Feed the text between two positions of a TextBlock to a
+ *                 TextBlockBuilder (leaving out the line terminators, which
+ *                 the builder adds back from the line endings). A NULL
+ *                 `endBlock` feeds everything up to the end of the TextBlock.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_TextBlock_FeedRange(
+    neuik_TextBlockBuilder * bld,
+    neuik_TextBlockData    * block,
+    size_t                   offset,
+    neuik_TextBlockData    * endBlock,
+    size_t                   endOffset)
+{
+    size_t       stop = 0;
+    const char * data = NULL;
+    const char * nul  = NULL;
+
+    for (; block != NULL; block = block->nextBlock, offset = 0)
+    {
+        stop = block->bytesInUse;
+        if (block == endBlock)
+        {
+            stop = endOffset;
+        }
+
+        data = block->data;
+        while (offset < stop)
+        {
+            nul = memchr(data + offset, '\0', stop - offset);
+            if (nul == NULL)
+            {
+                nul = data + stop;
+            }
+            if (neuik_TextBlockBuilder_Feed(bld, data + offset, 
+                (nul - data) - offset))
+            {
+                return 1;
+            }
+            offset = (nul - data) + 1;
+        }
+
+        if (block == endBlock)
+        {
+            break;
+        }
+    }
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_TextBlock_ReplaceAll
+ *
+ *  Description:   Replace every occurrence of `needle` with `replacement`.
+ *
+ *                 The TextBlock is rebuilt in a single pass: the text between
+ *                 matches and the replacement text are fed to a
+ *                 TextBlockBuilder, whose blocks then take the place of the
+ *                 old ones. The replacement text may contain line endings.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise.
+ *
+ ******************************************************************************/
+int neuik_TextBlock_ReplaceAll(
+    neuik_TextBlock * tblk,
+    const char      * needle,
+    const char      * replacement,
+    size_t          * nReplaced)
+{
+    size_t                   nRepl      = 0;
+    size_t                   replLen    = 0;
+    size_t                   offset     = 0;
+    size_t                   endOffset  = 0;
+    neuik_TextBlockData    * block      = NULL;
+    neuik_TextBlockData    * endBlock   = NULL;
+    neuik_TextBlockData    * oldFirst   = NULL;
+    neuik_TextBlockData    * emptyBlock = NULL;
+    neuik_TextBlockData    * newFirst   = NULL;
+    neuik_TextBlockSearch  * srch       = NULL;
+    neuik_TextBlockBuilder * bld        = NULL;
+    int                      eNum       = 0; /* which error to report (if any) */
+    static char              funcName[] = "neuik_TextBlock_ReplaceAll";
+    static char            * errMsgs[]  = {"", // [0] no error
+        "Argument `tblk` is NULL.",                            // [1]
+        "Argument `replacement` is NULL.",                     // [2]
+        "Failure in function `neuik_TextBlock_SearchBegin`.",  // [3]
+        "Failure in function `neuik_NewTextBlockBuilder`.",    // [4]
+        "Failure to build the replaced text.",                 // [5]
+        "Failure in function `neuik_NewTextBlockData`.",       // [6]
+        "Failure in function `neuik_TextBlock_AppendBlocks`.", // [7]
+        "Failure in function `neuik_TextBlock_ClearJournal`.", // [8]
+    };
+
+    if (nReplaced != NULL) *nReplaced = 0;
+    if (tblk == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    if (replacement == NULL)
+    {
+        eNum = 2;
+        goto out;
+    }
+    replLen = strlen(replacement);
+
+    if (neuik_TextBlock_SearchBegin(tblk, needle, 0, 0, &srch))
+    {
+        eNum = 3;
+        goto out;
+    }
+    if (neuik_NewTextBlockBuilder(&bld, tblk->blockSize, 
+        tblk->overProvisionPct))
+    {
+        eNum = 4;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Feed the text up to each match followed by the replacement text.       */
+    /*------------------------------------------------------------------------*/
+    block  = tblk->firstBlock;
+    offset = 0;
+    while (neuik_TextBlockSearch_NextMatch(srch, &endBlock, &endOffset))
+    {
+        if (neuik_TextBlock_FeedRange(bld, block, offset, 
+                srch->block, srch->offset) ||
+            neuik_TextBlockBuilder_Feed(bld, replacement, replLen))
+        {
+            eNum = 5;
+            goto out;
+        }
+        neuik_TextBlockSearch_Advance(srch, endBlock, endOffset);
+        block  = endBlock;
+        offset = endOffset;
+        nRepl++;
+    }
+    if (nRepl == 0)
+    {
+        goto out;
+    }
+    if (neuik_TextBlock_FeedRange(bld, block, offset, NULL, 0) ||
+        neuik_TextBlockBuilder_Finish(bld))
+    {
+        eNum = 5;
+        goto out;
+    }
+    newFirst = neuik_TextBlockBuilder_TakeBlocks(bld);
+    if (newFirst == NULL)
+    {
+        eNum = 5;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Recorded edits do not apply to the rebuilt text.                       */
+    /*------------------------------------------------------------------------*/
+    if (neuik_TextBlock_ClearJournal(tblk))
+    {
+        eNum = 8;
+        goto out;
+    }
+
+    /*------------------------------------------------------------------------*/
+    /* Swap the rebuilt blocks in for the old ones.                           */
+    /*------------------------------------------------------------------------*/
+    if (neuik_NewTextBlockData(&emptyBlock, tblk->blockSize))
+    {
+        eNum = 6;
+        goto out;
+    }
+    oldFirst = tblk->firstBlock;
+
+    tblk->firstBlock  = emptyBlock;
+    tblk->lastBlock   = emptyBlock;
+    tblk->chapters[0] = emptyBlock;
+    tblk->nDataBlocks = 1;
+    tblk->nChapters   = 1;
+    tblk->nLines      = 1;
+    tblk->length      = 0;
+    if (neuik_TextBlock_AppendBlocks(tblk, newFirst, 1))
+    {
+        eNum = 7;
+    }
+    newFirst = NULL;
+    neuik_TextBlockBuilder_FreeBlocks(oldFirst);
+
+    if (nReplaced != NULL) *nReplaced = nRepl;
+out:
+    neuik_TextBlockBuilder_FreeBlocks(newFirst);
+    neuik_TextBlockBuilder_Free(bld);
+    neuik_TextBlockSearch_Free(srch);
+    if (eNum > 0)
+    {
+        NEUIK_RaiseError(funcName, errMsgs[eNum]);
+        eNum = 1;
+    }
+
+    return eNum;
+}
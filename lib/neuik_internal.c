@@ -13,6 +13,7 @@
  * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  ******************************************************************************/
+#include <SDL.h>
 #include <string.h>
 #include <stdio.h>
 #include <signal.h>
@@ -21,9 +22,41 @@
 #include "neuik_internal.h"
 #include "NEUIK_error.h"
 
+extern SDL_atomic_t neuik__ObjectsCreated;
+
 neuik_Set   ** neuik_AllSets    = NULL;
 neuik_Class ** neuik_AllClasses = NULL;
 
+/* number of virtual function slots within each class dispatch table */
+static int neuik_VirtualFunc_nSlots = 0;
+
+/*----------------------------------------------------------------------------*/
+/* An object and all of its superclass objects are allocated as one block;    */
+/* the class object at depth `d` begins `nClass->offsets[d]` bytes into it.   */
+/*----------------------------------------------------------------------------*/
+#define NEUIK_OBJECT_ALIGN(sz) (((sz) + 15) & ~((size_t)15))
+#define NEUIK_MAX_PLACEMENTS   64
+
+#ifdef _MSC_VER
+    #define NEUIK_THREAD_LOCAL __declspec(thread)
+#else
+    #define NEUIK_THREAD_LOCAL __thread
+#endif /* _MSC_VER */
+
+/*----------------------------------------------------------------------------*/
+/* Space reserved within a block for a superclass object which has not been   */
+/* created yet. It is claimed by the New() call which fills the given slot.   */
+/*----------------------------------------------------------------------------*/
+typedef struct {
+    void        ** slot;    /* location the superclass object is stored in */
+    neuik_Class  * nClass;  /* class of the superclass object */
+    void         * address; /* reserved location within the block */
+} neuik_ObjectPlacement;
+
+static NEUIK_THREAD_LOCAL neuik_ObjectPlacement
+    neuik__Placements[NEUIK_MAX_PLACEMENTS];
+static NEUIK_THREAD_LOCAL int neuik__nPlacements = 0;
+
 neuik_FatalError neuik_Fatal = NEUIK_FATALERROR_NO_ERROR;
 
 #ifndef WIN32
@@ -235,11 +268,13 @@ int neuik_RegisterClass(
     const char             * classDescription, /* (in)  Description of the class Set */
     neuik_Set              * classSet,         /* (in)  The class set which this belongs to */
     neuik_Class            * superClass,       /* (in)  Superclass; NULL if there is none */
+    size_t                   objSize,          /* (in)  Size of the class object struct */
     neuik_Class_BaseFuncs  * baseFuncs,        /* (in)  Base function table for class support */
     void                   * classFuncs,       /* (in)  Class-specific function table */
     neuik_Class           ** newClass)         /* (out) Store a pointer to the new class */
 {
     int           ctr;
+    int           sCtr;
     size_t        sLen;
     int           eNum       = 0;
     neuik_Class * thisClass  = NULL;
@@ -383,6 +418,77 @@ int neuik_RegisterClass(
     thisClass->SuperClass = superClass;
     thisClass->baseFuncs  = baseFuncs;
 
+    /*------------------------------------------------------------------------*/
+    /* Resolve the lineage of this class once (superclasses are registered    */
+    /* before their subclasses). This allows class checks and class-object    */
+    /* lookups to index by depth rather than walk the superclass chain.       */
+    /*------------------------------------------------------------------------*/
+    thisClass->classDepth = 0;
+    if (superClass != NULL)
+    {
+        thisClass->classDepth = 1 + superClass->classDepth;
+    }
+    thisClass->lineage = (void**) malloc(
+        (1 + thisClass->classDepth)*sizeof(void*));
+    if (thisClass->lineage == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    for (sCtr = 0; sCtr < thisClass->classDepth; sCtr++)
+    {
+        thisClass->lineage[sCtr] = superClass->lineage[sCtr];
+    }
+    thisClass->lineage[thisClass->classDepth] = thisClass;
+
+    /*------------------------------------------------------------------------*/
+    /* The class object is followed by the block of its superclass, so the    */
+    /* offset of each superclass object is fixed for every object of a class. */
+    /*------------------------------------------------------------------------*/
+    thisClass->objSize   = objSize;
+    thisClass->blockSize = NEUIK_OBJECT_ALIGN(objSize);
+    if (superClass != NULL)
+    {
+        thisClass->blockSize += superClass->blockSize;
+    }
+    thisClass->offsets = (size_t*) malloc(
+        (1 + thisClass->classDepth)*sizeof(size_t));
+    if (thisClass->offsets == NULL)
+    {
+        eNum = 1;
+        goto out;
+    }
+    for (sCtr = 0; sCtr < thisClass->classDepth; sCtr++)
+    {
+        thisClass->offsets[sCtr] = 
+            NEUIK_OBJECT_ALIGN(objSize) + superClass->offsets[sCtr];
+    }
+    thisClass->offsets[thisClass->classDepth] = 0;
+
+    /*------------------------------------------------------------------------*/
+    /* A new class provides no virtual function implementations of its own;  */
+    /* its dispatch table starts out as a copy of its superclass table.       */
+    /*------------------------------------------------------------------------*/
+    thisClass->vFuncTable = NULL;
+    if (neuik_VirtualFunc_nSlots > 0)
+    {
+        thisClass->vFuncTable = (void**) malloc(
+            neuik_VirtualFunc_nSlots*sizeof(void*));
+        if (thisClass->vFuncTable == NULL)
+        {
+            eNum = 1;
+            goto out;
+        }
+        for (sCtr = 0; sCtr < neuik_VirtualFunc_nSlots; sCtr++)
+        {
+            thisClass->vFuncTable[sCtr] = NULL;
+            if (superClass != NULL)
+            {
+                thisClass->vFuncTable[sCtr] = superClass->vFuncTable[sCtr];
+            }
+        }
+    }
+
     (*newClass) = thisClass;
 out:
     if (eNum != 0)
@@ -409,6 +515,7 @@ int neuik_Object_New(
     void        ** objPtr)
 {
     int            eNum              = 0;
+    int            nPlaced           = neuik__nPlacements;
     int         (* newFunc)(void **) = NULL;
     static char    funcName[]        = "neuik_Object_New";
     static char  * errMsgs[]         = {"", // [0] no error
@@ -444,7 +551,15 @@ int neuik_Object_New(
         eNum = 4;
         goto out;
     }
+    SDL_AtomicIncRef(&neuik__ObjectsCreated);
 out:
+    /*------------------------------------------------------------------------*/
+    /* Drop any space reserved during this call which went unclaimed.         */
+    /*------------------------------------------------------------------------*/
+    if (neuik__nPlacements > nPlaced)
+    {
+        neuik__nPlacements = nPlaced;
+    }
     if (eNum != 0)
     {
         NEUIK_RaiseError(funcName, errMsgs[eNum]);
@@ -455,6 +570,100 @@ out:
 }
 
 
+/*******************************************************************************
+ *
+ *  Name:          neuik_Object_Alloc
+ *
+ *  Description:   Allocate the memory for an object of the specified class.
+ *                 This is to be used by class New() implementations in place
+ *                 of malloc().
+ *
+ *                 A single zeroed block is allocated which holds the object
+ *                 followed by each of its superclass objects. If space for
+ *                 this object was reserved within a subclass object (i.e.,
+ *                 `objPtr` is the superClassObj slot of that object), the
+ *                 reserved space is used instead.
+ *
+ *  Returns:       A pointer to the object; NULL if allocation failed.
+ *
+ ******************************************************************************/
+void * neuik_Object_Alloc(
+    neuik_Class  * objClass,
+    void        ** objPtr)
+{
+    int                     ctr;
+    int                     embedded = 0;
+    neuik_Object_Base     * objBase  = NULL;
+    neuik_ObjectPlacement * place    = NULL;
+
+    if (objClass == NULL) return NULL;
+
+    for (ctr = neuik__nPlacements - 1; ctr >= 0; ctr--)
+    {
+        place = &(neuik__Placements[ctr]);
+        if (place->slot == objPtr && place->nClass == objClass)
+        {
+            objBase  = (neuik_Object_Base*)(place->address);
+            embedded = 1;
+            /* claim it, along with anything left unclaimed above it */
+            neuik__nPlacements = ctr;
+            break;
+        }
+    }
+
+    if (objBase == NULL)
+    {
+        objBase = (neuik_Object_Base*) calloc(1, objClass->blockSize);
+        if (objBase == NULL) return NULL;
+    }
+    (objBase->object).contiguous = 1;
+    (objBase->object).embedded   = embedded;
+
+    /*------------------------------------------------------------------------*/
+    /* Reserve the space following this object for its superclass object.    */
+    /*------------------------------------------------------------------------*/
+    if (objClass->SuperClass != NULL)
+    {
+        if (neuik__nPlacements == NEUIK_MAX_PLACEMENTS)
+        {
+            /* the oldest reservations are the ones least likely claimed */
+            memmove(neuik__Placements, neuik__Placements + 1,
+                (NEUIK_MAX_PLACEMENTS - 1)*sizeof(neuik_ObjectPlacement));
+            neuik__nPlacements--;
+        }
+        place = &(neuik__Placements[neuik__nPlacements++]);
+        place->slot    = &((objBase->object).superClassObj);
+        place->nClass  = (neuik_Class*)(objClass->SuperClass);
+        place->address = (char*)(objBase) + 
+            NEUIK_OBJECT_ALIGN(objClass->objSize);
+    }
+
+    return objBase;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_Object_Release
+ *
+ *  Description:   Release the memory of an object allocated using 
+ *                 neuik_Object_Alloc(). This is to be used by class Free()
+ *                 implementations in place of free().
+ *
+ *                 Objects which reside within the block of a subclass object 
+ *                 are released along with that object.
+ *
+ ******************************************************************************/
+void neuik_Object_Release(
+    void * objPtr)
+{
+    if (objPtr == NULL) return;
+    if ((((neuik_Object_Base*)(objPtr))->object).embedded) return;
+
+    free(objPtr);
+}
+
+
 /*******************************************************************************
  *
  *  Name:          neuik_Object_Free
@@ -644,6 +853,28 @@ int neuik_Object_IsNEUIKObject_NoError(
 }
 
 
+/*******************************************************************************
+ *
+ *  Name:          neuik_Class_InLineage
+ *
+ *  Description:   Check whether a class is the same as, or a subclass of, the
+ *                 specified class. This uses the lineage resolved at class
+ *                 registration and so does not walk the superclass chain.
+ *
+ *  Returns:       1 if `objClass` implements `nClass`, 0 otherwise.
+ *
+ ******************************************************************************/
+static int neuik_Class_InLineage(
+    const neuik_Class * objClass,
+    const neuik_Class * nClass)
+{
+    if (objClass == NULL || nClass == NULL) return 0;
+    if (nClass->classDepth > objClass->classDepth) return 0;
+
+    return (objClass->lineage[nClass->classDepth] == nClass);
+}
+
+
 /*******************************************************************************
  *
  *  Name:          neuik_Object_ImplementsClass
@@ -660,7 +891,6 @@ int neuik_Object_ImplementsClass(
 {
     int                 eNum       = 2;
     int                 impClass   = 0;
-    neuik_Class       * sClass     = NULL; // superClass of a class
     neuik_Object_Base * objBase    = NULL;
     static char         funcName[] = "neuik_Object_ImplementsClass";
     static char       * errMsgs[]  = {"", // [0] no error
@@ -680,37 +910,10 @@ int neuik_Object_ImplementsClass(
     }
 
     objBase = (neuik_Object_Base*)(objPtr);
-    if ((objBase->object).nClass == nClass)
+    if (neuik_Class_InLineage((objBase->object).nClass, nClass))
     {
         impClass = 1;
         eNum     = 0;
-        goto out;
-    }
-
-    /*------------------------------------------------------------------------*/
-    /* Check if the object is of a class that has at least one SuperClass     */
-    /*------------------------------------------------------------------------*/
-    sClass = ((objBase->object).nClass)->SuperClass; // get the SuperClass of this objects class
-    if (sClass != NULL)
-    {
-        for (;;)
-        {
-            /*----------------------------------------------------------------*/
-            /* Iterate over the nested superclasses until NULL is hit         */
-            /*----------------------------------------------------------------*/
-            if (sClass == nClass)
-            {
-                impClass = 1;
-                eNum     = 0;
-                break;
-            }
-
-            /*----------------------------------------------------------------*/
-            /* change superClass pointer to point at the Super of this Class  */
-            /*----------------------------------------------------------------*/
-            sClass = sClass->SuperClass;
-            if (!sClass) break; // sClass = NULL means class has no SuperClass
-        }
     }
 out:
     if (eNum != 0)
@@ -739,50 +942,12 @@ int neuik_Object_ImplementsClass_NoEror(
     const void  * objPtr,
     neuik_Class * nClass)
 {
-    int                 impClass   = 0;
-    neuik_Class       * sClass     = NULL; // superClass of a class
     neuik_Object_Base * objBase    = NULL;
 
-    if (!neuik_Object_IsNEUIKObject_NoError(objPtr))
-    {
-        impClass = 0;
-        goto out;
-    }
+    if (!neuik_Object_IsNEUIKObject_NoError(objPtr)) return 0;
 
     objBase = (neuik_Object_Base*)(objPtr);
-    if ((objBase->object).nClass == nClass)
-    {
-        impClass = 1;
-        goto out;
-    }
-
-    /*------------------------------------------------------------------------*/
-    /* Check if the object is of a class that has at least one SuperClass     */
-    /*------------------------------------------------------------------------*/
-    sClass = ((objBase->object).nClass)->SuperClass; // get the SuperClass of this objects class
-    if (sClass != NULL)
-    {
-        for (;;)
-        {
-            /*----------------------------------------------------------------*/
-            /* Iterate over the nested superclasses until NULL is hit         */
-            /*----------------------------------------------------------------*/
-            if (sClass == nClass) return 1;
-            {
-                impClass = 1;
-                goto out;
-            }
-
-            /*----------------------------------------------------------------*/
-            /* change superClass pointer to point at the Super of this Class  */
-            /*----------------------------------------------------------------*/
-            sClass = sClass->SuperClass;
-            if (!sClass) break; // sClass = NULL means class has no SuperClass
-        }
-    }
-out:
-
-    return impClass;
+    return neuik_Class_InLineage((objBase->object).nClass, nClass);
 }
 
 
@@ -866,6 +1031,48 @@ int neuik_Object_IsClass_NoErr(
 }
 
 
+/*******************************************************************************
+ *
+ *  Name:          neuik_Object_GetSuperClassObjectAtDepth
+ *
+ *  Description:   Locate the class object of an object at the specified class
+ *                 depth. For objects allocated as a single block this is at a
+ *                 fixed offset; otherwise the superClassObj chain is followed.
+ *
+ *  Returns:       A pointer to the class object; NULL if the object chain is
+ *                 shorter than expected or does not match its class lineage.
+ *
+ ******************************************************************************/
+static neuik_Object_Base * neuik_Object_GetSuperClassObjectAtDepth(
+    neuik_Object_Base * objBase,
+    int                 depth)
+{
+    int                 hops;
+    neuik_Class       * nClass   = NULL;
+    neuik_Object_Base * sObjBase = NULL;
+
+    nClass = (objBase->object).nClass;
+    if ((objBase->object).contiguous)
+    {
+        sObjBase = (neuik_Object_Base*)((char*)(objBase) + 
+            nClass->offsets[depth]);
+        if ((sObjBase->object).nClass == nClass->lineage[depth])
+        {
+            return sObjBase;
+        }
+    }
+
+    for (hops = nClass->classDepth - depth; hops > 0; hops--)
+    {
+        objBase = (neuik_Object_Base*)(objBase->object.superClassObj);
+        if (objBase == NULL) return NULL;
+    }
+    if ((objBase->object).nClass != nClass->lineage[depth]) return NULL;
+
+    return objBase;
+}
+
+
 /*******************************************************************************
  *
  *  Name:          neuik_Object_GetClassObject
@@ -911,23 +1118,17 @@ int neuik_Object_GetClassObject(
     }
 
     /*------------------------------------------------------------------------*/
-    /* Iterate through the object SuperClasses till the correct Class Object  */
-    /* is found.                                                              */
+    /* The depth difference between the two classes gives the number of hops  */
+    /* along the superClassObj chain to the desired Class Object.             */
     /*------------------------------------------------------------------------*/
-    for (;;)
+    objBase = neuik_Object_GetSuperClassObjectAtDepth(objBase, 
+        nClass->classDepth);
+    if (objBase == NULL)
     {
-        objBase = (neuik_Object_Base*)(objBase->object.superClassObj);
-        if (objBase == NULL)
-        {
-            eNum = 3;
-            goto out;
-        }
-        else if ((objBase->object).nClass == nClass)
-        {
-            (*classObject) = objBase;
-            goto out;
-        }
+        eNum = 3;
+        goto out;
     }
+    (*classObject) = objBase;
 out:
     if (eNum != 0)
     {
@@ -978,23 +1179,17 @@ int neuik_Object_GetClassObject_NoError(
     }
 
     /*------------------------------------------------------------------------*/
-    /* Iterate through the object SuperClasses till the correct Class Object  */
-    /* is found.                                                              */
+    /* The depth difference between the two classes gives the number of hops  */
+    /* along the superClassObj chain to the desired Class Object.             */
     /*------------------------------------------------------------------------*/
-    for (;;)
+    objBase = neuik_Object_GetSuperClassObjectAtDepth(objBase, 
+        nClass->classDepth);
+    if (objBase == NULL)
     {
-        objBase = (neuik_Object_Base*)(objBase->object.superClassObj);
-        if (objBase == NULL)
-        {
-            eNum = 1;
-            goto out;
-        }
-        else if ((objBase->object).nClass == nClass)
-        {
-            (*classObject) = objBase;
-            goto out;
-        }
+        eNum = 1;
+        goto out;
     }
+    (*classObject) = objBase;
 out:
     if (eNum != 0)
     {
@@ -1110,6 +1305,95 @@ void neuik_Object_Show(
 
 
 
+/*******************************************************************************
+ *
+ *  Name:          neuik_VirtualFunc_AddSlot
+ *
+ *  Description:   Assign a new virtual function set a slot within the dispatch
+ *                 table of each registered class.
+ *
+ *  Returns:       1 if there is an error, 0 otherwise. 
+ *
+ ******************************************************************************/
+static int neuik_VirtualFunc_AddSlot(
+    neuik_virtualFuncSet * vFunc)
+{
+    int           ctr;
+    void       ** newTable   = NULL;
+    neuik_Class * thisClass  = NULL;
+
+    if (neuik_AllClasses != NULL)
+    {
+        for (ctr = 0;; ctr++)
+        {
+            thisClass = neuik_AllClasses[ctr];
+            if (thisClass == NULL) break;
+
+            newTable = (void**) realloc(thisClass->vFuncTable,
+                (1 + neuik_VirtualFunc_nSlots)*sizeof(void*));
+            if (newTable == NULL) return 1;
+
+            newTable[neuik_VirtualFunc_nSlots] = NULL;
+            thisClass->vFuncTable = newTable;
+        }
+    }
+    vFunc->slot = neuik_VirtualFunc_nSlots;
+    neuik_VirtualFunc_nSlots++;
+
+    return 0;
+}
+
+
+/*******************************************************************************
+ *
+ *  Name:          neuik_VirtualFunc_ResolveSlot
+ *
+ *  Description:   Recompute the slot of a virtual function set within the 
+ *                 dispatch table of each registered class. Classes without an
+ *                 implementation of their own inherit that of their superclass.
+ *
+ *                 Classes are stored in the order of their registration and a
+ *                 superclass is always registered before its subclasses, so a
+ *                 single pass resolves the whole class hierarchy.
+ *
+ ******************************************************************************/
+static void neuik_VirtualFunc_ResolveSlot(
+    neuik_virtualFuncSet * vFunc)
+{
+    int           ctr;
+    int           pCtr;
+    void        * funcImp    = NULL;
+    neuik_Class * thisClass  = NULL;
+    neuik_Class * sClass     = NULL;
+
+    if (neuik_AllClasses == NULL) return;
+
+    for (ctr = 0;; ctr++)
+    {
+        thisClass = neuik_AllClasses[ctr];
+        if (thisClass == NULL) break;
+
+        funcImp = NULL;
+        sClass  = (neuik_Class*)(thisClass->SuperClass);
+        if (sClass != NULL)
+        {
+            funcImp = sClass->vFuncTable[vFunc->slot];
+        }
+
+        for (pCtr = 0;; pCtr++)
+        {
+            if (vFunc->pairs[pCtr] == NULL) break;
+            if (vFunc->pairs[pCtr]->nClass == thisClass)
+            {
+                funcImp = vFunc->pairs[pCtr]->funcImp;
+                break;
+            }
+        }
+        thisClass->vFuncTable[vFunc->slot] = funcImp;
+    }
+}
+
+
 /*******************************************************************************
  *
  *  Name:          neuik_VirtualFunc_RegisterImplementation
@@ -1124,13 +1408,14 @@ int neuik_VirtualFunc_RegisterImplementation(
     neuik_Class       * nClass,
     void              * funcImp)
 {
-    int                     ctr;
-    int                     eNum       = 0;
-    neuik_VirtualFunc       vFunc      = NULL;
-    neuik_virtualFuncPair * thisPair   = NULL;
-    static char             funcName[] = 
+    int                      ctr;
+    int                      eNum       = 0;
+    neuik_VirtualFunc        vFunc      = NULL;
+    neuik_virtualFuncPair ** pairs      = NULL;
+    neuik_virtualFuncPair  * thisPair   = NULL;
+    static char              funcName[] = 
         "neuik_VirtualFunc_RegisterImplementation";
-    static char           * errMsgs[]  = {"", // [0] no error
+    static char            * errMsgs[]  = {"", // [0] no error
         "Output Argument `vFunc` is NULL.",   // [1]
         "Argument `nClass` is NULL.",         // [2]
         "Argument `funcImp` is NULL.",        // [3]
@@ -1160,25 +1445,40 @@ int neuik_VirtualFunc_RegisterImplementation(
     vFunc = *vFuncPtr;
 
     /*------------------------------------------------------------------------*/
-    /* Allocate/Reallocate the `vFunc` array.                                 */
+    /* Allocate/Reallocate the `vFunc` pair array.                            */
     /*------------------------------------------------------------------------*/
     if (vFunc == NULL)
     {
         /*--------------------------------------------------------------------*/
         /* This first time this is to be allocated.                           */
         /*--------------------------------------------------------------------*/
-        (*vFuncPtr) = 
-            (neuik_virtualFuncPair **) malloc(2*sizeof(neuik_virtualFuncPair *));
-        vFunc = *vFuncPtr;
+        vFunc = (neuik_virtualFuncSet *) malloc(sizeof(neuik_virtualFuncSet));
         if (vFunc == NULL)
         {
             eNum = 4;
             goto out;
         }
-        vFunc[1] = NULL; /* nullPtr terminated list */
+        vFunc->pairs = 
+            (neuik_virtualFuncPair **) malloc(2*sizeof(neuik_virtualFuncPair *));
+        if (vFunc->pairs == NULL)
+        {
+            free(vFunc);
+            eNum = 4;
+            goto out;
+        }
+        if (neuik_VirtualFunc_AddSlot(vFunc))
+        {
+            free(vFunc->pairs);
+            free(vFunc);
+            eNum = 5;
+            goto out;
+        }
+        (*vFuncPtr) = vFunc;
+        pairs = vFunc->pairs;
+        pairs[1] = NULL; /* nullPtr terminated list */
 
-        vFunc[0] = (neuik_virtualFuncPair *) malloc(sizeof(neuik_virtualFuncPair));
-        if (vFunc[0] == NULL)
+        pairs[0] = (neuik_virtualFuncPair *) malloc(sizeof(neuik_virtualFuncPair));
+        if (pairs[0] == NULL)
         {
             eNum = 4;
             goto out;
@@ -1196,24 +1496,24 @@ int neuik_VirtualFunc_RegisterImplementation(
         /* determine the current length of the array */
         for (ctr = 0;; ctr++)
         {
-            if (vFunc[ctr] == NULL)
+            if (vFunc->pairs[ctr] == NULL)
             {
                 break;
             }
         }
 
-        (*vFuncPtr) = (neuik_virtualFuncPair **) realloc((*vFuncPtr), 
+        pairs = (neuik_virtualFuncPair **) realloc(vFunc->pairs, 
             (2+ctr)*sizeof(neuik_virtualFuncPair *));
-        vFunc = *vFuncPtr;
-        if (vFunc == NULL)
+        if (pairs == NULL)
         {
             eNum = 5;
             goto out;
         }
-        vFunc[ctr + 1] = NULL; /* nullPtr terminated list */
+        vFunc->pairs = pairs;
+        pairs[ctr + 1] = NULL; /* nullPtr terminated list */
 
-        vFunc[ctr] = (neuik_virtualFuncPair *) malloc(sizeof(neuik_virtualFuncPair));
-        if (vFunc[ctr] == NULL)
+        pairs[ctr] = (neuik_virtualFuncPair *) malloc(sizeof(neuik_virtualFuncPair));
+        if (pairs[ctr] == NULL)
         {
             eNum = 4;
             goto out;
@@ -1224,9 +1524,15 @@ int neuik_VirtualFunc_RegisterImplementation(
     /*------------------------------------------------------------------------*/
     /* Store the values of the new virtual function pair                      */
     /*------------------------------------------------------------------------*/
-    thisPair          = vFunc[ctr];
+    thisPair          = pairs[ctr];
     thisPair->nClass  = nClass;
     thisPair->funcImp = funcImp;
+
+    /*------------------------------------------------------------------------*/
+    /* Update the dispatch tables of this class and the classes inheriting    */
+    /* from it.                                                               */
+    /*------------------------------------------------------------------------*/
+    neuik_VirtualFunc_ResolveSlot(vFunc);
 out:
     if (eNum != 0)
     {
@@ -1244,6 +1550,10 @@ out:
  *
  *  Description:   Get funcImplementation from a vFunc set if it exists.
  *
+ *                 The implementation is looked up within the dispatch table of
+ *                 the object class; this table is resolved when virtual 
+ *                 function implementations are registered.
+ *
  *  Returns:       NULL if no vFunc reimplemntation exists for the object, 
  *                 otherwise it returns a pointer to the appropriate function. 
  *
@@ -1252,60 +1562,12 @@ void * neuik_VirtualFunc_GetImplementation(
     neuik_VirtualFunc   vFunc,
     void              * object)
 {
-    int                 ctr;
-    void              * funcImp    = NULL;
     neuik_Object_Base * objBase    = NULL;
-    neuik_Class       * thisClass  = NULL;
 
     if (vFunc == NULL) return NULL;
     if (!neuik_Object_IsNEUIKObject_NoError(object)) return NULL;
 
-    /*------------------------------------------------------------------------*/
-    /* Check the toplevel object to see if it provides a vFunc implementation */
-    /*------------------------------------------------------------------------*/
-    objBase   = (neuik_Object_Base*)(object);
-    thisClass = (objBase->object).nClass;
-
-    for (ctr = 0;; ctr++)
-    {
-        if (vFunc[ctr] == NULL) break;
-        if (vFunc[ctr]->nClass == thisClass)
-        {
-            /*----------------------------------------------------------------*/
-            /* A class which provides a virtual function for this was located */
-            /*----------------------------------------------------------------*/
-            funcImp = vFunc[ctr]->funcImp;
-            goto out;
-        }
-    }
-
-    /*------------------------------------------------------------------------*/
-    /* Iterate through the object SuperClasses till the correct Class Object  */
-    /* is found.                                                              */
-    /*------------------------------------------------------------------------*/
-    objBase = (neuik_Object_Base*)(objBase->object.superClassObj);
-    for (;;)
-    {
-        if (objBase == NULL) break; /* no more superClasses for this object */
-
-        thisClass = (objBase->object).nClass;
-        for (ctr = 0;; ctr++)
-        {
-            if (vFunc[ctr] == NULL) break;
-            if (vFunc[ctr]->nClass == thisClass)
-            {
-                /*------------------------------------------------------------*/
-                /* A class which provides a virtual function for this was     */
-                /* located                                                    */
-                /*------------------------------------------------------------*/
-                funcImp = vFunc[ctr]->funcImp;
-                goto out;
-            }
-        }
-        /* point to the superClass of the current objectBase */
-        objBase = (neuik_Object_Base*)(objBase->object.superClassObj);
-    }
-out:
-    return funcImp;
+    objBase = (neuik_Object_Base*)(object);
+    return ((objBase->object).nClass)->vFuncTable[vFunc->slot];
 }
 